@@ -17,6 +17,7 @@
 
 #include "../tools_common.h"
 #include "../vp9/encoder/vp9_resize.h"
+#include "./vp9_rtcd.h"
 
 static const char *exec_name = NULL;
 
@@ -111,6 +112,8 @@ int main(int argc, char *argv[]) {
   inbuf_v = inbuf_u + width * height / 4;
   outbuf_u = outbuf + target_width * target_height;
   outbuf_v = outbuf_u + target_width * target_height / 4;
+  // The resizer uses the vp9 run time cpu detection table.
+  vp9_rtcd();
   f = 0;
   while (f < frames) {
     if (fread(inbuf, width * height * 3 / 2, 1, fpin) != 1) break;
@@ -231,6 +231,128 @@ class IntProColTest : public AverageTestBase<uint8_t>,
   int16_t sum_c_;
 };
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IntProColTest);
+
+typedef void (*IntProRowBatchFunc)(int16_t *hbuf, uint8_t const *ref,
+                                   const int ref_stride, const int width,
+                                   const int height);
+
+// <width, height, asm function, c function>
+typedef std::tuple<int, int, IntProRowBatchFunc, IntProRowBatchFunc>
+    IntProRowBatchParam;
+
+class IntProRowBatchTest
+    : public AverageTestBase<uint8_t>,
+      public ::testing::WithParamInterface<IntProRowBatchParam> {
+ public:
+  IntProRowBatchTest() : AverageTestBase(GET_PARAM(0), GET_PARAM(1)) {
+    asm_func_ = GET_PARAM(2);
+    c_func_ = GET_PARAM(3);
+  }
+
+ protected:
+  void RunComparison() {
+    DECLARE_ALIGNED(16, int16_t, hbuf_c[128]);
+    DECLARE_ALIGNED(16, int16_t, hbuf_asm[128]);
+    ASM_REGISTER_STATE_CHECK(
+        c_func_(hbuf_c, source_data_, width_, width_, height_));
+    ASM_REGISTER_STATE_CHECK(
+        asm_func_(hbuf_asm, source_data_, width_, width_, height_));
+    EXPECT_EQ(0, memcmp(hbuf_c, hbuf_asm, sizeof(*hbuf_c) * width_))
+        << "Output mismatch";
+  }
+
+ private:
+  IntProRowBatchFunc asm_func_;
+  IntProRowBatchFunc c_func_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IntProRowBatchTest);
+
+typedef void (*IntProColBatchFunc)(int16_t *vbuf, uint8_t const *ref,
+                                   const int ref_stride, const int width,
+                                   const int height, const int norm_factor);
+
+// <width, height, asm function, c function>
+typedef std::tuple<int, int, IntProColBatchFunc, IntProColBatchFunc>
+    IntProColBatchParam;
+
+class IntProColBatchTest
+    : public AverageTestBase<uint8_t>,
+      public ::testing::WithParamInterface<IntProColBatchParam> {
+ public:
+  IntProColBatchTest() : AverageTestBase(GET_PARAM(0), GET_PARAM(1)) {
+    asm_func_ = GET_PARAM(2);
+    c_func_ = GET_PARAM(3);
+  }
+
+ protected:
+  void RunComparison() {
+    DECLARE_ALIGNED(16, int16_t, vbuf_c[128]);
+    DECLARE_ALIGNED(16, int16_t, vbuf_asm[128]);
+    // Matches the normalization used by vp9_int_pro_motion_estimation().
+    const int norm_factor = 3 + (width_ >> 5);
+    ASM_REGISTER_STATE_CHECK(
+        c_func_(vbuf_c, source_data_, width_, width_, height_, norm_factor));
+    ASM_REGISTER_STATE_CHECK(asm_func_(vbuf_asm, source_data_, width_, width_,
+                                       height_, norm_factor));
+    EXPECT_EQ(0, memcmp(vbuf_c, vbuf_asm, sizeof(*vbuf_c) * height_))
+        << "Output mismatch";
+  }
+
+ private:
+  IntProColBatchFunc asm_func_;
+  IntProColBatchFunc c_func_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IntProColBatchTest);
+
+typedef int (*VectorVarFunc)(const int16_t *ref, const int16_t *src,
+                             const int bwl);
+
+// <bwl, asm function, c function>
+typedef std::tuple<int, VectorVarFunc, VectorVarFunc> VectorVarParam;
+
+class VectorVarTest : public ::testing::TestWithParam<VectorVarParam> {
+ public:
+  VectorVarTest() : bwl_(GET_PARAM(0)) {
+    asm_func_ = GET_PARAM(1);
+    c_func_ = GET_PARAM(2);
+  }
+
+ protected:
+  void SetUp() override { rnd_.Reset(ACMRandom::DeterministicSeed()); }
+
+  void TearDown() override { libvpx_test::ClearSystemState(); }
+
+  // The projections are 9 bit, [0, 510].
+  void FillConstant(int16_t ref_value, int16_t src_value) {
+    for (int i = 0; i < 64; ++i) {
+      ref_[i] = ref_value;
+      src_[i] = src_value;
+    }
+  }
+
+  void FillRandom() {
+    for (int i = 0; i < 64; ++i) {
+      ref_[i] = rnd_.Rand16() % 511;
+      src_[i] = rnd_.Rand16() % 511;
+    }
+  }
+
+  void RunComparison() {
+    int var_c, var_asm;
+    ASM_REGISTER_STATE_CHECK(var_c = c_func_(ref_, src_, bwl_));
+    ASM_REGISTER_STATE_CHECK(var_asm = asm_func_(ref_, src_, bwl_));
+    EXPECT_EQ(var_c, var_asm) << "Output mismatch";
+  }
+
+ private:
+  int bwl_;
+  VectorVarFunc asm_func_;
+  VectorVarFunc c_func_;
+  DECLARE_ALIGNED(16, int16_t, ref_[64]);
+  DECLARE_ALIGNED(16, int16_t, src_[64]);
+  ACMRandom rnd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VectorVarTest);
 #endif  // HAVE_NEON || HAVE_SSE2 || HAVE_MSA
 
 typedef int (*SatdFunc)(const tran_low_t *coeffs, int length);
@@ -414,6 +536,40 @@ TEST_P(IntProColTest, Random) {
   FillRandom();
   RunComparison();
 }
+
+TEST_P(IntProRowBatchTest, MaxValue) {
+  FillConstant(255);
+  RunComparison();
+}
+
+TEST_P(IntProRowBatchTest, Random) {
+  FillRandom();
+  RunComparison();
+}
+
+TEST_P(IntProColBatchTest, MaxValue) {
+  FillConstant(255);
+  RunComparison();
+}
+
+TEST_P(IntProColBatchTest, Random) {
+  FillRandom();
+  RunComparison();
+}
+
+TEST_P(VectorVarTest, MaxDiff) {
+  FillConstant(510, 0);
+  RunComparison();
+  FillConstant(0, 510);
+  RunComparison();
+}
+
+TEST_P(VectorVarTest, Random) {
+  for (int i = 0; i < 1000; ++i) {
+    FillRandom();
+    RunComparison();
+  }
+}
 #endif
 
 TEST_P(SatdLowbdTest, MinValue) {
@@ -634,6 +790,12 @@ INSTANTIATE_TEST_SUITE_P(
                       make_tuple(64, &vpx_int_pro_col_sse2,
                                  &vpx_int_pro_col_c)));
 
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, VectorVarTest,
+    ::testing::Values(make_tuple(2, &vpx_vector_var_sse2, &vpx_vector_var_c),
+                      make_tuple(3, &vpx_vector_var_sse2, &vpx_vector_var_c),
+                      make_tuple(4, &vpx_vector_var_sse2, &vpx_vector_var_c)));
+
 INSTANTIATE_TEST_SUITE_P(SSE2, SatdLowbdTest,
                          ::testing::Values(make_tuple(16, &vpx_satd_sse2),
                                            make_tuple(64, &vpx_satd_sse2),
@@ -649,6 +811,58 @@ INSTANTIATE_TEST_SUITE_P(
 #endif  // HAVE_SSE2
 
 #if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, IntProRowTest,
+    ::testing::Values(make_tuple(16, &vpx_int_pro_row_avx2, &vpx_int_pro_row_c),
+                      make_tuple(32, &vpx_int_pro_row_avx2, &vpx_int_pro_row_c),
+                      make_tuple(64, &vpx_int_pro_row_avx2,
+                                 &vpx_int_pro_row_c)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, IntProColTest,
+    ::testing::Values(make_tuple(16, &vpx_int_pro_col_avx2, &vpx_int_pro_col_c),
+                      make_tuple(32, &vpx_int_pro_col_avx2, &vpx_int_pro_col_c),
+                      make_tuple(64, &vpx_int_pro_col_avx2,
+                                 &vpx_int_pro_col_c)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, IntProRowBatchTest,
+    ::testing::Values(
+        make_tuple(16, 16, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c),
+        make_tuple(32, 16, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c),
+        make_tuple(32, 32, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c),
+        make_tuple(64, 32, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c),
+        make_tuple(64, 64, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c),
+        make_tuple(128, 64, &vpx_int_pro_row_batch_avx2,
+                   &vpx_int_pro_row_batch_c)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, IntProColBatchTest,
+    ::testing::Values(
+        make_tuple(16, 16, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c),
+        make_tuple(16, 32, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c),
+        make_tuple(32, 32, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c),
+        make_tuple(32, 64, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c),
+        make_tuple(64, 64, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c),
+        make_tuple(64, 128, &vpx_int_pro_col_batch_avx2,
+                   &vpx_int_pro_col_batch_c)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, VectorVarTest,
+    ::testing::Values(make_tuple(2, &vpx_vector_var_avx2, &vpx_vector_var_c),
+                      make_tuple(3, &vpx_vector_var_avx2, &vpx_vector_var_c),
+                      make_tuple(4, &vpx_vector_var_avx2, &vpx_vector_var_c)));
+
 INSTANTIATE_TEST_SUITE_P(AVX2, SatdLowbdTest,
                          ::testing::Values(make_tuple(16, &vpx_satd_avx2),
                                            make_tuple(64, &vpx_satd_avx2),
@@ -672,6 +886,15 @@ INSTANTIATE_TEST_SUITE_P(
                       make_tuple(1024, &vp9_block_error_fp_avx2)));
 #endif
 
+#if HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, BlockErrorTestFP,
+    ::testing::Values(make_tuple(16, &vp9_block_error_fp_avx512),
+                      make_tuple(64, &vp9_block_error_fp_avx512),
+                      make_tuple(256, &vp9_block_error_fp_avx512),
+                      make_tuple(1024, &vp9_block_error_fp_avx512)));
+#endif  // HAVE_AVX512
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(
     NEON, AverageTest,
@@ -615,6 +615,29 @@ TEST_P(ConvolveTest, DISABLED_Scale_Speed) {
          UUT_->use_highbd_ ? UUT_->use_highbd_ : 8, elapsed_time);
 }
 
+TEST_P(ConvolveTest, DISABLED_Scale_2to1_Speed) {
+  const uint8_t *const in = input();
+  uint8_t *const out = output();
+  const InterpKernel *const eighttap = vp9_filter_kernels[EIGHTTAP];
+  const int kNumTests = 5000000;
+  const int width = Width();
+  const int height = Height();
+  vpx_usec_timer timer;
+
+  SetConstantInput(127);
+
+  vpx_usec_timer_start(&timer);
+  for (int n = 0; n < kNumTests; ++n) {
+    UUT_->shv8_[0](in, kInputStride, out, kOutputStride, eighttap, 8, 32, 8, 32,
+                   width, height);
+  }
+  vpx_usec_timer_mark(&timer);
+
+  const int elapsed_time = static_cast<int>(vpx_usec_timer_elapsed(&timer));
+  printf("convolve_scale_2to1_%dx%d_%d: %d us\n", width, height,
+         UUT_->use_highbd_ ? UUT_->use_highbd_ : 8, elapsed_time);
+}
+
 TEST_P(ConvolveTest, DISABLED_8Tap_Speed) {
   const uint8_t *const in = input();
   uint8_t *const out = output();
@@ -1076,19 +1099,50 @@ TEST_P(ConvolveTest, FilterExtremes) {
 
 /* This test exercises that enough rows and columns are filtered with every
    possible initial fractional positions and scaling steps. */
-#if !CONFIG_VP9_HIGHBITDEPTH
 static const ConvolveFunc scaled_2d_c_funcs[2] = { vpx_scaled_2d_c,
                                                    vpx_scaled_avg_2d_c };
 
+#if CONFIG_VP9_HIGHBITDEPTH
+typedef void (*HighbdConvolveFunc)(const uint16_t *src, ptrdiff_t src_stride,
+                                   uint16_t *dst, ptrdiff_t dst_stride,
+                                   const InterpKernel *filter, int x0_q4,
+                                   int x_step_q4, int y0_q4, int y_step_q4,
+                                   int w, int h, int bd);
+
+static const HighbdConvolveFunc highbd_scaled_2d_c_funcs[2] = {
+  vpx_highbd_convolve8_c, vpx_highbd_convolve8_avg_c
+};
+#endif
+
 TEST_P(ConvolveTest, CheckScalingFiltering) {
   uint8_t *const in = input();
   uint8_t *const out = output();
+#if CONFIG_VP9_HIGHBITDEPTH
+  uint8_t ref8[kOutputStride * kMaxDimension];
+  uint16_t ref16[kOutputStride * kMaxDimension];
+  uint8_t *ref;
+  if (UUT_->use_highbd_ == 0) {
+    ref = ref8;
+  } else {
+    ref = CAST_TO_BYTEPTR(ref16);
+  }
+#else
   uint8_t ref[kOutputStride * kMaxDimension];
+#endif
 
   ::libvpx_test::ACMRandom prng;
   for (int y = 0; y < Height(); ++y) {
     for (int x = 0; x < Width(); ++x) {
-      const uint16_t r = prng.Rand8Extremes();
+      uint16_t r;
+#if CONFIG_VP9_HIGHBITDEPTH
+      if (UUT_->use_highbd_ == 0 || UUT_->use_highbd_ == 8) {
+        r = prng.Rand8Extremes();
+      } else {
+        r = prng.Rand16() & mask_;
+      }
+#else
+      r = prng.Rand8Extremes();
+#endif
       assign_val(in, y * kInputStride + x, r);
     }
   }
@@ -1099,8 +1153,21 @@ TEST_P(ConvolveTest, CheckScalingFiltering) {
       for (int frac = 0; frac < 16; ++frac) {
         for (int step = 1; step <= 32; ++step) {
           /* Test the horizontal and vertical filters in combination. */
+#if CONFIG_VP9_HIGHBITDEPTH
+          if (UUT_->use_highbd_ != 0) {
+            highbd_scaled_2d_c_funcs[i](CAST_TO_SHORTPTR(in), kInputStride,
+                                        CAST_TO_SHORTPTR(ref), kOutputStride,
+                                        eighttap, frac, step, frac, step,
+                                        Width(), Height(), UUT_->use_highbd_);
+          } else {
+            scaled_2d_c_funcs[i](in, kInputStride, ref, kOutputStride,
+                                 eighttap, frac, step, frac, step, Width(),
+                                 Height());
+          }
+#else
           scaled_2d_c_funcs[i](in, kInputStride, ref, kOutputStride, eighttap,
                                frac, step, frac, step, Width(), Height());
+#endif
           ASM_REGISTER_STATE_CHECK(
               UUT_->shv8_[i](in, kInputStride, out, kOutputStride, eighttap,
                              frac, step, frac, step, Width(), Height()));
@@ -1120,7 +1187,6 @@ TEST_P(ConvolveTest, CheckScalingFiltering) {
     }
   }
 }
-#endif
 
 using std::make_tuple;
 
@@ -1369,23 +1435,24 @@ const ConvolveFunctions convolve8_avx2(
     wrap_convolve8_vert_avx2_8, wrap_convolve8_avg_vert_avx2_8,
     wrap_convolve8_avx2_8, wrap_convolve8_avg_avx2_8, wrap_convolve8_horiz_c_8,
     wrap_convolve8_avg_horiz_c_8, wrap_convolve8_vert_c_8,
-    wrap_convolve8_avg_vert_c_8, wrap_convolve8_c_8, wrap_convolve8_avg_c_8, 8);
+    wrap_convolve8_avg_vert_c_8, wrap_convolve8_avx2_8,
+    wrap_convolve8_avg_avx2_8, 8);
 const ConvolveFunctions convolve10_avx2(
     wrap_convolve_copy_avx2_10, wrap_convolve_avg_avx2_10,
     wrap_convolve8_horiz_avx2_10, wrap_convolve8_avg_horiz_avx2_10,
     wrap_convolve8_vert_avx2_10, wrap_convolve8_avg_vert_avx2_10,
     wrap_convolve8_avx2_10, wrap_convolve8_avg_avx2_10,
     wrap_convolve8_horiz_c_10, wrap_convolve8_avg_horiz_c_10,
-    wrap_convolve8_vert_c_10, wrap_convolve8_avg_vert_c_10, wrap_convolve8_c_10,
-    wrap_convolve8_avg_c_10, 10);
+    wrap_convolve8_vert_c_10, wrap_convolve8_avg_vert_c_10,
+    wrap_convolve8_avx2_10, wrap_convolve8_avg_avx2_10, 10);
 const ConvolveFunctions convolve12_avx2(
     wrap_convolve_copy_avx2_12, wrap_convolve_avg_avx2_12,
     wrap_convolve8_horiz_avx2_12, wrap_convolve8_avg_horiz_avx2_12,
     wrap_convolve8_vert_avx2_12, wrap_convolve8_avg_vert_avx2_12,
     wrap_convolve8_avx2_12, wrap_convolve8_avg_avx2_12,
     wrap_convolve8_horiz_c_12, wrap_convolve8_avg_horiz_c_12,
-    wrap_convolve8_vert_c_12, wrap_convolve8_avg_vert_c_12, wrap_convolve8_c_12,
-    wrap_convolve8_avg_c_12, 12);
+    wrap_convolve8_vert_c_12, wrap_convolve8_avg_vert_c_12,
+    wrap_convolve8_avx2_12, wrap_convolve8_avg_avx2_12, 12);
 const ConvolveParam kArrayConvolve8_avx2[] = { ALL_SIZES(convolve8_avx2),
                                                ALL_SIZES(convolve10_avx2),
                                                ALL_SIZES(convolve12_avx2) };
@@ -1397,13 +1464,26 @@ const ConvolveFunctions convolve8_avx2(
     vpx_convolve8_avg_horiz_avx2, vpx_convolve8_vert_avx2,
     vpx_convolve8_avg_vert_avx2, vpx_convolve8_avx2, vpx_convolve8_avg_avx2,
     vpx_scaled_horiz_c, vpx_scaled_avg_horiz_c, vpx_scaled_vert_c,
-    vpx_scaled_avg_vert_c, vpx_scaled_2d_c, vpx_scaled_avg_2d_c, 0);
+    vpx_scaled_avg_vert_c, vpx_scaled_2d_avx2, vpx_scaled_avg_2d_c, 0);
 const ConvolveParam kArrayConvolve8_avx2[] = { ALL_SIZES(convolve8_avx2) };
 INSTANTIATE_TEST_SUITE_P(AVX2, ConvolveTest,
                          ::testing::ValuesIn(kArrayConvolve8_avx2));
 #endif  // CONFIG_VP9_HIGHBITDEPTH
 #endif  // HAVE_AVX2
 
+#if HAVE_AVX512
+const ConvolveFunctions convolve8_avx512(
+    vpx_convolve_copy_c, vpx_convolve_avg_c, vpx_convolve8_horiz_avx512,
+    vpx_convolve8_avg_horiz_avx512, vpx_convolve8_vert_avx512,
+    vpx_convolve8_avg_vert_avx512, vpx_convolve8_avx512,
+    vpx_convolve8_avg_avx512, vpx_scaled_horiz_c, vpx_scaled_avg_horiz_c,
+    vpx_scaled_vert_c, vpx_scaled_avg_vert_c, vpx_scaled_2d_c,
+    vpx_scaled_avg_2d_c, 0);
+const ConvolveParam kArrayConvolve8_avx512[] = { ALL_SIZES(convolve8_avx512) };
+INSTANTIATE_TEST_SUITE_P(AVX512, ConvolveTest,
+                         ::testing::ValuesIn(kArrayConvolve8_avx512));
+#endif  // HAVE_AVX512
+
 #if HAVE_NEON
 #if CONFIG_VP9_HIGHBITDEPTH
 const ConvolveFunctions convolve8_neon(
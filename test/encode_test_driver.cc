@@ -235,6 +235,8 @@ void EncoderTest::RunLoop(VideoSource *video) {
 
           case VPX_CODEC_STATS_PKT: StatsPktHook(pkt); break;
 
+          case VPX_CODEC_FPMB_STATS_PKT: FPMBStatsPktHook(pkt); break;
+
           default: break;
         }
       }
@@ -0,0 +1,55 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef VPX_TEST_MOVING_PATTERN_VIDEO_SOURCE_H_
+#define VPX_TEST_MOVING_PATTERN_VIDEO_SOURCE_H_
+
+#include "test/video_source.h"
+#include "vpx/vpx_image.h"
+#include "vpx/vpx_integer.h"
+
+namespace libvpx_test {
+
+// The pattern moves kPatternMvCol pixels left and kPatternMvRow pixels up
+// every frame, so every block is found kPatternMvRow rows down and
+// kPatternMvCol columns right in the previous frame.
+const int kPatternMvRow = 1;
+const int kPatternMvCol = 3;
+
+// Fills the visible area of an 8-bit 4:2:0 image with the given frame of a
+// textured pattern with the motion above.
+inline void FillMovingPattern(vpx_image_t *img, unsigned int frame) {
+  for (int plane = 0; plane < 3; ++plane) {
+    const int w = plane ? (img->d_w + 1) >> 1 : img->d_w;
+    const int h = plane ? (img->d_h + 1) >> 1 : img->d_h;
+    const int shift = plane ? 1 : 0;
+    uint8_t *const buf = img->planes[plane];
+    for (int r = 0; r < h; ++r) {
+      for (int c = 0; c < w; ++c) {
+        const int x = (c << shift) + kPatternMvCol * static_cast<int>(frame);
+        const int y = (r << shift) + kPatternMvRow * static_cast<int>(frame);
+        buf[r * img->stride[plane] + c] = static_cast<uint8_t>(
+            ((x >> 3) ^ (y >> 2)) * 37 + ((x * x + 3 * y * y) >> 5));
+      }
+    }
+  }
+}
+
+// A DummyVideoSource producing the moving pattern, for tests that need real
+// motion without depending on test vectors.
+class MovingPatternVideoSource : public DummyVideoSource {
+ protected:
+  void FillFrame() override {
+    if (img_ != nullptr) FillMovingPattern(img_, frame_);
+  }
+};
+
+}  // namespace libvpx_test
+
+#endif  // VPX_TEST_MOVING_PATTERN_VIDEO_SOURCE_H_
@@ -64,6 +64,7 @@ typedef TestParams<SadSkipMxNx4Func> SadSkipMxNx4Param;
 typedef void (*SadMxNx8Func)(const uint8_t *src_ptr, int src_stride,
                              const uint8_t *ref_ptr, int ref_stride,
                              unsigned int *sad_array);
+typedef TestParams<SadMxNx8Func> SadMxNx8Param;
 
 using libvpx_test::ACMRandom;
 
@@ -327,6 +328,42 @@ class SADx4Test : public SADTestBase<SadMxNx4Param> {
   }
 };
 
+class SADx8Test : public SADTestBase<SadMxNx8Param> {
+ public:
+  SADx8Test() : SADTestBase(GetParam()) {}
+
+ protected:
+  void SADs(unsigned int *results) const {
+    ASM_REGISTER_STATE_CHECK(params_.func(source_data_, source_stride_,
+                                          GetReference(0), reference_stride_,
+                                          results));
+  }
+
+  // The 8 positions read |params_.width| + 7 columns of the reference.
+  void FillReferenceConstant(uint16_t fill_constant) const {
+    FillConstant(GetReference(0), reference_stride_, fill_constant);
+    FillConstant(GetReferenceFromOffset(GetBlockRefOffset(0) + 8),
+                 reference_stride_, fill_constant);
+  }
+
+  void FillReferenceRandom() {
+    FillRandomWH(GetReference(0), reference_stride_, params_.width + 8,
+                 params_.height);
+  }
+
+  void CheckSADs() const {
+    uint32_t reference_sad;
+    DECLARE_ALIGNED(kDataAlignment, uint32_t, exp_sad[8]);
+
+    SADs(exp_sad);
+    for (int offset = 0; offset < 8; ++offset) {
+      reference_sad = ReferenceSAD(GetBlockRefOffset(0) + offset);
+
+      EXPECT_EQ(reference_sad, exp_sad[offset]) << "offset " << offset;
+    }
+  }
+};
+
 class SADSkipx4Test : public SADTestBase<SadMxNx4Param> {
  public:
   SADSkipx4Test() : SADTestBase(GetParam()) {}
@@ -795,6 +832,62 @@ TEST_P(SADSkipx4Test, DISABLED_Speed) {
   reference_stride_ = tmp_stride;
 }
 
+TEST_P(SADx8Test, MaxRef) {
+  FillConstant(source_data_, source_stride_, 0);
+  FillReferenceConstant(mask_);
+  CheckSADs();
+}
+
+TEST_P(SADx8Test, MaxSrc) {
+  FillConstant(source_data_, source_stride_, mask_);
+  FillReferenceConstant(0);
+  CheckSADs();
+}
+
+TEST_P(SADx8Test, ShortRef) {
+  int tmp_stride = reference_stride_;
+  reference_stride_ >>= 1;
+  FillRandom(source_data_, source_stride_);
+  FillReferenceRandom();
+  CheckSADs();
+  reference_stride_ = tmp_stride;
+}
+
+TEST_P(SADx8Test, UnalignedRef) {
+  int tmp_stride = reference_stride_;
+  reference_stride_ -= 1;
+  FillRandom(source_data_, source_stride_);
+  FillReferenceRandom();
+  CheckSADs();
+  reference_stride_ = tmp_stride;
+}
+
+TEST_P(SADx8Test, ShortSrc) {
+  int tmp_stride = source_stride_;
+  source_stride_ >>= 1;
+  FillRandom(source_data_, source_stride_);
+  FillReferenceRandom();
+  CheckSADs();
+  source_stride_ = tmp_stride;
+}
+
+TEST_P(SADx8Test, DISABLED_Speed) {
+  FillRandom(source_data_, source_stride_);
+  FillReferenceRandom();
+  const int kCountSpeedTestBlock = 500000000 / (params_.width * params_.height);
+  DECLARE_ALIGNED(kDataAlignment, uint32_t, exp_sad[8]);
+  vpx_usec_timer timer;
+  vpx_usec_timer_start(&timer);
+  for (int i = 0; i < kCountSpeedTestBlock; ++i) {
+    SADs(exp_sad);
+  }
+  vpx_usec_timer_mark(&timer);
+  const int elapsed_time =
+      static_cast<int>(vpx_usec_timer_elapsed(&timer) / 1000);
+  printf("sad%dx%dx8 time: %5d ms\n", params_.width, params_.height,
+         elapsed_time);
+}
+
 //------------------------------------------------------------------------------
 // C functions
 const SadMxNParam c_tests[] = {
@@ -1021,6 +1114,23 @@ const SadMxNx4Param x4d_c_tests[] = {
 };
 INSTANTIATE_TEST_SUITE_P(C, SADx4Test, ::testing::ValuesIn(x4d_c_tests));
 
+const SadMxNx8Param x8_c_tests[] = {
+  SadMxNx8Param(64, 64, &vpx_sad64x64x8_c),
+  SadMxNx8Param(64, 32, &vpx_sad64x32x8_c),
+  SadMxNx8Param(32, 64, &vpx_sad32x64x8_c),
+  SadMxNx8Param(32, 32, &vpx_sad32x32x8_c),
+  SadMxNx8Param(32, 16, &vpx_sad32x16x8_c),
+  SadMxNx8Param(16, 32, &vpx_sad16x32x8_c),
+  SadMxNx8Param(16, 16, &vpx_sad16x16x8_c),
+  SadMxNx8Param(16, 8, &vpx_sad16x8x8_c),
+  SadMxNx8Param(8, 16, &vpx_sad8x16x8_c),
+  SadMxNx8Param(8, 8, &vpx_sad8x8x8_c),
+  SadMxNx8Param(8, 4, &vpx_sad8x4x8_c),
+  SadMxNx8Param(4, 8, &vpx_sad4x8x8_c),
+  SadMxNx8Param(4, 4, &vpx_sad4x4x8_c),
+};
+INSTANTIATE_TEST_SUITE_P(C, SADx8Test, ::testing::ValuesIn(x8_c_tests));
+
 const SadSkipMxNx4Param skip_x4d_c_tests[] = {
   SadSkipMxNx4Param(64, 64, &vpx_sad_skip_64x64x4d_c),
   SadSkipMxNx4Param(64, 32, &vpx_sad_skip_64x32x4d_c),
@@ -1885,14 +1995,67 @@ const SadSkipMxNx4Param skip_x4d_avx2_tests[] = {
 INSTANTIATE_TEST_SUITE_P(AVX2, SADSkipx4Test,
                          ::testing::ValuesIn(skip_x4d_avx2_tests));
 
+const SadMxNx8Param x8_avx2_tests[] = {
+  SadMxNx8Param(64, 64, &vpx_sad64x64x8_avx2),
+  SadMxNx8Param(64, 32, &vpx_sad64x32x8_avx2),
+  SadMxNx8Param(32, 64, &vpx_sad32x64x8_avx2),
+  SadMxNx8Param(32, 32, &vpx_sad32x32x8_avx2),
+  SadMxNx8Param(32, 16, &vpx_sad32x16x8_avx2),
+  SadMxNx8Param(16, 32, &vpx_sad16x32x8_avx2),
+  SadMxNx8Param(16, 16, &vpx_sad16x16x8_avx2),
+  SadMxNx8Param(16, 8, &vpx_sad16x8x8_avx2),
+  SadMxNx8Param(8, 16, &vpx_sad8x16x8_avx2),
+  SadMxNx8Param(8, 8, &vpx_sad8x8x8_avx2),
+  SadMxNx8Param(8, 4, &vpx_sad8x4x8_avx2),
+};
+INSTANTIATE_TEST_SUITE_P(AVX2, SADx8Test, ::testing::ValuesIn(x8_avx2_tests));
+
 #endif  // HAVE_AVX2
 
 #if HAVE_AVX512
+const SadMxNParam avx512_tests[] = {
+  SadMxNParam(64, 64, &vpx_sad64x64_avx512),
+  SadMxNParam(64, 32, &vpx_sad64x32_avx512),
+  SadMxNParam(32, 64, &vpx_sad32x64_avx512),
+  SadMxNParam(32, 32, &vpx_sad32x32_avx512),
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADTest, ::testing::ValuesIn(avx512_tests));
+
+const SadSkipMxNParam skip_avx512_tests[] = {
+  SadSkipMxNParam(64, 64, &vpx_sad_skip_64x64_avx512),
+  SadSkipMxNParam(64, 32, &vpx_sad_skip_64x32_avx512),
+  SadSkipMxNParam(32, 64, &vpx_sad_skip_32x64_avx512),
+  SadSkipMxNParam(32, 32, &vpx_sad_skip_32x32_avx512),
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADSkipTest,
+                         ::testing::ValuesIn(skip_avx512_tests));
+
+const SadMxNAvgParam avg_avx512_tests[] = {
+  SadMxNAvgParam(64, 64, &vpx_sad64x64_avg_avx512),
+  SadMxNAvgParam(64, 32, &vpx_sad64x32_avg_avx512),
+  SadMxNAvgParam(32, 64, &vpx_sad32x64_avg_avx512),
+  SadMxNAvgParam(32, 32, &vpx_sad32x32_avg_avx512),
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADavgTest,
+                         ::testing::ValuesIn(avg_avx512_tests));
+
 const SadMxNx4Param x4d_avx512_tests[] = {
   SadMxNx4Param(64, 64, &vpx_sad64x64x4d_avx512),
+  SadMxNx4Param(64, 32, &vpx_sad64x32x4d_avx512),
+  SadMxNx4Param(32, 64, &vpx_sad32x64x4d_avx512),
+  SadMxNx4Param(32, 32, &vpx_sad32x32x4d_avx512),
 };
 INSTANTIATE_TEST_SUITE_P(AVX512, SADx4Test,
                          ::testing::ValuesIn(x4d_avx512_tests));
+
+const SadSkipMxNx4Param skip_x4d_avx512_tests[] = {
+  SadSkipMxNx4Param(64, 64, &vpx_sad_skip_64x64x4d_avx512),
+  SadSkipMxNx4Param(64, 32, &vpx_sad_skip_64x32x4d_avx512),
+  SadSkipMxNx4Param(32, 64, &vpx_sad_skip_32x64x4d_avx512),
+  SadSkipMxNx4Param(32, 32, &vpx_sad_skip_32x32x4d_avx512),
+};
+INSTANTIATE_TEST_SUITE_P(AVX512, SADSkipx4Test,
+                         ::testing::ValuesIn(skip_x4d_avx512_tests));
 #endif  // HAVE_AVX512
 
 //------------------------------------------------------------------------------
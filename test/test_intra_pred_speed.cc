@@ -252,6 +252,19 @@ INTRA_PRED_TEST(SSSE3, TestIntraPred32, nullptr, nullptr, nullptr, nullptr,
                 nullptr)
 #endif  // HAVE_SSSE3
 
+#if HAVE_AVX2
+INTRA_PRED_TEST(AVX2, TestIntraPred16, nullptr, nullptr, nullptr, nullptr,
+                nullptr, nullptr, vpx_d45_predictor_16x16_avx2,
+                vpx_d135_predictor_16x16_avx2, vpx_d117_predictor_16x16_avx2,
+                vpx_d153_predictor_16x16_avx2, vpx_d207_predictor_16x16_avx2,
+                vpx_d63_predictor_16x16_avx2, nullptr)
+INTRA_PRED_TEST(AVX2, TestIntraPred32, nullptr, nullptr, nullptr, nullptr,
+                nullptr, nullptr, vpx_d45_predictor_32x32_avx2,
+                vpx_d135_predictor_32x32_avx2, vpx_d117_predictor_32x32_avx2,
+                vpx_d153_predictor_32x32_avx2, vpx_d207_predictor_32x32_avx2,
+                vpx_d63_predictor_32x32_avx2, nullptr)
+#endif  // HAVE_AVX2
+
 #if HAVE_DSPR2
 INTRA_PRED_TEST(DSPR2, TestIntraPred4, vpx_dc_predictor_4x4_dspr2, nullptr,
                 nullptr, nullptr, nullptr, vpx_h_predictor_4x4_dspr2, nullptr,
@@ -570,6 +583,25 @@ HIGHBD_INTRA_PRED_TEST(SSSE3, TestHighbdIntraPred32, nullptr, nullptr, nullptr,
                        vpx_highbd_d63_predictor_32x32_ssse3, nullptr)
 #endif  // HAVE_SSSE3
 
+#if HAVE_AVX2
+HIGHBD_INTRA_PRED_TEST(AVX2, TestHighbdIntraPred16, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, nullptr,
+                       vpx_highbd_d45_predictor_16x16_avx2,
+                       vpx_highbd_d135_predictor_16x16_avx2,
+                       vpx_highbd_d117_predictor_16x16_avx2,
+                       vpx_highbd_d153_predictor_16x16_avx2,
+                       vpx_highbd_d207_predictor_16x16_avx2,
+                       vpx_highbd_d63_predictor_16x16_avx2, nullptr)
+HIGHBD_INTRA_PRED_TEST(AVX2, TestHighbdIntraPred32, nullptr, nullptr, nullptr,
+                       nullptr, nullptr, nullptr,
+                       vpx_highbd_d45_predictor_32x32_avx2,
+                       vpx_highbd_d135_predictor_32x32_avx2,
+                       vpx_highbd_d117_predictor_32x32_avx2,
+                       vpx_highbd_d153_predictor_32x32_avx2,
+                       vpx_highbd_d207_predictor_32x32_avx2,
+                       vpx_highbd_d63_predictor_32x32_avx2, nullptr)
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 HIGHBD_INTRA_PRED_TEST(
     NEON, TestHighbdIntraPred4, vpx_highbd_dc_predictor_4x4_neon,
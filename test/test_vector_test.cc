@@ -118,6 +118,9 @@ TEST_P(TestVectorTest, MD5Match) {
 
   cfg.threads = std::get<kThreads>(input);
   mt_mode_ = std::get<kMtMode>(input);
+#if CONFIG_VP9_DECODER
+  if (mt_mode_ == 3) flags |= VPX_CODEC_USE_FRAME_THREADING;
+#endif
   snprintf(str, sizeof(str) / sizeof(str[0]) - 1,
            "file: %s threads: %d MT mode: %d", filename.c_str(), cfg.threads,
            mt_mode_);
@@ -193,10 +196,11 @@ INSTANTIATE_TEST_SUITE_P(
             static_cast<const libvpx_test::CodecFactory *>(&libvpx_test::kVP9)),
         ::testing::Combine(
             ::testing::Range(2, 9),  // With 2 ~ 8 threads.
-            ::testing::Range(0, 3),  // With multi threads modes 0 ~ 2
+            ::testing::Range(0, 4),  // With multi threads modes 0 ~ 3
                                      // 0: LPF opt and Row MT disabled
                                      // 1: LPF opt enabled
                                      // 2: Row MT enabled
+                                     // 3: Frame parallel decode
             ::testing::ValuesIn(libvpx_test::kVP9TestVectors,
                                 libvpx_test::kVP9TestVectors +
                                     libvpx_test::kNumVP9TestVectors))));
@@ -198,6 +198,14 @@ INSTANTIATE_TEST_SUITE_P(
                                  VPX_BITS_8)));
 #endif  // HAVE_AVX2
 
+#if HAVE_AVX512
+INSTANTIATE_TEST_SUITE_P(
+    AVX512, BlockErrorTest,
+    ::testing::Values(make_tuple(&BlockError8BitWrapper<vp9_block_error_avx512>,
+                                 &BlockError8BitWrapper<vp9_block_error_c>,
+                                 VPX_BITS_8)));
+#endif  // HAVE_AVX512
+
 #if HAVE_NEON
 const BlockErrorParam neon_block_error_tests[] = {
 #if CONFIG_VP9_HIGHBITDEPTH
@@ -0,0 +1,244 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_decoder.h"
+#include "vpx/vpx_encoder.h"
+
+namespace {
+
+// Wide enough for two tile columns.
+const int kWidth = 704;
+const int kHeight = 144;
+const int kFrames = 10;
+
+// Encodes with lag 0 or 10, the latter filtering alt-ref frames.
+class EncoderComponentTimingTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<int> {
+ protected:
+  EncoderComponentTimingTest()
+      : EncoderTest(GET_PARAM(0)), lag_(GET_PARAM(1)), frames_(0) {}
+
+  ~EncoderComponentTimingTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kOnePassGood);
+    cfg_.g_lag_in_frames = lag_;
+    cfg_.rc_target_bitrate = 500;
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, 4);
+      encoder->Control(VP9E_SET_COMPONENT_TIMING, 1);
+    }
+  }
+
+  void PostEncodeFrameHook(::libvpx_test::Encoder *encoder) override {
+    encoder->Control(VP9E_GET_COMPONENT_TIMING, &timing_);
+  }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    // Hidden alt-ref frames are part of a superframe.
+    if (!(pkt->data.frame.flags & VPX_FRAME_IS_INVISIBLE)) ++frames_;
+  }
+
+  const int lag_;
+  unsigned int frames_;
+  vpx_enc_component_timing_t timing_;
+};
+
+TEST_P(EncoderComponentTimingTest, AccountsForEveryFrame) {
+  ::libvpx_test::MovingPatternVideoSource video;
+  video.SetSize(kWidth, kHeight);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), frames_);
+
+  EXPECT_GE(timing_.frames, static_cast<unsigned int>(kFrames));
+  EXPECT_GT(timing_.total_us, 0u);
+  EXPECT_GT(timing_.encode_frame_us, 0u);
+  EXPECT_EQ(0u, timing_.first_pass_us);
+  EXPECT_LE(timing_.temporal_filter_us + timing_.tpl_us +
+                timing_.encode_frame_us + timing_.loop_filter_us +
+                timing_.pack_bitstream_us,
+            timing_.total_us);
+  if (lag_ == 0) {
+    EXPECT_EQ(0u, timing_.temporal_filter_us);
+  }
+}
+
+TEST(EncoderComponentTimingControlTest, ResetsWhenTurnedOff) {
+  vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_lag_in_frames = 0;
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP8E_SET_CPUUSED, 6));
+
+  vpx_enc_component_timing_t timing;
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_GET_COMPONENT_TIMING,
+                              static_cast<vpx_enc_component_timing_t *>(
+                                  nullptr)));
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_COMPONENT_TIMING, 1));
+
+  vpx_image_t img;
+  ASSERT_NE(vpx_img_alloc(&img, VPX_IMG_FMT_I420, kWidth, kHeight, 1),
+            nullptr);
+  ::libvpx_test::FillMovingPattern(&img, 0);
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_encode(&enc, &img, 0, 1, 0, VPX_DL_GOOD_QUALITY));
+  vpx_img_free(&img);
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_GET_COMPONENT_TIMING, &timing));
+  EXPECT_EQ(1u, timing.frames);
+  EXPECT_GT(timing.total_us, 0u);
+
+  // Turning timing off resets the times.
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_COMPONENT_TIMING, 0));
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_GET_COMPONENT_TIMING, &timing));
+  EXPECT_EQ(0u, timing.frames);
+  EXPECT_EQ(0u, timing.total_us);
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+// Decodes with the given number of threads, with and without row based
+// multi-threading.
+class DecoderComponentTimingTest
+    : public ::testing::TestWithParam<::testing::tuple<int, int> > {
+ protected:
+  static void SetUpTestSuite() {
+    vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+    vpx_codec_enc_cfg_t cfg;
+    ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+    cfg.g_w = kWidth;
+    cfg.g_h = kHeight;
+    cfg.g_lag_in_frames = 0;
+    cfg.rc_target_bitrate = 500;
+    vpx_codec_ctx_t enc;
+    ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+    ASSERT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP8E_SET_CPUUSED, 6));
+    ASSERT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP9E_SET_TILE_COLUMNS, 1));
+
+    vpx_image_t img;
+    ASSERT_NE(vpx_img_alloc(&img, VPX_IMG_FMT_I420, kWidth, kHeight, 1),
+              nullptr);
+    packets_ = new std::vector<std::vector<uint8_t> >;
+    for (int frame = 0; frame < kFrames; ++frame) {
+      ::libvpx_test::FillMovingPattern(&img, frame);
+      ASSERT_EQ(VPX_CODEC_OK, vpx_codec_encode(&enc, &img, frame, 1, 0,
+                                               VPX_DL_GOOD_QUALITY));
+      vpx_codec_iter_t iter = nullptr;
+      const vpx_codec_cx_pkt_t *pkt;
+      while ((pkt = vpx_codec_get_cx_data(&enc, &iter)) != nullptr) {
+        if (pkt->kind != VPX_CODEC_CX_FRAME_PKT) continue;
+        const uint8_t *const buf =
+            static_cast<const uint8_t *>(pkt->data.frame.buf);
+        packets_->emplace_back(buf, buf + pkt->data.frame.sz);
+      }
+    }
+    vpx_img_free(&img);
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+  }
+
+  static void TearDownTestSuite() {
+    delete packets_;
+    packets_ = nullptr;
+  }
+
+  static std::vector<std::vector<uint8_t> > *packets_;
+};
+
+std::vector<std::vector<uint8_t> > *DecoderComponentTimingTest::packets_ =
+    nullptr;
+
+TEST_P(DecoderComponentTimingTest, SplitsTimeByTileColumn) {
+  ASSERT_EQ(static_cast<size_t>(kFrames), packets_->size());
+  vpx_codec_dec_cfg_t cfg = vpx_codec_dec_cfg_t();
+  cfg.threads = ::testing::get<0>(GetParam());
+  vpx_codec_ctx_t dec;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_dec_init(&dec, vpx_codec_vp9_dx(), &cfg, 0));
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_control(&dec, VP9D_SET_ROW_MT,
+                                            ::testing::get<1>(GetParam())));
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&dec, VP9D_SET_COMPONENT_TIMING, 1));
+
+  for (const std::vector<uint8_t> &packet : *packets_) {
+    ASSERT_EQ(VPX_CODEC_OK,
+              vpx_codec_decode(&dec, &packet[0],
+                               static_cast<unsigned int>(packet.size()),
+                               nullptr, 0));
+    vpx_codec_iter_t iter = nullptr;
+    while (vpx_codec_get_frame(&dec, &iter) != nullptr) {
+    }
+  }
+
+  vpx_dec_component_timing_t timing;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&dec, VP9D_GET_COMPONENT_TIMING, &timing));
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), timing.frames);
+  EXPECT_GT(timing.total_us, 0u);
+  EXPECT_GT(timing.recon_us, 0u);
+
+  // The tile columns take the parsing and reconstruction of the tile data,
+  // the parse time also covers the frame headers.
+  uint64_t tile_us = 0;
+  for (int col = 0; col < VPX_MAX_TILE_COLS; ++col) {
+    if (col >= 2) {
+      EXPECT_EQ(0u, timing.tile_us[col]);
+    }
+    tile_us += timing.tile_us[col];
+  }
+  EXPECT_GE(tile_us, timing.recon_us);
+  EXPECT_LE(tile_us, timing.recon_us + timing.parse_us);
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&dec));
+}
+
+TEST(DecoderComponentTimingControlTest, ReportsNothingWhenOff) {
+  vpx_codec_ctx_t dec;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_dec_init(&dec, vpx_codec_vp9_dx(), nullptr, 0));
+  vpx_dec_component_timing_t timing;
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&dec, VP9D_GET_COMPONENT_TIMING,
+                              static_cast<vpx_dec_component_timing_t *>(
+                                  nullptr)));
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&dec, VP9D_GET_COMPONENT_TIMING, &timing));
+  EXPECT_EQ(0u, timing.frames);
+  EXPECT_EQ(0u, timing.total_us);
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&dec));
+}
+
+VP9_INSTANTIATE_TEST_SUITE(EncoderComponentTimingTest,
+                           ::testing::Values(0, 10));
+INSTANTIATE_TEST_SUITE_P(VP9, DecoderComponentTimingTest,
+                         ::testing::Combine(::testing::Values(1, 4),
+                                            ::testing::Values(0, 1)));
+}  // namespace
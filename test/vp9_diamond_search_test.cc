@@ -0,0 +1,214 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "test/acm_random.h"
+#include "test/clear_system_state.h"
+#include "test/register_state_check.h"
+#include "vp9/encoder/vp9_block.h"
+#include "vp9/encoder/vp9_mcomp.h"
+#include "vpx/vpx_integer.h"
+
+using libvpx_test::ACMRandom;
+
+namespace {
+
+typedef int (*DiamondSearchFunc)(const MACROBLOCK *x,
+                                 const search_site_config *cfg, MV *ref_mv,
+                                 uint32_t start_mv_sad, MV *best_mv,
+                                 int search_param, int sad_per_bit,
+                                 int *num00, const vp9_sad_fn_ptr_t *sad_fn_ptr,
+                                 const MV *center_mv);
+
+struct BlockSad {
+  int width;
+  int height;
+  vp9_sad_fn_ptr_t sad;
+};
+
+// The C SAD functions are used, because the RTCD pointers are not set up yet
+// when this is initialized.
+const BlockSad kBlockSads[] = {
+  { 64, 64, { vpx_sad64x64_c, vpx_sad64x64x4d_c } },
+  { 64, 32, { vpx_sad64x32_c, vpx_sad64x32x4d_c } },
+  { 32, 64, { vpx_sad32x64_c, vpx_sad32x64x4d_c } },
+  { 32, 32, { vpx_sad32x32_c, vpx_sad32x32x4d_c } },
+  { 32, 16, { vpx_sad32x16_c, vpx_sad32x16x4d_c } },
+  { 16, 32, { vpx_sad16x32_c, vpx_sad16x32x4d_c } },
+  { 16, 16, { vpx_sad16x16_c, vpx_sad16x16x4d_c } },
+  { 16, 8, { vpx_sad16x8_c, vpx_sad16x8x4d_c } },
+  { 8, 16, { vpx_sad8x16_c, vpx_sad8x16x4d_c } },
+  { 8, 8, { vpx_sad8x8_c, vpx_sad8x8x4d_c } },
+  { 8, 4, { vpx_sad8x4_c, vpx_sad8x4x4d_c } },
+  { 4, 8, { vpx_sad4x8_c, vpx_sad4x8x4d_c } },
+  { 4, 4, { vpx_sad4x4_c, vpx_sad4x4x4d_c } },
+};
+
+const int kNumIterations = 20000;
+// The block sits in the middle of the reference, with room for the largest
+// block and the search range on every side.
+const int kMargin = 160;
+const int kRefStride = 2 * kMargin + 64;
+const int kRefHeight = 2 * kMargin + 64;
+const int kSrcStride = 64;
+
+class DiamondSearchTest : public ::testing::TestWithParam<DiamondSearchFunc> {
+ public:
+  ~DiamondSearchTest() override = default;
+
+  void SetUp() override {
+    search_ = GetParam();
+    x_.reset(new MACROBLOCK);
+    memset(x_.get(), 0, sizeof(*x_));
+    ref_.resize(kRefStride * kRefHeight);
+    src_.resize(kSrcStride * 64);
+    sad_cost_.resize(MV_VALS);
+    x_->plane[0].src.buf = &src_[0];
+    x_->plane[0].src.stride = kSrcStride;
+    x_->e_mbd.plane[0].pre[0].buf = &ref_[kMargin * kRefStride + kMargin];
+    x_->e_mbd.plane[0].pre[0].stride = kRefStride;
+    x_->nmvsadcost[0] = &sad_cost_[MV_MAX];
+    x_->nmvsadcost[1] = &sad_cost_[MV_MAX];
+  }
+
+  void TearDown() override { libvpx_test::ClearSystemState(); }
+
+ protected:
+  // Random costs with the properties the SIMD versions rely on: the joint
+  // costs of the nonzero joints are equal, and both components share one
+  // even cost function.
+  void RandomCosts(ACMRandom *rnd) {
+    x_->nmvjointsadcost[0] = rnd->Rand16() & 1023;
+    x_->nmvjointsadcost[1] = rnd->Rand16() & 1023;
+    x_->nmvjointsadcost[2] = x_->nmvjointsadcost[1];
+    x_->nmvjointsadcost[3] = x_->nmvjointsadcost[1];
+    int *const cost = x_->nmvsadcost[0];
+    cost[0] = rnd->Rand16() & 255;
+    for (int i = 1; i <= MV_MAX; ++i) {
+      cost[i] = cost[-i] = rnd->Rand16() & 8191;
+    }
+  }
+
+  // Fills the reference with either noise or a smooth pattern, and copies the
+  // source block from somewhere near the middle with a little noise, so that
+  // the search has a real minimum to find.
+  void RandomContent(ACMRandom *rnd, int width, int height) {
+    const int smooth = rnd->Rand8() & 1;
+    for (int r = 0; r < kRefHeight; ++r) {
+      for (int c = 0; c < kRefStride; ++c) {
+        ref_[r * kRefStride + c] =
+            smooth ? static_cast<uint8_t>((r * 3 + c * 5) ^ (r * c >> 6))
+                   : rnd->Rand8();
+      }
+    }
+    const int dr = rnd->PseudoUniform(65) - 32;
+    const int dc = rnd->PseudoUniform(65) - 32;
+    const uint8_t *const match =
+        &ref_[(kMargin + dr) * kRefStride + kMargin + dc];
+    for (int r = 0; r < height; ++r) {
+      for (int c = 0; c < width; ++c) {
+        const int v = match[r * kRefStride + c] + (rnd->Rand8() & 7) - 4;
+        src_[r * kSrcStride + c] = static_cast<uint8_t>(
+            v < 0 ? 0 : v > 255 ? 255 : v);
+      }
+    }
+  }
+
+  void RandomLimits(ACMRandom *rnd, int width, int height) {
+    MvLimits *const limits = &x_->mv_limits;
+    limits->row_min = -rnd->PseudoUniform(kMargin + 1);
+    limits->col_min = -rnd->PseudoUniform(kMargin + 1);
+    limits->row_max = rnd->PseudoUniform(kRefHeight - kMargin - height + 1);
+    limits->col_max = rnd->PseudoUniform(kRefStride - kMargin - width + 1);
+  }
+
+  int RandomInRange(ACMRandom *rnd, int min, int max) {
+    return min + rnd->PseudoUniform(max - min + 1);
+  }
+
+  DiamondSearchFunc search_;
+  std::unique_ptr<MACROBLOCK> x_;
+  std::vector<uint8_t> ref_;
+  std::vector<uint8_t> src_;
+  std::vector<int> sad_cost_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DiamondSearchTest);
+
+TEST_P(DiamondSearchTest, MatchesC) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  search_site_config cfgs[2];
+  vp9_init_dsmotion_compensation(&cfgs[0], kRefStride);
+  vp9_init3smotion_compensation(&cfgs[1], kRefStride);
+
+  for (int i = 0; i < kNumIterations; ++i) {
+    const BlockSad &block =
+        kBlockSads[rnd.PseudoUniform(sizeof(kBlockSads) / sizeof(*kBlockSads))];
+    const search_site_config &cfg = cfgs[rnd.Rand8() & 1];
+    if ((i & 63) == 0) {
+      RandomContent(&rnd, block.width, block.height);
+      RandomCosts(&rnd);
+    }
+    RandomLimits(&rnd, block.width, block.height);
+    const MvLimits &limits = x_->mv_limits;
+
+    MV ref_mv;
+    ref_mv.row = RandomInRange(&rnd, limits.row_min, limits.row_max);
+    ref_mv.col = RandomInRange(&rnd, limits.col_min, limits.col_max);
+    MV center_mv;
+    center_mv.row = RandomInRange(&rnd, limits.row_min, limits.row_max) * 8 +
+                    (rnd.Rand8() & 7);
+    center_mv.col = RandomInRange(&rnd, limits.col_min, limits.col_max) * 8 +
+                    (rnd.Rand8() & 7);
+    const int search_param = rnd.PseudoUniform(cfg.total_steps);
+    const int sad_per_bit = 1 + rnd.PseudoUniform(256);
+    // The SAD of the start position plus a stand-in for its MV cost, as in
+    // get_start_mv_sad().
+    const uint8_t *const start = x_->e_mbd.plane[0].pre[0].buf +
+                                 ref_mv.row * kRefStride + ref_mv.col;
+    const uint32_t start_mv_sad =
+        block.sad.sdf(&src_[0], kSrcStride, start, kRefStride) + rnd.Rand8();
+
+    MV ref_mv_c = ref_mv;
+    MV best_mv_ref, best_mv;
+    int num00_ref, num00;
+    const int sad_ref = vp9_diamond_search_sad_c(
+        x_.get(), &cfg, &ref_mv_c, start_mv_sad, &best_mv_ref, search_param,
+        sad_per_bit, &num00_ref, &block.sad, &center_mv);
+    int sad;
+    ASM_REGISTER_STATE_CHECK(
+        sad = search_(x_.get(), &cfg, &ref_mv, start_mv_sad, &best_mv,
+                      search_param, sad_per_bit, &num00, &block.sad,
+                      &center_mv));
+
+    ASSERT_EQ(sad_ref, sad) << "iteration " << i;
+    ASSERT_EQ(best_mv_ref.row, best_mv.row) << "iteration " << i;
+    ASSERT_EQ(best_mv_ref.col, best_mv.col) << "iteration " << i;
+    ASSERT_EQ(num00_ref, num00) << "iteration " << i;
+  }
+}
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, DiamondSearchTest,
+                         ::testing::Values(&vp9_diamond_search_sad_avx2));
+#endif  // HAVE_AVX2
+
+#if HAVE_NEON
+INSTANTIATE_TEST_SUITE_P(NEON, DiamondSearchTest,
+                         ::testing::Values(&vp9_diamond_search_sad_neon));
+#endif  // HAVE_NEON
+}  // namespace
@@ -14,6 +14,7 @@
 #include "test/codec_factory.h"
 #include "test/encode_test_driver.h"
 #include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
 #include "test/util.h"
 #include "test/y4m_video_source.h"
 #include "vp9/encoder/vp9_firstpass.h"
@@ -396,6 +397,68 @@ TEST_P(VPxEncoderThreadTest, EncoderResultTest) {
   EXPECT_NEAR(single_thr_psnr, multi_thr_psnr, 0.2);
 }
 
+#if !CONFIG_REALTIME_ONLY
+// Encodes with an alt-ref in every GF group, so that the TPL model is built,
+// and keeps the MD5 of every frame packet.
+class VPxTplRowMtTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<int> {
+ protected:
+  VPxTplRowMtTest() : EncoderTest(GET_PARAM(0)), set_cpu_used_(GET_PARAM(1)) {}
+  ~VPxTplRowMtTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kTwoPassGood);
+    cfg_.g_lag_in_frames = 25;
+    cfg_.rc_end_usage = VPX_VBR;
+    cfg_.rc_target_bitrate = 500;
+  }
+
+  void BeginPassHook(unsigned int /*pass*/) override { md5_.clear(); }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, set_cpu_used_);
+      encoder->Control(VP8E_SET_ENABLEAUTOALTREF, 1);
+      encoder->Control(VP9E_SET_TPL, 1);
+      encoder->Control(VP9E_SET_ROW_MT, 1);
+    }
+  }
+
+  bool DoDecode() const override { return false; }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    ::libvpx_test::MD5 md5_res;
+    md5_res.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+                pkt->data.frame.sz);
+    md5_.push_back(md5_res.Get());
+  }
+
+  int set_cpu_used_;
+  std::vector<std::string> md5_;
+};
+
+TEST_P(VPxTplRowMtTest, MatchesAcrossThreads) {
+  ::libvpx_test::MovingPatternVideoSource video;
+  video.SetSize(352, 288);
+  video.set_limit(12);
+
+  cfg_.g_threads = 1;
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  const std::vector<std::string> single_thr_md5 = md5_;
+  ASSERT_FALSE(single_thr_md5.empty());
+
+  for (int threads = 2; threads <= 4; threads += 2) {
+    SCOPED_TRACE(threads);
+    cfg_.g_threads = threads;
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+    EXPECT_EQ(single_thr_md5, md5_);
+  }
+}
+#endif  // !CONFIG_REALTIME_ONLY
+
 INSTANTIATE_TEST_SUITE_P(
     VP9, VPxFirstPassEncoderThreadTest,
     ::testing::Combine(
@@ -446,4 +509,8 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Range(2, 5)));  // threads
 #endif
 
+#if !CONFIG_REALTIME_ONLY
+VP9_INSTANTIATE_TEST_SUITE(VPxTplRowMtTest, ::testing::Values(2, 4));
+#endif
+
 }  // namespace
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kMbs = ((kWidth + 15) / 16) * ((kHeight + 15) / 16);
+const int kFrames = 10;
+const int kFastStep = 4;
+
+// The shared moving pattern, 'step' of its frames apart, for larger motion.
+class SteppedPatternVideoSource : public ::libvpx_test::DummyVideoSource {
+ public:
+  explicit SteppedPatternVideoSource(int step) : step_(step) {}
+
+ protected:
+  void FillFrame() override {
+    if (img_ != nullptr) ::libvpx_test::FillMovingPattern(img_, step_ * frame_);
+  }
+
+  const int step_;
+};
+
+struct FpMv {
+  int16_t row;
+  int16_t col;
+};
+
+class FpMvSeedsTest : public ::libvpx_test::EncoderTest,
+                      public ::libvpx_test::CodecTestWithParam<int> {
+ protected:
+  FpMvSeedsTest()
+      : EncoderTest(GET_PARAM(0)), speed_(GET_PARAM(1)), seeds_(true),
+        step_(1) {}
+
+  ~FpMvSeedsTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kTwoPassGood);
+    cfg_.g_lag_in_frames = 6;
+    cfg_.rc_target_bitrate = 400;
+    init_flags_ = VPX_CODEC_USE_PSNR;
+  }
+
+  void BeginPassHook(unsigned int pass) override {
+    if (pass == 0) {
+      fpmb_stats_.clear();
+      cfg_.rc_firstpass_mb_stats_in.buf = nullptr;
+      cfg_.rc_firstpass_mb_stats_in.sz = 0;
+    } else if (seeds_) {
+      cfg_.rc_firstpass_mb_stats_in.buf = &fpmb_stats_[0];
+      cfg_.rc_firstpass_mb_stats_in.sz = fpmb_stats_.size();
+    }
+    frames_ = 0;
+    bytes_ = 0;
+    psnr_ = 0.0;
+    md5_.clear();
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, speed_);
+      encoder->Control(VP9E_SET_FP_MV_SEEDS, seeds_ ? 1 : 0);
+    }
+  }
+
+  void FPMBStatsPktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    fpmb_stats_.append(
+        static_cast<const char *>(pkt->data.firstpass_mb_stats.buf),
+        pkt->data.firstpass_mb_stats.sz);
+  }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    ++frames_;
+    bytes_ += pkt->data.frame.sz;
+    ::libvpx_test::MD5 md5;
+    md5.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+            pkt->data.frame.sz);
+    md5_.push_back(md5.Get());
+  }
+
+  void PSNRPktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    psnr_ += pkt->data.psnr.psnr[0];
+  }
+
+  void Encode() {
+    SteppedPatternVideoSource video(step_);
+    video.SetSize(kWidth, kHeight);
+    video.set_limit(kFrames);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  }
+
+  const FpMv *field(int frame) const {
+    return reinterpret_cast<const FpMv *>(fpmb_stats_.data()) + frame * kMbs;
+  }
+
+  const int speed_;
+  bool seeds_;
+  int step_;
+  std::string fpmb_stats_;
+  int frames_;
+  size_t bytes_;
+  double psnr_;
+  std::vector<std::string> md5_;
+};
+
+TEST_P(FpMvSeedsTest, ReportsFirstPassMotion) {
+  ASSERT_NO_FATAL_FAILURE(Encode());
+  ASSERT_EQ(kFrames * kMbs * sizeof(FpMv), fpmb_stats_.size());
+
+  // The first frame is intra only.
+  for (int i = 0; i < kMbs; ++i) {
+    EXPECT_EQ(INT16_MIN, field(0)[i].row);
+    EXPECT_EQ(INT16_MIN, field(0)[i].col);
+  }
+  for (int frame = 1; frame < kFrames; ++frame) {
+    int matches = 0;
+    for (int i = 0; i < kMbs; ++i) {
+      matches += field(frame)[i].row == ::libvpx_test::kPatternMvRow &&
+                 field(frame)[i].col == ::libvpx_test::kPatternMvCol;
+    }
+    EXPECT_GT(matches, kMbs / 2) << "frame " << frame;
+  }
+}
+
+TEST_P(FpMvSeedsTest, EncodesWithSeeds) {
+  step_ = kFastStep;
+  seeds_ = false;
+  ASSERT_NO_FATAL_FAILURE(Encode());
+  ASSERT_EQ(kFrames, frames_);
+  const std::vector<std::string> plain_md5 = md5_;
+  const size_t plain_bytes = bytes_;
+  const double plain_psnr = psnr_ / frames_;
+
+  seeds_ = true;
+  ASSERT_NO_FATAL_FAILURE(Encode());
+  ASSERT_EQ(kFrames, frames_);
+  // The seeds steer the motion search, at about the same size and quality.
+  EXPECT_NE(plain_md5, md5_);
+  EXPECT_LE(bytes_, plain_bytes * 21 / 20);
+  EXPECT_GE(psnr_ / frames_, plain_psnr - 0.2);
+}
+
+TEST_P(FpMvSeedsTest, RejectsTruncatedMotionFields) {
+  ASSERT_NO_FATAL_FAILURE(Encode());
+
+  vpx_codec_enc_cfg_t cfg = cfg_;
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_pass = VPX_RC_LAST_PASS;
+  cfg.rc_twopass_stats_in = stats_.buf();
+  cfg.rc_firstpass_mb_stats_in.buf = &fpmb_stats_[0];
+  cfg.rc_firstpass_mb_stats_in.sz = fpmb_stats_.size() - 1;
+
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_init(&enc, vpx_codec_vp9_cx(), &cfg, 0));
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_FP_MV_SEEDS, 1));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+VP9_INSTANTIATE_TEST_SUITE(FpMvSeedsTest, ::testing::Values(0, 1, 2));
+}  // namespace
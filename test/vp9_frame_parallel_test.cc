@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_image.h"
+
+namespace {
+
+const int kWidth = 352;
+const int kHeight = 288;
+const int kFrames = 20;
+
+// Encodes a clip, then checks that frame parallel decode returns the same
+// frames as the serial decoder.
+class FrameParallelDecodeTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWith2Params<int, int> {
+ protected:
+  FrameParallelDecodeTest()
+      : EncoderTest(GET_PARAM(0)), frame_parallel_decoding_mode_(GET_PARAM(1)),
+        aq_mode_(GET_PARAM(2)) {}
+
+  ~FrameParallelDecodeTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kOnePassGood);
+    cfg_.g_lag_in_frames = 10;
+    cfg_.rc_target_bitrate = 300;
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, 4);
+      encoder->Control(VP8E_SET_ENABLEAUTOALTREF, 1);
+      encoder->Control(VP9E_SET_FRAME_PARALLEL_DECODING,
+                       frame_parallel_decoding_mode_);
+      encoder->Control(VP9E_SET_AQ_MODE, aq_mode_);
+    }
+  }
+
+  bool DoDecode() const override { return false; }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    const uint8_t *const buf = static_cast<const uint8_t *>(pkt->data.frame.buf);
+    frames_.push_back(std::vector<uint8_t>(buf, buf + pkt->data.frame.sz));
+  }
+
+  // Returns the number of frames added to 'md5s'.
+  static int AddFrames(::libvpx_test::Decoder *decoder,
+                       std::vector<std::string> *md5s) {
+    ::libvpx_test::DxDataIterator dec_iter = decoder->GetDxData();
+    const vpx_image_t *img;
+    int num_frames = 0;
+    while ((img = dec_iter.Next()) != nullptr) {
+      ::libvpx_test::MD5 md5;
+      md5.Add(img);
+      md5s->push_back(md5.Get());
+      ++num_frames;
+    }
+    return num_frames;
+  }
+
+  // Decodes 'packets'. If 'ref' is set, it replaces the last frame
+  // reference after packet 'ref_packet', between two runs of
+  // vpx_codec_get_frame(). Returns the most frames returned between two calls
+  // to vpx_codec_decode() in 'max_frames_per_decode'.
+  std::vector<std::string> Decode(
+      int threads, vpx_codec_flags_t flags,
+      const std::vector<std::vector<uint8_t> > &packets, vpx_image_t *ref,
+      size_t ref_packet, int *max_frames_per_decode) {
+    vpx_codec_dec_cfg_t cfg = vpx_codec_dec_cfg_t();
+    cfg.threads = threads;
+    ::libvpx_test::VP9Decoder decoder(cfg, flags);
+    std::vector<std::string> md5s;
+    *max_frames_per_decode = 0;
+    for (size_t i = 0; i < packets.size(); ++i) {
+      const vpx_codec_err_t res =
+          decoder.DecodeFrame(&packets[i][0], packets[i].size());
+      EXPECT_EQ(VPX_CODEC_OK, res) << decoder.DecodeError();
+      int num_frames = AddFrames(&decoder, &md5s);
+      if (ref != nullptr && i == ref_packet) {
+        vpx_ref_frame_t ref_frame;
+        ref_frame.frame_type = VP8_LAST_FRAME;
+        ref_frame.img = *ref;
+        decoder.Control(VP8_SET_REFERENCE, &ref_frame);
+        num_frames += AddFrames(&decoder, &md5s);
+      }
+      *max_frames_per_decode = std::max(*max_frames_per_decode, num_frames);
+    }
+    const vpx_codec_err_t res = decoder.DecodeFrame(nullptr, 0);
+    EXPECT_EQ(VPX_CODEC_OK, res) << decoder.DecodeError();
+    AddFrames(&decoder, &md5s);
+    return md5s;
+  }
+
+  std::vector<std::string> Decode(int threads, vpx_codec_flags_t flags) {
+    int max_frames_per_decode;
+    return Decode(threads, flags, frames_, nullptr, 0, &max_frames_per_decode);
+  }
+
+  const int frame_parallel_decoding_mode_;
+  const int aq_mode_;
+  std::vector<std::vector<uint8_t> > frames_;
+};
+
+TEST_P(FrameParallelDecodeTest, MatchesSerialDecode) {
+  ::libvpx_test::MovingPatternVideoSource video;
+  video.SetSize(kWidth, kHeight);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+
+  const std::vector<std::string> serial_md5s = Decode(1, 0);
+  ASSERT_EQ(static_cast<size_t>(kFrames), serial_md5s.size());
+  for (int threads = 2; threads <= 5; ++threads) {
+    SCOPED_TRACE(threads);
+    const std::vector<std::string> md5s =
+        Decode(threads, VPX_CODEC_USE_FRAME_THREADING);
+    EXPECT_EQ(serial_md5s, md5s);
+  }
+}
+
+// The controls that finish the frames in flight may return more frames
+// before the next call to vpx_codec_decode().
+TEST_P(FrameParallelDecodeTest, SetReferenceBetweenGetFrame) {
+  ::libvpx_test::MovingPatternVideoSource video;
+  video.SetSize(kWidth, kHeight);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+
+  vpx_image_t *const ref =
+      vpx_img_alloc(nullptr, VPX_IMG_FMT_I420, kWidth, kHeight, 32);
+  ASSERT_NE(ref, nullptr);
+  for (int plane = 0; plane < 3; ++plane) {
+    const int w = plane ? (kWidth + 1) >> 1 : kWidth;
+    const int h = plane ? (kHeight + 1) >> 1 : kHeight;
+    for (int y = 0; y < h; ++y) {
+      memset(ref->planes[plane] + y * ref->stride[plane], 128, w);
+    }
+  }
+  for (int threads = 2; threads <= 5; ++threads) {
+    SCOPED_TRACE(threads);
+    int max_frames_per_decode;
+    const std::vector<std::string> md5s =
+        Decode(threads, VPX_CODEC_USE_FRAME_THREADING, frames_, ref,
+               frames_.size() / 2, &max_frames_per_decode);
+    EXPECT_EQ(static_cast<size_t>(kFrames), md5s.size());
+    if (threads == 5 && frame_parallel_decoding_mode_ && !aq_mode_) {
+      // With 4 frames in flight, more frames than the frame cache holds have
+      // been returned.
+      EXPECT_GT(max_frames_per_decode, 4);
+    }
+  }
+  vpx_img_free(ref);
+}
+
+// Removes the superframe indexes: the frames of a superframe follow each
+// other in the packet.
+TEST_P(FrameParallelDecodeTest, FramesWithoutSuperframeIndex) {
+  // Two pass encoding, which places alt reference frames in superframes.
+  SetMode(::libvpx_test::kTwoPassGood);
+  ::libvpx_test::MovingPatternVideoSource video;
+  video.SetSize(kWidth, kHeight);
+  video.set_limit(kFrames);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+
+  std::vector<std::vector<uint8_t> > packets;
+  int num_superframes = 0;
+  for (const std::vector<uint8_t> &frame : frames_) {
+    const uint8_t marker = frame.back();
+    size_t size = frame.size();
+    if ((marker & 0xe0) == 0xc0) {
+      const size_t frames = (marker & 0x7) + 1;
+      const size_t mag = ((marker >> 3) & 0x3) + 1;
+      const size_t index_sz = 2 + mag * frames;
+      if (size >= index_sz && frame[size - index_sz] == marker) {
+        size -= index_sz;
+        ++num_superframes;
+      }
+    }
+    packets.push_back(
+        std::vector<uint8_t>(frame.begin(), frame.begin() + size));
+  }
+  ASSERT_GT(num_superframes, 0);
+
+  int max_frames_per_decode;
+  const std::vector<std::string> serial_md5s =
+      Decode(1, 0, packets, nullptr, 0, &max_frames_per_decode);
+  ASSERT_EQ(static_cast<size_t>(kFrames), serial_md5s.size());
+  for (int threads = 2; threads <= 5; ++threads) {
+    SCOPED_TRACE(threads);
+    const std::vector<std::string> md5s =
+        Decode(threads, VPX_CODEC_USE_FRAME_THREADING, packets, nullptr, 0,
+               &max_frames_per_decode);
+    EXPECT_EQ(serial_md5s, md5s);
+  }
+}
+
+VP9_INSTANTIATE_TEST_SUITE(FrameParallelDecodeTest, ::testing::Values(0, 1),
+                           ::testing::Values(0, 1));
+}  // namespace
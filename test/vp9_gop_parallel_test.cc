@@ -0,0 +1,102 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kFrames = 20;
+const int kGopFrames = 6;
+
+class GopParallelTest : public ::libvpx_test::EncoderTest,
+                        public ::libvpx_test::CodecTestWithParam<int> {
+ protected:
+  GopParallelTest() : EncoderTest(GET_PARAM(0)), threads_(GET_PARAM(1)) {}
+
+  ~GopParallelTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kTwoPassGood);
+    cfg_.g_lag_in_frames = 10;
+    cfg_.g_threads = threads_;
+    cfg_.rc_target_bitrate = 300;
+    cfg_.kf_max_dist = kGopFrames;
+  }
+
+  void BeginPassHook(unsigned int /*pass*/) override {
+    frames_.clear();
+    key_frames_.clear();
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, 4);
+      encoder->Control(VP9E_SET_GOP_PARALLEL, gop_parallel_);
+    }
+  }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    ::libvpx_test::MD5 md5;
+    md5.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+            pkt->data.frame.sz);
+    frames_.push_back(md5.Get());
+    if (pkt->data.frame.flags & VPX_FRAME_IS_KEY)
+      key_frames_.push_back(static_cast<int>(pkt->data.frame.pts));
+  }
+
+  std::vector<std::string> Encode(unsigned int gop_parallel) {
+    ::libvpx_test::MovingPatternVideoSource video;
+    video.SetSize(kWidth, kHeight);
+    video.set_limit(kFrames);
+    gop_parallel_ = gop_parallel;
+    EXPECT_NO_FATAL_FAILURE(RunLoop(&video));
+    return frames_;
+  }
+
+  const int threads_;
+  unsigned int gop_parallel_;
+  std::vector<std::string> frames_;
+  std::vector<int> key_frames_;
+};
+
+TEST_P(GopParallelTest, StartsEveryGopWithKeyFrame) {
+  const std::vector<std::string> frames = Encode(2);
+  ASSERT_EQ(static_cast<size_t>(kFrames), frames.size());
+  for (int i = 0; i < kFrames; i += kGopFrames) {
+    SCOPED_TRACE(i);
+    EXPECT_NE(std::find(key_frames_.begin(), key_frames_.end(), i),
+              key_frames_.end());
+  }
+}
+
+TEST_P(GopParallelTest, MatchesAcrossGopCounts) {
+  const std::vector<std::string> frames = Encode(2);
+  ASSERT_EQ(static_cast<size_t>(kFrames), frames.size());
+  for (unsigned int gop_parallel = 3; gop_parallel <= 5; ++gop_parallel) {
+    SCOPED_TRACE(gop_parallel);
+    EXPECT_EQ(frames, Encode(gop_parallel));
+  }
+}
+
+VP9_INSTANTIATE_TEST_SUITE(GopParallelTest, ::testing::Values(1, 2));
+}  // namespace
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef VPX_TEST_VP9_INTERNAL_ENCODER_H_
+#define VPX_TEST_VP9_INTERNAL_ENCODER_H_
+
+#include <csetjmp>
+#include <cstring>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/moving_pattern_video_source.h"
+#include "vp9/encoder/vp9_encoder.h"
+#include "vp9/vp9_cx_iface.h"
+#include "vp9/vp9_iface_common.h"
+#include "vpx/vpx_image.h"
+#include "vpx_mem/vpx_mem.h"
+
+namespace libvpx_test {
+
+// Encodes the moving pattern at 30 fps through the internal API of the VP9
+// encoder, for tests that run or inspect encoder stages between frames.
+class VP9InternalEncoder {
+ public:
+  VP9InternalEncoder() : pool_(nullptr), cpi_(nullptr), frame_(0) {
+    memset(&img_, 0, sizeof(img_));
+  }
+
+  ~VP9InternalEncoder() {
+    vpx_img_free(&img_);
+    if (cpi_ != nullptr) vp9_remove_compressor(cpi_);
+    vpx_free(pool_);
+  }
+
+  // Creates a one pass, row based multi-threaded encoder. It starts at speed 0
+  // as vpxenc does: the speed features of the faster speeds read the source
+  // frame in high bitdepth builds.
+  void Init(int width, int height, int bitrate, int lag_in_frames,
+            int threads) {
+    VP9EncoderConfig oxcf = vp9_get_encoder_config(
+        width, height, vpx_rational_t{ 30, 1 }, bitrate, 0, 0,
+        VPX_RC_ONE_PASS);
+    oxcf.lag_in_frames = lag_in_frames;
+    oxcf.max_threads = threads;
+    oxcf.row_mt = 1;
+#if CONFIG_VP9_HIGHBITDEPTH
+    oxcf.use_highbitdepth = 0;
+#endif
+
+    pool_ = static_cast<BufferPool *>(vpx_calloc(1, sizeof(*pool_)));
+    ASSERT_NE(pool_, nullptr);
+    vp9_initialize_enc();
+    cpi_ = vp9_create_compressor(&oxcf, pool_);
+    ASSERT_NE(cpi_, nullptr);
+    ASSERT_NO_FATAL_FAILURE(Run([](VP9_COMP *cpi) {
+      vp9_update_compressor_with_img_fmt(cpi, VPX_IMG_FMT_I420);
+    }));
+
+    ASSERT_NE(vpx_img_alloc(&img_, VPX_IMG_FMT_I420, width, height, 1),
+              nullptr);
+    dest_.resize(width * height * 2);
+  }
+
+  // Passes the next frame of the pattern to the encoder. Sets '*encoded' if a
+  // frame came out, which the lookahead may delay.
+  void EncodeFrame(bool *encoded) {
+    // 30 fps in the 1/10000000 second units of the encoder time stamps.
+    const int64_t ticks_per_frame = 10000000 / 30;
+    *encoded = false;
+    FillMovingPattern(&img_, frame_);
+    YV12_BUFFER_CONFIG sd;
+    image2yuvconfig(&img_, &sd);
+    const int64_t ts = frame_ * ticks_per_frame;
+    ++frame_;
+
+    Run([&](VP9_COMP *cpi) {
+      ASSERT_EQ(0, vp9_receive_raw_frame(cpi, 0, &sd, ts,
+                                         ts + ticks_per_frame));
+      unsigned int frame_flags = 0;
+      size_t size = 0;
+      int64_t time_stamp, time_end;
+      ENCODE_FRAME_RESULT encode_frame_result;
+      vp9_init_encode_frame_result(&encode_frame_result);
+      *encoded = vp9_get_compressed_data(cpi, &frame_flags, &size, &dest_[0],
+                                         dest_.size(), &time_stamp, &time_end,
+                                         0, &encode_frame_result) == 0;
+    });
+  }
+
+  // Calls 'fn' with the encoder, with its error handler set up as the codec
+  // interface does around each call into the encoder.
+  template <typename Fn>
+  void Run(Fn fn) {
+    VP9_COMMON *const cm = &cpi_->common;
+    if (setjmp(cm->error.jmp)) {
+      cm->error.setjmp = 0;
+      FAIL() << "Encoder error " << cm->error.error_code;
+    }
+    cm->error.setjmp = 1;
+    fn(cpi_);
+    cm->error.setjmp = 0;
+  }
+
+  VP9_COMP *cpi() const { return cpi_; }
+
+ private:
+  BufferPool *pool_;
+  VP9_COMP *cpi_;
+  vpx_image_t img_;
+  std::vector<uint8_t> dest_;
+  unsigned int frame_;
+};
+
+}  // namespace libvpx_test
+
+#endif  // VPX_TEST_VP9_INTERNAL_ENCODER_H_
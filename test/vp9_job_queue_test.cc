@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "./vpx_config.h"
+#include "vp9/decoder/vp9_job_queue.h"
+#include "vpx_util/vpx_thread.h"
+
+namespace {
+
+struct TestJob {
+  int id;
+  int producer;
+};
+
+class JobQueueTest : public ::testing::Test {
+ protected:
+  void Init(int num_jobs) {
+    buf_.resize(vp9_jobq_buf_size(num_jobs, sizeof(TestJob)));
+    vp9_jobq_init(&jobq_, &buf_[0], buf_.size(), sizeof(TestJob));
+  }
+
+  void TearDown() override { vp9_jobq_deinit(&jobq_); }
+
+  int Queue(int id, int producer) {
+    TestJob job = { id, producer };
+    return vp9_jobq_queue(&jobq_, &job, sizeof(job));
+  }
+
+  std::vector<uint8_t> buf_;
+  JobQueueRowMt jobq_;
+};
+
+TEST_F(JobQueueTest, Fifo) {
+  Init(16);
+  TestJob job;
+  EXPECT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 0), 1);
+  for (int i = 0; i < 16; ++i) ASSERT_EQ(Queue(i, 0), 0);
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 1), 0);
+    EXPECT_EQ(job.id, i);
+  }
+  EXPECT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 0), 1);
+
+  // Queued jobs are still returned after termination.
+  ASSERT_EQ(Queue(16, 0), 0);
+  vp9_jobq_terminate(&jobq_);
+  ASSERT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 1), 0);
+  EXPECT_EQ(job.id, 16);
+  EXPECT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 1), 1);
+
+  vp9_jobq_reset(&jobq_);
+  EXPECT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 0), 1);
+  ASSERT_EQ(Queue(17, 0), 0);
+  ASSERT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 1), 0);
+  EXPECT_EQ(job.id, 17);
+}
+
+TEST_F(JobQueueTest, SlotsAreReused) {
+  Init(3);
+  TestJob job;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(Queue(2 * i, 0), 0);
+    ASSERT_EQ(Queue(2 * i + 1, 0), 0);
+    ASSERT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 0), 0);
+    EXPECT_EQ(job.id, 2 * i);
+    ASSERT_EQ(vp9_jobq_dequeue(&jobq_, &job, sizeof(job), 0), 0);
+    EXPECT_EQ(job.id, 2 * i + 1);
+  }
+}
+
+#if CONFIG_MULTITHREAD
+const int kNumThreads = 4;
+const int kJobsPerProducer = 2000;
+
+struct ThreadData {
+  JobQueueRowMt *jobq;
+  int producer;
+  // Number of times each job was dequeued, indexed by producer and id.
+  std::vector<int> counts;
+};
+
+int ProducerHook(void *arg1, void * /*arg2*/) {
+  ThreadData *const data = static_cast<ThreadData *>(arg1);
+  for (int i = 0; i < kJobsPerProducer; ++i) {
+    TestJob job = { i, data->producer };
+    if (vp9_jobq_queue(data->jobq, &job, sizeof(job))) return 0;
+  }
+  return 1;
+}
+
+int ConsumerHook(void *arg1, void * /*arg2*/) {
+  ThreadData *const data = static_cast<ThreadData *>(arg1);
+  TestJob job;
+  int last_id[kNumThreads];
+  for (int i = 0; i < kNumThreads; ++i) last_id[i] = -1;
+  while (!vp9_jobq_dequeue(data->jobq, &job, sizeof(job), 1)) {
+    if (job.producer < 0 || job.producer >= kNumThreads) return 0;
+    if (job.id < 0 || job.id >= kJobsPerProducer) return 0;
+    // Jobs from one producer are dequeued in order.
+    if (job.id <= last_id[job.producer]) return 0;
+    last_id[job.producer] = job.id;
+    ++data->counts[job.producer * kJobsPerProducer + job.id];
+  }
+  return 1;
+}
+
+TEST_F(JobQueueTest, ConcurrentProducersAndConsumers) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  Init(kNumThreads * kJobsPerProducer);
+
+  VPxWorker consumers[kNumThreads], producers[kNumThreads];
+  ThreadData consumer_data[kNumThreads], producer_data[kNumThreads];
+  for (int i = 0; i < kNumThreads; ++i) {
+    consumer_data[i].jobq = &jobq_;
+    consumer_data[i].counts.assign(kNumThreads * kJobsPerProducer, 0);
+    winterface->init(&consumers[i]);
+    ASSERT_NE(winterface->reset(&consumers[i]), 0);
+    consumers[i].hook = ConsumerHook;
+    consumers[i].data1 = &consumer_data[i];
+    winterface->launch(&consumers[i]);
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    producer_data[i].jobq = &jobq_;
+    producer_data[i].producer = i;
+    winterface->init(&producers[i]);
+    ASSERT_NE(winterface->reset(&producers[i]), 0);
+    producers[i].hook = ProducerHook;
+    producers[i].data1 = &producer_data[i];
+    winterface->launch(&producers[i]);
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_NE(winterface->sync(&producers[i]), 0);
+    winterface->end(&producers[i]);
+  }
+  vp9_jobq_terminate(&jobq_);
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_NE(winterface->sync(&consumers[i]), 0);
+    winterface->end(&consumers[i]);
+  }
+
+  for (int j = 0; j < kNumThreads * kJobsPerProducer; ++j) {
+    int count = 0;
+    for (int i = 0; i < kNumThreads; ++i) count += consumer_data[i].counts[j];
+    ASSERT_EQ(count, 1) << "job " << j;
+  }
+}
+#endif  // CONFIG_MULTITHREAD
+
+}  // namespace
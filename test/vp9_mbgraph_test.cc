@@ -0,0 +1,82 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/vp9_internal_encoder.h"
+#include "vp9/encoder/vp9_encoder.h"
+#include "vp9/encoder/vp9_mbgraph.h"
+
+namespace {
+
+const int kWidth = 352;
+const int kHeight = 288;
+const int kLag = 16;
+const int kEncodedFrames = 2;
+
+struct MbgraphResult {
+  int n_frames;
+  std::vector<MBGRAPH_MB_STATS> mb_stats;
+  std::vector<uint8_t> segmentation_map;
+  int static_mb_pct;
+};
+
+// The mbgraph analysis only runs in two pass encodes with the
+// static_segmentation speed feature, which no speed turns on, so the encoder
+// is driven through its internal API and the analysis is run once the key
+// frame and the first alt-ref are encoded, over the rest of the lookahead.
+void Analyze(int threads, MbgraphResult *result) {
+  ::libvpx_test::VP9InternalEncoder encoder;
+  ASSERT_NO_FATAL_FAILURE(encoder.Init(kWidth, kHeight, 500, kLag, threads));
+  VP9_COMP *const cpi = encoder.cpi();
+
+  int frames_out = 0;
+  while (frames_out < kEncodedFrames) {
+    bool encoded = false;
+    ASSERT_NO_FATAL_FAILURE(encoder.EncodeFrame(&encoded));
+    frames_out += encoded;
+  }
+
+  ASSERT_NO_FATAL_FAILURE(encoder.Run(vp9_update_mbgraph_stats));
+  const VP9_COMMON *const cm = &cpi->common;
+  result->n_frames = cpi->mbgraph_n_frames;
+  result->mb_stats.clear();
+  for (int i = 0; i < cpi->mbgraph_n_frames; ++i) {
+    const MBGRAPH_MB_STATS *const mb_stats = cpi->mbgraph_stats[i].mb_stats;
+    result->mb_stats.insert(result->mb_stats.end(), mb_stats,
+                            mb_stats + cm->MBs);
+  }
+  result->segmentation_map.assign(
+      cpi->segmentation_map,
+      cpi->segmentation_map + cm->mi_rows * cm->mi_cols);
+  result->static_mb_pct = cpi->static_mb_pct;
+}
+
+TEST(MbgraphTest, MatchesAcrossThreads) {
+  MbgraphResult ref;
+  ASSERT_NO_FATAL_FAILURE(Analyze(1, &ref));
+  ASSERT_GT(ref.n_frames, 0);
+
+  for (int threads = 2; threads <= 4; threads += 2) {
+    SCOPED_TRACE(threads);
+    MbgraphResult result;
+    ASSERT_NO_FATAL_FAILURE(Analyze(threads, &result));
+    ASSERT_EQ(ref.n_frames, result.n_frames);
+    ASSERT_EQ(ref.mb_stats.size(), result.mb_stats.size());
+    EXPECT_EQ(0, memcmp(&ref.mb_stats[0], &result.mb_stats[0],
+                        ref.mb_stats.size() * sizeof(ref.mb_stats[0])));
+    EXPECT_EQ(ref.segmentation_map, result.segmentation_map);
+    EXPECT_EQ(ref.static_mb_pct, result.static_mb_pct);
+  }
+}
+
+}  // namespace
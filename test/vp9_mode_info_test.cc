@@ -0,0 +1,249 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/decode_test_driver.h"
+#include "test/encode_test_driver.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vp8dx.h"
+#include "vpx/vpx_encoder.h"
+#include "vpx_ports/vpx_timer.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kMiRows = (kHeight + 7) / 8;
+const int kMiCols = (kWidth + 7) / 8;
+const int kFrames = 12;
+
+// Transcodes a high rate encode of the source to a lower rate, once with a
+// full search and once from the mode info of the decoded high rate frames.
+class ModeInfoTranscodeTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWith2Params<libvpx_test::TestMode, int> {
+ protected:
+  ModeInfoTranscodeTest()
+      : EncoderTest(GET_PARAM(0)), encoding_mode_(GET_PARAM(1)),
+        speed_(GET_PARAM(2)) {}
+
+  ~ModeInfoTranscodeTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(encoding_mode_);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.rc_end_usage = VPX_VBR;
+    init_flags_ = VPX_CODEC_USE_PSNR;
+  }
+
+  void BeginPassHook(unsigned int /*pass*/) override {
+    frames_ = 0;
+    psnr_ = 0.0;
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) encoder->Control(VP8E_SET_CPUUSED, speed_);
+    // The hook is also called when flushing, after the last frame.
+    if (use_mode_info_ && video->img() != nullptr) {
+      ASSERT_LT(video->frame(), mode_info_.size());
+      vpx_mode_info_map_t map;
+      map.info = &mode_info_[video->frame()][0];
+      map.rows = kMiRows;
+      map.cols = kMiCols;
+      encoder->Control(VP9E_SET_MODE_INFO, &map);
+    }
+  }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    ++frames_;
+    if (source_decoder_ == nullptr) return;
+
+    ASSERT_EQ(VPX_CODEC_OK,
+              source_decoder_->DecodeFrame(
+                  static_cast<const uint8_t *>(pkt->data.frame.buf),
+                  pkt->data.frame.sz));
+    ::libvpx_test::DxDataIterator dec_iter = source_decoder_->GetDxData();
+    while (dec_iter.Next() != nullptr) {
+    }
+    std::vector<vpx_mode_info_t> info(kMiRows * kMiCols);
+    vpx_mode_info_map_t map;
+    map.info = &info[0];
+    map.rows = kMiRows;
+    map.cols = kMiCols;
+    source_decoder_->Control(VP9D_GET_MODE_INFO, &map);
+    mode_info_.push_back(info);
+  }
+
+  void PSNRPktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    psnr_ += pkt->data.psnr.psnr[0];
+  }
+
+  // Encodes the source at 'bitrate' and keeps the encode time in encode_us_.
+  void Encode(unsigned int bitrate) {
+    cfg_.rc_target_bitrate = bitrate;
+    ::libvpx_test::MovingPatternVideoSource video;
+    video.SetSize(kWidth, kHeight);
+    video.set_limit(kFrames);
+    vpx_usec_timer timer;
+    vpx_usec_timer_start(&timer);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+    vpx_usec_timer_mark(&timer);
+    encode_us_ = vpx_usec_timer_elapsed(&timer);
+  }
+
+  void EncodeSource() {
+    const vpx_codec_dec_cfg_t dec_cfg = vpx_codec_dec_cfg_t();
+    source_decoder_.reset(codec_->CreateDecoder(dec_cfg, 0));
+    mode_info_.clear();
+    use_mode_info_ = false;
+    ASSERT_NO_FATAL_FAILURE(Encode(1500));
+    source_decoder_.reset();
+  }
+
+  const libvpx_test::TestMode encoding_mode_;
+  const int speed_;
+  std::unique_ptr<libvpx_test::Decoder> source_decoder_;
+  std::vector<std::vector<vpx_mode_info_t> > mode_info_;
+  bool use_mode_info_;
+  int frames_;
+  double psnr_;
+  int64_t encode_us_;
+};
+
+TEST_P(ModeInfoTranscodeTest, ExportsModeInfo) {
+  ASSERT_NO_FATAL_FAILURE(EncodeSource());
+  ASSERT_EQ(static_cast<size_t>(kFrames), mode_info_.size());
+
+  for (int frame = 0; frame < kFrames; ++frame) {
+    int inter = 0;
+    for (const vpx_mode_info_t &info : mode_info_[frame]) {
+      EXPECT_GE(info.block_width, 4);
+      EXPECT_LE(info.block_width, 64);
+      EXPECT_GE(info.block_height, 4);
+      EXPECT_LE(info.block_height, 64);
+      EXPECT_GE(info.ref_frame[0], 0);
+      EXPECT_LE(info.ref_frame[0], 3);
+      inter += info.ref_frame[0] > 0;
+    }
+    // The first frame is a key frame and most of the others move the pattern.
+    if (frame == 0) {
+      EXPECT_EQ(0, inter);
+    } else {
+      EXPECT_GT(inter, kMiRows * kMiCols / 2) << "frame " << frame;
+    }
+  }
+}
+
+TEST_P(ModeInfoTranscodeTest, TranscodesFromModeInfo) {
+  ASSERT_NO_FATAL_FAILURE(EncodeSource());
+  ASSERT_EQ(static_cast<size_t>(kFrames), mode_info_.size());
+
+  use_mode_info_ = false;
+  ASSERT_NO_FATAL_FAILURE(Encode(400));
+  ASSERT_EQ(kFrames, frames_);
+  const double full_psnr = psnr_ / frames_;
+
+  use_mode_info_ = true;
+  ASSERT_NO_FATAL_FAILURE(Encode(400));
+  ASSERT_EQ(kFrames, frames_);
+  EXPECT_GT(psnr_ / frames_, full_psnr - 1.0);
+}
+
+TEST_P(ModeInfoTranscodeTest, NoModeInfoForExistingFrame) {
+  const vpx_codec_dec_cfg_t dec_cfg = vpx_codec_dec_cfg_t();
+  source_decoder_.reset(codec_->CreateDecoder(dec_cfg, 0));
+  use_mode_info_ = false;
+  ASSERT_NO_FATAL_FAILURE(Encode(1500));
+
+  // Frame marker, profile 0, show_existing_frame of reference slot 0.
+  const uint8_t show_existing_frame = 0x88;
+  ASSERT_EQ(VPX_CODEC_OK,
+            source_decoder_->DecodeFrame(&show_existing_frame, 1));
+  ::libvpx_test::DxDataIterator dec_iter = source_decoder_->GetDxData();
+  EXPECT_NE(dec_iter.Next(), nullptr);
+
+  std::vector<vpx_mode_info_t> info(kMiRows * kMiCols);
+  vpx_mode_info_map_t map;
+  map.info = &info[0];
+  map.rows = kMiRows;
+  map.cols = kMiCols;
+  EXPECT_EQ(VPX_CODEC_ERROR, vpx_codec_control(source_decoder_->GetDecoder(),
+                                               VP9D_GET_MODE_INFO, &map));
+  source_decoder_.reset();
+}
+
+TEST_P(ModeInfoTranscodeTest, DISABLED_Speed) {
+  ASSERT_NO_FATAL_FAILURE(EncodeSource());
+
+  use_mode_info_ = false;
+  ASSERT_NO_FATAL_FAILURE(Encode(400));
+  const int64_t full_us = encode_us_;
+  const double full_psnr = psnr_ / frames_;
+
+  use_mode_info_ = true;
+  ASSERT_NO_FATAL_FAILURE(Encode(400));
+  const int64_t mode_info_us = encode_us_;
+  const double mode_info_psnr = psnr_ / frames_;
+
+  printf("Full search: %.2f dB in %d us, from mode info: %.2f dB in %d us\n",
+         full_psnr, static_cast<int>(full_us), mode_info_psnr,
+         static_cast<int>(mode_info_us));
+  EXPECT_LT(mode_info_us, full_us);
+}
+
+TEST(ModeInfoControlTest, RejectsMismatchedMaps) {
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_config_default(vpx_codec_vp9_cx(), &cfg, 0));
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_lag_in_frames = 0;
+
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_init(&enc, vpx_codec_vp9_cx(), &cfg, 0));
+
+  std::vector<vpx_mode_info_t> info(kMiRows * kMiCols);
+  vpx_mode_info_map_t map;
+  map.info = &info[0];
+  map.rows = kMiRows;
+  map.cols = kMiCols - 1;
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_MODE_INFO, &map));
+
+  map.cols = kMiCols;
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP9E_SET_MODE_INFO, &map));
+
+  // A map without info clears the previous one.
+  map.info = nullptr;
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP9E_SET_MODE_INFO, &map));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+
+  // The decoder has no mode info before the first frame.
+  vpx_codec_ctx_t dec;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_dec_init(&dec, vpx_codec_vp9_dx(), nullptr, 0));
+  map.info = &info[0];
+  EXPECT_NE(VPX_CODEC_OK, vpx_codec_control(&dec, VP9D_GET_MODE_INFO, &map));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&dec));
+}
+
+VP9_INSTANTIATE_TEST_SUITE(ModeInfoTranscodeTest, ONE_PASS_TEST_MODES,
+                           ::testing::Values(2, 6));
+}  // namespace
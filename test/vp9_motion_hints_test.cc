@@ -0,0 +1,194 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kFrames = 12;
+
+class MotionHintsTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWith2Params<int, int> {
+ protected:
+  MotionHintsTest()
+      : EncoderTest(GET_PARAM(0)), speed_(GET_PARAM(1)),
+        block_size_(GET_PARAM(2)),
+        hint_mv_row_(::libvpx_test::kPatternMvRow * 8),
+        hint_mv_col_(::libvpx_test::kPatternMvCol * 8) {}
+
+  ~MotionHintsTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kRealTime);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.rc_end_usage = VPX_CBR;
+    cfg_.rc_target_bitrate = 300;
+  }
+
+  void BeginPassHook(unsigned int /*pass*/) override {
+    frames_ = 0;
+    psnr_ = 0.0;
+    md5_.clear();
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) encoder->Control(VP8E_SET_CPUUSED, speed_);
+    if (use_hints_) encoder->Control(VP9E_SET_MOTION_HINTS, &map_);
+  }
+
+  void FramePktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    ++frames_;
+    ::libvpx_test::MD5 md5;
+    md5.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+            pkt->data.frame.sz);
+    md5_.push_back(md5.Get());
+  }
+
+  void PSNRPktHook(const vpx_codec_cx_pkt_t *pkt) override {
+    psnr_ += pkt->data.psnr.psnr[0];
+  }
+
+  void Encode(bool use_hints, int refine_only) {
+    const unsigned int shift = block_size_ == 16 ? 4 : 3;
+    hints_.assign(((kHeight + block_size_ - 1) >> shift) *
+                      ((kWidth + block_size_ - 1) >> shift),
+                  vpx_motion_hint_t());
+    for (vpx_motion_hint_t &hint : hints_) {
+      hint.mv_row = hint_mv_row_;
+      hint.mv_col = hint_mv_col_;
+      hint.ref_frame = 1;
+    }
+    map_.hints = &hints_[0];
+    map_.rows = (kHeight + block_size_ - 1) >> shift;
+    map_.cols = (kWidth + block_size_ - 1) >> shift;
+    map_.block_size = block_size_;
+    map_.refine_only = refine_only;
+    use_hints_ = use_hints;
+
+    init_flags_ = VPX_CODEC_USE_PSNR;
+    ::libvpx_test::MovingPatternVideoSource video;
+    video.SetSize(kWidth, kHeight);
+    video.set_limit(kFrames);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  }
+
+  const int speed_;
+  const int block_size_;
+  // The hinted motion, in 1/8 pixel units.
+  int hint_mv_row_;
+  int hint_mv_col_;
+  std::vector<vpx_motion_hint_t> hints_;
+  vpx_motion_hint_map_t map_;
+  bool use_hints_;
+  int frames_;
+  double psnr_;
+  std::vector<std::string> md5_;
+};
+
+TEST_P(MotionHintsTest, SeedsSearch) {
+  ASSERT_NO_FATAL_FAILURE(Encode(false, 0));
+  ASSERT_EQ(kFrames, frames_);
+  const double psnr = psnr_ / frames_;
+
+  ASSERT_NO_FATAL_FAILURE(Encode(true, 0));
+  ASSERT_EQ(kFrames, frames_);
+  EXPECT_GT(psnr_ / frames_, psnr - 0.5);
+}
+
+TEST_P(MotionHintsTest, RefinesHints) {
+  ASSERT_NO_FATAL_FAILURE(Encode(false, 0));
+  ASSERT_EQ(kFrames, frames_);
+  const double psnr = psnr_ / frames_;
+
+  // The hints are exact, so restricting the search to them is no worse.
+  ASSERT_NO_FATAL_FAILURE(Encode(true, 1));
+  ASSERT_EQ(kFrames, frames_);
+  EXPECT_GT(psnr_ / frames_, psnr - 0.5);
+}
+
+TEST_P(MotionHintsTest, FollowsHints) {
+  ASSERT_NO_FATAL_FAILURE(Encode(true, 1));
+  ASSERT_EQ(kFrames, frames_);
+  const std::vector<std::string> exact_md5 = md5_;
+
+  // Hints against the motion of the pattern, with the search restricted to
+  // them, give another encode.
+  hint_mv_row_ = -hint_mv_row_;
+  hint_mv_col_ = -hint_mv_col_;
+  ASSERT_NO_FATAL_FAILURE(Encode(true, 1));
+  ASSERT_EQ(kFrames, frames_);
+  EXPECT_NE(exact_md5, md5_);
+}
+
+TEST(MotionHintsControlTest, RejectsMismatchedMaps) {
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_config_default(vpx_codec_vp9_cx(), &cfg, 0));
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_lag_in_frames = 0;
+
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_init(&enc, vpx_codec_vp9_cx(), &cfg, 0));
+
+  std::vector<vpx_motion_hint_t> hints(
+      ((kHeight + 7) / 8) * ((kWidth + 7) / 8), vpx_motion_hint_t());
+  vpx_motion_hint_map_t map;
+  map.hints = &hints[0];
+  map.rows = (kHeight + 7) / 8;
+  map.cols = (kWidth + 7) / 8;
+  map.block_size = 8;
+  map.refine_only = 0;
+  EXPECT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS, &map));
+
+  map.block_size = 32;
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS, &map));
+
+  map.block_size = 16;
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS, &map));
+
+  map.rows = (kHeight + 15) / 16;
+  map.cols = (kWidth + 15) / 16;
+  EXPECT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS, &map));
+
+  // A map without hints clears the previous one.
+  map.hints = nullptr;
+  EXPECT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS, &map));
+
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_MOTION_HINTS,
+                              static_cast<vpx_motion_hint_map_t *>(nullptr)));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+VP9_INSTANTIATE_TEST_SUITE(MotionHintsTest, ::testing::Values(5, 7, 8),
+                           ::testing::Values(8, 16));
+}  // namespace
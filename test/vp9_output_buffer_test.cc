@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kFrames = 20;
+
+// Output buffers handed out to the encoder, and the ones it returned unused.
+struct OutputBufferPool {
+  std::vector<std::unique_ptr<std::vector<uint8_t> > > buffers;
+  std::set<const void *> released;
+  size_t min_size = 0;
+};
+
+int GetOutputBuffer(void *cb_priv, size_t min_size, vpx_fixed_buf_t *buf) {
+  OutputBufferPool *const pool = static_cast<OutputBufferPool *>(cb_priv);
+  pool->min_size = min_size;
+  pool->buffers.emplace_back(new std::vector<uint8_t>(min_size));
+  buf->buf = &(*pool->buffers.back())[0];
+  buf->sz = min_size;
+  return 0;
+}
+
+void ReleaseOutputBuffer(void *cb_priv, vpx_fixed_buf_t *buf) {
+  OutputBufferPool *const pool = static_cast<OutputBufferPool *>(cb_priv);
+  EXPECT_TRUE(pool->released.insert(buf->buf).second);
+}
+
+int FailOutputBuffer(void * /*cb_priv*/, size_t /*min_size*/,
+                     vpx_fixed_buf_t * /*buf*/) {
+  return -1;
+}
+
+// Encodes with lag 0 or 10, the latter producing superframes with hidden
+// alt-ref frames.
+class OutputBufferTest : public ::testing::TestWithParam<int> {
+ protected:
+  void AddPackets(vpx_codec_ctx_t *enc, bool check_buffers) {
+    vpx_codec_iter_t iter = nullptr;
+    const vpx_codec_cx_pkt_t *pkt;
+    while ((pkt = vpx_codec_get_cx_data(enc, &iter)) != nullptr) {
+      if (pkt->kind != VPX_CODEC_CX_FRAME_PKT) continue;
+      ::libvpx_test::MD5 md5;
+      md5.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+              pkt->data.frame.sz);
+      frames_.push_back(md5.Get());
+      if (check_buffers) {
+        // Every packet starts a buffer of its own.
+        EXPECT_TRUE(packet_bufs_.insert(pkt->data.frame.buf).second);
+        EXPECT_LE(pkt->data.frame.sz, pool_.min_size);
+      }
+    }
+  }
+
+  std::vector<std::string> Encode(bool use_output_buffers) {
+    vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+    vpx_codec_enc_cfg_t cfg;
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+    cfg.g_w = kWidth;
+    cfg.g_h = kHeight;
+    cfg.g_lag_in_frames = GetParam();
+    cfg.rc_target_bitrate = 300;
+    vpx_codec_ctx_t enc;
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP8E_SET_CPUUSED, 4));
+    vpx_output_buffers_t output_buffers = { GetOutputBuffer,
+                                            ReleaseOutputBuffer, &pool_ };
+    if (use_output_buffers) {
+      EXPECT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP9E_SET_OUTPUT_BUFFERS,
+                                                &output_buffers));
+    }
+
+    frames_.clear();
+    vpx_image_t img;
+    EXPECT_NE(vpx_img_alloc(&img, VPX_IMG_FMT_I420, kWidth, kHeight, 1),
+              nullptr);
+    for (int frame = 0; frame < kFrames; ++frame) {
+      ::libvpx_test::FillMovingPattern(&img, frame);
+      EXPECT_EQ(VPX_CODEC_OK, vpx_codec_encode(&enc, &img, frame, 1, 0,
+                                               VPX_DL_GOOD_QUALITY));
+      AddPackets(&enc, use_output_buffers);
+    }
+    vpx_img_free(&img);
+    for (;;) {
+      const size_t num_frames = frames_.size();
+      EXPECT_EQ(VPX_CODEC_OK,
+                vpx_codec_encode(&enc, nullptr, 0, 1, 0, VPX_DL_GOOD_QUALITY));
+      AddPackets(&enc, use_output_buffers);
+      if (frames_.size() == num_frames) break;
+    }
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+    return frames_;
+  }
+
+  OutputBufferPool pool_;
+  std::set<const void *> packet_bufs_;
+  std::vector<std::string> frames_;
+};
+
+TEST_P(OutputBufferTest, MatchesInternalStorage) {
+  const std::vector<std::string> internal = Encode(false);
+  ASSERT_EQ(static_cast<size_t>(kFrames), internal.size());
+  EXPECT_EQ(internal, Encode(true));
+
+  // Every buffer is either handed out with a packet or released.
+  EXPECT_EQ(pool_.buffers.size(), packet_bufs_.size() + pool_.released.size());
+  for (const void *buf : pool_.released) {
+    EXPECT_EQ(packet_bufs_.end(), packet_bufs_.find(buf));
+  }
+}
+
+TEST(OutputBufferControlTest, ReportsFailedBuffer) {
+  vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+
+  // A release callback is required.
+  vpx_output_buffers_t output_buffers = { FailOutputBuffer, nullptr, nullptr };
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_OUTPUT_BUFFERS, &output_buffers));
+  output_buffers.release_cb = ReleaseOutputBuffer;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_control(&enc, VP9E_SET_OUTPUT_BUFFERS, &output_buffers));
+
+  vpx_image_t img;
+  ASSERT_NE(vpx_img_alloc(&img, VPX_IMG_FMT_I420, kWidth, kHeight, 1),
+            nullptr);
+  ::libvpx_test::FillMovingPattern(&img, 0);
+  EXPECT_EQ(VPX_CODEC_MEM_ERROR,
+            vpx_codec_encode(&enc, &img, 0, 1, 0, VPX_DL_GOOD_QUALITY));
+  vpx_img_free(&img);
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+INSTANTIATE_TEST_SUITE_P(VP9, OutputBufferTest, ::testing::Values(0, 10));
+}  // namespace
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "./vpx_scale_rtcd.h"
+#include "test/vp9_internal_encoder.h"
+#include "vp9/encoder/vp9_encoder.h"
+#include "vp9/encoder/vp9_picklpf.h"
+
+namespace {
+
+const int kWidth = 176;
+const int kHeight = 144;
+const int kThreads = 4;
+const int kFrames = 4;
+
+// Picks the filter level of the last encoded frame with the serial search on
+// a single thread and with the parallel search on all the encoder workers.
+void PickLevels(VP9_COMP *cpi, int early_stop, int *serial, int *parallel) {
+  VP9_COMMON *const cm = &cpi->common;
+  struct loopfilter *const lf = &cm->lf;
+  const int num_workers = cpi->num_workers;
+  const int last_filt_level = lf->last_filt_level;
+  cpi->sf.lpf_pick_early_stop = early_stop;
+
+  // The search starts from the unfiltered frame, which the encoder kept, and
+  // builds the masks from the mode info of the frame, which the encoder moved
+  // to prev_mi_grid_visible once done.
+  MODE_INFO **const mi_grid_visible = cm->mi_grid_visible;
+  cm->mi_grid_visible = cm->prev_mi_grid_visible;
+  vpx_yv12_copy_y(&cpi->last_frame_uf, cm->frame_to_show);
+
+  cpi->sf.lpf_pick_parallel = 0;
+  cpi->num_workers = 1;
+  vp9_pick_filter_level(cpi->Source, cpi, LPF_PICK_FROM_FULL_IMAGE);
+  *serial = lf->filter_level;
+
+  cpi->sf.lpf_pick_parallel = 1;
+  cpi->num_workers = num_workers;
+  lf->last_filt_level = last_filt_level;
+  vp9_pick_filter_level(cpi->Source, cpi, LPF_PICK_FROM_FULL_IMAGE);
+  *parallel = lf->filter_level;
+  cm->mi_grid_visible = mi_grid_visible;
+}
+
+TEST(PickLpfTest, ParallelMatchesSerial) {
+  ::libvpx_test::VP9InternalEncoder encoder;
+  ASSERT_NO_FATAL_FAILURE(encoder.Init(kWidth, kHeight, 300, 0, kThreads));
+  VP9_COMP *const cpi = encoder.cpi();
+
+  for (int frame = 0; frame < kFrames; ++frame) {
+    SCOPED_TRACE(frame);
+    bool encoded = false;
+    ASSERT_NO_FATAL_FAILURE(encoder.EncodeFrame(&encoded));
+    ASSERT_TRUE(encoded);
+    ASSERT_EQ(kThreads, cpi->num_workers);
+
+    for (int early_stop = 0; early_stop <= 1; ++early_stop) {
+      SCOPED_TRACE(early_stop);
+      int serial = 0, parallel = 0;
+      ASSERT_NO_FATAL_FAILURE(encoder.Run([&](VP9_COMP * /*cpi*/) {
+        PickLevels(cpi, early_stop, &serial, &parallel);
+      }));
+      EXPECT_EQ(serial, parallel);
+    }
+  }
+}
+
+}  // namespace
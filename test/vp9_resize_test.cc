@@ -0,0 +1,258 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "test/acm_random.h"
+#include "test/clear_system_state.h"
+#include "test/md5_helper.h"
+#include "test/register_state_check.h"
+#include "test/util.h"
+#include "vp9/encoder/vp9_resize.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+using libvpx_test::ACMRandom;
+
+namespace {
+
+const int kNumIterations = 1000;
+const int kMaxWidth = 160;
+const int kTaps = 8;
+
+typedef void (*ResizeVertFunc)(const uint8_t *const *src,
+                               const int16_t *filter, uint8_t *dst, int w);
+
+// Random taps in the range of the resize filters, with a sum that does not
+// exceed the 128 of the real ones by much.
+void RandomFilter(ACMRandom *rnd, int16_t *filter) {
+  for (int k = 0; k < kTaps; ++k) {
+    filter[k] = static_cast<int16_t>(rnd->Rand8() % 48) - 16;
+  }
+  filter[3 + (rnd->Rand8() & 1)] += 64;
+}
+
+class ResizeVert8tapTest : public ::testing::TestWithParam<ResizeVertFunc> {
+ public:
+  ~ResizeVert8tapTest() override = default;
+  void SetUp() override { func_ = GetParam(); }
+  void TearDown() override { libvpx_test::ClearSystemState(); }
+
+ protected:
+  ResizeVertFunc func_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ResizeVert8tapTest);
+
+TEST_P(ResizeVert8tapTest, MatchesC) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  DECLARE_ALIGNED(16, uint8_t, src[kTaps][kMaxWidth]);
+  DECLARE_ALIGNED(16, uint8_t, dst_ref[kMaxWidth]);
+  DECLARE_ALIGNED(16, uint8_t, dst[kMaxWidth]);
+  int16_t filter[kTaps];
+  const uint8_t *rows[kTaps];
+
+  for (int i = 0; i < kNumIterations; ++i) {
+    const int w = 1 + rnd.PseudoUniform(kMaxWidth);
+    const int extreme = i & 1;
+    RandomFilter(&rnd, filter);
+    for (int k = 0; k < kTaps; ++k) {
+      for (int x = 0; x < kMaxWidth; ++x) {
+        src[k][x] = extreme ? rnd.Rand8Extremes() : rnd.Rand8();
+      }
+      // Rows may repeat at the frame edges.
+      rows[k] = (rnd.Rand8() & 7) ? src[k] : src[0];
+    }
+    memset(dst_ref, 0, sizeof(dst_ref));
+    memset(dst, 0, sizeof(dst));
+
+    vp9_resize_vert_8tap_c(rows, filter, dst_ref, w);
+    ASM_REGISTER_STATE_CHECK(func_(rows, filter, dst, w));
+
+    for (int x = 0; x < kMaxWidth; ++x) {
+      ASSERT_EQ(dst_ref[x], dst[x]) << "w == " << w << ", x == " << x;
+    }
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(SSE2, ResizeVert8tapTest,
+                         ::testing::Values(&vp9_resize_vert_8tap_sse2));
+#endif  // HAVE_SSE2
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, ResizeVert8tapTest,
+                         ::testing::Values(&vp9_resize_vert_8tap_avx2));
+#endif  // HAVE_AVX2
+
+#if CONFIG_VP9_HIGHBITDEPTH
+typedef void (*HighbdResizeVertFunc)(const uint16_t *const *src,
+                                     const int16_t *filter, uint16_t *dst,
+                                     int w, int bd);
+
+typedef std::tuple<HighbdResizeVertFunc, int> HighbdResizeVertParam;
+
+class HighbdResizeVert8tapTest
+    : public ::testing::TestWithParam<HighbdResizeVertParam> {
+ public:
+  ~HighbdResizeVert8tapTest() override = default;
+  void SetUp() override {
+    func_ = GET_PARAM(0);
+    bd_ = GET_PARAM(1);
+  }
+  void TearDown() override { libvpx_test::ClearSystemState(); }
+
+ protected:
+  HighbdResizeVertFunc func_;
+  int bd_;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(HighbdResizeVert8tapTest);
+
+TEST_P(HighbdResizeVert8tapTest, MatchesC) {
+  ACMRandom rnd(ACMRandom::DeterministicSeed());
+  DECLARE_ALIGNED(16, uint16_t, src[kTaps][kMaxWidth]);
+  DECLARE_ALIGNED(16, uint16_t, dst_ref[kMaxWidth]);
+  DECLARE_ALIGNED(16, uint16_t, dst[kMaxWidth]);
+  const int mask = (1 << bd_) - 1;
+  int16_t filter[kTaps];
+  const uint16_t *rows[kTaps];
+
+  for (int i = 0; i < kNumIterations; ++i) {
+    const int w = 1 + rnd.PseudoUniform(kMaxWidth);
+    const int extreme = i & 1;
+    RandomFilter(&rnd, filter);
+    for (int k = 0; k < kTaps; ++k) {
+      for (int x = 0; x < kMaxWidth; ++x) {
+        src[k][x] = extreme ? ((rnd.Rand8() & 1) ? mask : 0)
+                            : (rnd.Rand16() & mask);
+      }
+      rows[k] = (rnd.Rand8() & 7) ? src[k] : src[0];
+    }
+    memset(dst_ref, 0, sizeof(dst_ref));
+    memset(dst, 0, sizeof(dst));
+
+    vp9_highbd_resize_vert_8tap_c(rows, filter, dst_ref, w, bd_);
+    ASM_REGISTER_STATE_CHECK(func_(rows, filter, dst, w, bd_));
+
+    for (int x = 0; x < kMaxWidth; ++x) {
+      ASSERT_EQ(dst_ref[x], dst[x]) << "w == " << w << ", x == " << x;
+    }
+  }
+}
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, HighbdResizeVert8tapTest,
+    ::testing::Combine(::testing::Values(&vp9_highbd_resize_vert_8tap_sse2),
+                       ::testing::Values(8, 10, 12)));
+#endif  // HAVE_SSE2
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, HighbdResizeVert8tapTest,
+    ::testing::Combine(::testing::Values(&vp9_highbd_resize_vert_8tap_avx2),
+                       ::testing::Values(8, 10, 12)));
+#endif  // HAVE_AVX2
+#endif  // CONFIG_VP9_HIGHBITDEPTH
+
+// Odd sizes and ratios for the whole plane resizer. The MD5s are those of the
+// per-column vertical pass the blocked one replaced.
+struct ResizePlaneParam {
+  int width;
+  int height;
+  int width2;
+  int height2;
+  const char *md5;
+  const char *highbd_md5[3];
+};
+
+const ResizePlaneParam kResizePlaneParams[] = {
+  { 352, 288, 176, 144, "89015a5371e4941b553cf693963088e4",
+    { "9ddeccdcd051e98af56d8cc3cb4f2c1c", "32882a14eb1ca47c9ab5cdc72ba1a098",
+      "99be79ef1d6a2ddf17b17b5340d3960c" } },
+  { 353, 289, 177, 145, "178876767d1255edaec0e07530237f53",
+    { "c0e935d4ae0e4eb3a84c1efce5c65553", "df642b528466fd23418f41b7495f82dc",
+      "5e1b781463b6036ce336f375f3d88c87" } },
+  { 317, 211, 211, 141, "af33c36ade97c5893cc036d4db4708fd",
+    { "2887036377e22eeef7db0ac6cf7806e1", "edd21dd08ca4a9c7da63ce98d660ef89",
+      "d01e6d413f0345400309a89e1378cc98" } },
+  { 97, 61, 131, 83, "d2d4df5093192a9892af0eba736bf65b",
+    { "bb4fd6b834555f45621868de40784bd0", "7b1e1e8b35031bd6f81d9c414cf7b52f",
+      "5483c9b1ea4d797fc012b062cccfe00e" } },
+  { 161, 91, 40, 23, "bb67ebe4fd6ee2235bbcbd44feccf660",
+    { "f16a61fe243fbca76840feb1d8db8cb2", "ddc2ef3f1f53a71a71da9f38183358c5",
+      "767411e9f1fdb9469151ebd353b896c0" } },
+  { 65, 67, 37, 23, "10efc60386e08965d72b14ffdeab6521",
+    { "2236a2efe11d0c2d8136e71d90c4f725", "28a5e64e3e73a30adb453c3670376694",
+      "7cd84e09e6205fd8901e8908437a1c23" } },
+  { 33, 17, 16, 9, "9f2cc763371b2920452a5fdca9abd9e5",
+    { "c4252d8dd85e5de39e1da274378688eb", "091ca38dd5ff579dbabb9c8ebd5df591",
+      "764188a8280e8b11c5e1e9f507e90022" } },
+};
+
+TEST(ResizePlaneTest, MatchesColumnResize) {
+  for (const ResizePlaneParam &p : kResizePlaneParams) {
+    ACMRandom rnd(ACMRandom::DeterministicSeed());
+    const int in_stride = p.width + 5;
+    const int out_stride = p.width2 + 3;
+    std::vector<uint8_t> input(in_stride * p.height);
+    std::vector<uint8_t> output(out_stride * p.height2);
+    for (uint8_t &v : input) v = rnd.Rand8();
+
+    vp9_resize_plane(&input[0], p.height, p.width, in_stride, &output[0],
+                     p.height2, p.width2, out_stride);
+
+    libvpx_test::MD5 md5;
+    for (int r = 0; r < p.height2; ++r) {
+      md5.Add(&output[r * out_stride], p.width2);
+    }
+    EXPECT_STREQ(p.md5, md5.Get())
+        << p.width << "x" << p.height << " -> " << p.width2 << "x"
+        << p.height2;
+  }
+}
+
+#if CONFIG_VP9_HIGHBITDEPTH
+TEST(ResizePlaneTest, HighbdMatchesColumnResize) {
+  const int kBitDepths[] = { 8, 10, 12 };
+  for (const ResizePlaneParam &p : kResizePlaneParams) {
+    for (int i = 0; i < 3; ++i) {
+      const int bd = kBitDepths[i];
+      ACMRandom rnd(ACMRandom::DeterministicSeed());
+      const int in_stride = p.width + 5;
+      const int out_stride = p.width2 + 3;
+      std::vector<uint16_t> input(in_stride * p.height);
+      std::vector<uint16_t> output(out_stride * p.height2);
+      for (uint16_t &v : input) v = rnd.Rand16() & ((1 << bd) - 1);
+
+      vp9_highbd_resize_plane(CONVERT_TO_BYTEPTR(&input[0]), p.height,
+                              p.width, in_stride,
+                              CONVERT_TO_BYTEPTR(&output[0]), p.height2,
+                              p.width2, out_stride, bd);
+
+      libvpx_test::MD5 md5;
+      for (int r = 0; r < p.height2; ++r) {
+        md5.Add(reinterpret_cast<const uint8_t *>(&output[r * out_stride]),
+                p.width2 * sizeof(output[0]));
+      }
+      EXPECT_STREQ(p.highbd_md5[i], md5.Get())
+          << p.width << "x" << p.height << " -> " << p.width2 << "x"
+          << p.height2 << ", bd " << bd;
+    }
+  }
+}
+#endif  // CONFIG_VP9_HIGHBITDEPTH
+
+}  // namespace
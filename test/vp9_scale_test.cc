@@ -206,6 +206,11 @@ INSTANTIATE_TEST_SUITE_P(SSSE3, ScaleTest,
                          ::testing::Values(vp9_scale_and_extend_frame_ssse3));
 #endif  // HAVE_SSSE3
 
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(AVX2, ScaleTest,
+                         ::testing::Values(vp9_scale_and_extend_frame_avx2));
+#endif  // HAVE_AVX2
+
 #if HAVE_NEON
 INSTANTIATE_TEST_SUITE_P(NEON, ScaleTest,
                          ::testing::Values(vp9_scale_and_extend_frame_neon));
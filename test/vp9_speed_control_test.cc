@@ -0,0 +1,219 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "./vpx_config.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/moving_pattern_video_source.h"
+#include "test/util.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+#include "vp9/encoder/vp9_encoder.h"
+
+namespace {
+
+const int kBudgetUs = 10000;
+
+class SpeedControlTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    memset(&sc_, 0, sizeof(sc_));
+    vp9_speed_control_configure(&sc_, kBudgetUs, 5);
+  }
+
+  // Encodes 'frames' inter frames that each take 'us'.
+  void Frames(int frames, int64_t us) {
+    for (int i = 0; i < frames; ++i) vp9_speed_control_update(&sc_, us, 0);
+  }
+
+  SPEED_CONTROL sc_;
+};
+
+TEST_F(SpeedControlTest, SpeedsUpOverBudget) {
+  Frames(1, 2 * kBudgetUs);
+  EXPECT_EQ(5, sc_.speed);
+  Frames(1, 2 * kBudgetUs);
+  EXPECT_EQ(6, sc_.speed);
+  Frames(100, 2 * kBudgetUs);
+  EXPECT_EQ(9, sc_.speed);
+  EXPECT_EQ(4u, sc_.speed_changes);
+  EXPECT_EQ(102u, sc_.frames_over_budget);
+}
+
+TEST_F(SpeedControlTest, IgnoresIntraOnlyFrames) {
+  for (int i = 0; i < 10; ++i) {
+    vp9_speed_control_update(&sc_, 10 * kBudgetUs, 1);
+  }
+  EXPECT_EQ(5, sc_.speed);
+  EXPECT_EQ(10u, sc_.frames);
+  EXPECT_EQ(10u, sc_.frames_over_budget);
+}
+
+TEST_F(SpeedControlTest, SlowsDownWithHysteresis) {
+  Frames(4, 2 * kBudgetUs);
+  ASSERT_EQ(7, sc_.speed);
+
+  // Well under the budget, the speed goes back one step after a while.
+  Frames(15, kBudgetUs / 2);
+  EXPECT_EQ(7, sc_.speed);
+  Frames(1, kBudgetUs / 2);
+  EXPECT_EQ(6, sc_.speed);
+
+  // Just under the budget is not enough to go back.
+  Frames(100, kBudgetUs * 9 / 10);
+  EXPECT_EQ(6, sc_.speed);
+
+  // The configured speed is the slowest.
+  Frames(100, kBudgetUs / 2);
+  EXPECT_EQ(5, sc_.speed);
+  EXPECT_EQ(4u, sc_.speed_changes);
+}
+
+TEST_F(SpeedControlTest, BacksOffAfterFailedSlowDown) {
+  Frames(2, 2 * kBudgetUs);
+  ASSERT_EQ(6, sc_.speed);
+  Frames(16, kBudgetUs / 2);
+  ASSERT_EQ(5, sc_.speed);
+
+  // Speed 5 is too slow after all: the next slow down waits twice as long.
+  Frames(2, 2 * kBudgetUs);
+  ASSERT_EQ(6, sc_.speed);
+  Frames(31, kBudgetUs / 2);
+  EXPECT_EQ(6, sc_.speed);
+  Frames(1, kBudgetUs / 2);
+  EXPECT_EQ(5, sc_.speed);
+}
+
+TEST_F(SpeedControlTest, ConfigureKeepsStateForSameBudget) {
+  Frames(4, 2 * kBudgetUs);
+  ASSERT_EQ(7, sc_.speed);
+
+  // A new configured speed moves the floor but keeps the adapted speed.
+  vp9_speed_control_configure(&sc_, kBudgetUs, 6);
+  EXPECT_EQ(7, sc_.speed);
+  vp9_speed_control_configure(&sc_, kBudgetUs, 8);
+  EXPECT_EQ(8, sc_.speed);
+  EXPECT_EQ(4u, sc_.frames);
+
+  // A new budget starts over.
+  vp9_speed_control_configure(&sc_, 2 * kBudgetUs, 6);
+  EXPECT_EQ(6, sc_.speed);
+  EXPECT_EQ(0u, sc_.frames);
+}
+
+const int kWidth = 352;
+const int kHeight = 288;
+const int kFrames = 12;
+
+// Encodes in real-time mode with row based multi-threading on and the given
+// number of threads.
+class EncoderSpeedControlTest
+    : public ::libvpx_test::EncoderTest,
+      public ::libvpx_test::CodecTestWithParam<int> {
+ protected:
+  EncoderSpeedControlTest()
+      : EncoderTest(GET_PARAM(0)), threads_(GET_PARAM(1)) {}
+
+  ~EncoderSpeedControlTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig();
+    SetMode(::libvpx_test::kRealTime);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.g_threads = threads_;
+    cfg_.rc_end_usage = VPX_CBR;
+    cfg_.rc_target_bitrate = 500;
+  }
+
+  void PreEncodeFrameHook(::libvpx_test::VideoSource *video,
+                          ::libvpx_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(VP8E_SET_CPUUSED, speed_);
+      encoder->Control(VP9E_SET_ROW_MT, 1);
+      encoder->Control(VP9E_SET_FRAME_TIME_BUDGET, budget_us_);
+    }
+  }
+
+  void PostEncodeFrameHook(::libvpx_test::Encoder *encoder) override {
+    encoder->Control(VP9E_GET_SPEED_CONTROL_STATS, &stats_);
+  }
+
+  // Encodes at 'speed' with the given budget and keeps the stats.
+  void EncodeWithBudget(int speed, unsigned int budget_us) {
+    speed_ = speed;
+    budget_us_ = budget_us;
+    memset(&stats_, 0, sizeof(stats_));
+    ::libvpx_test::MovingPatternVideoSource video;
+    video.SetSize(kWidth, kHeight);
+    video.set_limit(kFrames);
+    ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+  }
+
+  const int threads_;
+  int speed_;
+  unsigned int budget_us_;
+  vpx_speed_control_stats_t stats_;
+};
+
+TEST_P(EncoderSpeedControlTest, SpeedsUpToMeetBudget) {
+  // No frame can be encoded in a microsecond.
+  ASSERT_NO_FATAL_FAILURE(EncodeWithBudget(5, 1));
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), stats_.frames);
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), stats_.frames_over_budget);
+  EXPECT_EQ(9, stats_.speed);
+  EXPECT_EQ(4u, stats_.speed_changes);
+  EXPECT_GT(stats_.avg_frame_us, 0u);
+}
+
+// Row based multi-threading is only used from speed 5 in real-time mode, so
+// it is turned on as the speed goes up.
+TEST_P(EncoderSpeedControlTest, SpeedsUpIntoRowMt) {
+  ASSERT_NO_FATAL_FAILURE(EncodeWithBudget(3, 1));
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), stats_.frames);
+  // One step every two inter frames.
+  EXPECT_EQ(8, stats_.speed);
+  EXPECT_EQ(5u, stats_.speed_changes);
+}
+
+TEST_P(EncoderSpeedControlTest, KeepsSpeedWithinBudget) {
+  ASSERT_NO_FATAL_FAILURE(EncodeWithBudget(5, 100000000));
+  EXPECT_EQ(static_cast<unsigned int>(kFrames), stats_.frames);
+  EXPECT_EQ(0u, stats_.frames_over_budget);
+  EXPECT_EQ(5, stats_.speed);
+  EXPECT_EQ(0u, stats_.speed_changes);
+}
+
+TEST_P(EncoderSpeedControlTest, OffByDefault) {
+  ASSERT_NO_FATAL_FAILURE(EncodeWithBudget(5, 0));
+  EXPECT_EQ(0u, stats_.frames);
+  EXPECT_EQ(5, stats_.speed);
+}
+
+TEST(SpeedControlStatsTest, RejectsNullStats) {
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_config_default(vpx_codec_vp9_cx(), &cfg, 0));
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK,
+            vpx_codec_enc_init(&enc, vpx_codec_vp9_cx(), &cfg, 0));
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_GET_SPEED_CONTROL_STATS,
+                              static_cast<vpx_speed_control_stats_t *>(
+                                  nullptr)));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+VP9_INSTANTIATE_TEST_SUITE(EncoderSpeedControlTest, ::testing::Values(1, 2));
+}  // namespace
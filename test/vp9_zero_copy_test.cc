@@ -0,0 +1,200 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/src/include/gtest/gtest.h"
+#include "test/md5_helper.h"
+#include "test/moving_pattern_video_source.h"
+#include "vpx/vp8cx.h"
+#include "vpx/vpx_encoder.h"
+#include "vpx_scale/yv12config.h"
+
+namespace {
+
+const int kWidth = 174;
+const int kHeight = 142;
+const int kFrames = 20;
+const int kLag = 10;
+const int kPoolSize = kLag + 2;
+const int kBorder = VP9_ENC_BORDER_IN_PIXELS;
+
+// An I420 image surrounded by the border the encoder needs. It has the
+// layout of the encoder's frame buffers, and can be used in place, if its
+// stride is aligned to 32.
+class BorderedImage {
+ public:
+  explicit BorderedImage(unsigned int stride_align)
+      : in_use_(false), releases_(0) {
+    const int w = ((kWidth + 7) & ~7) + 2 * kBorder;
+    const int h = ((kHeight + 7) & ~7) + 2 * kBorder;
+    buf_.resize(((w + 31) & ~31) * h * 3 / 2);
+    vpx_img_wrap(&img_, VPX_IMG_FMT_I420, w, h, stride_align, &buf_[0]);
+    vpx_img_set_rect(&img_, kBorder, kBorder, kWidth, kHeight);
+    img_.user_priv = this;
+  }
+
+  void Fill(int frame) { ::libvpx_test::FillMovingPattern(&img_, frame); }
+
+  vpx_image_t img_;
+  bool in_use_;
+  int releases_;
+
+ private:
+  std::vector<uint8_t> buf_;
+};
+
+void ReleaseImage(void *cb_priv, void *user_priv) {
+  int *const outstanding = static_cast<int *>(cb_priv);
+  BorderedImage *const image = static_cast<BorderedImage *>(user_priv);
+  EXPECT_TRUE(image->in_use_);
+  image->in_use_ = false;
+  ++image->releases_;
+  --*outstanding;
+}
+
+class ZeroCopyInputTest
+    : public ::testing::TestWithParam<::testing::tuple<int, unsigned int> > {
+ protected:
+  ZeroCopyInputTest()
+      : noise_sensitivity_(::testing::get<0>(GetParam())),
+        stride_align_(::testing::get<1>(GetParam())), max_outstanding_(0) {}
+
+  void AddPackets(vpx_codec_ctx_t *enc, std::vector<std::string> *frames) {
+    vpx_codec_iter_t iter = nullptr;
+    const vpx_codec_cx_pkt_t *pkt;
+    while ((pkt = vpx_codec_get_cx_data(enc, &iter)) != nullptr) {
+      if (pkt->kind != VPX_CODEC_CX_FRAME_PKT) continue;
+      ::libvpx_test::MD5 md5;
+      md5.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+              pkt->data.frame.sz);
+      frames->push_back(md5.Get());
+    }
+  }
+
+  // Encodes the clip from a pool of kPoolSize images, lending them to the
+  // encoder with the given border if 'zero_copy' is set.
+  std::vector<std::string> Encode(bool zero_copy, int border = kBorder) {
+    vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+    vpx_codec_enc_cfg_t cfg;
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+    cfg.g_w = kWidth;
+    cfg.g_h = kHeight;
+    cfg.g_lag_in_frames = kLag;
+    cfg.g_threads = 2;
+    cfg.rc_target_bitrate = 300;
+    vpx_codec_ctx_t enc;
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_control(&enc, VP8E_SET_CPUUSED, 4));
+    EXPECT_EQ(VPX_CODEC_OK,
+              vpx_codec_control(&enc, VP9E_SET_NOISE_SENSITIVITY,
+                                noise_sensitivity_));
+
+    int outstanding = 0;
+    vpx_zero_copy_input_t lender = { ReleaseImage, &outstanding, border };
+    if (zero_copy) {
+      EXPECT_EQ(VPX_CODEC_OK,
+                vpx_codec_control(&enc, VP9E_SET_ZERO_COPY_INPUT, &lender));
+    }
+
+    std::vector<std::unique_ptr<BorderedImage> > pool;
+    for (int i = 0; i < kPoolSize; ++i) {
+      // With no alignment given, images used in place and copied images
+      // alternate, so the lookahead entries go from one to the other.
+      const unsigned int stride_align =
+          stride_align_ ? stride_align_ : (i & 1 ? 32 : 1);
+      pool.emplace_back(new BorderedImage(stride_align));
+    }
+    std::vector<std::string> frames;
+    for (int frame = 0; frame < kFrames; ++frame) {
+      BorderedImage *image = nullptr;
+      for (int i = 0; i < kPoolSize; ++i) {
+        BorderedImage *const candidate = pool[(frame + i) % kPoolSize].get();
+        if (!candidate->in_use_) {
+          image = candidate;
+          break;
+        }
+      }
+      if (image == nullptr) {
+        ADD_FAILURE() << "No free image for frame " << frame;
+        break;
+      }
+      image->Fill(frame);
+      if (zero_copy) {
+        image->in_use_ = true;
+        ++outstanding;
+      }
+      EXPECT_EQ(VPX_CODEC_OK, vpx_codec_encode(&enc, &image->img_, frame, 1, 0,
+                                               VPX_DL_GOOD_QUALITY));
+      AddPackets(&enc, &frames);
+      max_outstanding_ = std::max(max_outstanding_, outstanding);
+    }
+    EXPECT_EQ(VPX_CODEC_OK,
+              vpx_codec_encode(&enc, nullptr, 0, 1, 0, VPX_DL_GOOD_QUALITY));
+    AddPackets(&enc, &frames);
+    EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+
+    EXPECT_EQ(0, outstanding);
+    if (zero_copy) {
+      int releases = 0;
+      for (const std::unique_ptr<BorderedImage> &image : pool) {
+        releases += image->releases_;
+      }
+      EXPECT_EQ(kFrames, releases);
+    }
+    return frames;
+  }
+
+  const int noise_sensitivity_;
+  const unsigned int stride_align_;
+  int max_outstanding_;
+};
+
+TEST_P(ZeroCopyInputTest, MatchesCopiedInput) {
+  const std::vector<std::string> copied = Encode(false);
+  ASSERT_EQ(static_cast<size_t>(kFrames), copied.size());
+  EXPECT_EQ(copied, Encode(true));
+  // The images are only held by the encoder if they are used in place. The
+  // denoisers filter the source in place, so the images are copied when
+  // noise sensitivity is set.
+  if (noise_sensitivity_ == 0 && stride_align_ != 1) {
+    EXPECT_GT(max_outstanding_, 0);
+  } else {
+    EXPECT_EQ(0, max_outstanding_);
+  }
+}
+
+// The images are copied unless the application confirms their border.
+TEST_P(ZeroCopyInputTest, CopiesWithoutBorder) {
+  const std::vector<std::string> copied = Encode(false);
+  ASSERT_EQ(static_cast<size_t>(kFrames), copied.size());
+  EXPECT_EQ(copied, Encode(true, kBorder - 1));
+  EXPECT_EQ(0, max_outstanding_);
+}
+
+TEST(ZeroCopyInputControlTest, RejectsNullConfig) {
+  vpx_codec_iface_t *const iface = vpx_codec_vp9_cx();
+  vpx_codec_enc_cfg_t cfg;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_config_default(iface, &cfg, 0));
+  vpx_codec_ctx_t enc;
+  ASSERT_EQ(VPX_CODEC_OK, vpx_codec_enc_init(&enc, iface, &cfg, 0));
+  EXPECT_EQ(VPX_CODEC_INVALID_PARAM,
+            vpx_codec_control(&enc, VP9E_SET_ZERO_COPY_INPUT,
+                              static_cast<vpx_zero_copy_input_t *>(nullptr)));
+  EXPECT_EQ(VPX_CODEC_OK, vpx_codec_destroy(&enc));
+}
+
+INSTANTIATE_TEST_SUITE_P(VP9, ZeroCopyInputTest,
+                         ::testing::Combine(::testing::Values(0, 1),
+                                            ::testing::Values(0u, 1u, 32u)));
+}  // namespace
@@ -13,6 +13,9 @@
 
 #include "./vpx_config.h"
 #include "vpx/internal/vpx_codec_internal.h"
+#include "vpx/vpx_frame_buffer.h"
+#include "vpx_util/vpx_atomics.h"
+#include "vpx_util/vpx_pthread.h"
 #include "./vp9_rtcd.h"
 #include "vp9/common/vp9_alloccommon.h"
 #include "vp9/common/vp9_loopfilter.h"
@@ -36,9 +39,10 @@ extern "C" {
 #define REF_FRAMES_LOG2 3
 #define REF_FRAMES (1 << REF_FRAMES_LOG2)
 
-// 1 scratch frame for the new frame, REFS_PER_FRAME for scaled references on
-// the encoder.
-#define FRAME_BUFFERS (REF_FRAMES + 1 + REFS_PER_FRAME)
+// VPX_MAXIMUM_WORK_BUFFERS covers the frames in flight in frame parallel
+// decode, as well as 1 scratch frame for the new frame and REFS_PER_FRAME for
+// scaled references on the encoder.
+#define FRAME_BUFFERS (REF_FRAMES + VPX_MAXIMUM_WORK_BUFFERS)
 
 #define FRAME_CONTEXTS_LOG2 2
 #define FRAME_CONTEXTS (1 << FRAME_CONTEXTS_LOG2)
@@ -80,6 +84,13 @@ typedef struct {
                            // frame.
   vpx_codec_frame_buffer_t raw_frame_buffer;
   YV12_BUFFER_CONFIG buf;
+
+#if CONFIG_MULTITHREAD
+  // Frame parallel decode only: the number of luma rows of this frame that
+  // are fully reconstructed and loop filtered, INT_MAX once the frame is
+  // complete. Updated under BufferPool::progress_mutex.
+  vpx_atomic_int row;
+#endif
 } RefCntBuffer;
 
 typedef struct BufferPool {
@@ -93,6 +104,13 @@ typedef struct BufferPool {
 
   // Frame buffers allocated internally by the codec.
   InternalFrameBufferList int_frame_buffers;
+
+#if CONFIG_MULTITHREAD
+  // Signals RefCntBuffer::row updates. Only initialized in frame parallel
+  // decode.
+  pthread_mutex_t progress_mutex;
+  pthread_cond_t progress_cond;
+#endif
 } BufferPool;
 
 typedef struct VP9Common {
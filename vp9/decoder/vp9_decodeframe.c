@@ -21,6 +21,11 @@
 #include "vpx_mem/vpx_mem.h"
 #include "vpx_ports/mem.h"
 #include "vpx_ports/mem_ops.h"
+#if VPX_ARCH_X86 || VPX_ARCH_X86_64
+#include "vpx_ports/x86.h"
+#else
+#define x86_pause_hint()
+#endif
 #include "vpx_scale/vpx_scale.h"
 #include "vpx_util/vpx_pthread.h"
 #include "vpx_util/vpx_thread.h"
@@ -46,10 +51,15 @@
 #include "vp9/decoder/vp9_decodemv.h"
 #include "vp9/decoder/vp9_decoder.h"
 #include "vp9/decoder/vp9_dsubexp.h"
+#include "vp9/decoder/vp9_dthread.h"
 #include "vp9/decoder/vp9_job_queue.h"
 
 #define MAX_VP9_HEADER_SIZE 80
 
+// Frame parallel decode: the loop filter of a superblock row modifies up to 7
+// rows of the row above it, i.e. 14 luma rows for 4:2:0 chroma.
+#define LF_PROGRESS_LAG 16
+
 typedef int (*predict_recon_func)(TileWorkerData *twd, MODE_INFO *const mi,
                                   int plane, int row, int col, TX_SIZE tx_size);
 
@@ -580,7 +590,7 @@ static void dec_build_inter_predictors(
     int y, int w, int h, int mi_x, int mi_y, const InterpKernel *kernel,
     const struct scale_factors *sf, struct buf_2d *pre_buf,
     struct buf_2d *dst_buf, const MV *mv, RefCntBuffer *ref_frame_buf,
-    int is_scaled, int ref) {
+    int is_scaled, int ref, BufferPool *const wait_pool) {
   struct macroblockd_plane *const pd = &xd->plane[plane];
   uint8_t *const dst = dst_buf->buf + dst_buf->stride * y + x;
   MV32 scaled_mv;
@@ -657,6 +667,16 @@ static void dec_build_inter_predictors(
   buf_ptr = ref_frame + y0 * pre_buf->stride + x0;
   buf_stride = pre_buf->stride;
 
+  // In frame parallel decode, wait until the rows of the reference frame
+  // read by this block, including the interpolation filter taps, are final.
+  if (wait_pool != NULL) {
+    int y1 = ((y0_16 + (h - 1) * ys) >> SUBPEL_BITS) + 1;
+    if (subpel_y || (sf->y_step_q4 != SUBPEL_SHIFTS)) y1 += VP9_INTERP_EXTEND;
+    y1 = clamp(y1, 0, frame_height - 1);
+    vp9_frameworker_wait(wait_pool, ref_frame_buf,
+                         (y1 + 1) << pd->subsampling_y);
+  }
+
   // Do border extension if there is motion or the
   // width/height is not a multiple of 8 pixels.
   if (is_scaled || scaled_mv.col || scaled_mv.row || (frame_width & 0x7) ||
@@ -724,6 +744,8 @@ static void dec_build_inter_predictors_sb(TileWorkerData *twd,
   const InterpKernel *kernel = vp9_filter_kernels[mi->interp_filter];
   const BLOCK_SIZE sb_type = mi->sb_type;
   const int is_compound = has_second_ref(mi);
+  BufferPool *const wait_pool =
+      pbi->frame_parallel_decode ? pbi->common.buffer_pool : NULL;
   int ref;
   int is_scaled;
 
@@ -760,7 +782,7 @@ static void dec_build_inter_predictors_sb(TileWorkerData *twd,
             dec_build_inter_predictors(twd, xd, plane, n4w_x4, n4h_x4, 4 * x,
                                        4 * y, 4, 4, mi_x, mi_y, kernel, sf,
                                        pre_buf, dst_buf, &mv, ref_frame_buf,
-                                       is_scaled, ref);
+                                       is_scaled, ref, wait_pool);
           }
         }
       }
@@ -776,7 +798,8 @@ static void dec_build_inter_predictors_sb(TileWorkerData *twd,
         struct buf_2d *const pre_buf = &pd->pre[ref];
         dec_build_inter_predictors(twd, xd, plane, n4w_x4, n4h_x4, 0, 0, n4w_x4,
                                    n4h_x4, mi_x, mi_y, kernel, sf, pre_buf,
-                                   dst_buf, &mv, ref_frame_buf, is_scaled, ref);
+                                   dst_buf, &mv, ref_frame_buf, is_scaled, ref,
+                                   wait_pool);
       }
     }
   }
@@ -1698,35 +1721,68 @@ static void get_tile_buffers(VP9Decoder *pbi, const uint8_t *data,
   }
 }
 
-static void map_write(RowMTWorkerData *const row_mt_worker_data, int map_idx,
-                      int sync_idx) {
 #if CONFIG_MULTITHREAD
-  pthread_mutex_lock(&row_mt_worker_data->recon_sync_mutex[sync_idx]);
-  row_mt_worker_data->recon_map[map_idx] = 1;
-  pthread_cond_signal(&row_mt_worker_data->recon_sync_cond[sync_idx]);
-  pthread_mutex_unlock(&row_mt_worker_data->recon_sync_mutex[sync_idx]);
+// recon_progress[] holds, for each sb row of each tile, the index of the last
+// superblock column reconstructed plus one. RECON_PROGRESS_WAITER is or'ed in
+// while a thread sleeps on it, so that the writer only takes the mutex when
+// someone needs to be woken up.
+#define RECON_PROGRESS_WAITER (1 << 30)
+// Number of polls of recon progress before sleeping on the condition
+// variable.
+#define RECON_PROGRESS_SPIN_COUNT 128
+#endif  // CONFIG_MULTITHREAD
+
+static void recon_progress_write(RowMTWorkerData *const row_mt_worker_data,
+                                 int sync_idx, int sb_col_end) {
+#if CONFIG_MULTITHREAD
+  vpx_atomic_int *const progress =
+      &row_mt_worker_data->recon_progress[sync_idx];
+  if (vpx_atomic_exchange(progress, sb_col_end) & RECON_PROGRESS_WAITER) {
+    pthread_mutex_lock(&row_mt_worker_data->recon_sync_mutex[sync_idx]);
+    pthread_cond_broadcast(&row_mt_worker_data->recon_sync_cond[sync_idx]);
+    pthread_mutex_unlock(&row_mt_worker_data->recon_sync_mutex[sync_idx]);
+  }
 #else
   (void)row_mt_worker_data;
-  (void)map_idx;
   (void)sync_idx;
+  (void)sb_col_end;
 #endif  // CONFIG_MULTITHREAD
 }
 
-static void map_read(RowMTWorkerData *const row_mt_worker_data, int map_idx,
-                     int sync_idx) {
+// Waits until superblock column 'sb_col' of the tile row 'sync_idx' has been
+// reconstructed.
+static void recon_progress_wait(RowMTWorkerData *const row_mt_worker_data,
+                                int sync_idx, int sb_col) {
 #if CONFIG_MULTITHREAD
-  volatile int8_t *map = row_mt_worker_data->recon_map + map_idx;
+  vpx_atomic_int *const progress =
+      &row_mt_worker_data->recon_progress[sync_idx];
   pthread_mutex_t *const mutex =
       &row_mt_worker_data->recon_sync_mutex[sync_idx];
+  int cur;
+  int i;
+
+  for (i = 0; i < RECON_PROGRESS_SPIN_COUNT; ++i) {
+    if ((vpx_atomic_load_acquire(progress) & ~RECON_PROGRESS_WAITER) > sb_col)
+      return;
+    x86_pause_hint();
+  }
+
   pthread_mutex_lock(mutex);
-  while (!(*map)) {
-    pthread_cond_wait(&row_mt_worker_data->recon_sync_cond[sync_idx], mutex);
+  cur = vpx_atomic_load_acquire(progress);
+  while ((cur & ~RECON_PROGRESS_WAITER) <= sb_col) {
+    // If the flag cannot be set, 'cur' holds the new progress: check again.
+    if ((cur & RECON_PROGRESS_WAITER) ||
+        vpx_atomic_compare_exchange(progress, &cur,
+                                    cur | RECON_PROGRESS_WAITER)) {
+      pthread_cond_wait(&row_mt_worker_data->recon_sync_cond[sync_idx], mutex);
+      cur = vpx_atomic_load_acquire(progress);
+    }
   }
   pthread_mutex_unlock(mutex);
 #else
   (void)row_mt_worker_data;
-  (void)map_idx;
   (void)sync_idx;
+  (void)sb_col;
 #endif  // CONFIG_MULTITHREAD
 }
 
@@ -1774,18 +1830,32 @@ static void vp9_jobq_alloc(VP9Decoder *pbi) {
   const int aligned_rows = mi_cols_aligned_to_sb(cm->mi_rows);
   const int sb_rows = aligned_rows >> MI_BLOCK_SIZE_LOG2;
   const int tile_cols = 1 << cm->log2_tile_cols;
-  const size_t jobq_size = (tile_cols * sb_rows * 2 + sb_rows) * sizeof(Job);
+  const size_t jobq_size =
+      vp9_jobq_buf_size(tile_cols * sb_rows * 2 + sb_rows, sizeof(Job));
 
   if (jobq_size > row_mt_worker_data->jobq_size) {
     vpx_free(row_mt_worker_data->jobq_buf);
     CHECK_MEM_ERROR(&cm->error, row_mt_worker_data->jobq_buf,
                     vpx_calloc(1, jobq_size));
     vp9_jobq_init(&row_mt_worker_data->jobq, row_mt_worker_data->jobq_buf,
-                  jobq_size);
+                  jobq_size, sizeof(Job));
     row_mt_worker_data->jobq_size = jobq_size;
   }
 }
 
+// Adds the time since start_stage_timer() to the time of the tile column and
+// to *stage_time.
+static void end_tile_timer(const VP9Decoder *pbi, struct vpx_usec_timer *timer,
+                           uint64_t *tile_time, uint64_t *stage_time) {
+  if (pbi->time_stages) {
+    int64_t elapsed;
+    vpx_usec_timer_mark(timer);
+    elapsed = vpx_usec_timer_elapsed(timer);
+    *tile_time += elapsed;
+    *stage_time += elapsed;
+  }
+}
+
 static void recon_tile_row(TileWorkerData *tile_data, VP9Decoder *pbi,
                            int mi_row, int is_last_row, VP9LfSync *lf_sync,
                            int cur_tile_col) {
@@ -1793,7 +1863,6 @@ static void recon_tile_row(TileWorkerData *tile_data, VP9Decoder *pbi,
   RowMTWorkerData *const row_mt_worker_data = pbi->row_mt_worker_data;
   const int tile_cols = 1 << cm->log2_tile_cols;
   const int aligned_cols = mi_cols_aligned_to_sb(cm->mi_cols);
-  const int sb_cols = aligned_cols >> MI_BLOCK_SIZE_LOG2;
   const int cur_sb_row = mi_row >> MI_BLOCK_SIZE_LOG2;
   int mi_col_start = tile_data->xd.tile.mi_col_start;
   int mi_col_end = tile_data->xd.tile.mi_col_end;
@@ -1808,8 +1877,8 @@ static void recon_tile_row(TileWorkerData *tile_data, VP9Decoder *pbi,
 
     // Top Dependency
     if (cur_sb_row) {
-      map_read(row_mt_worker_data, ((cur_sb_row - 1) * sb_cols) + c,
-               ((cur_sb_row - 1) * tile_cols) + cur_tile_col);
+      recon_progress_wait(row_mt_worker_data,
+                          ((cur_sb_row - 1) * tile_cols) + cur_tile_col, c);
     }
 
     for (plane = 0; plane < MAX_MB_PLANE; ++plane) {
@@ -1846,8 +1915,8 @@ static void recon_tile_row(TileWorkerData *tile_data, VP9Decoder *pbi,
         }
       }
     }
-    map_write(row_mt_worker_data, (cur_sb_row * sb_cols) + c,
-              (cur_sb_row * tile_cols) + cur_tile_col);
+    recon_progress_write(row_mt_worker_data,
+                         (cur_sb_row * tile_cols) + cur_tile_col, c + 1);
   }
 }
 
@@ -1899,18 +1968,18 @@ static int row_decode_worker_hook(void *arg1, void *arg2) {
   VP9Decoder *const pbi = thread_data->pbi;
   VP9_COMMON *const cm = &pbi->common;
   RowMTWorkerData *const row_mt_worker_data = pbi->row_mt_worker_data;
-  const int aligned_cols = mi_cols_aligned_to_sb(cm->mi_cols);
   const int aligned_rows = mi_cols_aligned_to_sb(cm->mi_rows);
   const int sb_rows = aligned_rows >> MI_BLOCK_SIZE_LOG2;
   const int tile_cols = 1 << cm->log2_tile_cols;
   Job job;
   LFWorkerData *lf_data = thread_data->lf_data;
   VP9LfSync *lf_sync = thread_data->lf_sync;
+  vpx_dec_component_timing_t *const timing = &thread_data->timing;
+  struct vpx_usec_timer timer;
   volatile int corrupted = 0;
   TileWorkerData *volatile tile_data_recon = NULL;
 
   while (!vp9_jobq_dequeue(&row_mt_worker_data->jobq, &job, sizeof(job), 1)) {
-    int mi_col;
     const int mi_row = job.row_num;
 
     if (job.job_type == LPF_JOB) {
@@ -1919,12 +1988,14 @@ static int row_decode_worker_hook(void *arg1, void *arg2) {
 
       if (cm->lf.filter_level && !cm->skip_loop_filter &&
           mi_row < cm->mi_rows) {
+        start_stage_timer(pbi, &timer);
         vp9_loopfilter_job(lf_data, lf_sync);
+        end_stage_timer(pbi, &timer, &timing->loop_filter_us);
       }
     } else if (job.job_type == RECON_JOB) {
       const int cur_sb_row = mi_row >> MI_BLOCK_SIZE_LOG2;
       const int is_last_row = sb_rows - 1 == cur_sb_row;
-      int mi_col_start, mi_col_end;
+      int mi_col_end;
       if (!tile_data_recon)
         CHECK_MEM_ERROR(&cm->error, tile_data_recon,
                         vpx_memalign(32, sizeof(TileWorkerData)));
@@ -1932,19 +2003,16 @@ static int row_decode_worker_hook(void *arg1, void *arg2) {
       tile_data_recon->xd = pbi->mb;
       vp9_tile_init(&tile_data_recon->xd.tile, cm, 0, job.tile_col);
       vp9_init_macroblockd(cm, &tile_data_recon->xd, tile_data_recon->dqcoeff);
-      mi_col_start = tile_data_recon->xd.tile.mi_col_start;
       mi_col_end = tile_data_recon->xd.tile.mi_col_end;
 
       if (setjmp(tile_data_recon->error_info.jmp)) {
-        const int sb_cols = aligned_cols >> MI_BLOCK_SIZE_LOG2;
         tile_data_recon->error_info.setjmp = 0;
         corrupted = 1;
-        for (mi_col = mi_col_start; mi_col < mi_col_end;
-             mi_col += MI_BLOCK_SIZE) {
-          const int c = mi_col >> MI_BLOCK_SIZE_LOG2;
-          map_write(row_mt_worker_data, (cur_sb_row * sb_cols) + c,
-                    (cur_sb_row * tile_cols) + job.tile_col);
-        }
+        // Release the rows below that wait on this one.
+        recon_progress_write(row_mt_worker_data,
+                             (cur_sb_row * tile_cols) + job.tile_col,
+                             mi_cols_aligned_to_sb(mi_col_end) >>
+                                 MI_BLOCK_SIZE_LOG2);
         if (is_last_row) {
           vp9_tile_done(pbi);
         }
@@ -1954,8 +2022,11 @@ static int row_decode_worker_hook(void *arg1, void *arg2) {
       tile_data_recon->error_info.setjmp = 1;
       tile_data_recon->xd.error_info = &tile_data_recon->error_info;
 
+      start_stage_timer(pbi, &timer);
       recon_tile_row(tile_data_recon, pbi, mi_row, is_last_row, lf_sync,
                      job.tile_col);
+      end_tile_timer(pbi, &timer, &timing->tile_us[job.tile_col],
+                     &timing->recon_us);
 
       if (corrupted)
         vpx_internal_error(&tile_data_recon->error_info,
@@ -1981,7 +2052,10 @@ static int row_decode_worker_hook(void *arg1, void *arg2) {
 
       tile_data->error_info.setjmp = 1;
 
+      start_stage_timer(pbi, &timer);
       parse_tile_row(tile_data, pbi, mi_row, job.tile_col, data_end);
+      end_tile_timer(pbi, &timer, &timing->tile_us[job.tile_col],
+                     &timing->parse_us);
 
       corrupted |= tile_data->xd.corrupted;
       if (corrupted)
@@ -2025,6 +2099,8 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
   int tile_row, tile_col;
   int mi_row, mi_col;
   TileWorkerData *tile_data = NULL;
+  vpx_dec_component_timing_t *const timing = &pbi->frame_timing;
+  struct vpx_usec_timer timer;
 
   if (cm->lf.filter_level && !cm->skip_loop_filter &&
       pbi->lf_worker.data1 == NULL) {
@@ -2083,11 +2159,18 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
     vp9_tile_set_row(&tile, cm, tile_row);
     for (mi_row = tile.mi_row_start; mi_row < tile.mi_row_end;
          mi_row += MI_BLOCK_SIZE) {
+      // The co-located motion vectors of the previous frame are read while
+      // parsing this row.
+      if (pbi->frame_parallel_decode && cm->use_prev_frame_mvs) {
+        vp9_frameworker_wait(cm->buffer_pool, cm->prev_frame,
+                             (mi_row << MI_SIZE_LOG2) + 1);
+      }
       for (tile_col = 0; tile_col < tile_cols; ++tile_col) {
         const int col =
             pbi->inv_tile_order ? tile_cols - tile_col - 1 : tile_col;
         tile_data = pbi->tile_worker_data + tile_cols * tile_row + col;
         vp9_tile_set_col(&tile, cm, col);
+        start_stage_timer(pbi, &timer);
         vp9_zero(tile_data->xd.left_context);
         vp9_zero(tile_data->xd.left_seg_context);
         for (mi_col = tile.mi_col_start; mi_col < tile.mi_col_end;
@@ -2116,6 +2199,7 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
             decode_partition(tile_data, pbi, mi_row, mi_col, BLOCK_64X64, 4);
           }
         }
+        end_tile_timer(pbi, &timer, &timing->tile_us[col], &timing->recon_us);
         pbi->mb.corrupted |= tile_data->xd.corrupted;
         if (pbi->mb.corrupted)
           vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
@@ -2132,6 +2216,7 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
         // decoding has completed: finish up the loop filter in this thread.
         if (mi_row + MI_BLOCK_SIZE >= cm->mi_rows) continue;
 
+        start_stage_timer(pbi, &timer);
         winterface->sync(&pbi->lf_worker);
         lf_data->start = lf_start;
         lf_data->stop = mi_row;
@@ -2140,6 +2225,16 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
         } else {
           winterface->execute(&pbi->lf_worker);
         }
+        end_stage_timer(pbi, &timer, &timing->loop_filter_us);
+
+        if (pbi->frame_parallel_decode) {
+          assert(pbi->max_threads == 1);
+          vp9_frameworker_broadcast(cm->buffer_pool, pbi->cur_buf,
+                                    (mi_row << MI_SIZE_LOG2) - LF_PROGRESS_LAG);
+        }
+      } else if (pbi->frame_parallel_decode) {
+        vp9_frameworker_broadcast(cm->buffer_pool, pbi->cur_buf,
+                                  (mi_row + MI_BLOCK_SIZE) << MI_SIZE_LOG2);
       }
     }
   }
@@ -2147,10 +2242,16 @@ static const uint8_t *decode_tiles(VP9Decoder *pbi, const uint8_t *data,
   // Loopfilter remaining rows in the frame.
   if (cm->lf.filter_level && !cm->skip_loop_filter) {
     LFWorkerData *const lf_data = (LFWorkerData *)pbi->lf_worker.data1;
+    start_stage_timer(pbi, &timer);
     winterface->sync(&pbi->lf_worker);
     lf_data->start = lf_data->stop;
     lf_data->stop = cm->mi_rows;
     winterface->execute(&pbi->lf_worker);
+    end_stage_timer(pbi, &timer, &timing->loop_filter_us);
+  }
+
+  if (pbi->frame_parallel_decode) {
+    vp9_frameworker_broadcast(cm->buffer_pool, pbi->cur_buf, INT_MAX);
   }
 
   // Get last tile data.
@@ -2192,6 +2293,7 @@ static int tile_worker_hook(void *arg1, void *arg2) {
 
   LFWorkerData *lf_data = tile_data->lf_data;
   VP9LfSync *lf_sync = tile_data->lf_sync;
+  struct vpx_usec_timer timer;
 
   volatile int mi_row = 0;
   volatile int n = tile_data->buf_start;
@@ -2219,6 +2321,7 @@ static int tile_worker_hook(void *arg1, void *arg2) {
      * more than one row of tiles. (So tile->mi_row_start will be 0)
      */
     assert(cm->log2_tile_rows == 0);
+    start_stage_timer(pbi, &timer);
     mi_row = 0;
     vp9_zero(tile_data->dqcoeff);
     vp9_tile_init(tile, &pbi->common, 0, buf->col);
@@ -2247,6 +2350,10 @@ static int tile_worker_hook(void *arg1, void *arg2) {
       }
     }
 
+    // Each tile column is decoded by a single worker.
+    end_tile_timer(pbi, &timer, &pbi->frame_timing.tile_us[buf->col],
+                   &tile_data->recon_us);
+
     if (buf->col == final_col) {
       bit_reader_end = vpx_reader_find_end(&tile_data->bit_reader);
     }
@@ -2264,7 +2371,9 @@ static int tile_worker_hook(void *arg1, void *arg2) {
 
   if (pbi->lpf_mt_opt && !tile_data->xd.corrupted && cm->lf.filter_level &&
       !cm->skip_loop_filter) {
+    start_stage_timer(pbi, &timer);
     vp9_loopfilter_rows(lf_data, lf_sync);
+    end_stage_timer(pbi, &timer, &tile_data->loop_filter_us);
   }
 
   tile_data->data_end = bit_reader_end;
@@ -2338,7 +2447,6 @@ static const uint8_t *decode_tiles_row_wise_mt(VP9Decoder *pbi,
   int col;
   int corrupted = 0;
   const int sb_rows = mi_cols_aligned_to_sb(cm->mi_rows) >> MI_BLOCK_SIZE_LOG2;
-  const int sb_cols = mi_cols_aligned_to_sb(cm->mi_cols) >> MI_BLOCK_SIZE_LOG2;
   VP9LfSync *lf_row_sync = &pbi->lf_row_sync;
   YV12_BUFFER_CONFIG *const new_fb = get_frame_new_buffer(cm);
 
@@ -2346,8 +2454,10 @@ static const uint8_t *decode_tiles_row_wise_mt(VP9Decoder *pbi,
   assert(tile_rows == 1);
   (void)tile_rows;
 
-  memset(row_mt_worker_data->recon_map, 0,
-         sb_rows * sb_cols * sizeof(*row_mt_worker_data->recon_map));
+#if CONFIG_MULTITHREAD
+  for (i = 0; i < sb_rows * tile_cols; ++i)
+    vpx_atomic_init(&row_mt_worker_data->recon_progress[i], 0);
+#endif
 
   init_mt(pbi);
 
@@ -2365,6 +2475,7 @@ static const uint8_t *decode_tiles_row_wise_mt(VP9Decoder *pbi,
     }
 
     thread_data->pbi = pbi;
+    vp9_zero(thread_data->timing);
 
     worker->hook = row_decode_worker_hook;
     worker->data1 = thread_data;
@@ -2423,6 +2534,19 @@ static const uint8_t *decode_tiles_row_wise_mt(VP9Decoder *pbi,
     corrupted |= !winterface->sync(worker);
   }
 
+  if (pbi->time_stages) {
+    vpx_dec_component_timing_t *const timing = &pbi->frame_timing;
+    for (i = 0; i < num_workers; ++i) {
+      const vpx_dec_component_timing_t *const thread_timing =
+          &row_mt_worker_data->thread_data[i].timing;
+      timing->parse_us += thread_timing->parse_us;
+      timing->recon_us += thread_timing->recon_us;
+      timing->loop_filter_us += thread_timing->loop_filter_us;
+      for (col = 0; col < tile_cols; ++col)
+        timing->tile_us[col] += thread_timing->tile_us[col];
+    }
+  }
+
   pbi->mb.corrupted = corrupted;
 
   {
@@ -2523,6 +2647,13 @@ static const uint8_t *decode_tiles_mt(VP9Decoder *pbi, const uint8_t *data,
     }
   }
 
+  for (n = 0; n < num_workers; ++n) {
+    TileWorkerData *const tile_data =
+        (TileWorkerData *)pbi->tile_workers[n].data1;
+    tile_data->recon_us = 0;
+    tile_data->loop_filter_us = 0;
+  }
+
   {
     const int base = tile_cols / num_workers;
     const int remain = tile_cols % num_workers;
@@ -2556,6 +2687,8 @@ static const uint8_t *decode_tiles_mt(VP9Decoder *pbi, const uint8_t *data,
       // detected, there's no point in continuing to decode tiles.
       pbi->mb.corrupted |= !winterface->sync(worker);
       if (!bit_reader_end) bit_reader_end = tile_data->data_end;
+      pbi->frame_timing.recon_us += tile_data->recon_us;
+      pbi->frame_timing.loop_filter_us += tile_data->loop_filter_us;
     }
   }
 
@@ -2701,7 +2834,9 @@ static size_t read_uncompressed_header(VP9Decoder *pbi,
     setup_frame_size(cm, rb);
     if (pbi->need_resync) {
       memset(&cm->ref_frame_map, -1, sizeof(cm->ref_frame_map));
-      flush_all_fb_on_key(cm);
+      // Frame parallel decode keeps exact reference counts on the buffers
+      // still used by the other frame workers.
+      if (!pbi->frame_parallel_decode) flush_all_fb_on_key(cm);
       pbi->need_resync = 0;
     }
   } else {
@@ -2952,18 +3087,76 @@ BITSTREAM_PROFILE vp9_read_profile(struct vpx_read_bit_buffer *rb) {
   return (BITSTREAM_PROFILE)profile;
 }
 
+static void decode_frame_tiles(VP9Decoder *pbi, const uint8_t *data,
+                               const uint8_t *data_end,
+                               const uint8_t **p_data_end) {
+  VP9_COMMON *const cm = &pbi->common;
+  MACROBLOCKD *const xd = &pbi->mb;
+  const int tile_rows = 1 << cm->log2_tile_rows;
+  const int tile_cols = 1 << cm->log2_tile_cols;
+  YV12_BUFFER_CONFIG *const new_fb = get_frame_new_buffer(cm);
+
+  if (pbi->max_threads > 1 && tile_rows == 1 &&
+      (tile_cols > 1 || pbi->row_mt == 1)) {
+    if (pbi->row_mt == 1) {
+      *p_data_end = decode_tiles_row_wise_mt(pbi, data, data_end);
+    } else {
+      // Multi-threaded tile decoder
+      *p_data_end = decode_tiles_mt(pbi, data, data_end);
+      if (!pbi->lpf_mt_opt) {
+        if (!xd->corrupted) {
+          if (!cm->skip_loop_filter) {
+            struct vpx_usec_timer timer;
+            start_stage_timer(pbi, &timer);
+            // If multiple threads are used to decode tiles, then we use those
+            // threads to do parallel loopfiltering.
+            vp9_loop_filter_frame_mt(
+                new_fb, cm, pbi->mb.plane, cm->lf.filter_level, 0, 0,
+                pbi->tile_workers, pbi->num_tile_workers, &pbi->lf_row_sync);
+            end_stage_timer(pbi, &timer, &pbi->frame_timing.loop_filter_us);
+          }
+        } else {
+          vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
+                             "Decode failed. Frame data is corrupted.");
+        }
+      }
+    }
+  } else {
+    *p_data_end = decode_tiles(pbi, data, data_end);
+  }
+
+  if (!xd->corrupted) {
+    if (!cm->error_resilient_mode && !cm->frame_parallel_decoding_mode) {
+      vp9_adapt_coef_probs(cm);
+
+      if (!frame_is_intra_only(cm)) {
+        vp9_adapt_mode_probs(cm);
+        vp9_adapt_mv_probs(cm, cm->allow_high_precision_mv);
+      }
+    }
+  } else {
+    vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
+                       "Decode failed. Frame data is corrupted.");
+  }
+}
+
 void vp9_decode_frame(VP9Decoder *pbi, const uint8_t *data,
                       const uint8_t *data_end, const uint8_t **p_data_end) {
   VP9_COMMON *const cm = &pbi->common;
   MACROBLOCKD *const xd = &pbi->mb;
   struct vpx_read_bit_buffer rb;
-  int context_updated = 0;
   uint8_t clear_data[MAX_VP9_HEADER_SIZE];
-  const size_t first_partition_size = read_uncompressed_header(
+  struct vpx_usec_timer timer;
+  size_t first_partition_size;
+  int tile_rows, tile_cols;
+  YV12_BUFFER_CONFIG *new_fb;
+
+  start_stage_timer(pbi, &timer);
+  first_partition_size = read_uncompressed_header(
       pbi, init_read_bit_buffer(pbi, &rb, data, data_end, clear_data));
-  const int tile_rows = 1 << cm->log2_tile_rows;
-  const int tile_cols = 1 << cm->log2_tile_cols;
-  YV12_BUFFER_CONFIG *const new_fb = get_frame_new_buffer(cm);
+  tile_rows = 1 << cm->log2_tile_rows;
+  tile_cols = 1 << cm->log2_tile_cols;
+  new_fb = get_frame_new_buffer(cm);
 #if CONFIG_BITSTREAM_DEBUG || CONFIG_MISMATCH_DEBUG
   bitstream_queue_set_frame_read(cm->current_video_frame * 2 + cm->show_frame);
 #endif
@@ -2975,6 +3168,7 @@ void vp9_decode_frame(VP9Decoder *pbi, const uint8_t *data,
   if (!first_partition_size) {
     // showing a frame directly
     *p_data_end = data + (cm->profile <= PROFILE_2 ? 1 : 2);
+    end_stage_timer(pbi, &timer, &pbi->stage_timing.parse_us);
     return;
   }
 
@@ -3000,6 +3194,7 @@ void vp9_decode_frame(VP9Decoder *pbi, const uint8_t *data,
   if (new_fb->corrupted)
     vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
                        "Decode failed. Frame data header is corrupted.");
+  end_stage_timer(pbi, &timer, &pbi->stage_timing.parse_us);
 
   if (cm->lf.filter_level && !cm->skip_loop_filter) {
     vp9_loop_filter_frame_init(cm, cm->lf.filter_level);
@@ -3019,48 +3214,40 @@ void vp9_decode_frame(VP9Decoder *pbi, const uint8_t *data,
     pbi->total_tiles = tile_rows * tile_cols;
   }
 
-  if (pbi->max_threads > 1 && tile_rows == 1 &&
-      (tile_cols > 1 || pbi->row_mt == 1)) {
-    if (pbi->row_mt == 1) {
-      *p_data_end =
-          decode_tiles_row_wise_mt(pbi, data + first_partition_size, data_end);
-    } else {
-      // Multi-threaded tile decoder
-      *p_data_end = decode_tiles_mt(pbi, data + first_partition_size, data_end);
-      if (!pbi->lpf_mt_opt) {
-        if (!xd->corrupted) {
-          if (!cm->skip_loop_filter) {
-            // If multiple threads are used to decode tiles, then we use those
-            // threads to do parallel loopfiltering.
-            vp9_loop_filter_frame_mt(
-                new_fb, cm, pbi->mb.plane, cm->lf.filter_level, 0, 0,
-                pbi->tile_workers, pbi->num_tile_workers, &pbi->lf_row_sync);
-          }
-        } else {
-          vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
-                             "Decode failed. Frame data is corrupted.");
-        }
-      }
+  if (pbi->frame_parallel_decode) {
+    // The frame worker decodes the tiles with vp9_decode_frame_tiles().
+    pbi->frame_data = data + first_partition_size;
+    pbi->frame_data_end = data_end;
+    // The end of the last tile is only known once it has been decoded.
+    *p_data_end = data_end;
+
+    // Without backward adaptation the frame context is final once the headers
+    // are read. Store it now so the headers of the next frame can be read
+    // while this one is decoded.
+    if (cm->refresh_frame_context &&
+        (cm->error_resilient_mode || cm->frame_parallel_decoding_mode)) {
+      cm->frame_contexts[cm->frame_context_idx] = *cm->fc;
     }
-  } else {
-    *p_data_end = decode_tiles(pbi, data + first_partition_size, data_end);
+    return;
   }
 
-  if (!xd->corrupted) {
-    if (!cm->error_resilient_mode && !cm->frame_parallel_decoding_mode) {
-      vp9_adapt_coef_probs(cm);
+  decode_frame_tiles(pbi, data + first_partition_size, data_end, p_data_end);
 
-      if (!frame_is_intra_only(cm)) {
-        vp9_adapt_mode_probs(cm);
-        vp9_adapt_mv_probs(cm, cm->allow_high_precision_mv);
-      }
-    }
-  } else {
-    vpx_internal_error(&cm->error, VPX_CODEC_CORRUPT_FRAME,
-                       "Decode failed. Frame data is corrupted.");
-  }
+  if (cm->refresh_frame_context)
+    cm->frame_contexts[cm->frame_context_idx] = *cm->fc;
+}
 
-  // Non frame parallel update frame context here.
-  if (cm->refresh_frame_context && !context_updated)
+const uint8_t *vp9_decode_frame_tiles(VP9Decoder *pbi) {
+  VP9_COMMON *const cm = &pbi->common;
+  const uint8_t *data_end;
+
+  decode_frame_tiles(pbi, pbi->frame_data, pbi->frame_data_end, &data_end);
+
+  // The frame context of frames without backward adaptation was stored by
+  // vp9_decode_frame().
+  if (cm->refresh_frame_context && !cm->error_resilient_mode &&
+      !cm->frame_parallel_decoding_mode) {
     cm->frame_contexts[cm->frame_context_idx] = *cm->fc;
+  }
+  return data_end;
 }
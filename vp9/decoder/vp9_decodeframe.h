@@ -28,6 +28,10 @@ BITSTREAM_PROFILE vp9_read_profile(struct vpx_read_bit_buffer *rb);
 void vp9_decode_frame(struct VP9Decoder *pbi, const uint8_t *data,
                       const uint8_t *data_end, const uint8_t **p_data_end);
 
+// Frame parallel decode: decodes the tiles of the frame whose headers were
+// read by the last call to vp9_decode_frame(). Returns the end of the frame.
+const uint8_t *vp9_decode_frame_tiles(struct VP9Decoder *pbi);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
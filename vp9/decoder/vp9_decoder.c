@@ -83,6 +83,10 @@ void vp9_dec_alloc_row_mt_mem(RowMTWorkerData *row_mt_worker_data,
         pthread_cond_init(&row_mt_worker_data->recon_sync_cond[i], NULL);
       }
     }
+
+    CHECK_MEM_ERROR(
+        &cm->error, row_mt_worker_data->recon_progress,
+        vpx_malloc(sizeof(*row_mt_worker_data->recon_progress) * num_jobs));
   }
 #endif
   row_mt_worker_data->num_sbs = num_sbs;
@@ -97,8 +101,6 @@ void vp9_dec_alloc_row_mt_mem(RowMTWorkerData *row_mt_worker_data,
   CHECK_MEM_ERROR(&cm->error, row_mt_worker_data->partition,
                   vpx_calloc(num_sbs * PARTITIONS_PER_SB,
                              sizeof(*row_mt_worker_data->partition)));
-  CHECK_MEM_ERROR(&cm->error, row_mt_worker_data->recon_map,
-                  vpx_calloc(num_sbs, sizeof(*row_mt_worker_data->recon_map)));
 
   // allocate memory for thread_data
   if (row_mt_worker_data->thread_data == NULL) {
@@ -128,6 +130,8 @@ void vp9_dec_free_row_mt_mem(RowMTWorkerData *row_mt_worker_data) {
       vpx_free(row_mt_worker_data->recon_sync_cond);
       row_mt_worker_data->recon_sync_cond = NULL;
     }
+    vpx_free(row_mt_worker_data->recon_progress);
+    row_mt_worker_data->recon_progress = NULL;
 #endif
     for (plane = 0; plane < 3; ++plane) {
       vpx_free(row_mt_worker_data->eob[plane]);
@@ -137,8 +141,6 @@ void vp9_dec_free_row_mt_mem(RowMTWorkerData *row_mt_worker_data) {
     }
     vpx_free(row_mt_worker_data->partition);
     row_mt_worker_data->partition = NULL;
-    vpx_free(row_mt_worker_data->recon_map);
-    row_mt_worker_data->recon_map = NULL;
     vpx_free(row_mt_worker_data->thread_data);
     row_mt_worker_data->thread_data = NULL;
   }
@@ -333,6 +335,48 @@ vpx_codec_err_t vp9_set_reference_dec(VP9_COMMON *cm,
   return cm->error.error_code;
 }
 
+vpx_codec_err_t vp9_get_mode_info(const VP9Decoder *pbi,
+                                  vpx_mode_info_map_t *map) {
+  const VP9_COMMON *const cm = &pbi->common;
+  int mi_row, mi_col, i;
+
+  // The mode info is that of the last coded frame, not the frame shown.
+  if (cm->show_existing_frame) return VPX_CODEC_ERROR;
+
+  if (map->info == NULL || (int)map->rows != cm->mi_rows ||
+      (int)map->cols != cm->mi_cols)
+    return VPX_CODEC_INVALID_PARAM;
+
+  for (mi_row = 0; mi_row < cm->mi_rows; ++mi_row) {
+    for (mi_col = 0; mi_col < cm->mi_cols; ++mi_col) {
+      const MODE_INFO *const mi =
+          cm->mi_grid_visible[mi_row * cm->mi_stride + mi_col];
+      vpx_mode_info_t *const info = &map->info[mi_row * cm->mi_cols + mi_col];
+
+      memset(info, 0, sizeof(*info));
+      info->ref_frame[1] = NO_REF_FRAME;
+      if (mi == NULL) {
+        // Not decoded, e.g. a corrupt frame.
+        info->block_width = 8;
+        info->block_height = 8;
+        info->mode = DC_PRED;
+        continue;
+      }
+      info->block_width = 4 * num_4x4_blocks_wide_lookup[mi->sb_type];
+      info->block_height = 4 * num_4x4_blocks_high_lookup[mi->sb_type];
+      info->mode = mi->mode;
+      for (i = 0; i < 2; ++i) {
+        info->ref_frame[i] = mi->ref_frame[i];
+        if (mi->ref_frame[i] > INTRA_FRAME) {
+          info->mv_row[i] = mi->mv[i].as_mv.row;
+          info->mv_col[i] = mi->mv[i].as_mv.col;
+        }
+      }
+    }
+  }
+  return VPX_CODEC_OK;
+}
+
 /* If any buffer updating is signaled it should be done here. */
 static void swap_frame_buffers(VP9Decoder *pbi) {
   int ref_index = 0, mask;
@@ -369,6 +413,49 @@ static void swap_frame_buffers(VP9Decoder *pbi) {
     cm->frame_refs[ref_index].idx = -1;
 }
 
+// Updates the state that only the headers of the next frame depend on. In
+// frame parallel decode this is done as soon as the headers have been read.
+static void update_frame_header_state(VP9Decoder *pbi) {
+  VP9_COMMON *const cm = &pbi->common;
+
+  if (!cm->show_existing_frame) {
+    cm->last_show_frame = cm->show_frame;
+    cm->last_width = cm->width;
+    cm->last_height = cm->height;
+  }
+  if (cm->show_frame) {
+    cm->current_video_frame++;
+  }
+}
+
+static void add_frame_timing(VP9Decoder *pbi) {
+  vpx_dec_component_timing_t *const timing = &pbi->stage_timing;
+  int i;
+  ++timing->frames;
+  timing->recon_us += pbi->frame_timing.recon_us;
+  timing->parse_us += pbi->frame_timing.parse_us;
+  timing->loop_filter_us += pbi->frame_timing.loop_filter_us;
+  for (i = 0; i < VPX_MAX_TILE_COLS; ++i)
+    timing->tile_us[i] += pbi->frame_timing.tile_us[i];
+  vp9_zero(pbi->frame_timing);
+}
+
+static void finish_frame(VP9Decoder *pbi) {
+  VP9_COMMON *const cm = &pbi->common;
+
+  if (pbi->time_stages) add_frame_timing(pbi);
+  swap_frame_buffers(pbi);
+
+  vpx_clear_system_state();
+
+  if (!cm->show_existing_frame) {
+    cm->prev_frame = cm->cur_frame;
+    if (cm->seg.enabled) vp9_swap_current_and_last_seg_map(cm);
+  }
+
+  if (cm->show_frame) cm->cur_show_frame_fb_idx = cm->new_fb_idx;
+}
+
 static void release_fb_on_decoder_exit(VP9Decoder *pbi) {
   const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
   VP9_COMMON *volatile const cm = &pbi->common;
@@ -383,6 +470,12 @@ static void release_fb_on_decoder_exit(VP9Decoder *pbi) {
     winterface->sync(&pbi->tile_workers[i]);
   }
 
+  // Release the previous frame if this frame was holding it.
+  if (pbi->prev_buf != NULL) {
+    decrease_ref_count((int)(pbi->prev_buf - frame_bufs), frame_bufs, pool);
+    pbi->prev_buf = NULL;
+  }
+
   // Release all the reference buffers if worker thread is holding them.
   if (pbi->hold_ref_buf == 1) {
     int ref_index = 0, mask;
@@ -441,6 +534,14 @@ int vp9_receive_compressed_data(VP9Decoder *pbi, size_t size,
     frame_bufs[cm->new_fb_idx].released = 1;
   }
 
+  // In frame parallel decode the previous frame may still be decoding or may
+  // have been released already. Hold it so that its motion vectors stay valid
+  // until this frame is finished.
+  if (pbi->frame_parallel_decode && cm->prev_frame != NULL) {
+    pbi->prev_buf = cm->prev_frame;
+    ++pbi->prev_buf->ref_count;
+  }
+
   // Find a free frame buffer. Return error if can not find any.
   cm->new_fb_idx = get_free_fb(cm);
   if (cm->new_fb_idx == INVALID_IDX) {
@@ -471,27 +572,36 @@ int vp9_receive_compressed_data(VP9Decoder *pbi, size_t size,
   cm->error.setjmp = 1;
   vp9_decode_frame(pbi, source, source + size, psource);
 
-  swap_frame_buffers(pbi);
+  // In frame parallel decode only the headers have been read. The frame
+  // worker decodes the tiles and vp9_finish_decoding_frame() completes the
+  // frame.
+  if (!pbi->frame_parallel_decode) finish_frame(pbi);
+  update_frame_header_state(pbi);
 
-  vpx_clear_system_state();
-
-  if (!cm->show_existing_frame) {
-    cm->last_show_frame = cm->show_frame;
-    cm->prev_frame = cm->cur_frame;
-    if (cm->seg.enabled) vp9_swap_current_and_last_seg_map(cm);
-  }
+  cm->error.setjmp = 0;
+  return retcode;
+}
 
-  if (cm->show_frame) cm->cur_show_frame_fb_idx = cm->new_fb_idx;
+int vp9_finish_decoding_frame(VP9Decoder *pbi, int failed) {
+  VP9_COMMON *const cm = &pbi->common;
+  BufferPool *const pool = cm->buffer_pool;
+  RefCntBuffer *const frame_bufs = pool->frame_bufs;
 
-  // Update progress in frame parallel decode.
-  cm->last_width = cm->width;
-  cm->last_height = cm->height;
-  if (cm->show_frame) {
-    cm->current_video_frame++;
+  if (failed) {
+    pbi->ready_for_new_data = 1;
+    release_fb_on_decoder_exit(pbi);
+    // Release current frame.
+    decrease_ref_count(cm->new_fb_idx, frame_bufs, pool);
+    vpx_clear_system_state();
+    return -1;
   }
 
-  cm->error.setjmp = 0;
-  return retcode;
+  if (pbi->prev_buf != NULL) {
+    decrease_ref_count((int)(pbi->prev_buf - frame_bufs), frame_bufs, pool);
+    pbi->prev_buf = NULL;
+  }
+  finish_frame(pbi);
+  return 0;
 }
 
 int vp9_get_raw_frame(VP9Decoder *pbi, YV12_BUFFER_CONFIG *sd,
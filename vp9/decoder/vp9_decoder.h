@@ -13,9 +13,12 @@
 
 #include "./vpx_config.h"
 
+#include "vpx/vp8dx.h"
 #include "vpx/vpx_codec.h"
 #include "vpx_dsp/bitreader.h"
+#include "vpx_ports/vpx_timer.h"
 #include "vpx_scale/yv12config.h"
+#include "vpx_util/vpx_atomics.h"
 #include "vpx_util/vpx_pthread.h"
 #include "vpx_util/vpx_thread.h"
 
@@ -38,6 +41,8 @@ typedef struct ThreadData {
   struct VP9Decoder *pbi;
   LFWorkerData *lf_data;
   VP9LfSync *lf_sync;
+  // Stage times of the jobs run by this thread in the current frame.
+  vpx_dec_component_timing_t timing;
 } ThreadData;
 
 typedef struct TileBuffer {
@@ -58,6 +63,9 @@ typedef struct TileWorkerData {
   DECLARE_ALIGNED(32, tran_low_t, dqcoeff[32 * 32]);
   DECLARE_ALIGNED(16, uint16_t, extend_and_predict_buf[80 * 2 * 80 * 2]);
   struct vpx_internal_error_info error_info;
+  // Stage times of the tile worker in the current frame.
+  uint64_t recon_us;
+  uint64_t loop_filter_us;
 } TileWorkerData;
 
 typedef void (*process_block_fn_t)(TileWorkerData *twd,
@@ -70,7 +78,6 @@ typedef struct RowMTWorkerData {
   int *eob[MAX_MB_PLANE];
   PARTITION_TYPE *partition;
   tran_low_t *dqcoeff[MAX_MB_PLANE];
-  int8_t *recon_map;
   const uint8_t *data_end;
   uint8_t *jobq_buf;
   JobQueueRowMt jobq;
@@ -79,6 +86,8 @@ typedef struct RowMTWorkerData {
   int num_jobs;
 #if CONFIG_MULTITHREAD
   pthread_mutex_t recon_done_mutex;
+  // Per tile row recon progress, indexed by sb_row * tile_cols + tile_col.
+  vpx_atomic_int *recon_progress;
   pthread_mutex_t *recon_sync_mutex;
   pthread_cond_t *recon_sync_cond;
 #endif
@@ -125,11 +134,34 @@ typedef struct VP9Decoder {
   int row_mt;
   int lpf_mt_opt;
   RowMTWorkerData *row_mt_worker_data;
+
+  // Frame parallel decode: vp9_decode_frame() only reads the headers, the
+  // tiles in [frame_data, frame_data_end) are decoded by the frame worker
+  // (see vp9_dthread.h).
+  int frame_parallel_decode;
+  const uint8_t *frame_data;
+  const uint8_t *frame_data_end;
+  // Frame parallel decode: reference held on cm->prev_frame while its motion
+  // vectors may be read.
+  RefCntBuffer *prev_buf;
+
+  // Stage times accumulated while time_stages is set, see
+  // VP9D_SET_COMPONENT_TIMING. The tile decoding of a frame, which may run on
+  // the frame worker, is timed in frame_timing and added to stage_timing once
+  // the frame is finished.
+  int time_stages;
+  vpx_dec_component_timing_t stage_timing;
+  vpx_dec_component_timing_t frame_timing;
 } VP9Decoder;
 
 int vp9_receive_compressed_data(struct VP9Decoder *pbi, size_t size,
                                 const uint8_t **psource);
 
+// Frame parallel decode: completes the frame whose tiles were decoded by the
+// frame worker after vp9_receive_compressed_data() read its headers. 'failed'
+// is set if the frame worker hit an error.
+int vp9_finish_decoding_frame(struct VP9Decoder *pbi, int failed);
+
 int vp9_get_raw_frame(struct VP9Decoder *pbi, YV12_BUFFER_CONFIG *sd,
                       vp9_ppflags_t *flags);
 
@@ -141,6 +173,12 @@ vpx_codec_err_t vp9_set_reference_dec(VP9_COMMON *cm,
                                       VP9_REFFRAME ref_frame_flag,
                                       YV12_BUFFER_CONFIG *sd);
 
+// Copies the mode info of the last decoded frame to 'map', whose dimensions
+// must match the frame in 8x8 units. Fails if the last frame showed an
+// existing frame.
+vpx_codec_err_t vp9_get_mode_info(const struct VP9Decoder *pbi,
+                                  vpx_mode_info_map_t *map);
+
 static INLINE uint8_t read_marker(vpx_decrypt_cb decrypt_cb,
                                   void *decrypt_state, const uint8_t *data) {
   if (decrypt_cb) {
@@ -167,6 +205,21 @@ void vp9_dec_alloc_row_mt_mem(RowMTWorkerData *row_mt_worker_data,
                               int num_jobs);
 void vp9_dec_free_row_mt_mem(RowMTWorkerData *row_mt_worker_data);
 
+static INLINE void start_stage_timer(const VP9Decoder *pbi,
+                                     struct vpx_usec_timer *timer) {
+  if (pbi->time_stages) vpx_usec_timer_start(timer);
+}
+
+// Adds the time since start_stage_timer() to *stage_time.
+static INLINE void end_stage_timer(const VP9Decoder *pbi,
+                                   struct vpx_usec_timer *timer,
+                                   uint64_t *stage_time) {
+  if (pbi->time_stages) {
+    vpx_usec_timer_mark(timer);
+    *stage_time += vpx_usec_timer_elapsed(timer);
+  }
+}
+
 static INLINE void decrease_ref_count(int idx, RefCntBuffer *const frame_bufs,
                                       BufferPool *const pool) {
   if (idx >= 0 && frame_bufs[idx].ref_count > 0) {
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "./vpx_config.h"
+#include "vpx_util/vpx_atomics.h"
+#include "vpx_util/vpx_pthread.h"
+
+#include "vp9/decoder/vp9_decodeframe.h"
+#include "vp9/decoder/vp9_decoder.h"
+#include "vp9/decoder/vp9_dthread.h"
+
+int vp9_frameworker_hook(void *arg1, void *arg2) {
+  FrameWorkerData *const frame_worker_data = (FrameWorkerData *)arg1;
+  VP9Decoder *const pbi = frame_worker_data->pbi;
+  VP9_COMMON *const cm = &pbi->common;
+  (void)arg2;
+
+  // Nothing is decoded when showing an existing frame.
+  if (cm->show_existing_frame) return 1;
+
+  if (setjmp(cm->error.jmp)) {
+    cm->error.setjmp = 0;
+    // Release the frame workers waiting on this frame. Their output is
+    // dropped since they depend on a corrupted frame.
+    vp9_frameworker_broadcast(cm->buffer_pool, pbi->cur_buf, INT_MAX);
+    return 0;
+  }
+
+  cm->error.setjmp = 1;
+  frame_worker_data->frame_end = vp9_decode_frame_tiles(pbi);
+  cm->error.setjmp = 0;
+  return 1;
+}
+
+void vp9_frameworker_wait(BufferPool *pool, RefCntBuffer *ref_buf, int row) {
+#if CONFIG_MULTITHREAD
+  if (ref_buf == NULL || vpx_atomic_load_acquire(&ref_buf->row) >= row) return;
+
+  pthread_mutex_lock(&pool->progress_mutex);
+  while (vpx_atomic_load_acquire(&ref_buf->row) < row) {
+    pthread_cond_wait(&pool->progress_cond, &pool->progress_mutex);
+  }
+  pthread_mutex_unlock(&pool->progress_mutex);
+#else
+  (void)pool;
+  (void)ref_buf;
+  (void)row;
+#endif  // CONFIG_MULTITHREAD
+}
+
+void vp9_frameworker_broadcast(BufferPool *pool, RefCntBuffer *buf, int row) {
+#if CONFIG_MULTITHREAD
+  pthread_mutex_lock(&pool->progress_mutex);
+  vpx_atomic_store_release(&buf->row, row);
+  pthread_cond_broadcast(&pool->progress_cond);
+  pthread_mutex_unlock(&pool->progress_mutex);
+#else
+  (void)pool;
+  (void)buf;
+  (void)row;
+#endif  // CONFIG_MULTITHREAD
+}
+
+void vp9_frameworker_copy_context(VP9Decoder *dst, const VP9Decoder *src) {
+  VP9_COMMON *const cm = &dst->common;
+  const VP9_COMMON *const src_cm = &src->common;
+
+  // The reference buffer map is only updated when the source frame is
+  // finished. Until then it is held in next_ref_frame_map.
+  if (src->hold_ref_buf) {
+    memcpy(cm->ref_frame_map, src_cm->next_ref_frame_map,
+           sizeof(cm->ref_frame_map));
+  } else {
+    memcpy(cm->ref_frame_map, src_cm->ref_frame_map,
+           sizeof(cm->ref_frame_map));
+  }
+  memcpy(cm->frame_contexts, src_cm->frame_contexts,
+         FRAME_CONTEXTS * sizeof(cm->frame_contexts[0]));
+
+  cm->last_width = src_cm->last_width;
+  cm->last_height = src_cm->last_height;
+  cm->last_show_frame = src_cm->last_show_frame;
+  cm->current_video_frame = src_cm->current_video_frame;
+  cm->prev_frame =
+      src_cm->show_existing_frame ? src_cm->prev_frame : src_cm->cur_frame;
+
+  cm->frame_type = src_cm->frame_type;
+  cm->intra_only = src_cm->intra_only;
+  cm->bit_depth = src_cm->bit_depth;
+#if CONFIG_VP9_HIGHBITDEPTH
+  cm->use_highbitdepth = src_cm->use_highbitdepth;
+#endif
+  cm->subsampling_x = src_cm->subsampling_x;
+  cm->subsampling_y = src_cm->subsampling_y;
+  cm->color_space = src_cm->color_space;
+  cm->color_range = src_cm->color_range;
+
+  cm->seg = src_cm->seg;
+  memcpy(cm->lf.ref_deltas, src_cm->lf.ref_deltas, sizeof(cm->lf.ref_deltas));
+  memcpy(cm->lf.mode_deltas, src_cm->lf.mode_deltas,
+         sizeof(cm->lf.mode_deltas));
+  cm->lf.mode_ref_delta_enabled = src_cm->lf.mode_ref_delta_enabled;
+  memcpy(cm->ref_frame_sign_bias, src_cm->ref_frame_sign_bias,
+         sizeof(cm->ref_frame_sign_bias));
+
+  dst->need_resync = src->need_resync;
+}
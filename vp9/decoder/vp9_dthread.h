@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VPX_VP9_DECODER_VP9_DTHREAD_H_
+#define VPX_VP9_DECODER_VP9_DTHREAD_H_
+
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+
+#include "vp9/common/vp9_onyxc_int.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct VP9Decoder;
+
+// Frame parallel decode: each frame worker owns a VP9Decoder. The headers of
+// a frame are read on the calling thread, then the worker decodes the tiles
+// while the next frame is started on another worker.
+typedef struct FrameWorkerData {
+  struct VP9Decoder *pbi;
+  // Copy of the compressed frame. The tiles are read after the call to
+  // vpx_codec_decode() that submitted the frame has returned.
+  uint8_t *data;
+  size_t data_size;
+  void *user_priv;
+  // Submission order of the frame held by this worker.
+  int64_t frame_seq;
+  // Set while the worker holds a frame that has not been finished yet.
+  int frame_pending;
+  // Set if the frame is returned by vpx_codec_get_frame() once finished.
+  int output;
+  // Size of the frame in 'data', and its end as found by the decoder. The end
+  // is only known once the tiles have been decoded.
+  size_t frame_size;
+  const uint8_t *frame_end;
+  // Set if another frame may follow this one in 'data' (no superframe index).
+  int check_end;
+} FrameWorkerData;
+
+// Decodes the tiles of the frame whose headers were read into 'arg1'
+// (FrameWorkerData). Returns 0 on error.
+int vp9_frameworker_hook(void *arg1, void *arg2);
+
+// Blocks until 'row' luma rows of 'ref_buf' have been decoded. 'row' is
+// compared against the progress published with vp9_frameworker_broadcast().
+void vp9_frameworker_wait(BufferPool *pool, RefCntBuffer *ref_buf, int row);
+
+// Publishes that 'row' luma rows of 'buf' are final and wakes up any frame
+// worker waiting on it.
+void vp9_frameworker_broadcast(BufferPool *pool, RefCntBuffer *buf, int row);
+
+// Copies the decoder state that the headers of the next frame depend on from
+// 'src' (the previous frame in decode order) into 'dst'.
+void vp9_frameworker_copy_context(struct VP9Decoder *dst,
+                                  const struct VP9Decoder *src);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // VPX_VP9_DECODER_VP9_DTHREAD_H_
@@ -16,28 +16,127 @@
 
 #include "vp9/decoder/vp9_job_queue.h"
 
-void vp9_jobq_init(JobQueueRowMt *jobq, uint8_t *buf, size_t buf_size) {
+// The queue is a ring of slots, each tagged with a sequence number. A slot at
+// position 'pos' can be written when its sequence number is 'pos', and read
+// once the writer has set it to 'pos + 1'. The reader then sets it to
+// 'pos + num_slots', handing the slot over to the next lap of writers.
+// Producers and consumers claim positions with a compare-exchange on
+// write_pos / read_pos, so they never wait on each other.
+
+#if CONFIG_MULTITHREAD
+static INLINE int counter_load(const JobQueueCounter *counter) {
+  return vpx_atomic_load_acquire(counter);
+}
+
+static INLINE void counter_store(JobQueueCounter *counter, int value) {
+  vpx_atomic_store_release(counter, value);
+}
+
+static INLINE int counter_compare_exchange(JobQueueCounter *counter,
+                                           int *expected, int desired) {
+  return vpx_atomic_compare_exchange(counter, expected, desired);
+}
+#else
+static INLINE int counter_load(const JobQueueCounter *counter) {
+  return *counter;
+}
+
+static INLINE void counter_store(JobQueueCounter *counter, int value) {
+  *counter = value;
+}
+
+static INLINE int counter_compare_exchange(JobQueueCounter *counter,
+                                           int *expected, int desired) {
+  if (*counter != *expected) {
+    *expected = *counter;
+    return 0;
+  }
+  *counter = desired;
+  return 1;
+}
+#endif  // CONFIG_MULTITHREAD
+
+static size_t get_slot_size(size_t job_size) {
+  // Keep the sequence number of every slot aligned.
+  return (sizeof(JobQueueCounter) + job_size + sizeof(JobQueueCounter) - 1) &
+         ~(sizeof(JobQueueCounter) - 1);
+}
+
+static JobQueueCounter *get_slot(const JobQueueRowMt *jobq, int pos) {
+  return (JobQueueCounter *)(jobq->buf_base +
+                             (size_t)(pos % jobq->num_slots) *
+                                 jobq->slot_size);
+}
+
+static int try_queue(JobQueueRowMt *jobq, const void *job, size_t job_size) {
+  int pos = counter_load(&jobq->write_pos);
+  JobQueueCounter *seq;
+
+  while (1) {
+    int diff;
+    seq = get_slot(jobq, pos);
+    diff = counter_load(seq) - pos;
+    if (diff == 0) {
+      if (counter_compare_exchange(&jobq->write_pos, &pos, pos + 1)) break;
+    } else if (diff < 0) {
+      // All the slots are in use.
+      return 1;
+    } else {
+      pos = counter_load(&jobq->write_pos);
+    }
+  }
+  memcpy(seq + 1, job, job_size);
+  counter_store(seq, pos + 1);
+  return 0;
+}
+
+static int try_dequeue(JobQueueRowMt *jobq, void *job, size_t job_size) {
+  int pos = counter_load(&jobq->read_pos);
+  JobQueueCounter *seq;
+
+  while (1) {
+    int diff;
+    seq = get_slot(jobq, pos);
+    diff = counter_load(seq) - (pos + 1);
+    if (diff == 0) {
+      if (counter_compare_exchange(&jobq->read_pos, &pos, pos + 1)) break;
+    } else if (diff < 0) {
+      // The slot has not been written yet.
+      return 1;
+    } else {
+      pos = counter_load(&jobq->read_pos);
+    }
+  }
+  memcpy(job, seq + 1, job_size);
+  counter_store(seq, pos + jobq->num_slots);
+  return 0;
+}
+
+size_t vp9_jobq_buf_size(int num_jobs, size_t job_size) {
+  return (size_t)num_jobs * get_slot_size(job_size);
+}
+
+void vp9_jobq_init(JobQueueRowMt *jobq, uint8_t *buf, size_t buf_size,
+                   size_t job_size) {
 #if CONFIG_MULTITHREAD
   pthread_mutex_init(&jobq->mutex, NULL);
   pthread_cond_init(&jobq->cond, NULL);
+  vpx_atomic_init(&jobq->num_waiters, 0);
 #endif
   jobq->buf_base = buf;
-  jobq->buf_wr = buf;
-  jobq->buf_rd = buf;
-  jobq->buf_end = buf + buf_size;
-  jobq->terminate = 0;
+  jobq->slot_size = get_slot_size(job_size);
+  jobq->num_slots = (int)(buf_size / jobq->slot_size);
+  assert(jobq->num_slots > 0);
+  vp9_jobq_reset(jobq);
 }
 
+// Must not be called while other threads use the queue.
 void vp9_jobq_reset(JobQueueRowMt *jobq) {
-#if CONFIG_MULTITHREAD
-  pthread_mutex_lock(&jobq->mutex);
-#endif
-  jobq->buf_wr = jobq->buf_base;
-  jobq->buf_rd = jobq->buf_base;
-  jobq->terminate = 0;
-#if CONFIG_MULTITHREAD
-  pthread_mutex_unlock(&jobq->mutex);
-#endif
+  int i;
+  for (i = 0; i < jobq->num_slots; ++i) counter_store(get_slot(jobq, i), i);
+  counter_store(&jobq->write_pos, 0);
+  counter_store(&jobq->read_pos, 0);
+  counter_store(&jobq->terminate, 0);
 }
 
 void vp9_jobq_deinit(JobQueueRowMt *jobq) {
@@ -49,77 +148,55 @@ void vp9_jobq_deinit(JobQueueRowMt *jobq) {
 }
 
 void vp9_jobq_terminate(JobQueueRowMt *jobq) {
+  counter_store(&jobq->terminate, 1);
 #if CONFIG_MULTITHREAD
   pthread_mutex_lock(&jobq->mutex);
-#endif
-  jobq->terminate = 1;
-#if CONFIG_MULTITHREAD
   pthread_cond_broadcast(&jobq->cond);
   pthread_mutex_unlock(&jobq->mutex);
 #endif
 }
 
 int vp9_jobq_queue(JobQueueRowMt *jobq, void *job, size_t job_size) {
-  int ret = 0;
-#if CONFIG_MULTITHREAD
-  pthread_mutex_lock(&jobq->mutex);
-#endif
-  if (jobq->buf_end >= jobq->buf_wr + job_size) {
-    memcpy(jobq->buf_wr, job, job_size);
-    jobq->buf_wr = jobq->buf_wr + job_size;
-#if CONFIG_MULTITHREAD
-    pthread_cond_signal(&jobq->cond);
-#endif
-    ret = 0;
-  } else {
-    /* Wrap around case is not supported */
+  assert(get_slot_size(job_size) <= jobq->slot_size);
+  if (try_queue(jobq, job, job_size)) {
+    /* Queue full case is not supported */
     assert(0);
-    ret = 1;
+    return 1;
   }
 #if CONFIG_MULTITHREAD
-  pthread_mutex_unlock(&jobq->mutex);
+  // Read num_waiters with a read-modify-write so that it is ordered after the
+  // slot update above: either a sleeping thread is seen here, or it sees the
+  // new job when it checks the queue after registering itself.
+  if (vpx_atomic_fetch_add(&jobq->num_waiters, 0) > 0) {
+    pthread_mutex_lock(&jobq->mutex);
+    pthread_cond_signal(&jobq->cond);
+    pthread_mutex_unlock(&jobq->mutex);
+  }
 #endif
-  return ret;
+  return 0;
 }
 
 int vp9_jobq_dequeue(JobQueueRowMt *jobq, void *job, size_t job_size,
                      int blocking) {
-  int ret = 0;
+  int ret;
+  assert(get_slot_size(job_size) <= jobq->slot_size);
+  if (!try_dequeue(jobq, job, job_size)) return 0;
+
+  /* If all the entries have been dequeued, or if there is no job available
+   * and this is non blocking call, then return fail */
+  if (counter_load(&jobq->terminate) || blocking != 1) return 1;
+
 #if CONFIG_MULTITHREAD
   pthread_mutex_lock(&jobq->mutex);
-#endif
-  if (jobq->buf_end >= jobq->buf_rd + job_size) {
-    while (1) {
-      if (jobq->buf_wr >= jobq->buf_rd + job_size) {
-        memcpy(job, jobq->buf_rd, job_size);
-        jobq->buf_rd = jobq->buf_rd + job_size;
-        ret = 0;
-        break;
-      } else {
-        /* If all the entries have been dequeued, then break and return */
-        if (jobq->terminate == 1) {
-          ret = 1;
-          break;
-        }
-        if (blocking == 1) {
-#if CONFIG_MULTITHREAD
-          pthread_cond_wait(&jobq->cond, &jobq->mutex);
-#endif
-        } else {
-          /* If there is no job available,
-           * and this is non blocking call then return fail */
-          ret = 1;
-          break;
-        }
-      }
-    }
-  } else {
-    /* Wrap around case is not supported */
-    ret = 1;
+  vpx_atomic_fetch_add(&jobq->num_waiters, 1);
+  while ((ret = try_dequeue(jobq, job, job_size)) != 0 &&
+         !counter_load(&jobq->terminate)) {
+    pthread_cond_wait(&jobq->cond, &jobq->mutex);
   }
-#if CONFIG_MULTITHREAD
+  vpx_atomic_fetch_add(&jobq->num_waiters, -1);
   pthread_mutex_unlock(&jobq->mutex);
+#else
+  ret = 1;
 #endif
-
   return ret;
 }
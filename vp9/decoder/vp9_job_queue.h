@@ -11,30 +11,55 @@
 #ifndef VPX_VP9_DECODER_VP9_JOB_QUEUE_H_
 #define VPX_VP9_DECODER_VP9_JOB_QUEUE_H_
 
+#include <stddef.h>
+
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_util/vpx_atomics.h"
 #include "vpx_util/vpx_pthread.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_MULTITHREAD
+typedef vpx_atomic_int JobQueueCounter;
+#else
+typedef int JobQueueCounter;
+#endif
+
+// Bounded multi-producer multi-consumer FIFO. Jobs are queued and dequeued
+// without taking a lock; the mutex is only used to put a thread with nothing
+// to do to sleep.
 typedef struct {
-  // Pointer to buffer base which contains the jobs
+  // Pointer to buffer base which contains the job slots. Each slot holds a
+  // sequence number followed by the job.
   uint8_t *buf_base;
 
-  // Pointer to current address where new job can be added
-  uint8_t *volatile buf_wr;
+  size_t slot_size;
 
-  // Pointer to current address from where next job can be obtained
-  uint8_t *volatile buf_rd;
+  int num_slots;
 
-  // Pointer to end of job buffer
-  uint8_t *buf_end;
+  // Number of jobs queued and dequeued since the last reset.
+  JobQueueCounter write_pos;
+  JobQueueCounter read_pos;
 
-  int terminate;
+  JobQueueCounter terminate;
 
 #if CONFIG_MULTITHREAD
+  // Number of threads sleeping in vp9_jobq_dequeue().
+  vpx_atomic_int num_waiters;
   pthread_mutex_t mutex;
   pthread_cond_t cond;
 #endif
 } JobQueueRowMt;
 
-void vp9_jobq_init(JobQueueRowMt *jobq, uint8_t *buf, size_t buf_size);
+// Returns the size of the buffer needed to hold 'num_jobs' jobs of 'job_size'
+// bytes.
+size_t vp9_jobq_buf_size(int num_jobs, size_t job_size);
+
+void vp9_jobq_init(JobQueueRowMt *jobq, uint8_t *buf, size_t buf_size,
+                   size_t job_size);
 void vp9_jobq_reset(JobQueueRowMt *jobq);
 void vp9_jobq_deinit(JobQueueRowMt *jobq);
 void vp9_jobq_terminate(JobQueueRowMt *jobq);
@@ -42,4 +67,8 @@ int vp9_jobq_queue(JobQueueRowMt *jobq, void *job, size_t job_size);
 int vp9_jobq_dequeue(JobQueueRowMt *jobq, void *job, size_t job_size,
                      int blocking);
 
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
 #endif  // VPX_VP9_DECODER_VP9_JOB_QUEUE_H_
@@ -2394,6 +2394,58 @@ static void set_fixed_partitioning(VP9_COMP *cpi, const TileInfo *const tile,
   }
 }
 
+// Sets the partitioning of the block of size bsize at mi_row, mi_col from the
+// mode info hints of the frame. A block is split further where the hinted
+// block does not fit the frame, as the bitstream requires, and blocks smaller
+// than 8x8 are only used if allow_sub8x8 is set.
+static void set_mode_info_partitioning(VP9_COMP *cpi, MODE_INFO **mi_8x8,
+                                       int mi_row, int mi_col,
+                                       BLOCK_SIZE bsize, int allow_sub8x8) {
+  VP9_COMMON *const cm = &cpi->common;
+  const int mis = cm->mi_stride;
+  const int bs = num_8x8_blocks_wide_lookup[bsize];
+  const int hbs = bs >> 1;
+  const int has_rows = mi_row + hbs < cm->mi_rows;
+  const int has_cols = mi_col + hbs < cm->mi_cols;
+  const int width = 4 * num_4x4_blocks_wide_lookup[bsize];
+  const vpx_mode_info_t *info;
+  PARTITION_TYPE partition;
+
+  if (mi_row >= cm->mi_rows || mi_col >= cm->mi_cols) return;
+
+  info = get_mode_info_hint(cpi, mi_row, mi_col);
+  assert(info != NULL);
+  if (info->block_width >= width && info->block_height >= width)
+    partition = PARTITION_NONE;
+  else if (info->block_width >= width && info->block_height >= width / 2)
+    partition = PARTITION_HORZ;
+  else if (info->block_height >= width && info->block_width >= width / 2)
+    partition = PARTITION_VERT;
+  else
+    partition = PARTITION_SPLIT;
+
+  if ((partition == PARTITION_NONE && (!has_rows || !has_cols)) ||
+      (partition == PARTITION_HORZ && !has_cols) ||
+      (partition == PARTITION_VERT && !has_rows))
+    partition = PARTITION_SPLIT;
+  if (bsize == BLOCK_8X8 && !allow_sub8x8) partition = PARTITION_NONE;
+
+  if (partition != PARTITION_SPLIT || bsize == BLOCK_8X8) {
+    mi_8x8[0] = cm->mi + mi_row * mis + mi_col;
+    mi_8x8[0]->sb_type = get_subsize(bsize, partition);
+  } else {
+    const BLOCK_SIZE subsize = get_subsize(bsize, PARTITION_SPLIT);
+    set_mode_info_partitioning(cpi, mi_8x8, mi_row, mi_col, subsize,
+                               allow_sub8x8);
+    set_mode_info_partitioning(cpi, mi_8x8 + hbs, mi_row, mi_col + hbs,
+                               subsize, allow_sub8x8);
+    set_mode_info_partitioning(cpi, mi_8x8 + hbs * mis, mi_row + hbs, mi_col,
+                               subsize, allow_sub8x8);
+    set_mode_info_partitioning(cpi, mi_8x8 + hbs * mis + hbs, mi_row + hbs,
+                               mi_col + hbs, subsize, allow_sub8x8);
+  }
+}
+
 static const struct {
   int row;
   int col;
@@ -2683,6 +2735,9 @@ static void rd_use_partition(VP9_COMP *cpi, ThreadData *td,
   int splits_below = 0;
   BLOCK_SIZE bs_type = mi_8x8[0]->sb_type;
   int do_partition_search = 1;
+  // The partitioning of a transcoded source is refined by one level.
+  const int adjust_partitioning =
+      cpi->sf.adjust_partitioning_from_last_frame || use_mode_info_hints(cpi);
   PICK_MODE_CONTEXT *ctx = &pc_tree->none;
 
   if (mi_row >= cm->mi_rows || mi_col >= cm->mi_cols) return;
@@ -2707,7 +2762,7 @@ static void rd_use_partition(VP9_COMP *cpi, ThreadData *td,
 
   if (do_partition_search &&
       cpi->sf.partition_search_type == SEARCH_PARTITION &&
-      cpi->sf.adjust_partitioning_from_last_frame) {
+      adjust_partitioning) {
     // Check if any of the sub blocks are further split.
     if (partition == PARTITION_SPLIT && subsize > BLOCK_8X8) {
       sub_subsize = get_subsize(subsize, PARTITION_SPLIT);
@@ -2750,10 +2805,15 @@ static void rd_use_partition(VP9_COMP *cpi, ThreadData *td,
                        ctx, INT_MAX, INT64_MAX);
       break;
     case PARTITION_HORZ:
+      // Only a mode info map gives an 8x8 node a 8x4 or 4x8 block: the fixed
+      // and variance based partitionings stop at 8x8 or split to 4x4. The
+      // sub8x8 search covers the whole 8x8 block then, and the second
+      // context of an 8x8 node has no buffers.
+      assert(bsize > BLOCK_8X8 || use_mode_info_hints(cpi));
       pc_tree->horizontal[0].skip_ref_frame_mask = 0;
       rd_pick_sb_modes(cpi, tile_data, x, mi_row, mi_col, &last_part_rdc,
                        subsize, &pc_tree->horizontal[0], INT_MAX, INT64_MAX);
-      if (last_part_rdc.rate != INT_MAX && bsize >= BLOCK_8X8 &&
+      if (last_part_rdc.rate != INT_MAX && bsize > BLOCK_8X8 &&
           mi_row + (mi_step >> 1) < cm->mi_rows) {
         RD_COST tmp_rdc;
         PICK_MODE_CONTEXT *hctx = &pc_tree->horizontal[0];
@@ -2774,10 +2834,11 @@ static void rd_use_partition(VP9_COMP *cpi, ThreadData *td,
       }
       break;
     case PARTITION_VERT:
+      assert(bsize > BLOCK_8X8 || use_mode_info_hints(cpi));
       pc_tree->vertical[0].skip_ref_frame_mask = 0;
       rd_pick_sb_modes(cpi, tile_data, x, mi_row, mi_col, &last_part_rdc,
                        subsize, &pc_tree->vertical[0], INT_MAX, INT64_MAX);
-      if (last_part_rdc.rate != INT_MAX && bsize >= BLOCK_8X8 &&
+      if (last_part_rdc.rate != INT_MAX && bsize > BLOCK_8X8 &&
           mi_col + (mi_step >> 1) < cm->mi_cols) {
         RD_COST tmp_rdc;
         PICK_MODE_CONTEXT *vctx = &pc_tree->vertical[0];
@@ -2837,7 +2898,7 @@ static void rd_use_partition(VP9_COMP *cpi, ThreadData *td,
         RDCOST(x->rdmult, x->rddiv, last_part_rdc.rate, last_part_rdc.dist);
   }
 
-  if (do_partition_search && cpi->sf.adjust_partitioning_from_last_frame &&
+  if (do_partition_search && adjust_partitioning &&
       cpi->sf.partition_search_type == SEARCH_PARTITION &&
       partition != PARTITION_SPLIT && bsize > BLOCK_8X8 &&
       (mi_row + mi_step < cm->mi_rows ||
@@ -4561,6 +4622,11 @@ static void encode_rd_sb_row(VP9_COMP *cpi, ThreadData *td,
       set_fixed_partitioning(cpi, tile_info, mi, mi_row, mi_col, bsize);
       rd_use_partition(cpi, td, tile_data, mi, tp, mi_row, mi_col, BLOCK_64X64,
                        &dummy_rate, &dummy_dist, 1, td->pc_root);
+    } else if (use_mode_info_hints(cpi)) {
+      set_offsets(cpi, tile_info, x, mi_row, mi_col, BLOCK_64X64);
+      set_mode_info_partitioning(cpi, mi, mi_row, mi_col, BLOCK_64X64, 1);
+      rd_use_partition(cpi, td, tile_data, mi, tp, mi_row, mi_col, BLOCK_64X64,
+                       &dummy_rate, &dummy_dist, 1, td->pc_root);
     } else if (sf->partition_search_type == VAR_BASED_PARTITION &&
                cm->frame_type != KEY_FRAME) {
       choose_partitioning(cpi, tile_info, x, mi_row, mi_col);
@@ -5624,6 +5690,9 @@ static void encode_nonrd_sb_row(VP9_COMP *cpi, ThreadData *td,
       }
     }
 
+    if (use_mode_info_hints(cpi) && !seg_skip)
+      partition_search_type = MODE_INFO_PARTITION;
+
     // Set the partition type of the 64X64 block
     switch (partition_search_type) {
       case VAR_BASED_PARTITION:
@@ -5655,6 +5724,12 @@ static void encode_nonrd_sb_row(VP9_COMP *cpi, ThreadData *td,
         nonrd_use_partition(cpi, td, tile_data, mi, tp, mi_row, mi_col,
                             BLOCK_64X64, 1, &dummy_rdc, td->pc_root);
         break;
+      case MODE_INFO_PARTITION:
+        set_mode_info_partitioning(cpi, mi, mi_row, mi_col, BLOCK_64X64,
+                                   frame_is_intra_only(cm));
+        nonrd_use_partition(cpi, td, tile_data, mi, tp, mi_row, mi_col,
+                            BLOCK_64X64, 1, &dummy_rdc, td->pc_root);
+        break;
       default:
         assert(partition_search_type == REFERENCE_PARTITION);
         x->sb_pickmode_part = 1;
@@ -798,6 +798,138 @@ int vp9_get_active_map(VP9_COMP *cpi, unsigned char *new_map_16x16, int rows,
   }
 }
 
+// Allocates the motion hint and mode info maps for the mi grid of the frame.
+static vpx_codec_err_t alloc_hints(VP9_COMP *cpi) {
+  const VP9_COMMON *const cm = &cpi->common;
+
+  if (cpi->hint_mi_rows == cm->mi_rows && cpi->hint_mi_cols == cm->mi_cols)
+    return VPX_CODEC_OK;
+
+  vpx_free(cpi->motion_hints);
+  vpx_free(cpi->mode_info_hints);
+  cpi->hint_mi_rows = 0;
+  cpi->hint_mi_cols = 0;
+  cpi->motion_hints_enabled = 0;
+  cpi->mode_info_hints_enabled = 0;
+  cpi->motion_hints = (vpx_motion_hint_t *)vpx_malloc(
+      cm->mi_rows * cm->mi_cols * sizeof(*cpi->motion_hints));
+  cpi->mode_info_hints = (vpx_mode_info_t *)vpx_malloc(
+      cm->mi_rows * cm->mi_cols * sizeof(*cpi->mode_info_hints));
+  if (cpi->motion_hints == NULL || cpi->mode_info_hints == NULL)
+    return VPX_CODEC_MEM_ERROR;
+  cpi->hint_mi_rows = cm->mi_rows;
+  cpi->hint_mi_cols = cm->mi_cols;
+  return VPX_CODEC_OK;
+}
+
+vpx_codec_err_t vp9_set_motion_hints(VP9_COMP *cpi,
+                                     const vpx_motion_hint_map_t *map) {
+  const VP9_COMMON *const cm = &cpi->common;
+  const int shift = map->block_size == 16;
+  vpx_codec_err_t res;
+  int r, c;
+
+  if (map->hints == NULL) {
+    cpi->motion_hints_enabled = 0;
+    return VPX_CODEC_OK;
+  }
+
+  if ((map->block_size != 8 && map->block_size != 16) ||
+      (int)map->rows != (cm->mi_rows + shift) >> shift ||
+      (int)map->cols != (cm->mi_cols + shift) >> shift)
+    return VPX_CODEC_INVALID_PARAM;
+
+  res = alloc_hints(cpi);
+  if (res != VPX_CODEC_OK) return res;
+
+  for (r = 0; r < cm->mi_rows; ++r) {
+    for (c = 0; c < cm->mi_cols; ++c) {
+      cpi->motion_hints[r * cm->mi_cols + c] =
+          map->hints[(r >> shift) * map->cols + (c >> shift)];
+    }
+  }
+  cpi->motion_hints_enabled = 1;
+  cpi->motion_hint_refine_only = map->refine_only != 0;
+  return VPX_CODEC_OK;
+}
+
+vpx_codec_err_t vp9_set_mode_info(VP9_COMP *cpi,
+                                  const vpx_mode_info_map_t *map) {
+  const VP9_COMMON *const cm = &cpi->common;
+  vpx_codec_err_t res;
+  int i;
+
+  if (map->info == NULL) {
+    cpi->mode_info_hints_enabled = 0;
+    cpi->motion_hints_enabled = 0;
+    return VPX_CODEC_OK;
+  }
+
+  if ((int)map->rows != cm->mi_rows || (int)map->cols != cm->mi_cols)
+    return VPX_CODEC_INVALID_PARAM;
+
+  res = alloc_hints(cpi);
+  if (res != VPX_CODEC_OK) return res;
+
+  memcpy(cpi->mode_info_hints, map->info,
+         cm->mi_rows * cm->mi_cols * sizeof(*cpi->mode_info_hints));
+
+  // The motion vectors of the source blocks are refined by the motion search.
+  for (i = 0; i < cm->mi_rows * cm->mi_cols; ++i) {
+    cpi->motion_hints[i].mv_row = map->info[i].mv_row[0];
+    cpi->motion_hints[i].mv_col = map->info[i].mv_col[0];
+    cpi->motion_hints[i].ref_frame = map->info[i].ref_frame[0];
+  }
+  cpi->motion_hints_enabled = 1;
+  cpi->motion_hint_refine_only = 1;
+  cpi->mode_info_hints_enabled = 1;
+  return VPX_CODEC_OK;
+}
+
+int vp9_get_mode_info_hint_refs(const VP9_COMP *cpi, int segment_id,
+                                int mi_row, int mi_col,
+                                MV_REFERENCE_FRAME refs[2]) {
+  const vpx_mode_info_t *const info = get_mode_info_hint(cpi, mi_row, mi_col);
+
+  if (info == NULL || cpi->rc.is_src_frame_alt_ref ||
+      segfeature_active(&cpi->common.seg, segment_id, SEG_LVL_REF_FRAME))
+    return 0;
+
+  refs[0] = info->ref_frame[0];
+  refs[1] = info->ref_frame[1];
+  if (refs[0] < INTRA_FRAME || refs[0] > ALTREF_FRAME) return 0;
+  if (refs[0] > INTRA_FRAME &&
+      !(cpi->ref_frame_flags & ref_frame_to_flag(refs[0])))
+    return 0;
+  if (refs[0] == INTRA_FRAME || refs[1] <= INTRA_FRAME ||
+      refs[1] > ALTREF_FRAME || refs[1] == refs[0] ||
+      !(cpi->ref_frame_flags & ref_frame_to_flag(refs[1])))
+    refs[1] = NO_REF_FRAME;
+  return 1;
+}
+
+int vp9_get_motion_hint(const VP9_COMP *cpi, MV_REFERENCE_FRAME ref_frame,
+                        int mi_row, int mi_col, BLOCK_SIZE bsize, MV *mv) {
+  const VP9_COMMON *const cm = &cpi->common;
+  const vpx_motion_hint_t *hint;
+
+  // The hints do not apply to frames coded at another size.
+  if (!cpi->motion_hints_enabled || cpi->hint_mi_rows != cm->mi_rows ||
+      cpi->hint_mi_cols != cm->mi_cols)
+    return 0;
+
+  mi_row = VPXMIN(mi_row + (num_8x8_blocks_high_lookup[bsize] >> 1),
+                  cm->mi_rows - 1);
+  mi_col = VPXMIN(mi_col + (num_8x8_blocks_wide_lookup[bsize] >> 1),
+                  cm->mi_cols - 1);
+  hint = &cpi->motion_hints[mi_row * cm->mi_cols + mi_col];
+  if (hint->ref_frame != ref_frame) return 0;
+
+  mv->row = hint->mv_row >> 3;
+  mv->col = hint->mv_col >> 3;
+  return 1;
+}
+
 void vp9_set_high_precision_mv(VP9_COMP *cpi, int allow_high_precision_mv) {
   MACROBLOCK *const mb = &cpi->td.mb;
   cpi->common.allow_high_precision_mv = allow_high_precision_mv;
@@ -1024,6 +1156,16 @@ static void dealloc_compressor_data(VP9_COMP *cpi) {
   vpx_free(cpi->mi_ssim_rdmult_scaling_factors);
   cpi->mi_ssim_rdmult_scaling_factors = NULL;
 
+  vpx_free(cpi->twopass.fp_motion_field);
+  cpi->twopass.fp_motion_field = NULL;
+
+  vpx_free(cpi->motion_hints);
+  cpi->motion_hints = NULL;
+  vpx_free(cpi->mode_info_hints);
+  cpi->mode_info_hints = NULL;
+  cpi->hint_mi_rows = 0;
+  cpi->hint_mi_cols = 0;
+
 #if CONFIG_RATE_CTRL
   if (cpi->oxcf.use_simple_encode_api) {
     free_partition_info(cpi);
@@ -1288,12 +1430,7 @@ static void alloc_raw_frame_buffers(VP9_COMP *cpi) {
   const VP9EncoderConfig *oxcf = &cpi->oxcf;
 
   if (!cpi->lookahead)
-    cpi->lookahead = vp9_lookahead_init(oxcf->width, oxcf->height,
-                                        cm->subsampling_x, cm->subsampling_y,
-#if CONFIG_VP9_HIGHBITDEPTH
-                                        cm->use_highbitdepth,
-#endif
-                                        oxcf->lag_in_frames);
+    cpi->lookahead = vp9_lookahead_init(oxcf->lag_in_frames);
   if (!cpi->lookahead)
     vpx_internal_error(&cm->error, VPX_CODEC_MEM_ERROR,
                        "Failed to allocate lag buffers");
@@ -1581,7 +1718,8 @@ void vp9_set_rc_buffer_sizes(VP9_COMP *cpi) {
   cpi->fn_ptr[BT].svf = SVF;                                            \
   cpi->fn_ptr[BT].svaf = SVAF;                                          \
   cpi->fn_ptr[BT].sdx4df = SDX4DF;                                      \
-  cpi->fn_ptr[BT].sdsx4df = SDSX4DF;
+  cpi->fn_ptr[BT].sdsx4df = SDSX4DF;                                    \
+  cpi->fn_ptr[BT].sdx8f = NULL;
 
 #define MAKE_BFP_SAD_WRAPPER(fnname)                                           \
   static unsigned int fnname##_bits8(const uint8_t *src_ptr,                   \
@@ -2092,6 +2230,9 @@ void vp9_change_config(struct VP9_COMP *cpi, const VP9EncoderConfig *oxcf) {
   cpi->td.mb.e_mbd.bd = (int)cm->bit_depth;
 #endif  // CONFIG_VP9_HIGHBITDEPTH
 
+  vp9_speed_control_configure(&cpi->speed_control, oxcf->frame_time_budget,
+                              oxcf->speed);
+
   if ((oxcf->pass == 0) && (oxcf->rc_mode == VPX_Q)) {
     rc->baseline_gf_interval = FIXED_GF_INTERVAL;
   } else {
@@ -2372,12 +2513,7 @@ void vp9_update_compressor_with_img_fmt(VP9_COMP *cpi, vpx_img_fmt_t img_fmt) {
 #endif
 
   assert(cpi->lookahead == NULL);
-  cpi->lookahead = vp9_lookahead_init(oxcf->width, oxcf->height, subsampling_x,
-                                      subsampling_y,
-#if CONFIG_VP9_HIGHBITDEPTH
-                                      use_highbitdepth,
-#endif
-                                      oxcf->lag_in_frames);
+  cpi->lookahead = vp9_lookahead_init(oxcf->lag_in_frames);
   alloc_raw_frame_buffers(cpi);
 }
 
@@ -2665,67 +2801,77 @@ VP9_COMP *vp9_create_compressor(const VP9EncoderConfig *oxcf,
                   vpx_calloc(cm->MBs, sizeof(cpi->source_diff_var)));
   cpi->source_var_thresh = 0;
   cpi->frames_till_next_var_check = 0;
-#define BFP(BT, SDF, SDSF, SDAF, VF, SVF, SVAF, SDX4DF, SDSX4DF) \
-  cpi->fn_ptr[BT].sdf = SDF;                                     \
-  cpi->fn_ptr[BT].sdsf = SDSF;                                   \
-  cpi->fn_ptr[BT].sdaf = SDAF;                                   \
-  cpi->fn_ptr[BT].vf = VF;                                       \
-  cpi->fn_ptr[BT].svf = SVF;                                     \
-  cpi->fn_ptr[BT].svaf = SVAF;                                   \
-  cpi->fn_ptr[BT].sdx4df = SDX4DF;                               \
-  cpi->fn_ptr[BT].sdsx4df = SDSX4DF;
+#define BFP(BT, SDF, SDSF, SDAF, VF, SVF, SVAF, SDX4DF, SDSX4DF, SDX8F) \
+  cpi->fn_ptr[BT].sdf = SDF;                                            \
+  cpi->fn_ptr[BT].sdsf = SDSF;                                          \
+  cpi->fn_ptr[BT].sdaf = SDAF;                                          \
+  cpi->fn_ptr[BT].vf = VF;                                              \
+  cpi->fn_ptr[BT].svf = SVF;                                            \
+  cpi->fn_ptr[BT].svaf = SVAF;                                          \
+  cpi->fn_ptr[BT].sdx4df = SDX4DF;                                      \
+  cpi->fn_ptr[BT].sdsx4df = SDSX4DF;                                    \
+  cpi->fn_ptr[BT].sdx8f = SDX8F;
 
   BFP(BLOCK_32X16, vpx_sad32x16, vpx_sad_skip_32x16, vpx_sad32x16_avg,
       vpx_variance32x16, vpx_sub_pixel_variance32x16,
-      vpx_sub_pixel_avg_variance32x16, vpx_sad32x16x4d, vpx_sad_skip_32x16x4d)
+      vpx_sub_pixel_avg_variance32x16, vpx_sad32x16x4d,
+      vpx_sad_skip_32x16x4d, vpx_sad32x16x8)
 
   BFP(BLOCK_16X32, vpx_sad16x32, vpx_sad_skip_16x32, vpx_sad16x32_avg,
       vpx_variance16x32, vpx_sub_pixel_variance16x32,
-      vpx_sub_pixel_avg_variance16x32, vpx_sad16x32x4d, vpx_sad_skip_16x32x4d)
+      vpx_sub_pixel_avg_variance16x32, vpx_sad16x32x4d,
+      vpx_sad_skip_16x32x4d, vpx_sad16x32x8)
 
   BFP(BLOCK_64X32, vpx_sad64x32, vpx_sad_skip_64x32, vpx_sad64x32_avg,
       vpx_variance64x32, vpx_sub_pixel_variance64x32,
-      vpx_sub_pixel_avg_variance64x32, vpx_sad64x32x4d, vpx_sad_skip_64x32x4d)
+      vpx_sub_pixel_avg_variance64x32, vpx_sad64x32x4d,
+      vpx_sad_skip_64x32x4d, vpx_sad64x32x8)
 
   BFP(BLOCK_32X64, vpx_sad32x64, vpx_sad_skip_32x64, vpx_sad32x64_avg,
       vpx_variance32x64, vpx_sub_pixel_variance32x64,
-      vpx_sub_pixel_avg_variance32x64, vpx_sad32x64x4d, vpx_sad_skip_32x64x4d)
+      vpx_sub_pixel_avg_variance32x64, vpx_sad32x64x4d,
+      vpx_sad_skip_32x64x4d, vpx_sad32x64x8)
 
   BFP(BLOCK_32X32, vpx_sad32x32, vpx_sad_skip_32x32, vpx_sad32x32_avg,
       vpx_variance32x32, vpx_sub_pixel_variance32x32,
-      vpx_sub_pixel_avg_variance32x32, vpx_sad32x32x4d, vpx_sad_skip_32x32x4d)
+      vpx_sub_pixel_avg_variance32x32, vpx_sad32x32x4d,
+      vpx_sad_skip_32x32x4d, vpx_sad32x32x8)
 
   BFP(BLOCK_64X64, vpx_sad64x64, vpx_sad_skip_64x64, vpx_sad64x64_avg,
       vpx_variance64x64, vpx_sub_pixel_variance64x64,
-      vpx_sub_pixel_avg_variance64x64, vpx_sad64x64x4d, vpx_sad_skip_64x64x4d)
+      vpx_sub_pixel_avg_variance64x64, vpx_sad64x64x4d,
+      vpx_sad_skip_64x64x4d, vpx_sad64x64x8)
 
   BFP(BLOCK_16X16, vpx_sad16x16, vpx_sad_skip_16x16, vpx_sad16x16_avg,
       vpx_variance16x16, vpx_sub_pixel_variance16x16,
-      vpx_sub_pixel_avg_variance16x16, vpx_sad16x16x4d, vpx_sad_skip_16x16x4d)
+      vpx_sub_pixel_avg_variance16x16, vpx_sad16x16x4d,
+      vpx_sad_skip_16x16x4d, vpx_sad16x16x8)
 
   BFP(BLOCK_16X8, vpx_sad16x8, vpx_sad_skip_16x8, vpx_sad16x8_avg,
       vpx_variance16x8, vpx_sub_pixel_variance16x8,
-      vpx_sub_pixel_avg_variance16x8, vpx_sad16x8x4d, vpx_sad_skip_16x8x4d)
+      vpx_sub_pixel_avg_variance16x8, vpx_sad16x8x4d,
+      vpx_sad_skip_16x8x4d, vpx_sad16x8x8)
 
   BFP(BLOCK_8X16, vpx_sad8x16, vpx_sad_skip_8x16, vpx_sad8x16_avg,
       vpx_variance8x16, vpx_sub_pixel_variance8x16,
-      vpx_sub_pixel_avg_variance8x16, vpx_sad8x16x4d, vpx_sad_skip_8x16x4d)
+      vpx_sub_pixel_avg_variance8x16, vpx_sad8x16x4d,
+      vpx_sad_skip_8x16x4d, vpx_sad8x16x8)
 
   BFP(BLOCK_8X8, vpx_sad8x8, vpx_sad_skip_8x8, vpx_sad8x8_avg, vpx_variance8x8,
       vpx_sub_pixel_variance8x8, vpx_sub_pixel_avg_variance8x8, vpx_sad8x8x4d,
-      vpx_sad_skip_8x8x4d)
+      vpx_sad_skip_8x8x4d, vpx_sad8x8x8)
 
   BFP(BLOCK_8X4, vpx_sad8x4, vpx_sad_skip_8x4, vpx_sad8x4_avg, vpx_variance8x4,
       vpx_sub_pixel_variance8x4, vpx_sub_pixel_avg_variance8x4, vpx_sad8x4x4d,
-      vpx_sad_skip_8x4x4d)
+      vpx_sad_skip_8x4x4d, vpx_sad8x4x8)
 
   BFP(BLOCK_4X8, vpx_sad4x8, vpx_sad_skip_4x8, vpx_sad4x8_avg, vpx_variance4x8,
       vpx_sub_pixel_variance4x8, vpx_sub_pixel_avg_variance4x8, vpx_sad4x8x4d,
-      vpx_sad_skip_4x8x4d)
+      vpx_sad_skip_4x8x4d, vpx_sad4x8x8)
 
   BFP(BLOCK_4X4, vpx_sad4x4, vpx_sad_skip_4x4, vpx_sad4x4_avg, vpx_variance4x4,
       vpx_sub_pixel_variance4x4, vpx_sub_pixel_avg_variance4x4, vpx_sad4x4x4d,
-      vpx_sad_skip_4x4x4d)
+      vpx_sad_skip_4x4x4d, vpx_sad4x4x8)
 
 #if CONFIG_VP9_HIGHBITDEPTH
   highbd_set_var_fns(cpi);
@@ -2889,6 +3035,7 @@ void vp9_remove_compressor(VP9_COMP *cpi) {
   vp9_free_tpl_buffer(cpi);
 
   vp9_loop_filter_dealloc(&cpi->lf_row_sync);
+  vp9_free_lpf_pick_data(cpi);
   vp9_bitstream_encode_tiles_buffer_dealloc(cpi);
   vp9_row_mt_mem_dealloc(cpi);
   vp9_encode_free_mt_data(cpi);
@@ -2903,6 +3050,7 @@ void vp9_remove_compressor(VP9_COMP *cpi) {
        ++i) {
     vpx_free(cpi->mbgraph_stats[i].mb_stats);
   }
+  vp9_row_mt_sync_mem_dealloc(&cpi->mbgraph_row_mt_sync);
 
   vp9_extrc_delete(&cpi->ext_ratectrl);
 
@@ -5500,6 +5648,7 @@ static void encode_frame_to_data_rate(
   VP9_COMMON *const cm = &cpi->common;
   const VP9EncoderConfig *const oxcf = &cpi->oxcf;
   struct segmentation *const seg = &cm->seg;
+  struct vpx_usec_timer stage_timer;
   TX_SIZE t;
 
   if (vp9_svc_check_skip_enhancement_layer(cpi)) return;
@@ -5602,8 +5751,11 @@ static void encode_frame_to_data_rate(
     cpi->ext_ratectrl.ext_rdmult = ext_rdmult;
   }
 
+  start_stage_timer(cpi, &stage_timer);
   if (cpi->sf.recode_loop == DISALLOW_RECODE) {
-    if (!encode_without_recode_loop(cpi, size, dest, dest_size)) return;
+    const int encoded = encode_without_recode_loop(cpi, size, dest, dest_size);
+    end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.encode_frame_us);
+    if (!encoded) return;
   } else {
 #if !CONFIG_REALTIME_ONLY
 #if CONFIG_RATE_CTRL
@@ -5619,6 +5771,7 @@ static void encode_frame_to_data_rate(
 #endif
 #endif  // CONFIG_RATE_CTRL
 #endif  // !CONFIG_REALTIME_ONLY
+    end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.encode_frame_us);
   }
 
   // TODO(jingning): When using show existing frame mode, we assume that the
@@ -5678,8 +5831,10 @@ static void encode_frame_to_data_rate(
 #if CONFIG_COLLECT_COMPONENT_TIMING
   start_timing(cpi, loopfilter_frame_time);
 #endif
+  start_stage_timer(cpi, &stage_timer);
   // Pick the loop filter level for the frame.
   loopfilter_frame(cpi, cm);
+  end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.loop_filter_us);
 #if CONFIG_COLLECT_COMPONENT_TIMING
   end_timing(cpi, loopfilter_frame_time);
 #endif
@@ -5689,8 +5844,10 @@ static void encode_frame_to_data_rate(
 #if CONFIG_COLLECT_COMPONENT_TIMING
   start_timing(cpi, vp9_pack_bitstream_time);
 #endif
+  start_stage_timer(cpi, &stage_timer);
   // build the bitstream
   vp9_pack_bitstream(cpi, dest, dest_size, size);
+  end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.pack_bitstream_us);
 #if CONFIG_COLLECT_COMPONENT_TIMING
   end_timing(cpi, vp9_pack_bitstream_time);
 #endif
@@ -5920,9 +6077,10 @@ static void Pass2Encode(VP9_COMP *cpi, size_t *size, uint8_t *dest,
 }
 #endif  // !CONFIG_REALTIME_ONLY
 
-int vp9_receive_raw_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
-                          YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
-                          int64_t end_time) {
+static int receive_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
+                         YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                         int64_t end_time, const vpx_zero_copy_input_t *lender,
+                         void *user_priv) {
   VP9_COMMON *const cm = &cpi->common;
   struct vpx_usec_timer timer;
   int res = 0;
@@ -5943,11 +6101,26 @@ int vp9_receive_raw_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
 
   vpx_usec_timer_start(&timer);
 
-  if (vp9_lookahead_push(cpi->lookahead, sd, time_stamp, end_time,
-                         use_highbitdepth, frame_flags))
-    res = -1;
+  if (lender != NULL && cpi->oxcf.noise_sensitivity == 0 &&
+      vp9_lookahead_can_lend(sd, lender->border)) {
+    if (vp9_lookahead_push_lent(cpi->lookahead, sd, time_stamp, end_time,
+                                frame_flags, lender->release_cb,
+                                lender->cb_priv, user_priv)) {
+      lender->release_cb(lender->cb_priv, user_priv);
+      res = -1;
+    }
+  } else {
+    // The denoisers filter the source frame in place, so it is copied, as
+    // are frames with a layout of their own.
+    if (vp9_lookahead_push(cpi->lookahead, sd, time_stamp, end_time,
+                           use_highbitdepth, frame_flags))
+      res = -1;
+    if (lender != NULL) lender->release_cb(lender->cb_priv, user_priv);
+  }
   vpx_usec_timer_mark(&timer);
   cpi->time_receive_data += vpx_usec_timer_elapsed(&timer);
+  if (cpi->time_stages)
+    cpi->stage_timing.total_us += vpx_usec_timer_elapsed(&timer);
 
   if ((cm->profile == PROFILE_0 || cm->profile == PROFILE_2) &&
       (subsampling_x != 1 || subsampling_y != 1)) {
@@ -5965,6 +6138,21 @@ int vp9_receive_raw_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
   return res;
 }
 
+int vp9_receive_raw_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
+                          YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                          int64_t end_time) {
+  return receive_frame(cpi, frame_flags, sd, time_stamp, end_time, NULL, NULL);
+}
+
+int vp9_receive_lent_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
+                           YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                           int64_t end_time,
+                           const vpx_zero_copy_input_t *lender,
+                           void *user_priv) {
+  return receive_frame(cpi, frame_flags, sd, time_stamp, end_time, lender,
+                       user_priv);
+}
+
 static int frame_is_reference(const VP9_COMP *cpi) {
   const VP9_COMMON *cm = &cpi->common;
 
@@ -6347,6 +6535,11 @@ static INLINE int should_run_tpl(VP9_COMP *cpi, int gf_group_index) {
   return 0;
 }
 
+static int use_speed_control(const VP9_COMP *cpi) {
+  return cpi->speed_control.budget_us > 0 && cpi->oxcf.mode == REALTIME &&
+         cpi->oxcf.pass == 0 && !cpi->use_svc;
+}
+
 int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
                             size_t *size, uint8_t *dest, size_t dest_size,
                             int64_t *time_stamp, int64_t *time_end, int flush,
@@ -6356,6 +6549,7 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
   BufferPool *const pool = cm->buffer_pool;
   RATE_CONTROL *const rc = &cpi->rc;
   struct vpx_usec_timer cmptimer;
+  struct vpx_usec_timer stage_timer;
   YV12_BUFFER_CONFIG *force_src_buffer = NULL;
   struct lookahead_entry *last_source = NULL;
   struct lookahead_entry *source = NULL;
@@ -6373,6 +6567,12 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
 
   vpx_usec_timer_start(&cmptimer);
 
+  if (use_speed_control(cpi) && cpi->oxcf.speed != cpi->speed_control.speed) {
+    cpi->oxcf.speed = cpi->speed_control.speed;
+    // Row based multi-threading depends on the speed in real-time mode.
+    vp9_set_row_mt(cpi);
+  }
+
   vp9_set_high_precision_mv(cpi, ALTREF_HIGH_PRECISION_MV);
 
   // Is multi-arf enabled.
@@ -6439,9 +6639,12 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
 #if CONFIG_COLLECT_COMPONENT_TIMING
         start_timing(cpi, vp9_temporal_filter_time);
 #endif
+        start_stage_timer(cpi, &stage_timer);
         // Produce the filtered ARF frame.
         vp9_temporal_filter(cpi, arf_src_index);
         vpx_extend_frame_borders(&cpi->alt_ref_buffer);
+        end_stage_timer(cpi, &stage_timer,
+                        &cpi->stage_timing.temporal_filter_us);
 #if CONFIG_COLLECT_COMPONENT_TIMING
         end_timing(cpi, vp9_temporal_filter_time);
 #endif
@@ -6608,9 +6811,11 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
   start_timing(cpi, setup_tpl_stats_time);
 #endif
   if (should_run_tpl(cpi, gf_group_index)) {
+    start_stage_timer(cpi, &stage_timer);
     vp9_init_tpl_buffer(cpi);
     vp9_estimate_tpl_qp_gop(cpi);
     vp9_setup_tpl_stats(cpi);
+    end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.tpl_us);
   }
 #if CONFIG_COLLECT_COMPONENT_TIMING
   end_timing(cpi, setup_tpl_stats_time);
@@ -6649,7 +6854,9 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
     cpi->td.mb.fwd_txfm4x4 = lossless ? vp9_fwht4x4 : vpx_fdct4x4;
 #endif  // CONFIG_VP9_HIGHBITDEPTH
     cpi->td.mb.inv_txfm_add = lossless ? vp9_iwht4x4_add : vp9_idct4x4_add;
+    start_stage_timer(cpi, &stage_timer);
     vp9_first_pass(cpi, source);
+    end_stage_timer(cpi, &stage_timer, &cpi->stage_timing.first_pass_us);
   } else if (oxcf->pass == 2 && !cpi->use_svc) {
 #if CONFIG_COLLECT_COMPONENT_TIMING
     // Accumulate 2nd pass time in 2-pass case.
@@ -6668,6 +6875,10 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
   }
 #endif  // CONFIG_REALTIME_ONLY
 
+  // The motion hints and mode info only apply to the frame they were set for.
+  cpi->motion_hints_enabled = 0;
+  cpi->mode_info_hints_enabled = 0;
+
   if (cm->show_frame) cm->cur_show_frame_fb_idx = cm->new_fb_idx;
 
   if (cm->refresh_frame_context)
@@ -6694,6 +6905,16 @@ int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
 
   vpx_usec_timer_mark(&cmptimer);
   cpi->time_compress_data += vpx_usec_timer_elapsed(&cmptimer);
+  if (cpi->time_stages) {
+    cpi->stage_timing.total_us += vpx_usec_timer_elapsed(&cmptimer);
+    ++cpi->stage_timing.frames;
+  }
+
+  if (use_speed_control(cpi) && *size > 0) {
+    vp9_speed_control_update(&cpi->speed_control,
+                             vpx_usec_timer_elapsed(&cmptimer),
+                             frame_is_intra_only(cm));
+  }
 
   if (cpi->keep_level_stats && oxcf->pass != 1)
     update_level_info(cpi, size, arf_src_index);
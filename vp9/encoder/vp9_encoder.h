@@ -25,6 +25,7 @@
 #include "vpx_dsp/variance.h"
 #include "vpx_dsp/psnr.h"
 #include "vpx_ports/system_state.h"
+#include "vpx_ports/vpx_timer.h"
 #include "vpx_util/vpx_pthread.h"
 #include "vpx_util/vpx_thread.h"
 #include "vpx_util/vpx_timestamp.h"
@@ -268,6 +269,14 @@ typedef struct VP9EncoderConfig {
   unsigned int target_level;
 
   vpx_fixed_buf_t two_pass_stats_in;
+  // Use the first pass motion in fp_motion_field_in as motion search seeds,
+  // see VP9E_SET_FP_MV_SEEDS.
+  int fp_mv_seeds;
+  vpx_fixed_buf_t fp_motion_field_in;
+
+  // Target encode time per frame in microseconds for real-time encoding, see
+  // VP9E_SET_FRAME_TIME_BUDGET. 0 is off.
+  unsigned int frame_time_budget;
 
   vp8e_tuning tuning;
   vp9e_tune_content content;
@@ -326,6 +335,18 @@ typedef struct TplDepFrame {
 #endif
 } TplDepFrame;
 
+// Inputs of the TPL block estimation for the frame being processed, shared by
+// the row-mt workers.
+typedef struct TplJobData {
+  struct GF_PICTURE *gf_picture;
+  int frame_idx;
+  BLOCK_SIZE bsize;
+  struct scale_factors sf;
+  YV12_BUFFER_CONFIG *ref_frame[MAX_INTER_REF_FRAMES];
+  // Initial state of the mode info each worker predicts into.
+  MODE_INFO mi;
+} TplJobData;
+
 #define TPL_DEP_COST_SCALE_LOG2 4
 
 // TODO(jingning) All spatially adaptive variables should go to TileDataEnc.
@@ -660,7 +681,6 @@ static INLINE int get_num_unit_16x16(int size) { return (size + 15) >> 4; }
 #endif  // CONFIG_RATE_CTRL
 
 #if CONFIG_COLLECT_COMPONENT_TIMING
-#include "vpx_ports/vpx_timer.h"
 // Adjust the following to add new components.
 typedef enum {
   vp9_get_compressed_data_time,
@@ -751,6 +771,7 @@ typedef struct VP9_COMP {
 
   BLOCK_SIZE tpl_bsize;
   TplDepFrame tpl_stats[MAX_ARF_GOP_SIZE];
+  TplJobData tpl_job_data;
   // Used to store TPL stats before propagation
   VpxTplGopStats tpl_gop_stats;
   YV12_BUFFER_CONFIG *tpl_recon_frames[REF_FRAMES];
@@ -831,6 +852,8 @@ typedef struct VP9_COMP {
 
   MBGRAPH_FRAME_STATS mbgraph_stats[MAX_LAG_BUFFERS];
   int mbgraph_n_frames;  // number of frames filled in the above
+  MbgraphJobData mbgraph_job_data;
+  VP9RowMTSync mbgraph_row_mt_sync;
   int static_mb_pct;     // % forced skip mbs by segmentation
   int ref_frame_flags;
 
@@ -867,6 +890,14 @@ typedef struct VP9_COMP {
   uint64_t time_pick_lpf;
   uint64_t time_encode_sb_row;
 
+  // Stage times accumulated while time_stages is set, see
+  // VP9E_SET_COMPONENT_TIMING.
+  int time_stages;
+  vpx_enc_component_timing_t stage_timing;
+
+  // Speed adaptation to oxcf.frame_time_budget.
+  SPEED_CONTROL speed_control;
+
   TWO_PASS twopass;
 
   // Force recalculation of segment_ids for each mode info
@@ -989,6 +1020,8 @@ typedef struct VP9_COMP {
   VPxWorker *workers;
   struct EncWorkerData *tile_thr_data;
   VP9LfSync lf_row_sync;
+  // Per candidate data of the parallel loop filter level search.
+  struct LpfPickWorkerData *lpf_pick_data;
   struct VP9BitstreamWorkerData *vp9_bitstream_worker_data;
 
   int keep_level_stats;
@@ -1031,6 +1064,17 @@ typedef struct VP9_COMP {
   int multi_layer_arf;
   vpx_roi_map_t roi;
 
+  // Motion hints and mode info of the next frame, one per 8x8 block, see
+  // VP9E_SET_MOTION_HINTS and VP9E_SET_MODE_INFO. Both maps are allocated for
+  // hint_mi_rows x hint_mi_cols blocks.
+  vpx_motion_hint_t *motion_hints;
+  vpx_mode_info_t *mode_info_hints;
+  int hint_mi_rows;
+  int hint_mi_cols;
+  int motion_hints_enabled;
+  int motion_hint_refine_only;
+  int mode_info_hints_enabled;
+
   LOOPFILTER_CONTROL loopfilter_ctrl;
 #if CONFIG_RATE_CTRL
   ENCODE_COMMAND encode_command;
@@ -1224,6 +1268,15 @@ int vp9_receive_raw_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
                           YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
                           int64_t end_time);
 
+// Same as vp9_receive_raw_frame(), but the frame buffer is lent by the
+// application and used in place when possible. lender->release_cb is called
+// with user_priv once the encoder no longer uses the frame.
+int vp9_receive_lent_frame(VP9_COMP *cpi, vpx_enc_frame_flags_t frame_flags,
+                           YV12_BUFFER_CONFIG *sd, int64_t time_stamp,
+                           int64_t end_time,
+                           const vpx_zero_copy_input_t *lender,
+                           void *user_priv);
+
 int vp9_get_compressed_data(VP9_COMP *cpi, unsigned int *frame_flags,
                             size_t *size, uint8_t *dest, size_t dest_size,
                             int64_t *time_stamp, int64_t *time_end, int flush,
@@ -1250,6 +1303,24 @@ int vp9_set_active_map(VP9_COMP *cpi, unsigned char *new_map_16x16, int rows,
 int vp9_get_active_map(VP9_COMP *cpi, unsigned char *new_map_16x16, int rows,
                        int cols);
 
+vpx_codec_err_t vp9_set_motion_hints(VP9_COMP *cpi,
+                                     const vpx_motion_hint_map_t *map);
+
+vpx_codec_err_t vp9_set_mode_info(VP9_COMP *cpi,
+                                  const vpx_mode_info_map_t *map);
+
+// Gets the reference frames of the mode info hint of the block at mi_row,
+// mi_col, if the block can be restricted to them. Returns 0 if it cannot.
+int vp9_get_mode_info_hint_refs(const VP9_COMP *cpi, int segment_id,
+                                int mi_row, int mi_col,
+                                MV_REFERENCE_FRAME refs[2]);
+
+// Gets the motion hint of the 8x8 block at the centre of the block of size
+// bsize at mi_row, mi_col if it is for ref_frame, in full pixels. Returns 0
+// if there is none.
+int vp9_get_motion_hint(const VP9_COMP *cpi, MV_REFERENCE_FRAME ref_frame,
+                        int mi_row, int mi_col, BLOCK_SIZE bsize, MV *mv);
+
 int vp9_set_internal_size(VP9_COMP *cpi, VPX_SCALING_MODE horiz_mode,
                           VPX_SCALING_MODE vert_mode);
 
@@ -1301,6 +1372,23 @@ static INLINE int ref_frame_to_flag(int8_t ref_frame) {
   return kVp9RefFlagList[ref_frame];
 }
 
+// Returns 1 if the frame is coded from the mode info hints. They do not apply
+// to frames coded at another size.
+static INLINE int use_mode_info_hints(const VP9_COMP *cpi) {
+  const VP9_COMMON *const cm = &cpi->common;
+  return cpi->mode_info_hints_enabled && cpi->hint_mi_rows == cm->mi_rows &&
+         cpi->hint_mi_cols == cm->mi_cols;
+}
+
+// Returns the mode info hint of the 8x8 block at mi_row, mi_col, or NULL if
+// there is none for the frame.
+static INLINE const vpx_mode_info_t *get_mode_info_hint(const VP9_COMP *cpi,
+                                                        int mi_row,
+                                                        int mi_col) {
+  if (!use_mode_info_hints(cpi)) return NULL;
+  return &cpi->mode_info_hints[mi_row * cpi->common.mi_cols + mi_col];
+}
+
 static INLINE int get_ref_frame_map_idx(const VP9_COMP *cpi,
                                         MV_REFERENCE_FRAME ref_frame) {
   if (ref_frame == LAST_FRAME) {
@@ -1644,6 +1732,21 @@ static INLINE int do_trellis_opt(const struct macroblockd_plane *pd,
   }
 }
 
+static INLINE void start_stage_timer(const VP9_COMP *cpi,
+                                     struct vpx_usec_timer *timer) {
+  if (cpi->time_stages) vpx_usec_timer_start(timer);
+}
+
+// Adds the time since start_stage_timer() to *stage_time.
+static INLINE void end_stage_timer(const VP9_COMP *cpi,
+                                   struct vpx_usec_timer *timer,
+                                   uint64_t *stage_time) {
+  if (cpi->time_stages) {
+    vpx_usec_timer_mark(timer);
+    *stage_time += vpx_usec_timer_elapsed(timer);
+  }
+}
+
 #if CONFIG_COLLECT_COMPONENT_TIMING
 static INLINE void start_timing(VP9_COMP *cpi, int component) {
   vpx_usec_timer_start(&cpi->component_timer[component]);
@@ -72,6 +72,15 @@ void vp9_row_mt_sync_mem_dealloc(VP9RowMTSync *row_mt_sync);
 
 void vp9_temporal_filter_row_mt(struct VP9_COMP *cpi);
 
+// Builds the TPL stats of the blocks of the frame set up in
+// cpi->tpl_job_data, distributing the block rows of each tile column over the
+// encoder workers.
+void vp9_tpl_row_mt(struct VP9_COMP *cpi);
+
+// Analyzes the MB rows of the frame set up in cpi->mbgraph_job_data on the
+// encoder workers.
+void vp9_mbgraph_row_mt(struct VP9_COMP *cpi);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
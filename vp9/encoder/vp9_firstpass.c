@@ -262,7 +262,7 @@ static double get_distribution_av_err(VP9_COMP *cpi, TWO_PASS *const twopass) {
 #define ACT_AREA_CORRECTION 0.5
 // Calculate a modified Error used in distributing bits between easier and
 // harder frames.
-static double calculate_mod_frame_score(const VP9_COMP *cpi,
+static double calculate_mod_frame_score(const FRAME_INFO *frame_info,
                                         const VP9EncoderConfig *oxcf,
                                         const FIRSTPASS_STATS *this_frame,
                                         const double av_err) {
@@ -276,8 +276,8 @@ static double calculate_mod_frame_score(const VP9_COMP *cpi,
   // remaining active MBs. The correction here assumes that coding
   // 0.5N blocks of complexity 2X is a little easier than coding N
   // blocks of complexity X.
-  modified_score *= pow(calculate_active_area(&cpi->frame_info, this_frame),
-                        ACT_AREA_CORRECTION);
+  modified_score *=
+      pow(calculate_active_area(frame_info, this_frame), ACT_AREA_CORRECTION);
 
   return modified_score;
 }
@@ -339,6 +339,8 @@ void vp9_end_first_pass(VP9_COMP *cpi) {
   cpi->twopass.first_pass_done = 1;
   vpx_free(cpi->twopass.fp_mb_float_stats);
   cpi->twopass.fp_mb_float_stats = NULL;
+  vpx_free(cpi->twopass.fp_motion_field);
+  cpi->twopass.fp_motion_field = NULL;
 }
 
 static vpx_variance_fn_t get_block_variance_fn(BLOCK_SIZE bsize) {
@@ -1245,6 +1247,9 @@ void vp9_first_pass_encode_tile_mb_row(VP9_COMP *cpi, ThreadData *td,
         fp_acc_data->sr_coded_error += motion_error;
       }
 
+      if (cpi->twopass.fp_motion_field != NULL)
+        cpi->twopass.fp_motion_field[mb_index].as_mv = mv;
+
       // Start by assuming that intra mode is best.
       best_ref_mv->row = 0;
       best_ref_mv->col = 0;
@@ -1448,6 +1453,16 @@ void vp9_first_pass(VP9_COMP *cpi, const struct lookahead_entry *source) {
         &cm->error, cpi->twopass.fp_mb_float_stats,
         vpx_calloc(cm->MBs * sizeof(*cpi->twopass.fp_mb_float_stats), 1));
 
+  if (cpi->oxcf.fp_mv_seeds) {
+    int i;
+    if (twopass->fp_motion_field == NULL)
+      CHECK_MEM_ERROR(
+          &cm->error, twopass->fp_motion_field,
+          vpx_malloc(cm->MBs * sizeof(*twopass->fp_motion_field)));
+    for (i = 0; i < cm->MBs; ++i)
+      twopass->fp_motion_field[i].as_int = INVALID_MV;
+  }
+
   {
     FIRSTPASS_STATS fps;
     TileDataEnc *first_tile_col;
@@ -1663,6 +1678,44 @@ void calculate_coded_size(VP9_COMP *cpi, int *scaled_frame_width,
   *scaled_frame_height = rc->frame_height[rc->frame_size_selector];
 }
 
+int vp9_get_fp_mv_seed(const VP9_COMP *cpi, MV_REFERENCE_FRAME ref_frame,
+                       int mi_row, int mi_col, BLOCK_SIZE bsize, MV *mv) {
+  const VP9_COMMON *const cm = &cpi->common;
+  const vpx_fixed_buf_t *const field_in = &cpi->oxcf.fp_motion_field_in;
+  const RefCntBuffer *const frame_bufs = cm->buffer_pool->frame_bufs;
+  const int ref_buf_idx = get_ref_frame_buf_idx(cpi, ref_frame);
+  const int frame_index = frame_bufs[cm->new_fb_idx].frame_index;
+  const size_t frame_sz = cm->MBs * sizeof(int_mv);
+  const int_mv *field;
+  int distance, mb_row, mb_col;
+  int_mv fp_mv;
+
+  // The fields do not apply to frames coded at another size.
+  if (field_in->buf == NULL || cm->MBs != cpi->frame_info.num_mbs ||
+      ref_buf_idx == INVALID_IDX || frame_index < 0 ||
+      (size_t)(frame_index + 1) * frame_sz > field_in->sz)
+    return 0;
+
+  distance = frame_index - frame_bufs[ref_buf_idx].frame_index;
+  if (distance == 0) return 0;
+
+  field = (const int_mv *)field_in->buf + (size_t)frame_index * cm->MBs;
+  mb_row = VPXMIN((mi_row + (num_8x8_blocks_high_lookup[bsize] >> 1)) >> 1,
+                  cm->mb_rows - 1);
+  mb_col = VPXMIN((mi_col + (num_8x8_blocks_wide_lookup[bsize] >> 1)) >> 1,
+                  cm->mb_cols - 1);
+  fp_mv = field[mb_row * cm->mb_cols + mb_col];
+  if (fp_mv.as_int == INVALID_MV) return 0;
+
+  // The first pass searches each frame against the previous one, assume the
+  // motion is constant over the distance to the reference.
+  mv->row = (int16_t)clamp(fp_mv.as_mv.row * distance, -MAX_FULL_PEL_VAL,
+                           MAX_FULL_PEL_VAL);
+  mv->col = (int16_t)clamp(fp_mv.as_mv.col * distance, -MAX_FULL_PEL_VAL,
+                           MAX_FULL_PEL_VAL);
+  return 1;
+}
+
 void vp9_init_second_pass(VP9_COMP *cpi) {
   VP9EncoderConfig *const oxcf = &cpi->oxcf;
   RATE_CONTROL *const rc = &cpi->rc;
@@ -1696,7 +1749,8 @@ void vp9_init_second_pass(VP9_COMP *cpi) {
       av_err = get_distribution_av_err(cpi, twopass);
       // The first scan is unclamped and gives a raw average.
       while (s < twopass->stats_in_end) {
-        modified_score_total += calculate_mod_frame_score(cpi, oxcf, s, av_err);
+        modified_score_total +=
+            calculate_mod_frame_score(&cpi->frame_info, oxcf, s, av_err);
         ++s;
       }
 
@@ -1774,6 +1828,73 @@ void vp9_init_second_pass(VP9_COMP *cpi) {
   twopass->arnr_strength_adjustment = 0;
 }
 
+void vp9_get_first_pass_section(const FIRSTPASS_STATS *stats, int first,
+                                int count, FIRSTPASS_STATS *section) {
+  FIRSTPASS_STATS *const total = &section[count];
+  int i;
+  zero_stats(total);
+  for (i = 0; i < count; ++i) {
+    section[i] = stats[first + i];
+    accumulate_stats(total, &section[i]);
+  }
+}
+
+void vp9_split_two_pass_bandwidth(const VP9EncoderConfig *oxcf,
+                                  const FRAME_INFO *frame_info,
+                                  const FIRSTPASS_STATS *stats, int num_frames,
+                                  int section_frames,
+                                  int64_t *section_bandwidth) {
+  const FIRSTPASS_STATS *const total = &stats[num_frames];
+  const int num_sections = (num_frames + section_frames - 1) / section_frames;
+  const double av_weight = total->weight / DOUBLE_DIVIDE_CHECK(total->count);
+  double mean_mod_score;
+  double av_err;
+  double score_total = 0.0;
+  int i;
+
+  // In corpus VBR mode the frame scores are normalized against a fixed
+  // corpus complexity and each section adjusts its own bandwidth in
+  // vp9_init_second_pass().
+  if (oxcf->vbr_corpus_complexity) {
+    for (i = 0; i < num_sections; ++i)
+      section_bandwidth[i] = oxcf->target_bandwidth;
+    return;
+  }
+
+  // Same two scans as vp9_init_second_pass(), over the whole clip.
+  av_err = (total->coded_error * av_weight) / DOUBLE_DIVIDE_CHECK(total->count);
+  mean_mod_score = 0.0;
+  for (i = 0; i < num_frames; ++i)
+    mean_mod_score +=
+        calculate_mod_frame_score(frame_info, oxcf, &stats[i], av_err);
+  mean_mod_score /= DOUBLE_DIVIDE_CHECK(total->count);
+
+  for (i = 0; i < num_frames; ++i)
+    score_total += calc_norm_frame_score(oxcf, frame_info, &stats[i],
+                                         mean_mod_score, av_err);
+
+  for (i = 0; i < num_sections; ++i) {
+    const int first = i * section_frames;
+    const int last = VPXMIN(first + section_frames, num_frames);
+    // Matches the duration of the total packet of the section, see
+    // vp9_get_first_pass_section().
+    double duration = 1.0;
+    double score = 0.0;
+    int j;
+    for (j = first; j < last; ++j) {
+      score += calc_norm_frame_score(oxcf, frame_info, &stats[j],
+                                     mean_mod_score, av_err);
+      duration += stats[j].duration;
+    }
+    // The section is given the share of the bits of the clip that the single
+    // pass over the clip would have allocated to its frames.
+    section_bandwidth[i] =
+        (int64_t)((double)oxcf->target_bandwidth * total->duration /
+                      duration * score / DOUBLE_DIVIDE_CHECK(score_total) +
+                  0.5);
+  }
+}
+
 /* This function considers how the quality of prediction may be deteriorating
  * with distance. It compares the coded error for the last frame and the
  * second reference frame (usually two frames old) and also applies a factor
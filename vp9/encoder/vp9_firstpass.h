@@ -142,6 +142,11 @@ typedef struct {
 
   FP_MB_FLOAT_STATS *fp_mb_float_stats;
 
+  // First pass: full pixel motion of each 16x16 block of the current frame
+  // to the previous frame, INVALID_MV where no search was done. Only
+  // allocated with VP9EncoderConfig.fp_mv_seeds.
+  int_mv *fp_motion_field;
+
   // An indication of the content type of the current frame
   FRAME_CONTENT_TYPE fr_content_type;
 
@@ -202,16 +207,40 @@ void vp9_first_pass_encode_tile_mb_row(struct VP9_COMP *cpi,
                                        MV *best_ref_mv, int mb_row);
 
 void vp9_init_second_pass(struct VP9_COMP *cpi);
+
+// Gets the first pass motion of the 16x16 block at the centre of the block
+// of size bsize at mi_row, mi_col in the current frame, scaled by the
+// distance to ref_frame, in full pixels. Returns 0 if there is none.
+int vp9_get_fp_mv_seed(const struct VP9_COMP *cpi,
+                       MV_REFERENCE_FRAME ref_frame, int mi_row, int mi_col,
+                       BLOCK_SIZE bsize, MV *mv);
 void vp9_rc_get_second_pass_params(struct VP9_COMP *cpi);
 void vp9_init_vizier_params(TWO_PASS *const twopass, int screen_area);
 
+// Copies the first pass stats of frames [first, first + count) of 'stats' to
+// 'section' and appends their total, so that the frames can be encoded as a
+// clip of their own. 'section' must hold count + 1 entries.
+void vp9_get_first_pass_section(const FIRSTPASS_STATS *stats, int first,
+                                int count, FIRSTPASS_STATS *section);
+
+struct VP9EncoderConfig;
+// Splits the bits of a two pass encode of the 'num_frames' frames of 'stats'
+// (followed by their total) between consecutive sections of
+// 'section_frames' frames, in proportion to the normalized frame scores used
+// for bit allocation. Writes the target bandwidth that makes each section
+// spend its share when encoded on its own to 'section_bandwidth'.
+void vp9_split_two_pass_bandwidth(const struct VP9EncoderConfig *oxcf,
+                                  const FRAME_INFO *frame_info,
+                                  const FIRSTPASS_STATS *stats, int num_frames,
+                                  int section_frames,
+                                  int64_t *section_bandwidth);
+
 // Post encode update of the rate control parameters for 2-pass
 void vp9_twopass_postencode_update(struct VP9_COMP *cpi);
 
 void calculate_coded_size(struct VP9_COMP *cpi, int *scaled_frame_width,
                           int *scaled_frame_height);
 
-struct VP9EncoderConfig;
 int vp9_get_frames_to_next_key(const struct VP9EncoderConfig *oxcf,
                                const TWO_PASS *const twopass, int kf_show_idx,
                                int min_gf_interval);
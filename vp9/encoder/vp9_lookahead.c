@@ -12,6 +12,7 @@
 #include <string.h>
 
 #include "./vpx_config.h"
+#include "./vpx_scale_rtcd.h"
 
 #include "vp9/common/vp9_common.h"
 
@@ -30,26 +31,33 @@ static struct lookahead_entry *pop(struct lookahead_ctx *ctx, int *idx) {
   return buf;
 }
 
+// Returns the lent frame of buf, if any, to the application and puts the
+// frame buffer of the entry back in place.
+static void release_lent_frame(struct lookahead_entry *buf) {
+  if (buf->release_cb != NULL) {
+    buf->release_cb(buf->cb_priv, buf->user_priv);
+    buf->release_cb = NULL;
+    buf->img = buf->owned_img;
+    memset(&buf->owned_img, 0, sizeof(buf->owned_img));
+  }
+}
+
 void vp9_lookahead_destroy(struct lookahead_ctx *ctx) {
   if (ctx) {
     if (ctx->buf) {
       int i;
 
-      for (i = 0; i < ctx->max_sz; i++) vpx_free_frame_buffer(&ctx->buf[i].img);
+      for (i = 0; i < ctx->max_sz; i++) {
+        release_lent_frame(&ctx->buf[i]);
+        vpx_free_frame_buffer(&ctx->buf[i].img);
+      }
       free(ctx->buf);
     }
     free(ctx);
   }
 }
 
-struct lookahead_ctx *vp9_lookahead_init(unsigned int width,
-                                         unsigned int height,
-                                         unsigned int subsampling_x,
-                                         unsigned int subsampling_y,
-#if CONFIG_VP9_HIGHBITDEPTH
-                                         int use_highbitdepth,
-#endif
-                                         unsigned int depth) {
+struct lookahead_ctx *vp9_lookahead_init(unsigned int depth) {
   struct lookahead_ctx *ctx = NULL;
 
   // Clamp the lookahead queue depth
@@ -61,20 +69,10 @@ struct lookahead_ctx *vp9_lookahead_init(unsigned int width,
   // Allocate the lookahead structures
   ctx = calloc(1, sizeof(*ctx));
   if (ctx) {
-    const int legacy_byte_alignment = 0;
-    unsigned int i;
     ctx->max_sz = depth;
     ctx->buf = calloc(depth, sizeof(*ctx->buf));
     ctx->next_show_idx = 0;
     if (!ctx->buf) goto bail;
-    for (i = 0; i < depth; i++)
-      if (vpx_alloc_frame_buffer(
-              &ctx->buf[i].img, width, height, subsampling_x, subsampling_y,
-#if CONFIG_VP9_HIGHBITDEPTH
-              use_highbitdepth,
-#endif
-              VP9_ENC_BORDER_IN_PIXELS, legacy_byte_alignment))
-        goto bail;
   }
   return ctx;
 bail:
@@ -109,6 +107,7 @@ int vp9_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
   if (vp9_lookahead_full(ctx)) return 1;
   ctx->sz++;
   buf = pop(ctx, &ctx->write_idx);
+  release_lent_frame(buf);
 
   new_dimensions = width != buf->img.y_crop_width ||
                    height != buf->img.y_crop_height ||
@@ -153,6 +152,72 @@ int vp9_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
   return 0;
 }
 
+int vp9_lookahead_can_lend(const YV12_BUFFER_CONFIG *src, int border) {
+  // Same layout as vpx_realloc_frame_buffer(). Some of the encoder functions
+  // index the source frames and the frame buffers with the same offsets.
+  const int aligned_width = (src->y_crop_width + 7) & ~7;
+  const int y_stride =
+      (aligned_width + 2 * VP9_ENC_BORDER_IN_PIXELS + 31) & ~31;
+  // The chroma planes of NV12 frames are deinterleaved when copied.
+  return border >= VP9_ENC_BORDER_IN_PIXELS && src->y_stride == y_stride &&
+         src->uv_stride == (y_stride >> src->subsampling_x) &&
+         src->v_buffer - src->u_buffer != 1;
+}
+
+int vp9_lookahead_push_lent(struct lookahead_ctx *ctx,
+                            const YV12_BUFFER_CONFIG *src, int64_t ts_start,
+                            int64_t ts_end, vpx_enc_frame_flags_t flags,
+                            vpx_release_input_cb_fn_t release_cb,
+                            void *cb_priv, void *user_priv) {
+  const int aligned_width = (src->y_crop_width + 7) & ~7;
+  const int aligned_height = (src->y_crop_height + 7) & ~7;
+  struct lookahead_entry *buf;
+  YV12_BUFFER_CONFIG *img;
+
+  assert(vp9_lookahead_can_lend(src, VP9_ENC_BORDER_IN_PIXELS));
+  if (vp9_lookahead_full(ctx)) return 1;
+  ctx->sz++;
+  buf = pop(ctx, &ctx->write_idx);
+  release_lent_frame(buf);
+  // Keeps the frame buffer of the entry for the next copied frame.
+  buf->owned_img = buf->img;
+
+  img = &buf->img;
+  memset(img, 0, sizeof(*img));
+  img->y_buffer = src->y_buffer;
+  img->u_buffer = src->u_buffer;
+  img->v_buffer = src->v_buffer;
+  img->y_stride = src->y_stride;
+  img->uv_stride = src->uv_stride;
+  img->y_crop_width = src->y_crop_width;
+  img->y_crop_height = src->y_crop_height;
+  img->uv_crop_width = src->uv_crop_width;
+  img->uv_crop_height = src->uv_crop_height;
+  img->y_width = aligned_width;
+  img->y_height = aligned_height;
+  img->uv_width = aligned_width >> src->subsampling_x;
+  img->uv_height = aligned_height >> src->subsampling_y;
+  img->subsampling_x = src->subsampling_x;
+  img->subsampling_y = src->subsampling_y;
+  img->color_space = src->color_space;
+  img->color_range = src->color_range;
+  img->render_width = src->render_width;
+  img->render_height = src->render_height;
+  img->flags = src->flags;
+  img->border = VP9_ENC_BORDER_IN_PIXELS;
+  vpx_extend_frame_borders(img);
+
+  buf->release_cb = release_cb;
+  buf->cb_priv = cb_priv;
+  buf->user_priv = user_priv;
+  buf->ts_start = ts_start;
+  buf->ts_end = ts_end;
+  buf->flags = flags;
+  buf->show_idx = ctx->next_show_idx;
+  ++ctx->next_show_idx;
+  return 0;
+}
+
 struct lookahead_entry *vp9_lookahead_pop(struct lookahead_ctx *ctx,
                                           int drain) {
   struct lookahead_entry *buf = NULL;
@@ -12,6 +12,7 @@
 #define VPX_VP9_ENCODER_VP9_LOOKAHEAD_H_
 
 #include "vpx_scale/yv12config.h"
+#include "vpx/vp8cx.h"
 #include "vpx/vpx_encoder.h"
 #include "vpx/vpx_integer.h"
 
@@ -27,6 +28,13 @@ struct lookahead_entry {
   int64_t ts_end;
   int show_idx; /*The show_idx of this frame*/
   vpx_enc_frame_flags_t flags;
+  // Set if img wraps a frame lent by the application, which is returned with
+  // release_cb(cb_priv, user_priv) once the entry is reused. The frame buffer
+  // of the entry, if any, is kept in owned_img meanwhile.
+  vpx_release_input_cb_fn_t release_cb;
+  void *cb_priv;
+  void *user_priv;
+  YV12_BUFFER_CONFIG owned_img;
 };
 
 // The max of past frames we want to keep in the queue.
@@ -45,16 +53,10 @@ struct lookahead_ctx {
 /**\brief Initializes the lookahead stage
  *
  * The lookahead stage is a queue of frame buffers on which some analysis
- * may be done when buffers are enqueued.
+ * may be done when buffers are enqueued. The frame buffers are allocated
+ * when a frame is first copied into them.
  */
-struct lookahead_ctx *vp9_lookahead_init(unsigned int width,
-                                         unsigned int height,
-                                         unsigned int subsampling_x,
-                                         unsigned int subsampling_y,
-#if CONFIG_VP9_HIGHBITDEPTH
-                                         int use_highbitdepth,
-#endif
-                                         unsigned int depth);
+struct lookahead_ctx *vp9_lookahead_init(unsigned int depth);
 
 /**\brief Destroys the lookahead stage
  */
@@ -92,6 +94,28 @@ int vp9_lookahead_push(struct lookahead_ctx *ctx, YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
                        vpx_enc_frame_flags_t flags);
 
+/**\brief Check whether a source buffer can be used in place
+ *
+ * Returns 1 if src has the layout of the frame buffers allocated by the
+ * lookahead, which the rest of the encoder relies on. border is the writable
+ * border around the luma plane of src, as given by the application: it cannot
+ * be told from the buffer.
+ */
+int vp9_lookahead_can_lend(const YV12_BUFFER_CONFIG *src, int border);
+
+/**\brief Enqueue a source buffer lent by the application
+ *
+ * Same as vp9_lookahead_push(), but src, which must pass
+ * vp9_lookahead_can_lend(), is used in place and its border is extended
+ * here. release_cb(cb_priv, user_priv) is called once the frame is no longer
+ * used, when its entry is reused or the lookahead is destroyed.
+ */
+int vp9_lookahead_push_lent(struct lookahead_ctx *ctx,
+                            const YV12_BUFFER_CONFIG *src, int64_t ts_start,
+                            int64_t ts_end, vpx_enc_frame_flags_t flags,
+                            vpx_release_input_cb_fn_t release_cb,
+                            void *cb_priv, void *user_priv);
+
 /**\brief Get the next source buffer to encode
  *
  *
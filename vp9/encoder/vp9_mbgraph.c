@@ -22,13 +22,11 @@
 #include "vp9/common/vp9_reconinter.h"
 #include "vp9/common/vp9_reconintra.h"
 
-static unsigned int do_16x16_motion_iteration(VP9_COMP *cpi, const MV *ref_mv,
-                                              MV *dst_mv, int mb_row,
-                                              int mb_col) {
-  MACROBLOCK *const x = &cpi->td.mb;
+static unsigned int do_16x16_motion_iteration(VP9_COMP *cpi, MACROBLOCK *x,
+                                              const MV *ref_mv, MV *dst_mv,
+                                              int mb_row, int mb_col) {
   MACROBLOCKD *const xd = &x->e_mbd;
-  MV_SPEED_FEATURES *const mv_sf = &cpi->sf.mv;
-  const SEARCH_METHODS old_search_method = mv_sf->search_method;
+  const MV_SPEED_FEATURES *const mv_sf = &cpi->sf.mv;
   const vp9_variance_fn_ptr_t v_fn_ptr = cpi->fn_ptr[BLOCK_16X16];
   const MvLimits tmp_mv_limits = x->mv_limits;
   MV ref_full;
@@ -43,11 +41,11 @@ static unsigned int do_16x16_motion_iteration(VP9_COMP *cpi, const MV *ref_mv,
   ref_full.col = ref_mv->col >> 3;
   ref_full.row = ref_mv->row >> 3;
 
-  mv_sf->search_method = HEX;
-  vp9_full_pixel_search(cpi, x, BLOCK_16X16, &ref_full, step_param,
-                        cpi->sf.mv.search_method, x->errorperbit,
-                        cond_cost_list(cpi, cost_list), ref_mv, dst_mv, 0, 0);
-  mv_sf->search_method = old_search_method;
+  // The speed features are shared by the row-mt workers, so the search method
+  // is passed directly rather than overridden in cpi->sf.
+  vp9_full_pixel_search(cpi, x, BLOCK_16X16, &ref_full, step_param, HEX,
+                        x->errorperbit, cond_cost_list(cpi, cost_list), ref_mv,
+                        dst_mv, 0, 0);
 
   /* restore UMV window */
   x->mv_limits = tmp_mv_limits;
@@ -74,9 +72,9 @@ static unsigned int do_16x16_motion_iteration(VP9_COMP *cpi, const MV *ref_mv,
                       xd->plane[0].dst.buf, xd->plane[0].dst.stride);
 }
 
-static int do_16x16_motion_search(VP9_COMP *cpi, const MV *ref_mv,
-                                  int_mv *dst_mv, int mb_row, int mb_col) {
-  MACROBLOCK *const x = &cpi->td.mb;
+static int do_16x16_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
+                                  const MV *ref_mv, int_mv *dst_mv, int mb_row,
+                                  int mb_col) {
   MACROBLOCKD *const xd = &x->e_mbd;
   unsigned int err, tmp_err;
   MV tmp_mv;
@@ -89,7 +87,7 @@ static int do_16x16_motion_search(VP9_COMP *cpi, const MV *ref_mv,
 
   // Test last reference frame using the previous best mv as the
   // starting point (best reference) for the search
-  tmp_err = do_16x16_motion_iteration(cpi, ref_mv, &tmp_mv, mb_row, mb_col);
+  tmp_err = do_16x16_motion_iteration(cpi, x, ref_mv, &tmp_mv, mb_row, mb_col);
   if (tmp_err < err) {
     err = tmp_err;
     dst_mv->as_mv = tmp_mv;
@@ -100,8 +98,8 @@ static int do_16x16_motion_search(VP9_COMP *cpi, const MV *ref_mv,
   if (ref_mv->row != 0 || ref_mv->col != 0) {
     MV zero_ref_mv = { 0, 0 };
 
-    tmp_err =
-        do_16x16_motion_iteration(cpi, &zero_ref_mv, &tmp_mv, mb_row, mb_col);
+    tmp_err = do_16x16_motion_iteration(cpi, x, &zero_ref_mv, &tmp_mv, mb_row,
+                                        mb_col);
     if (tmp_err < err) {
       dst_mv->as_mv = tmp_mv;
       err = tmp_err;
@@ -111,8 +109,7 @@ static int do_16x16_motion_search(VP9_COMP *cpi, const MV *ref_mv,
   return err;
 }
 
-static int do_16x16_zerozero_search(VP9_COMP *cpi, int_mv *dst_mv) {
-  MACROBLOCK *const x = &cpi->td.mb;
+static int do_16x16_zerozero_search(MACROBLOCK *x, int_mv *dst_mv) {
   MACROBLOCKD *const xd = &x->e_mbd;
   unsigned int err;
 
@@ -125,8 +122,7 @@ static int do_16x16_zerozero_search(VP9_COMP *cpi, int_mv *dst_mv) {
 
   return err;
 }
-static int find_best_16x16_intra(VP9_COMP *cpi, PREDICTION_MODE *pbest_mode) {
-  MACROBLOCK *const x = &cpi->td.mb;
+static int find_best_16x16_intra(MACROBLOCK *x, PREDICTION_MODE *pbest_mode) {
   MACROBLOCKD *const xd = &x->e_mbd;
   PREDICTION_MODE best_mode = -1, mode;
   unsigned int best_err = INT_MAX;
@@ -155,13 +151,13 @@ static int find_best_16x16_intra(VP9_COMP *cpi, PREDICTION_MODE *pbest_mode) {
   return best_err;
 }
 
-static void update_mbgraph_mb_stats(VP9_COMP *cpi, MBGRAPH_MB_STATS *stats,
+static void update_mbgraph_mb_stats(VP9_COMP *cpi, MACROBLOCK *x,
+                                    MBGRAPH_MB_STATS *stats,
                                     YV12_BUFFER_CONFIG *buf, int mb_y_offset,
                                     YV12_BUFFER_CONFIG *golden_ref,
                                     const MV *prev_golden_ref_mv,
                                     YV12_BUFFER_CONFIG *alt_ref, int mb_row,
                                     int mb_col) {
-  MACROBLOCK *const x = &cpi->td.mb;
   MACROBLOCKD *const xd = &x->e_mbd;
   int intra_error;
   VP9_COMMON *cm = &cpi->common;
@@ -174,7 +170,7 @@ static void update_mbgraph_mb_stats(VP9_COMP *cpi, MBGRAPH_MB_STATS *stats,
   xd->plane[0].dst.stride = get_frame_new_buffer(cm)->y_stride;
 
   // do intra 16x16 prediction
-  intra_error = find_best_16x16_intra(cpi, &stats->ref[INTRA_FRAME].m.mode);
+  intra_error = find_best_16x16_intra(x, &stats->ref[INTRA_FRAME].m.mode);
   if (intra_error <= 0) intra_error = 1;
   stats->ref[INTRA_FRAME].err = intra_error;
 
@@ -184,7 +180,7 @@ static void update_mbgraph_mb_stats(VP9_COMP *cpi, MBGRAPH_MB_STATS *stats,
     xd->plane[0].pre[0].buf = golden_ref->y_buffer + mb_y_offset;
     xd->plane[0].pre[0].stride = golden_ref->y_stride;
     g_motion_error =
-        do_16x16_motion_search(cpi, prev_golden_ref_mv,
+        do_16x16_motion_search(cpi, x, prev_golden_ref_mv,
                                &stats->ref[GOLDEN_FRAME].m.mv, mb_row, mb_col);
     stats->ref[GOLDEN_FRAME].err = g_motion_error;
   } else {
@@ -199,7 +195,7 @@ static void update_mbgraph_mb_stats(VP9_COMP *cpi, MBGRAPH_MB_STATS *stats,
     xd->plane[0].pre[0].buf = alt_ref->y_buffer + mb_y_offset;
     xd->plane[0].pre[0].stride = alt_ref->y_stride;
     a_motion_error =
-        do_16x16_zerozero_search(cpi, &stats->ref[ALTREF_FRAME].m.mv);
+        do_16x16_zerozero_search(x, &stats->ref[ALTREF_FRAME].m.mv);
 
     stats->ref[ALTREF_FRAME].err = a_motion_error;
   } else {
@@ -208,72 +204,94 @@ static void update_mbgraph_mb_stats(VP9_COMP *cpi, MBGRAPH_MB_STATS *stats,
   }
 }
 
-static void update_mbgraph_frame_stats(VP9_COMP *cpi,
-                                       MBGRAPH_FRAME_STATS *stats,
-                                       YV12_BUFFER_CONFIG *buf,
-                                       YV12_BUFFER_CONFIG *golden_ref,
-                                       YV12_BUFFER_CONFIG *alt_ref) {
-  MACROBLOCK *const x = &cpi->td.mb;
+void vp9_update_mbgraph_row(VP9_COMP *cpi, ThreadData *td, int mb_row,
+                            VP9RowMTSync *row_mt_sync) {
+  MbgraphJobData *const job_data = &cpi->mbgraph_job_data;
+  MBGRAPH_FRAME_STATS *const stats = job_data->stats;
+  YV12_BUFFER_CONFIG *const buf = job_data->buf;
+  MACROBLOCK *const x = &td->mb;
   MACROBLOCKD *const xd = &x->e_mbd;
   VP9_COMMON *const cm = &cpi->common;
-
-  int mb_col, mb_row, offset = 0;
-  int mb_y_offset = 0;
-  MV gld_top_mv = { 0, 0 };
+  MODE_INFO **const saved_mi = xd->mi;
+  const int offset = mb_row * cm->mb_cols;
+  int mb_col;
+  int mb_y_in_offset = mb_row * 16 * buf->y_stride;
+  MV gld_left_mv = { 0, 0 };
   MODE_INFO mi_local;
+  MODE_INFO *mi_ptr = &mi_local;
   MODE_INFO mi_above, mi_left;
 
+  // The golden frame search of the first MB of a row starts from the MV found
+  // for the first MB of the row above.
+  if (mb_row > 0) {
+    if (row_mt_sync != NULL) vp9_row_mt_sync_read(row_mt_sync, mb_row, 0);
+    gld_left_mv =
+        stats->mb_stats[offset - cm->mb_cols].ref[GOLDEN_FRAME].m.mv.as_mv;
+  }
+
   vp9_zero(mi_local);
   // Set up limit values for motion vectors to prevent them extending outside
   // the UMV borders.
-  x->mv_limits.row_min = -BORDER_MV_PIXELS_B16;
-  x->mv_limits.row_max = (cm->mb_rows - 1) * 8 + BORDER_MV_PIXELS_B16;
-  // Signal to vp9_predict_intra_block() that above is not available
-  xd->above_mi = NULL;
+  x->mv_limits.row_min = -BORDER_MV_PIXELS_B16 - 16 * mb_row;
+  x->mv_limits.row_max =
+      (cm->mb_rows - 1) * 16 + BORDER_MV_PIXELS_B16 - 16 * mb_row;
+  x->mv_limits.col_min = -BORDER_MV_PIXELS_B16;
+  x->mv_limits.col_max = (cm->mb_cols - 1) * 16 + BORDER_MV_PIXELS_B16;
+  // Signal to vp9_predict_intra_block() whether above is available, left is
+  // not available for the first MB.
+  xd->above_mi = mb_row > 0 ? &mi_above : NULL;
+  xd->left_mi = NULL;
 
   xd->plane[0].dst.stride = buf->y_stride;
   xd->plane[0].pre[0].stride = buf->y_stride;
   xd->plane[1].dst.stride = buf->uv_stride;
-  xd->mi[0] = &mi_local;
+  xd->mi = &mi_ptr;
   mi_local.sb_type = BLOCK_16X16;
   mi_local.ref_frame[0] = LAST_FRAME;
   mi_local.ref_frame[1] = NO_REF_FRAME;
 
-  for (mb_row = 0; mb_row < cm->mb_rows; mb_row++) {
-    MV gld_left_mv = gld_top_mv;
-    int mb_y_in_offset = mb_y_offset;
-
-    // Set up limit values for motion vectors to prevent them extending outside
-    // the UMV borders.
-    x->mv_limits.col_min = -BORDER_MV_PIXELS_B16;
-    x->mv_limits.col_max = (cm->mb_cols - 1) * 8 + BORDER_MV_PIXELS_B16;
-    // Signal to vp9_predict_intra_block() that left is not available
-    xd->left_mi = NULL;
-
-    for (mb_col = 0; mb_col < cm->mb_cols; mb_col++) {
-      MBGRAPH_MB_STATS *mb_stats = &stats->mb_stats[offset + mb_col];
-
-      update_mbgraph_mb_stats(cpi, mb_stats, buf, mb_y_in_offset, golden_ref,
-                              &gld_left_mv, alt_ref, mb_row, mb_col);
-      gld_left_mv = mb_stats->ref[GOLDEN_FRAME].m.mv.as_mv;
-      if (mb_col == 0) {
-        gld_top_mv = gld_left_mv;
-      }
-      // Signal to vp9_predict_intra_block() that left is available
-      xd->left_mi = &mi_left;
+  for (mb_col = 0; mb_col < cm->mb_cols; mb_col++) {
+    MBGRAPH_MB_STATS *mb_stats = &stats->mb_stats[offset + mb_col];
 
-      mb_y_in_offset += 16;
-      x->mv_limits.col_min -= 16;
-      x->mv_limits.col_max -= 16;
+    update_mbgraph_mb_stats(cpi, x, mb_stats, buf, mb_y_in_offset,
+                            job_data->golden_ref, &gld_left_mv,
+                            job_data->alt_ref, mb_row, mb_col);
+    gld_left_mv = mb_stats->ref[GOLDEN_FRAME].m.mv.as_mv;
+    // Only the first MB of the row is needed by the row below.
+    if (mb_col == 0 && row_mt_sync != NULL) {
+      vp9_row_mt_sync_write(row_mt_sync, mb_row, mb_col, cm->mb_cols);
     }
+    // Signal to vp9_predict_intra_block() that left is available
+    xd->left_mi = &mi_left;
+
+    mb_y_in_offset += 16;
+    x->mv_limits.col_min -= 16;
+    x->mv_limits.col_max -= 16;
+  }
 
-    // Signal to vp9_predict_intra_block() that above is available
-    xd->above_mi = &mi_above;
+  xd->mi = saved_mi;
+}
 
-    mb_y_offset += buf->y_stride * 16;
-    x->mv_limits.row_min -= 16;
-    x->mv_limits.row_max -= 16;
-    offset += cm->mb_cols;
+static void update_mbgraph_frame_stats(VP9_COMP *cpi,
+                                       MBGRAPH_FRAME_STATS *stats,
+                                       YV12_BUFFER_CONFIG *buf,
+                                       YV12_BUFFER_CONFIG *golden_ref,
+                                       YV12_BUFFER_CONFIG *alt_ref) {
+  VP9_COMMON *const cm = &cpi->common;
+  MbgraphJobData *const job_data = &cpi->mbgraph_job_data;
+  int mb_row;
+
+  job_data->stats = stats;
+  job_data->buf = buf;
+  job_data->golden_ref = golden_ref;
+  job_data->alt_ref = alt_ref;
+
+  if (cpi->row_mt && cpi->oxcf.max_threads > 1) {
+    vp9_mbgraph_row_mt(cpi);
+  } else {
+    for (mb_row = 0; mb_row < cm->mb_rows; mb_row++) {
+      vp9_update_mbgraph_row(cpi, &cpi->td, mb_row, NULL);
+    }
   }
 }
 
@@ -29,10 +29,26 @@ typedef struct {
   MBGRAPH_MB_STATS *mb_stats;
 } MBGRAPH_FRAME_STATS;
 
+// Frame being analyzed, shared by the row-mt workers.
+typedef struct {
+  MBGRAPH_FRAME_STATS *stats;
+  YV12_BUFFER_CONFIG *buf;
+  YV12_BUFFER_CONFIG *golden_ref;
+  YV12_BUFFER_CONFIG *alt_ref;
+} MbgraphJobData;
+
 struct VP9_COMP;
+struct ThreadData;
+struct VP9RowMTSyncData;
 
 void vp9_update_mbgraph_stats(struct VP9_COMP *cpi);
 
+// Fills the stats of the MBs of row 'mb_row' of the frame described by
+// cpi->mbgraph_job_data. 'row_mt_sync' is NULL when the rows are processed in
+// order on a single thread.
+void vp9_update_mbgraph_row(struct VP9_COMP *cpi, struct ThreadData *td,
+                            int mb_row, struct VP9RowMTSyncData *row_mt_sync);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -1493,6 +1493,29 @@ int vp9_get_mvpred_av_var(const MACROBLOCK *x, const MV *best_mv,
                      : 0);
 }
 
+int vp9_apply_mv_seed(const MACROBLOCK *x, const vp9_variance_fn_ptr_t *vfp,
+                      const MV *ref_mv, MV seed, int refine_only,
+                      MV *mvp_full, int *step_param) {
+  clamp_mv(&seed, x->mv_limits.col_min, x->mv_limits.col_max,
+           x->mv_limits.row_min, x->mv_limits.row_max);
+  if (refine_only) {
+    *mvp_full = seed;
+    *step_param = VPXMAX(*step_param, MAX_MVSEARCH_STEPS - 2);
+    return 1;
+  }
+
+  clamp_mv(mvp_full, x->mv_limits.col_min, x->mv_limits.col_max,
+           x->mv_limits.row_min, x->mv_limits.row_max);
+  if (is_equal_mv(&seed, mvp_full) ||
+      vp9_get_mvpred_var(x, &seed, ref_mv, vfp, 1) <=
+          vp9_get_mvpred_var(x, mvp_full, ref_mv, vfp, 1)) {
+    *mvp_full = seed;
+    *step_param = VPXMAX(*step_param, MAX_MVSEARCH_STEPS - 4);
+    return 1;
+  }
+  return 0;
+}
+
 static int hex_search(const MACROBLOCK *x, MV *ref_mv, int search_param,
                       int sad_per_bit, int do_init_search, int *cost_list,
                       const vp9_variance_fn_ptr_t *vfp, int use_mvcost,
@@ -1677,8 +1700,30 @@ static int exhaustive_mesh_search(const MACROBLOCK *x, MV *ref_mv, MV *best_mv,
           }
         }
       } else {
-        // 4 sads in a single call if we are checking every location
-        if (c + 3 <= end_col) {
+        // 8 sads in a single call if we are checking every location and the
+        // block size has a multi-position kernel.
+        if (fn_ptr->sdx8f != NULL && c + 7 <= end_col) {
+          unsigned int sads[8];
+          const MV start = { fcenter_mv.row + r, fcenter_mv.col + c };
+          fn_ptr->sdx8f(what->buf, what->stride,
+                        get_buf_from_mv(in_what, &start), in_what->stride,
+                        sads);
+
+          for (i = 0; i < 8; ++i) {
+            if (sads[i] < best_sad) {
+              const MV mv = { fcenter_mv.row + r, fcenter_mv.col + c + i };
+              const unsigned int sad =
+                  sads[i] + mvsad_err_cost(x, &mv, ref_mv, sad_per_bit);
+              if (sad < best_sad) {
+                best_sad = sad;
+                *best_mv = mv;
+              }
+            }
+          }
+          // The following group of 4 has been covered as well.
+          c += 4;
+        } else if (c + 3 <= end_col) {
+          // 4 sads in a single call if we are checking every location
           unsigned int sads[4];
           const uint8_t *addrs[4];
           for (i = 0; i < 4; ++i) {
@@ -1781,6 +1826,28 @@ static int64_t exhaustive_mesh_search_single_step(
   end_col = VPXMIN(center_mv->col + range, mv_limits->col_max);
   for (r = start_row; r <= end_row; r += 1) {
     c = start_col;
+    if (fn_ptr->sdx8f != NULL) {
+      while (c + 7 <= end_col) {
+        unsigned int sads[8];
+        const MV start = { r, c };
+        fn_ptr->sdx8f(src->buf, src->stride, get_buf_from_mv(pre, &start),
+                      pre->stride, sads);
+
+        for (i = 0; i < 8; ++i) {
+          int64_t sad = (int64_t)sads[i] << LOG2_PRECISION;
+          if (sad < best_sad) {
+            const MV mv = { r, c + i };
+            sad += lambda *
+                   vp9_nb_mvs_inconsistency(&mv, nb_full_mvs, full_mv_num);
+            if (sad < best_sad) {
+              best_sad = sad;
+              *best_mv = mv;
+            }
+          }
+        }
+        c += 8;
+      }
+    }
     while (c + 3 <= end_col) {
       unsigned int sads[4];
       const uint8_t *addrs[4];
@@ -2315,28 +2382,16 @@ unsigned int vp9_int_pro_motion_estimation(const VP9_COMP *cpi, MACROBLOCK *x,
 
   // Set up prediction 1-D reference set
   ref_buf = xd->plane[0].pre[0].buf - (bw >> 1);
-  for (idx = 0; idx < search_width; idx += 16) {
-    vpx_int_pro_row(&hbuf[idx], ref_buf, ref_stride, bh);
-    ref_buf += 16;
-  }
+  vpx_int_pro_row_batch(hbuf, ref_buf, ref_stride, search_width, bh);
 
   ref_buf = xd->plane[0].pre[0].buf - (bh >> 1) * ref_stride;
-  for (idx = 0; idx < search_height; ++idx) {
-    vbuf[idx] = vpx_int_pro_col(ref_buf, bw) >> norm_factor;
-    ref_buf += ref_stride;
-  }
+  vpx_int_pro_col_batch(vbuf, ref_buf, ref_stride, bw, search_height,
+                        norm_factor);
 
   // Set up src 1-D reference set
-  for (idx = 0; idx < bw; idx += 16) {
-    src_buf = x->plane[0].src.buf + idx;
-    vpx_int_pro_row(&src_hbuf[idx], src_buf, src_stride, bh);
-  }
-
   src_buf = x->plane[0].src.buf;
-  for (idx = 0; idx < bh; ++idx) {
-    src_vbuf[idx] = vpx_int_pro_col(src_buf, bw) >> norm_factor;
-    src_buf += src_stride;
-  }
+  vpx_int_pro_row_batch(src_hbuf, src_buf, src_stride, bw, bh);
+  vpx_int_pro_col_batch(src_vbuf, src_buf, src_stride, bw, bh, norm_factor);
 
   // Find the best match per 1-D search
   tmp_mv->col = vector_match(hbuf, src_hbuf, b_width_log2_lookup[bsize]);
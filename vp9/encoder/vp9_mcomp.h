@@ -66,6 +66,15 @@ int vp9_get_mvpred_av_var(const MACROBLOCK *x, const MV *best_mv,
                           const MV *center_mv, const uint8_t *second_pred,
                           const vp9_variance_fn_ptr_t *vfp, int use_mvcost);
 
+// Makes the full pixel motion vector seed the start point of a full pixel
+// search from *mvp_full if it predicts the block at least as well, or always
+// with refine_only, and raises *step_param to search a narrower window
+// around it. Both are clamped to the search range. Returns 1 if the seed is
+// used.
+int vp9_apply_mv_seed(const MACROBLOCK *x, const vp9_variance_fn_ptr_t *vfp,
+                      const MV *ref_mv, MV seed, int refine_only,
+                      MV *mvp_full, int *step_param);
+
 struct VP9_COMP;
 struct SPEED_FEATURES;
 struct vp9_sad_table;
@@ -10,11 +10,14 @@
 
 #include <assert.h>
 #include <limits.h>
+#include <string.h>
 
 #include "./vpx_scale_rtcd.h"
 #include "vpx_dsp/psnr.h"
 #include "vpx_mem/vpx_mem.h"
 #include "vpx_ports/mem.h"
+#include "vpx_ports/system_state.h"
+#include "vpx_util/vpx_thread.h"
 
 #include "vp9/common/vp9_loopfilter.h"
 #include "vp9/common/vp9_onyxc_int.h"
@@ -75,6 +78,207 @@ static int64_t try_filter_frame(const YV12_BUFFER_CONFIG *sd,
   return filt_err;
 }
 
+// Maximum number of filter levels evaluated at once by the parallel search:
+// the two levels of the current step, plus the levels the next step may need.
+#define LPF_PICK_MAX_CANDIDATES 6
+
+// Model based early stop: the search ends once a parabola fitted through the
+// errors of the current step predicts less than 1/2^LPF_PICK_MODEL_SHIFT of
+// improvement from a finer step.
+#define LPF_PICK_MODEL_SHIFT 10
+
+typedef struct LpfPickWorkerData {
+  const YV12_BUFFER_CONFIG *sd;
+  const YV12_BUFFER_CONFIG *unfiltered;
+  // The loop filter reads its masks and levels from VP9_COMMON, so each
+  // candidate is filtered with a copy of it that owns its masks.
+  VP9_COMMON cm;
+  MACROBLOCKD xd;
+  LOOP_FILTER_MASK *lfm;
+  int lfm_size;
+  // Only the Y plane of 'dst' is allocated, in 'dst_buf'.
+  YV12_BUFFER_CONFIG dst;
+  uint8_t *dst_buf;
+  size_t dst_buf_size;
+  int filt_level;
+  int partial_frame;
+  int64_t filt_err;
+} LpfPickWorkerData;
+
+static int lpf_pick_worker_hook(void *arg1, void *unused) {
+  LpfPickWorkerData *const data = (LpfPickWorkerData *)arg1;
+  VP9_COMMON *const cm = &data->cm;
+  (void)unused;
+
+  vpx_yv12_copy_y(data->unfiltered, &data->dst);
+  vp9_build_mask_frame(cm, data->filt_level, data->partial_frame);
+  vp9_loop_filter_frame(&data->dst, cm, &data->xd, data->filt_level, 1,
+                        data->partial_frame);
+
+#if CONFIG_VP9_HIGHBITDEPTH
+  if (cm->use_highbitdepth) {
+    data->filt_err = vpx_highbd_get_y_sse(data->sd, &data->dst);
+  } else {
+    data->filt_err = vpx_get_y_sse(data->sd, &data->dst);
+  }
+#else
+  data->filt_err = vpx_get_y_sse(data->sd, &data->dst);
+#endif  // CONFIG_VP9_HIGHBITDEPTH
+  return 1;
+}
+
+// Sets up 'data->dst' as a frame with only a Y plane, since the search
+// only filters and measures luma. The chroma pointers alias the Y plane so
+// that vp9_setup_dst_planes() stays within the buffer; they are never read.
+static void alloc_lpf_pick_dst(VP9_COMMON *cm, LpfPickWorkerData *data) {
+  YV12_BUFFER_CONFIG *const dst = &data->dst;
+  const int aligned_width = (cm->width + 7) & ~7;
+  const int aligned_height = (cm->height + 7) & ~7;
+  const int y_stride = (aligned_width + 31) & ~31;
+#if CONFIG_VP9_HIGHBITDEPTH
+  const int bytes_per_pixel = cm->use_highbitdepth ? 2 : 1;
+#else
+  const int bytes_per_pixel = 1;
+#endif
+  const size_t size = (size_t)y_stride * aligned_height * bytes_per_pixel;
+
+  if (data->dst_buf_size < size) {
+    vpx_free(data->dst_buf);
+    data->dst_buf_size = 0;
+    CHECK_MEM_ERROR(&cm->error, data->dst_buf, vpx_memalign(32, size));
+    data->dst_buf_size = size;
+  }
+
+  memset(dst, 0, sizeof(*dst));
+  dst->y_width = aligned_width;
+  dst->y_height = aligned_height;
+  dst->y_crop_width = cm->width;
+  dst->y_crop_height = cm->height;
+  dst->y_stride = y_stride;
+  dst->uv_stride = y_stride;
+  dst->y_buffer = data->dst_buf;
+#if CONFIG_VP9_HIGHBITDEPTH
+  if (cm->use_highbitdepth) {
+    dst->y_buffer = CONVERT_TO_BYTEPTR(data->dst_buf);
+    dst->flags = YV12_FLAG_HIGHBITDEPTH;
+    dst->bit_depth = cm->bit_depth;
+  }
+#endif
+  dst->u_buffer = dst->y_buffer;
+  dst->v_buffer = dst->y_buffer;
+}
+
+static void alloc_lpf_pick_data(VP9_COMP *cpi, int num_candidates) {
+  VP9_COMMON *const cm = &cpi->common;
+  const int lfm_size =
+      ((cm->mi_rows + (MI_BLOCK_SIZE - 1)) >> 3) * cm->lf.lfm_stride;
+  int i;
+
+  if (cpi->lpf_pick_data == NULL) {
+    CHECK_MEM_ERROR(&cm->error, cpi->lpf_pick_data,
+                    vpx_calloc(LPF_PICK_MAX_CANDIDATES,
+                               sizeof(*cpi->lpf_pick_data)));
+  }
+
+  for (i = 0; i < num_candidates; ++i) {
+    LpfPickWorkerData *const data = &cpi->lpf_pick_data[i];
+    if (data->lfm_size < lfm_size) {
+      vpx_free(data->lfm);
+      data->lfm_size = 0;
+      CHECK_MEM_ERROR(&cm->error, data->lfm,
+                      vpx_calloc(lfm_size, sizeof(*data->lfm)));
+      data->lfm_size = lfm_size;
+    }
+    alloc_lpf_pick_dst(cm, data);
+  }
+}
+
+void vp9_free_lpf_pick_data(VP9_COMP *cpi) {
+  int i;
+  if (cpi->lpf_pick_data == NULL) return;
+  for (i = 0; i < LPF_PICK_MAX_CANDIDATES; ++i) {
+    LpfPickWorkerData *const data = &cpi->lpf_pick_data[i];
+    vpx_free(data->lfm);
+    vpx_free(data->dst_buf);
+  }
+  vpx_free(cpi->lpf_pick_data);
+  cpi->lpf_pick_data = NULL;
+}
+
+// Evaluates the filter levels in 'levels' concurrently, one per encoder
+// worker, and stores their errors in 'ss_err'.
+static void try_filter_frames_mt(const YV12_BUFFER_CONFIG *sd,
+                                 VP9_COMP *const cpi, const int *levels,
+                                 int num_levels, int partial_frame,
+                                 int64_t *ss_err) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  VP9_COMMON *const cm = &cpi->common;
+  const int num_workers = cpi->num_workers;
+  int start, i;
+
+  alloc_lpf_pick_data(cpi, VPXMIN(num_levels, num_workers));
+
+  for (start = 0; start < num_levels; start += num_workers) {
+    const int num_jobs = VPXMIN(num_levels - start, num_workers);
+
+    for (i = 0; i < num_jobs; ++i) {
+      LpfPickWorkerData *const data = &cpi->lpf_pick_data[i];
+      data->sd = sd;
+      data->unfiltered = &cpi->last_frame_uf;
+      data->cm = *cm;
+      data->cm.lf.lfm = data->lfm;
+      data->xd = cpi->td.mb.e_mbd;
+      data->filt_level = levels[start + i];
+      data->partial_frame = partial_frame;
+    }
+
+    // The last job runs on the calling thread, which owns the last worker.
+    for (i = 0; i < num_jobs; ++i) {
+      VPxWorker *const worker =
+          &cpi->workers[i == num_jobs - 1 ? num_workers - 1 : i];
+      worker->hook = lpf_pick_worker_hook;
+      worker->data1 = &cpi->lpf_pick_data[i];
+      worker->data2 = NULL;
+      if (i == num_jobs - 1)
+        winterface->execute(worker);
+      else
+        winterface->launch(worker);
+    }
+    for (i = 0; i < num_jobs - 1; ++i) winterface->sync(&cpi->workers[i]);
+
+    for (i = 0; i < num_jobs; ++i)
+      ss_err[levels[start + i]] = cpi->lpf_pick_data[i].filt_err;
+  }
+}
+
+static void add_lpf_candidate(int *levels, int *num_levels, int level,
+                              int min_level, int max_level,
+                              const int64_t *ss_err) {
+  int i;
+  if (*num_levels >= LPF_PICK_MAX_CANDIDATES) return;
+  level = clamp(level, min_level, max_level);
+  if (ss_err[level] >= 0) return;
+  for (i = 0; i < *num_levels; ++i)
+    if (levels[i] == level) return;
+  levels[(*num_levels)++] = level;
+}
+
+// Returns 1 if the parabola through the errors at filt_mid - step, filt_mid
+// and filt_mid + step predicts no significant gain from refining around
+// filt_mid.
+static int lpf_search_converged(int64_t err_low, int64_t err_mid,
+                                int64_t err_high, int64_t best_err) {
+  vpx_clear_system_state();
+  {
+    const double curvature =
+        (double)err_low + (double)err_high - 2.0 * err_mid;
+    const double slope = (double)err_low - (double)err_high;
+    if (curvature <= 0) return 0;
+    return slope * slope / (8.0 * curvature) <
+           (double)(best_err >> LPF_PICK_MODEL_SHIFT);
+  }
+}
+
 static int search_filter_level(const YV12_BUFFER_CONFIG *sd, VP9_COMP *cpi,
                                int partial_frame) {
   const VP9_COMMON *const cm = &cpi->common;
@@ -116,6 +320,33 @@ static int search_filter_level(const YV12_BUFFER_CONFIG *sd, VP9_COMP *cpi,
     // yx, bias less for large block size
     if (cm->tx_mode != ONLY_4X4) bias >>= 1;
 
+    if (cpi->sf.lpf_pick_parallel && cpi->num_workers > 1) {
+      // Evaluate the levels this step needs together. Idle workers also try
+      // the levels the next step may need, whatever its outcome.
+      int levels[LPF_PICK_MAX_CANDIDATES];
+      int num_levels = 0;
+      if (filt_direction <= 0 && filt_low != filt_mid)
+        add_lpf_candidate(levels, &num_levels, filt_low, min_filter_level,
+                          max_filter_level, ss_err);
+      if (filt_direction >= 0 && filt_high != filt_mid)
+        add_lpf_candidate(levels, &num_levels, filt_high, min_filter_level,
+                          max_filter_level, ss_err);
+      if (num_levels > 0 && num_levels < cpi->num_workers) {
+        const int next_levels[4] = { filt_low - filter_step,
+                                     filt_high + filter_step,
+                                     filt_mid - filter_step / 2,
+                                     filt_mid + filter_step / 2 };
+        int i;
+        for (i = 0; i < 4 && num_levels < cpi->num_workers; ++i) {
+          add_lpf_candidate(levels, &num_levels, next_levels[i],
+                            min_filter_level, max_filter_level, ss_err);
+        }
+      }
+      if (num_levels > 0)
+        try_filter_frames_mt(sd, cpi, levels, num_levels, partial_frame,
+                             ss_err);
+    }
+
     if (filt_direction <= 0 && filt_low != filt_mid) {
       // Get Low filter error score
       if (ss_err[filt_low] < 0) {
@@ -145,6 +376,12 @@ static int search_filter_level(const YV12_BUFFER_CONFIG *sd, VP9_COMP *cpi,
 
     // Half the step distance if the best filter value was the same as last time
     if (filt_best == filt_mid) {
+      if (cpi->sf.lpf_pick_early_stop && filt_low != filt_mid &&
+          filt_high - filt_mid == filt_mid - filt_low &&
+          ss_err[filt_low] >= 0 && ss_err[filt_high] >= 0 &&
+          lpf_search_converged(ss_err[filt_low], ss_err[filt_mid],
+                               ss_err[filt_high], best_err))
+        break;
       filter_step /= 2;
       filt_direction = 0;
     } else {
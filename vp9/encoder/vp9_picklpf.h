@@ -22,6 +22,10 @@ struct VP9_COMP;
 
 void vp9_pick_filter_level(const struct yv12_buffer_config *sd,
                            struct VP9_COMP *cpi, LPF_PICK_METHOD method);
+
+// Frees the buffers used by the parallel filter level search.
+void vp9_free_lpf_pick_data(struct VP9_COMP *cpi);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
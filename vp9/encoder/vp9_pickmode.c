@@ -158,9 +158,10 @@ static int combined_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
   MACROBLOCKD *xd = &x->e_mbd;
   MODE_INFO *mi = xd->mi[0];
   struct buf_2d backup_yv12[MAX_MB_PLANE] = { { 0, 0 } };
-  const int step_param = cpi->sf.mv.fullpel_search_step_param;
+  int step_param = cpi->sf.mv.fullpel_search_step_param;
   const int sadpb = x->sadperbit16;
   MV mvp_full;
+  MV hint_mv;
   const int ref = mi->ref_frame[0];
   const MV ref_mv = x->mbmi_ext->ref_mvs[ref][0].as_mv;
   MV center_mv;
@@ -199,6 +200,11 @@ static int combined_motion_search(VP9_COMP *cpi, MACROBLOCK *x,
   mvp_full.col >>= 3;
   mvp_full.row >>= 3;
 
+  if (vp9_get_motion_hint(cpi, ref, mi_row, mi_col, bsize, &hint_mv)) {
+    vp9_apply_mv_seed(x, &cpi->fn_ptr[bsize], &ref_mv, hint_mv,
+                      cpi->motion_hint_refine_only, &mvp_full, &step_param);
+  }
+
   if (!use_base_mv)
     center_mv = ref_mv;
   else
@@ -1696,6 +1702,7 @@ void vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x, TileDataEnc *tile_data,
 
   MV_REFERENCE_FRAME ref_frame;
   MV_REFERENCE_FRAME usable_ref_frame, second_ref_frame;
+  MV_REFERENCE_FRAME hint_refs[2];
   int_mv frame_mv[MB_MODE_COUNT][MAX_REF_FRAMES];
   uint8_t mode_checked[MB_MODE_COUNT][MAX_REF_FRAMES];
   struct buf_2d yv12_mb[4][MAX_MB_PLANE] = { 0 };
@@ -2000,6 +2007,14 @@ void vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x, TileDataEnc *tile_data,
     }
   }
 
+  // Transcoding from mode info: only the reference frame of an inter source
+  // block is searched.
+  if (!vp9_get_mode_info_hint_refs(cpi, mi->segment_id, mi_row, mi_col,
+                                   hint_refs) ||
+      hint_refs[0] > usable_ref_frame ||
+      (hint_refs[0] > INTRA_FRAME && skip_ref_find_pred[hint_refs[0]]))
+    hint_refs[0] = NO_REF_FRAME;
+
   if (cpi->use_svc || cpi->oxcf.speed <= 7 || bsize < BLOCK_32X32)
     x->sb_use_mv_part = 0;
 
@@ -2072,6 +2087,7 @@ void vp9_pick_inter_mode(VP9_COMP *cpi, MACROBLOCK *x, TileDataEnc *tile_data,
 
     if (ref_frame > usable_ref_frame) continue;
     if (skip_ref_find_pred[ref_frame]) continue;
+    if (hint_refs[0] > INTRA_FRAME && ref_frame != hint_refs[0]) continue;
 
     if (svc->previous_frame_is_intra_only) {
       if (ref_frame != LAST_FRAME || frame_mv[this_mode][ref_frame].as_int != 0)
@@ -2580,6 +2580,8 @@ static void single_motion_search(VP9_COMP *cpi, MACROBLOCK *x, BLOCK_SIZE bsize,
   const int pw = num_4x4_blocks_wide_lookup[bsize] << 2;
   const int ph = num_4x4_blocks_high_lookup[bsize] << 2;
   MV pred_mv[3];
+  MV seed_mv;
+  int refine_hint = 0;
 
   int bestsme = INT_MAX;
 #if CONFIG_NON_GREEDY_MV
@@ -2666,6 +2668,16 @@ static void single_motion_search(VP9_COMP *cpi, MACROBLOCK *x, BLOCK_SIZE bsize,
   mvp_full.col >>= 3;
   mvp_full.row >>= 3;
 
+  if (vp9_get_motion_hint(cpi, ref, mi_row, mi_col, bsize, &seed_mv)) {
+    refine_hint = cpi->motion_hint_refine_only;
+    vp9_apply_mv_seed(x, &cpi->fn_ptr[bsize], &ref_mv, seed_mv, refine_hint,
+                      &mvp_full, &step_param);
+  } else if (cpi->oxcf.fp_mv_seeds &&
+             vp9_get_fp_mv_seed(cpi, ref, mi_row, mi_col, bsize, &seed_mv)) {
+    vp9_apply_mv_seed(x, &cpi->fn_ptr[bsize], &ref_mv, seed_mv, 0, &mvp_full,
+                      &step_param);
+  }
+
 #if CONFIG_NON_GREEDY_MV
   bestsme = vp9_full_pixel_diamond_new(cpi, x, bsize, &mvp_full, step_param,
                                        lambda, 1, nb_full_mvs, nb_full_mv_num,
@@ -2676,7 +2688,7 @@ static void single_motion_search(VP9_COMP *cpi, MACROBLOCK *x, BLOCK_SIZE bsize,
       cond_cost_list(cpi, cost_list), &ref_mv, &tmp_mv->as_mv, INT_MAX, 1);
 #endif  // CONFIG_NON_GREEDY_MV
 
-  if (cpi->sf.enhanced_full_pixel_motion_search) {
+  if (cpi->sf.enhanced_full_pixel_motion_search && !refine_hint) {
     int i;
     for (i = 0; i < 3; ++i) {
       int this_me;
@@ -3500,6 +3512,7 @@ void vp9_rd_pick_inter_mode_sb(VP9_COMP *cpi, TileDataEnc *tile_data,
       num_4x4_blocks_wide_lookup[bsize] != num_4x4_blocks_high_lookup[bsize];
   int64_t mask_filter = 0;
   int64_t filter_cache[SWITCHABLE_FILTER_CONTEXTS];
+  MV_REFERENCE_FRAME hint_refs[2];
 
   struct buf_2d *recon;
   struct buf_2d recon_buf;
@@ -3621,6 +3634,17 @@ void vp9_rd_pick_inter_mode_sb(VP9_COMP *cpi, TileDataEnc *tile_data,
     ref_frame_skip_mask[1] |= (1 << INTRA_FRAME);
   }
 
+  // Transcoding from mode info: only the reference frames of the source block
+  // are searched.
+  if (vp9_get_mode_info_hint_refs(cpi, segment_id, mi_row, mi_col,
+                                  hint_refs)) {
+    ref_frame_skip_mask[0] = ~(1 << hint_refs[0]) & 0xff;
+    ref_frame_skip_mask[1] = hint_refs[1] > INTRA_FRAME
+                                 ? ~(1 << hint_refs[1]) & 0xff
+                                 : SECOND_REF_FRAME_MASK;
+    if (hint_refs[0] > INTRA_FRAME) mode_skip_mask[hint_refs[0]] = 0;
+  }
+
   mode_skip_mask[INTRA_FRAME] |=
       (uint16_t) ~(sf->intra_y_mode_mask[max_txsize_lookup[bsize]]);
 
@@ -4331,6 +4355,7 @@ void vp9_rd_pick_inter_mode_sub8x8(VP9_COMP *cpi, TileDataEnc *tile_data,
   int ref_frame_skip_mask[2] = { 0 };
   int64_t mask_filter = 0;
   int64_t filter_cache[SWITCHABLE_FILTER_CONTEXTS];
+  MV_REFERENCE_FRAME hint_refs[2];
   int internal_active_edge =
       vp9_active_edge_sb(cpi, mi_row, mi_col) && vp9_internal_image_edge(cpi);
   const int *const rd_thresh_freq_fact = tile_data->thresh_freq_fact[bsize];
@@ -4368,6 +4393,16 @@ void vp9_rd_pick_inter_mode_sub8x8(VP9_COMP *cpi, TileDataEnc *tile_data,
     frame_mv[ZEROMV][ref_frame].as_int = 0;
   }
 
+  // Transcoding from mode info: only the reference frames of the source block
+  // are searched.
+  if (vp9_get_mode_info_hint_refs(cpi, segment_id, mi_row, mi_col,
+                                  hint_refs)) {
+    ref_frame_skip_mask[0] = ~(1 << hint_refs[0]) & 0xff;
+    ref_frame_skip_mask[1] = hint_refs[1] > INTRA_FRAME
+                                 ? ~(1 << hint_refs[1]) & 0xff
+                                 : SECOND_REF_FRAME_MASK;
+  }
+
   for (ref_index = 0; ref_index < MAX_REFS; ++ref_index) {
     int mode_excluded = 0;
     int64_t this_rd = INT64_MAX;
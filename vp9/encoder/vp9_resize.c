@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "./vp9_rtcd.h"
 #include "./vpx_config.h"
 #if CONFIG_VP9_HIGHBITDEPTH
 #include "vpx_dsp/vpx_dsp_common.h"
@@ -26,14 +27,23 @@
 #define FILTER_BITS 7
 
 #define INTERP_TAPS 8
-#define SUBPEL_BITS 5
-#define SUBPEL_MASK ((1 << SUBPEL_BITS) - 1)
+// The resizer filters use finer phases than the normative ones in
+// vpx_filter.h.
+#define RESIZE_SUBPEL_BITS 5
+#define RESIZE_SUBPEL_SHIFTS (1 << RESIZE_SUBPEL_BITS)
+#define RESIZE_SUBPEL_MASK (RESIZE_SUBPEL_SHIFTS - 1)
 #define INTERP_PRECISION_BITS 32
 
+// Number of columns filtered together in the vertical pass. Each block of
+// columns is resized down the full height of the plane before moving on, so
+// the intermediate buffers stay small enough to remain in cache.
+#define RESIZE_COL_BLOCK 64
+#define HIGHBD_RESIZE_COL_BLOCK 32
+
 typedef int16_t interp_kernel[INTERP_TAPS];
 
 // Filters for interpolation (0.5-band) - note this also filters integer pels.
-static const interp_kernel filteredinterp_filters500[(1 << SUBPEL_BITS)] = {
+static const interp_kernel filteredinterp_filters500[RESIZE_SUBPEL_SHIFTS] = {
   { -3, 0, 35, 64, 35, 0, -3, 0 },    { -3, -1, 34, 64, 36, 1, -3, 0 },
   { -3, -1, 32, 64, 38, 1, -3, 0 },   { -2, -2, 31, 63, 39, 2, -3, 0 },
   { -2, -2, 29, 63, 41, 2, -3, 0 },   { -2, -2, 28, 63, 42, 3, -4, 0 },
@@ -53,7 +63,7 @@ static const interp_kernel filteredinterp_filters500[(1 << SUBPEL_BITS)] = {
 };
 
 // Filters for interpolation (0.625-band) - note this also filters integer pels.
-static const interp_kernel filteredinterp_filters625[(1 << SUBPEL_BITS)] = {
+static const interp_kernel filteredinterp_filters625[RESIZE_SUBPEL_SHIFTS] = {
   { -1, -8, 33, 80, 33, -8, -1, 0 }, { -1, -8, 30, 80, 35, -8, -1, 1 },
   { -1, -8, 28, 80, 37, -7, -2, 1 }, { 0, -8, 26, 79, 39, -7, -2, 1 },
   { 0, -8, 24, 79, 41, -7, -2, 1 },  { 0, -8, 22, 78, 43, -6, -2, 1 },
@@ -73,7 +83,7 @@ static const interp_kernel filteredinterp_filters625[(1 << SUBPEL_BITS)] = {
 };
 
 // Filters for interpolation (0.75-band) - note this also filters integer pels.
-static const interp_kernel filteredinterp_filters750[(1 << SUBPEL_BITS)] = {
+static const interp_kernel filteredinterp_filters750[RESIZE_SUBPEL_SHIFTS] = {
   { 2, -11, 25, 96, 25, -11, 2, 0 }, { 2, -11, 22, 96, 28, -11, 2, 0 },
   { 2, -10, 19, 95, 31, -11, 2, 0 }, { 2, -10, 17, 95, 34, -12, 2, 0 },
   { 2, -9, 14, 94, 37, -12, 2, 0 },  { 2, -8, 12, 93, 40, -12, 1, 0 },
@@ -93,7 +103,7 @@ static const interp_kernel filteredinterp_filters750[(1 << SUBPEL_BITS)] = {
 };
 
 // Filters for interpolation (0.875-band) - note this also filters integer pels.
-static const interp_kernel filteredinterp_filters875[(1 << SUBPEL_BITS)] = {
+static const interp_kernel filteredinterp_filters875[RESIZE_SUBPEL_SHIFTS] = {
   { 3, -8, 13, 112, 13, -8, 3, 0 },   { 3, -7, 10, 112, 17, -9, 3, -1 },
   { 2, -6, 7, 111, 21, -9, 3, -1 },   { 2, -5, 4, 111, 24, -10, 3, -1 },
   { 2, -4, 1, 110, 28, -11, 3, -1 },  { 1, -3, -1, 108, 32, -12, 4, -1 },
@@ -113,7 +123,7 @@ static const interp_kernel filteredinterp_filters875[(1 << SUBPEL_BITS)] = {
 };
 
 // Filters for interpolation (full-band) - no filtering for integer pixels
-static const interp_kernel filteredinterp_filters1000[(1 << SUBPEL_BITS)] = {
+static const interp_kernel filteredinterp_filters1000[RESIZE_SUBPEL_SHIFTS] = {
   { 0, 0, 0, 128, 0, 0, 0, 0 },        { 0, 1, -3, 128, 3, -1, 0, 0 },
   { -1, 2, -6, 127, 7, -2, 1, 0 },     { -1, 3, -9, 126, 12, -4, 1, 0 },
   { -1, 4, -12, 125, 16, -5, 1, 0 },   { -1, 4, -14, 123, 20, -6, 2, 0 },
@@ -136,6 +146,16 @@ static const interp_kernel filteredinterp_filters1000[(1 << SUBPEL_BITS)] = {
 static const int16_t vp9_down2_symeven_half_filter[] = { 56, 12, -3, -1 };
 static const int16_t vp9_down2_symodd_half_filter[] = { 64, 35, 0, -3 };
 
+// The down2 filters expanded to 8 taps centered like the interpolation
+// filters, for use with the vertical row filters. Output i of the even filter
+// reads input rows 2 * i - 3 to 2 * i + 4; the odd filter ignores the last.
+static const int16_t vp9_down2_symeven_filter[INTERP_TAPS] = {
+  -1, -3, 12, 56, 56, 12, -3, -1
+};
+static const int16_t vp9_down2_symodd_filter[INTERP_TAPS] = {
+  -3, 0, 35, 64, 35, 0, -3, 0
+};
+
 static const interp_kernel *choose_interp_filter(int inlength, int outlength) {
   int outlength16 = outlength * 16;
   if (outlength16 >= inlength * 16)
@@ -186,7 +206,8 @@ static void interpolate(const uint8_t *const input, int inlength,
     for (x = 0, y = offset; x < outlength; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k) {
@@ -201,7 +222,8 @@ static void interpolate(const uint8_t *const input, int inlength,
     for (x = 0, y = offset; x < x1; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k)
@@ -214,7 +236,8 @@ static void interpolate(const uint8_t *const input, int inlength,
     for (; x <= x2; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k)
@@ -225,7 +248,8 @@ static void interpolate(const uint8_t *const input, int inlength,
     for (; x < outlength; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k)
@@ -408,21 +432,119 @@ static void resize_multistep(const uint8_t *const input, int length,
   }
 }
 
-static void fill_col_to_arr(uint8_t *img, int stride, int len, uint8_t *arr) {
-  int i;
-  uint8_t *iptr = img;
-  uint8_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *aptr++ = *iptr;
+void vp9_resize_vert_8tap_c(const uint8_t *const *src, const int16_t *filter,
+                            uint8_t *dst, int w) {
+  int x, k;
+  for (x = 0; x < w; ++x) {
+    int sum = 0;
+    for (k = 0; k < INTERP_TAPS; ++k) sum += filter[k] * src[k][x];
+    dst[x] = clip_pixel(ROUND_POWER_OF_TWO(sum, FILTER_BITS));
   }
 }
 
-static void fill_arr_to_col(uint8_t *img, int stride, int len, uint8_t *arr) {
+// Set rows[k] to input row start + k, clamped to the [0, length - 1] range.
+static void get_filter_rows(const uint8_t *const input, int in_stride,
+                            int length, int start, const uint8_t **rows) {
+  int k;
+  for (k = 0; k < INTERP_TAPS; ++k) {
+    const int r = start + k;
+    rows[k] = input + (r < 0 ? 0 : (r >= length ? length - 1 : r)) * in_stride;
+  }
+}
+
+// Vertical equivalents of interpolate(), down2_symeven() and down2_symodd().
+// Each sample is a row of cols pixels and all columns are filtered at once.
+static void interpolate_vert(const uint8_t *const input, int in_stride,
+                             int inlength, uint8_t *output, int out_stride,
+                             int outlength, int cols) {
+  const int64_t delta =
+      (((uint64_t)inlength << 32) + outlength / 2) / outlength;
+  const int64_t offset =
+      inlength > outlength
+          ? (((int64_t)(inlength - outlength) << 31) + outlength / 2) /
+                outlength
+          : -(((int64_t)(outlength - inlength) << 31) + outlength / 2) /
+                outlength;
+  const interp_kernel *interp_filters =
+      choose_interp_filter(inlength, outlength);
+  const uint8_t *rows[INTERP_TAPS];
+  int x;
+  int64_t y;
+
+  for (x = 0, y = offset; x < outlength; ++x, y += delta) {
+    const int int_pel = (int)(y >> INTERP_PRECISION_BITS);
+    const int sub_pel =
+        (int)(y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+        RESIZE_SUBPEL_MASK;
+    get_filter_rows(input, in_stride, inlength, int_pel - INTERP_TAPS / 2 + 1,
+                    rows);
+    vp9_resize_vert_8tap(rows, interp_filters[sub_pel], output, cols);
+    output += out_stride;
+  }
+}
+
+static void down2_vert(const uint8_t *const input, int in_stride, int length,
+                       uint8_t *output, int out_stride, int cols) {
+  const int16_t *const filter =
+      (length & 1) ? vp9_down2_symodd_filter : vp9_down2_symeven_filter;
+  const uint8_t *rows[INTERP_TAPS];
   int i;
-  uint8_t *iptr = img;
-  uint8_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *iptr = *aptr++;
+
+  for (i = 0; i < length; i += 2) {
+    get_filter_rows(input, in_stride, length, i - INTERP_TAPS / 2 + 1, rows);
+    vp9_resize_vert_8tap(rows, filter, output, cols);
+    output += out_stride;
+  }
+}
+
+// Same as resize_multistep() on cols columns at once. otmp must hold
+// length * cols pixels.
+static void resize_vert_multistep(const uint8_t *const input, int in_stride,
+                                  int length, uint8_t *output, int out_stride,
+                                  int olength, int cols, uint8_t *otmp) {
+  int steps;
+  if (length == olength) {
+    int i;
+    for (i = 0; i < length; ++i) {
+      memcpy(output + i * out_stride, input + i * in_stride,
+             sizeof(output[0]) * cols);
+    }
+    return;
+  }
+  steps = get_down2_steps(length, olength);
+
+  if (steps > 0) {
+    int s;
+    const uint8_t *in = input;
+    int in_pitch = in_stride;
+    uint8_t *out = NULL;
+    int out_pitch = 0;
+    uint8_t *otmp2;
+    int filteredlength = length;
+
+    assert(otmp != NULL);
+    otmp2 = otmp + get_down2_length(length, 1) * cols;
+    for (s = 0; s < steps; ++s) {
+      const int proj_filteredlength = get_down2_length(filteredlength, 1);
+      if (s == steps - 1 && proj_filteredlength == olength) {
+        out = output;
+        out_pitch = out_stride;
+      } else {
+        out = (s & 1 ? otmp2 : otmp);
+        out_pitch = cols;
+      }
+      down2_vert(in, in_pitch, filteredlength, out, out_pitch, cols);
+      in = out;
+      in_pitch = out_pitch;
+      filteredlength = proj_filteredlength;
+    }
+    if (filteredlength != olength) {
+      interpolate_vert(out, out_pitch, filteredlength, output, out_stride,
+                       olength, cols);
+    }
+  } else {
+    interpolate_vert(input, in_stride, length, output, out_stride, olength,
+                     cols);
   }
 }
 
@@ -433,10 +555,9 @@ void vp9_resize_plane(const uint8_t *const input, int height, int width,
   uint8_t *intbuf = (uint8_t *)calloc(width2 * height, sizeof(*intbuf));
   uint8_t *tmpbuf =
       (uint8_t *)calloc(width < height ? height : width, sizeof(*tmpbuf));
-  uint8_t *arrbuf = (uint8_t *)calloc(height, sizeof(*arrbuf));
-  uint8_t *arrbuf2 = (uint8_t *)calloc(height2, sizeof(*arrbuf2));
-  if (intbuf == NULL || tmpbuf == NULL || arrbuf == NULL || arrbuf2 == NULL)
-    goto Error;
+  uint8_t *colbuf =
+      (uint8_t *)malloc(sizeof(*colbuf) * height * RESIZE_COL_BLOCK);
+  if (intbuf == NULL || tmpbuf == NULL || colbuf == NULL) goto Error;
   assert(width > 0);
   assert(height > 0);
   assert(width2 > 0);
@@ -444,17 +565,16 @@ void vp9_resize_plane(const uint8_t *const input, int height, int width,
   for (i = 0; i < height; ++i)
     resize_multistep(input + in_stride * i, width, intbuf + width2 * i, width2,
                      tmpbuf);
-  for (i = 0; i < width2; ++i) {
-    fill_col_to_arr(intbuf + i, width2, height, arrbuf);
-    resize_multistep(arrbuf, height, arrbuf2, height2, tmpbuf);
-    fill_arr_to_col(output + i, out_stride, height2, arrbuf2);
+  for (i = 0; i < width2; i += RESIZE_COL_BLOCK) {
+    const int cols = VPXMIN(RESIZE_COL_BLOCK, width2 - i);
+    resize_vert_multistep(intbuf + i, width2, height, output + i, out_stride,
+                          height2, cols, colbuf);
   }
 
 Error:
   free(intbuf);
   free(tmpbuf);
-  free(arrbuf);
-  free(arrbuf2);
+  free(colbuf);
 }
 
 #if CONFIG_VP9_HIGHBITDEPTH
@@ -494,7 +614,8 @@ static void highbd_interpolate(const uint16_t *const input, int inlength,
     for (x = 0, y = offset; x < outlength; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k) {
@@ -509,7 +630,8 @@ static void highbd_interpolate(const uint16_t *const input, int inlength,
     for (x = 0, y = offset; x < x1; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k) {
@@ -524,7 +646,8 @@ static void highbd_interpolate(const uint16_t *const input, int inlength,
     for (; x <= x2; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k)
@@ -535,7 +658,8 @@ static void highbd_interpolate(const uint16_t *const input, int inlength,
     for (; x < outlength; ++x, y += delta) {
       const int16_t *filter;
       int_pel = y >> INTERP_PRECISION_BITS;
-      sub_pel = (y >> (INTERP_PRECISION_BITS - SUBPEL_BITS)) & SUBPEL_MASK;
+      sub_pel = (y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+                RESIZE_SUBPEL_MASK;
       filter = interp_filters[sub_pel];
       sum = 0;
       for (k = 0; k < INTERP_TAPS; ++k)
@@ -697,23 +821,123 @@ static void highbd_resize_multistep(const uint16_t *const input, int length,
   }
 }
 
-static void highbd_fill_col_to_arr(uint16_t *img, int stride, int len,
-                                   uint16_t *arr) {
-  int i;
-  uint16_t *iptr = img;
-  uint16_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *aptr++ = *iptr;
+void vp9_highbd_resize_vert_8tap_c(const uint16_t *const *src,
+                                   const int16_t *filter, uint16_t *dst, int w,
+                                   int bd) {
+  int x, k;
+  for (x = 0; x < w; ++x) {
+    int sum = 0;
+    for (k = 0; k < INTERP_TAPS; ++k) sum += filter[k] * src[k][x];
+    dst[x] = clip_pixel_highbd(ROUND_POWER_OF_TWO(sum, FILTER_BITS), bd);
   }
 }
 
-static void highbd_fill_arr_to_col(uint16_t *img, int stride, int len,
-                                   uint16_t *arr) {
+static void highbd_get_filter_rows(const uint16_t *const input, int in_stride,
+                                   int length, int start,
+                                   const uint16_t **rows) {
+  int k;
+  for (k = 0; k < INTERP_TAPS; ++k) {
+    const int r = start + k;
+    rows[k] = input + (r < 0 ? 0 : (r >= length ? length - 1 : r)) * in_stride;
+  }
+}
+
+static void highbd_interpolate_vert(const uint16_t *const input, int in_stride,
+                                    int inlength, uint16_t *output,
+                                    int out_stride, int outlength, int cols,
+                                    int bd) {
+  const int64_t delta =
+      (((uint64_t)inlength << 32) + outlength / 2) / outlength;
+  const int64_t offset =
+      inlength > outlength
+          ? (((int64_t)(inlength - outlength) << 31) + outlength / 2) /
+                outlength
+          : -(((int64_t)(outlength - inlength) << 31) + outlength / 2) /
+                outlength;
+  const interp_kernel *interp_filters =
+      choose_interp_filter(inlength, outlength);
+  const uint16_t *rows[INTERP_TAPS];
+  int x;
+  int64_t y;
+
+  for (x = 0, y = offset; x < outlength; ++x, y += delta) {
+    const int int_pel = (int)(y >> INTERP_PRECISION_BITS);
+    const int sub_pel =
+        (int)(y >> (INTERP_PRECISION_BITS - RESIZE_SUBPEL_BITS)) &
+        RESIZE_SUBPEL_MASK;
+    highbd_get_filter_rows(input, in_stride, inlength,
+                           int_pel - INTERP_TAPS / 2 + 1, rows);
+    vp9_highbd_resize_vert_8tap(rows, interp_filters[sub_pel], output, cols,
+                                bd);
+    output += out_stride;
+  }
+}
+
+static void highbd_down2_vert(const uint16_t *const input, int in_stride,
+                              int length, uint16_t *output, int out_stride,
+                              int cols, int bd) {
+  const int16_t *const filter =
+      (length & 1) ? vp9_down2_symodd_filter : vp9_down2_symeven_filter;
+  const uint16_t *rows[INTERP_TAPS];
   int i;
-  uint16_t *iptr = img;
-  uint16_t *aptr = arr;
-  for (i = 0; i < len; ++i, iptr += stride) {
-    *iptr = *aptr++;
+
+  for (i = 0; i < length; i += 2) {
+    highbd_get_filter_rows(input, in_stride, length, i - INTERP_TAPS / 2 + 1,
+                           rows);
+    vp9_highbd_resize_vert_8tap(rows, filter, output, cols, bd);
+    output += out_stride;
+  }
+}
+
+static void highbd_resize_vert_multistep(const uint16_t *const input,
+                                         int in_stride, int length,
+                                         uint16_t *output, int out_stride,
+                                         int olength, int cols, uint16_t *otmp,
+                                         int bd) {
+  int steps;
+  if (length == olength) {
+    int i;
+    for (i = 0; i < length; ++i) {
+      memcpy(output + i * out_stride, input + i * in_stride,
+             sizeof(output[0]) * cols);
+    }
+    return;
+  }
+  steps = get_down2_steps(length, olength);
+
+  if (steps > 0) {
+    int s;
+    const uint16_t *in = input;
+    int in_pitch = in_stride;
+    uint16_t *out = NULL;
+    int out_pitch = 0;
+    uint16_t *otmp2;
+    int filteredlength = length;
+
+    assert(otmp != NULL);
+    otmp2 = otmp + get_down2_length(length, 1) * cols;
+    for (s = 0; s < steps; ++s) {
+      const int proj_filteredlength = get_down2_length(filteredlength, 1);
+      if (s == steps - 1 && proj_filteredlength == olength) {
+        out = output;
+        out_pitch = out_stride;
+      } else {
+        out = (s & 1 ? otmp2 : otmp);
+        out_pitch = cols;
+      }
+      highbd_down2_vert(in, in_pitch, filteredlength, out, out_pitch, cols,
+                        bd);
+      in = out;
+      in_pitch = out_pitch;
+      filteredlength = proj_filteredlength;
+    }
+    if (filteredlength != olength) {
+      highbd_interpolate_vert(out, out_pitch, filteredlength, output,
+                              out_stride, olength, cols, bd);
+    }
+  } else {
+    highbd_interpolate_vert(input, in_stride, length, output, out_stride,
+                            olength, cols, bd);
   }
 }
 
@@ -724,10 +948,9 @@ void vp9_highbd_resize_plane(const uint8_t *const input, int height, int width,
   uint16_t *intbuf = (uint16_t *)malloc(sizeof(uint16_t) * width2 * height);
   uint16_t *tmpbuf =
       (uint16_t *)malloc(sizeof(uint16_t) * (width < height ? height : width));
-  uint16_t *arrbuf = (uint16_t *)malloc(sizeof(uint16_t) * height);
-  uint16_t *arrbuf2 = (uint16_t *)malloc(sizeof(uint16_t) * height2);
-  if (intbuf == NULL || tmpbuf == NULL || arrbuf == NULL || arrbuf2 == NULL)
-    goto Error;
+  uint16_t *colbuf = (uint16_t *)malloc(sizeof(uint16_t) * height *
+                                        HIGHBD_RESIZE_COL_BLOCK);
+  if (intbuf == NULL || tmpbuf == NULL || colbuf == NULL) goto Error;
   assert(width > 0);
   assert(height > 0);
   assert(width2 > 0);
@@ -736,18 +959,17 @@ void vp9_highbd_resize_plane(const uint8_t *const input, int height, int width,
     highbd_resize_multistep(CONVERT_TO_SHORTPTR(input + in_stride * i), width,
                             intbuf + width2 * i, width2, tmpbuf, bd);
   }
-  for (i = 0; i < width2; ++i) {
-    highbd_fill_col_to_arr(intbuf + i, width2, height, arrbuf);
-    highbd_resize_multistep(arrbuf, height, arrbuf2, height2, tmpbuf, bd);
-    highbd_fill_arr_to_col(CONVERT_TO_SHORTPTR(output + i), out_stride, height2,
-                           arrbuf2);
+  for (i = 0; i < width2; i += HIGHBD_RESIZE_COL_BLOCK) {
+    const int cols = VPXMIN(HIGHBD_RESIZE_COL_BLOCK, width2 - i);
+    highbd_resize_vert_multistep(intbuf + i, width2, height,
+                                 CONVERT_TO_SHORTPTR(output) + i, out_stride,
+                                 height2, cols, colbuf, bd);
   }
 
 Error:
   free(intbuf);
   free(tmpbuf);
-  free(arrbuf);
-  free(arrbuf2);
+  free(colbuf);
 }
 #endif  // CONFIG_VP9_HIGHBITDEPTH
 
@@ -9,6 +9,7 @@
  */
 
 #include <limits.h>
+#include <string.h>
 
 #include "vp9/encoder/vp9_encoder.h"
 #include "vp9/encoder/vp9_speed_features.h"
@@ -235,6 +236,7 @@ static void set_good_speed_feature_framesize_independent(VP9_COMP *cpi,
   sf->prune_ref_frame_for_rect_partitions = 1;
   sf->temporal_filter_search_method = NSTEP;
   sf->tx_size_search_breakout = 1;
+  sf->lpf_pick_parallel = 1;
   sf->use_square_partition_only = !boosted;
   sf->early_term_interp_search_plane_rd = 1;
   sf->cb_pred_filter_search = 1;
@@ -314,6 +316,7 @@ static void set_good_speed_feature_framesize_independent(VP9_COMP *cpi,
         (cpi->twopass.fr_content_type == FC_GRAPHICS_ANIMATION) ? (1 << 23)
                                                                 : INT_MAX;
     sf->use_accurate_subpel_search = USE_4_TAPS;
+    sf->lpf_pick_early_stop = 1;
   }
 
   if (speed >= 2) {
@@ -986,6 +989,8 @@ void vp9_set_speed_features_framesize_independent(VP9_COMP *cpi, int speed) {
   sf->use_uv_intra_rd_estimate = 0;
   sf->allow_skip_recode = 0;
   sf->lpf_pick = LPF_PICK_FROM_FULL_IMAGE;
+  sf->lpf_pick_parallel = 0;
+  sf->lpf_pick_early_stop = 0;
   sf->use_fast_coef_updates = TWO_LOOP;
   sf->use_fast_coef_costing = 0;
   sf->mode_skip_start = MAX_MODES;  // Mode index at which mode skip mask set
@@ -1091,3 +1096,63 @@ void vp9_set_speed_features_framesize_independent(VP9_COMP *cpi, int speed) {
       oxcf->max_threads > 1)
     sf->adaptive_rd_thresh = 0;
 }
+
+// Fastest speed the controller goes to.
+#define SPEED_CONTROL_MAX_SPEED 9
+// Inter frames averaged over the budget before speeding up.
+#define SPEED_CONTROL_SPEEDUP_FRAMES 2
+// Bounds of the inter frames averaged well below the budget before slowing
+// down.
+#define SPEED_CONTROL_MIN_SLOWDOWN_FRAMES 16
+#define SPEED_CONTROL_MAX_SLOWDOWN_FRAMES 256
+
+void vp9_speed_control_configure(SPEED_CONTROL *sc, int64_t budget_us,
+                                 int min_speed) {
+  if (budget_us != sc->budget_us) {
+    memset(sc, 0, sizeof(*sc));
+    sc->budget_us = budget_us;
+    sc->speed = min_speed;
+    sc->slowdown_frames = SPEED_CONTROL_MIN_SLOWDOWN_FRAMES;
+  }
+  sc->min_speed = min_speed;
+  sc->speed =
+      clamp(sc->speed, min_speed, VPXMAX(min_speed, SPEED_CONTROL_MAX_SPEED));
+}
+
+void vp9_speed_control_update(SPEED_CONTROL *sc, int64_t frame_us,
+                              int intra_only) {
+  ++sc->frames;
+  if (frame_us > sc->budget_us) ++sc->frames_over_budget;
+
+  // Intra only frames take much longer than the frames around them, reacting
+  // to them would only make the next frames slower to encode than needed.
+  if (intra_only) return;
+
+  sc->avg_us = sc->avg_frames ? (3 * sc->avg_us + frame_us + 2) / 4 : frame_us;
+  if (sc->avg_frames < SPEED_CONTROL_MAX_SLOWDOWN_FRAMES) ++sc->avg_frames;
+
+  if (sc->avg_us > sc->budget_us) {
+    if (sc->avg_frames >= SPEED_CONTROL_SPEEDUP_FRAMES &&
+        sc->speed < SPEED_CONTROL_MAX_SPEED) {
+      // Wait longer before the next slow down if the last one did not last.
+      if (sc->last_change < 0 && sc->avg_frames < sc->slowdown_frames) {
+        sc->slowdown_frames =
+            VPXMIN(2 * sc->slowdown_frames, SPEED_CONTROL_MAX_SLOWDOWN_FRAMES);
+      } else if (sc->avg_frames >= sc->slowdown_frames) {
+        sc->slowdown_frames = SPEED_CONTROL_MIN_SLOWDOWN_FRAMES;
+      }
+      ++sc->speed;
+      sc->last_change = 1;
+      sc->avg_frames = 0;
+      ++sc->speed_changes;
+    }
+  } else if (sc->avg_us * 10 < sc->budget_us * 7) {
+    // Leave room for the slower speed, which can take a third longer.
+    if (sc->avg_frames >= sc->slowdown_frames && sc->speed > sc->min_speed) {
+      --sc->speed;
+      sc->last_change = -1;
+      sc->avg_frames = 0;
+      ++sc->speed_changes;
+    }
+  }
+}
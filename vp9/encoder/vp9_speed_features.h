@@ -152,7 +152,11 @@ typedef enum {
   SOURCE_VAR_BASED_PARTITION,
 
   // Make partition decisions with machine learning models.
-  ML_BASED_PARTITION
+  ML_BASED_PARTITION,
+
+  // Use the partitioning of the source of a transcode, see
+  // VP9E_SET_MODE_INFO.
+  MODE_INFO_PARTITION
 } PARTITION_SEARCH_TYPE;
 
 typedef enum {
@@ -492,6 +496,15 @@ typedef struct SPEED_FEATURES {
   // This feature controls how the loop filter level is determined.
   LPF_PICK_METHOD lpf_pick;
 
+  // With LPF_PICK_FROM_FULL_IMAGE and LPF_PICK_FROM_SUBIMAGE, evaluate the
+  // candidate filter levels of each search step concurrently on the encoder
+  // workers. The picked level is the same as with the serial search.
+  int lpf_pick_parallel;
+
+  // Stop the filter level search once a model of the error around the best
+  // level predicts no significant gain from a finer step.
+  int lpf_pick_early_stop;
+
   // This feature limits the number of coefficients updates we actually do
   // by only looking at counts from 1/2 the bands.
   FAST_COEFF_UPDATE use_fast_coef_updates;
@@ -660,6 +673,27 @@ typedef struct SPEED_FEATURES {
   int allow_skip_txfm_ac_dc;
 } SPEED_FEATURES;
 
+// Adapts the speed of real-time encoding to a target encode time per frame,
+// see VP9E_SET_FRAME_TIME_BUDGET.
+typedef struct {
+  int64_t budget_us;  // Target time per frame, 0 when off.
+  int min_speed;      // The configured speed, the controller stays above it.
+  int speed;          // Speed of the next frame.
+
+  // Running average of the time of the inter frames encoded at this speed.
+  int64_t avg_us;
+  int avg_frames;
+
+  // Frames the average has to stay well below the budget before slowing
+  // down. It grows when a slow down has to be undone right away.
+  int slowdown_frames;
+  int last_change;  // 1 after speeding up, -1 after slowing down.
+
+  unsigned int frames;
+  unsigned int frames_over_budget;
+  unsigned int speed_changes;
+} SPEED_CONTROL;
+
 struct VP9_COMP;
 
 void vp9_set_speed_features_framesize_independent(struct VP9_COMP *cpi,
@@ -667,6 +701,14 @@ void vp9_set_speed_features_framesize_independent(struct VP9_COMP *cpi,
 void vp9_set_speed_features_framesize_dependent(struct VP9_COMP *cpi,
                                                 int speed);
 
+// Sets the budget and the lowest speed. The state is reset when the budget
+// changes.
+void vp9_speed_control_configure(SPEED_CONTROL *sc, int64_t budget_us,
+                                 int min_speed);
+// Accounts the time of a frame and picks the speed of the next one.
+void vp9_speed_control_update(SPEED_CONTROL *sc, int64_t frame_us,
+                              int intra_only);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
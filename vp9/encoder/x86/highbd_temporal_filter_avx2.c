@@ -0,0 +1,508 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+#include "vp9/encoder/vp9_encoder.h"
+#include "vp9/encoder/vp9_temporal_filter.h"
+#include "vp9/encoder/vp9_temporal_filter_constants.h"
+
+// This follows highbd_temporal_filter_sse4.c with 8 32-bit distortions per
+// register. Each luma column of 16 is filtered as two registers in one pass
+// over the rows, and U and V share the luma distortion loads.
+
+static INLINE __m256i highbd_load_2x128(const void *lo, const void *hi) {
+  const __m128i lo_reg = _mm_loadu_si128((const __m128i *)lo);
+  const __m128i hi_reg = _mm_loadu_si128((const __m128i *)hi);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lo_reg), hi_reg, 1);
+}
+
+static INLINE __m256i highbd_set_weight_pair(int lo, int hi) {
+  return _mm256_inserti128_si256(_mm256_set1_epi32(lo), _mm_set1_epi32(hi), 1);
+}
+
+// Compute (a-b)**2 for 8 pixels with size 16-bit
+static INLINE void highbd_store_dist_8(const uint16_t *a, const uint16_t *b,
+                                       uint32_t *dst) {
+  const __m256i a_reg =
+      _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)a));
+  const __m256i b_reg =
+      _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)b));
+  const __m256i diff = _mm256_sub_epi32(a_reg, b_reg);
+
+  _mm256_storeu_si256((__m256i *)dst, _mm256_mullo_epi32(diff, diff));
+}
+
+// Sum up three neighboring distortions for the pixels
+static INLINE __m256i highbd_get_sum_8(const uint32_t *dist) {
+  const __m256i dist_reg = _mm256_loadu_si256((const __m256i *)dist);
+  const __m256i dist_left = _mm256_loadu_si256((const __m256i *)(dist - 1));
+  const __m256i dist_right = _mm256_loadu_si256((const __m256i *)(dist + 1));
+
+  return _mm256_add_epi32(_mm256_add_epi32(dist_reg, dist_left), dist_right);
+}
+
+// Average the value based on the number of values summed (9 for pixels away
+// from the border, 4 for pixels in corners, and 6 for other edge values, plus
+// however many values from y/uv plane are).
+//
+// Add in the rounding factor and shift, clamp to 16, invert and shift. Multiply
+// by weight.
+static INLINE __m256i highbd_average_8(const __m256i sum,
+                                       const __m256i mul_constants,
+                                       const int strength, const int rounding,
+                                       const __m256i weight) {
+  const __m128i strength_u128 = _mm_cvtsi32_si128(strength);
+  const __m256i rounding_u32 = _mm256_set1_epi32(rounding);
+  const __m256i sixteen = _mm256_set1_epi32(16);
+
+  // modifier * 3 / index;
+  // The even elements keep the high half of the 64-bit product in the low
+  // 32 bits after the shift, the odd elements already have it in place.
+  const __m256i mul_even =
+      _mm256_srli_epi64(_mm256_mul_epu32(sum, mul_constants), 32);
+  const __m256i mul_odd = _mm256_mul_epu32(
+      _mm256_srli_epi64(sum, 32), _mm256_srli_epi64(mul_constants, 32));
+  __m256i output = _mm256_blend_epi32(mul_even, mul_odd, 0xaa);
+
+  // Round
+  output = _mm256_add_epi32(output, rounding_u32);
+  output = _mm256_srl_epi32(output, strength_u128);
+
+  // Multiply with the weight
+  output = _mm256_min_epu32(output, sixteen);
+  output = _mm256_sub_epi32(sixteen, output);
+  return _mm256_mullo_epi32(output, weight);
+}
+
+// Add 'sum_u32' to 'count'. Multiply by 'pred' and add to 'accumulator.'
+static INLINE void highbd_accumulate_and_store_8(const __m256i sum_u32,
+                                                 const uint16_t *pred,
+                                                 uint16_t *count,
+                                                 uint32_t *accumulator) {
+  // Cast down to 16-bit ints
+  const __m256i sum_packed = _mm256_packus_epi32(sum_u32, sum_u32);
+  const __m128i sum_u16 =
+      _mm256_castsi256_si128(_mm256_permute4x64_epi64(sum_packed, 0x08));
+  const __m256i pred_u32 =
+      _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)pred));
+  __m128i count_u16 = _mm_loadu_si128((const __m128i *)count);
+  __m256i accum_u32 = _mm256_loadu_si256((const __m256i *)accumulator);
+
+  count_u16 = _mm_adds_epu16(count_u16, sum_u16);
+  _mm_storeu_si128((__m128i *)count, count_u16);
+
+  accum_u32 =
+      _mm256_add_epi32(accum_u32, _mm256_mullo_epi32(sum_u32, pred_u32));
+  _mm256_storeu_si256((__m256i *)accumulator, accum_u32);
+}
+
+// Read the U + V distortion that corresponds to a row of 8 luma values.
+static INLINE __m256i highbd_read_chroma_dist_row_8(int ss_x,
+                                                    const uint32_t *u_dist,
+                                                    const uint32_t *v_dist) {
+  if (!ss_x) {
+    // If there is no chroma subsampling in the horizontal direction, then we
+    // need to load 8 entries from chroma.
+    const __m256i u_reg = _mm256_loadu_si256((const __m256i *)u_dist);
+    const __m256i v_reg = _mm256_loadu_si256((const __m256i *)v_dist);
+    return _mm256_add_epi32(u_reg, v_reg);
+  } else {  // ss_x == 1
+    // Otherwise, we only need to load 4 entries and duplicate each of them.
+    const __m128i uv_reg =
+        _mm_add_epi32(_mm_loadu_si128((const __m128i *)u_dist),
+                      _mm_loadu_si128((const __m128i *)v_dist));
+    const __m256i uv_64 = _mm256_cvtepu32_epi64(uv_reg);
+    return _mm256_or_si256(uv_64, _mm256_slli_epi64(uv_64, 32));
+  }
+}
+
+// Apply temporal filter to a luma column of 16 X block_height as two halves of
+// 8. neighbors holds the constant tables for each group of 4 columns.
+// top_weight and bottom_weight hold the weight of each half for the top and
+// bottom half of the rows.
+static void highbd_apply_temporal_filter_luma_16(
+    const uint16_t *y_pre, int y_pre_stride, unsigned int block_height,
+    int ss_x, int ss_y, int strength, uint32_t *y_accum, uint16_t *y_count,
+    const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist,
+    const uint32_t *const *const *neighbors, const int *top_weight,
+    const int *bottom_weight) {
+  const int rounding = (1 << strength) >> 1;
+  const unsigned int uv_offset = 8 >> ss_x;
+  const __m256i mul_edge_0 =
+      highbd_load_2x128(neighbors[0][0], neighbors[1][0]);
+  const __m256i mul_edge_1 =
+      highbd_load_2x128(neighbors[2][0], neighbors[3][0]);
+  const __m256i mul_center_0 =
+      highbd_load_2x128(neighbors[0][1], neighbors[1][1]);
+  const __m256i mul_center_1 =
+      highbd_load_2x128(neighbors[2][1], neighbors[3][1]);
+  const __m256i top_weight_0 = _mm256_set1_epi32(top_weight[0]);
+  const __m256i top_weight_1 = _mm256_set1_epi32(top_weight[1]);
+  const __m256i bottom_weight_0 = _mm256_set1_epi32(bottom_weight[0]);
+  const __m256i bottom_weight_1 = _mm256_set1_epi32(bottom_weight[1]);
+
+  __m256i sum_row_1_0 = _mm256_setzero_si256();
+  __m256i sum_row_1_1 = _mm256_setzero_si256();
+  __m256i sum_row_2_0 = highbd_get_sum_8(y_dist);
+  __m256i sum_row_2_1 = highbd_get_sum_8(y_dist + 8);
+  __m256i sum_row_3_0 = highbd_get_sum_8(y_dist + DIST_STRIDE);
+  __m256i sum_row_3_1 = highbd_get_sum_8(y_dist + DIST_STRIDE + 8);
+  __m256i uv_dist_0 = _mm256_setzero_si256();
+  __m256i uv_dist_1 = _mm256_setzero_si256();
+
+  // Loop variables
+  unsigned int h;
+
+  assert(strength >= 4 && strength <= 14 &&
+         "invalid adjusted temporal filter strength");
+
+  for (h = 0; h < block_height; ++h) {
+    const int is_edge = h == 0 || h == block_height - 1;
+    const int is_top = h < block_height / 2;
+    // We don't need to saturate here because the maximum value is
+    // UINT12_MAX ** 2 * (9 + 2) < INT32_MAX
+    __m256i sum_row_0 = sum_row_2_0;
+    __m256i sum_row_1 = sum_row_2_1;
+
+    if (h > 0) {
+      sum_row_0 = _mm256_add_epi32(sum_row_0, sum_row_1_0);
+      sum_row_1 = _mm256_add_epi32(sum_row_1, sum_row_1_1);
+    }
+    if (h < block_height - 1) {
+      sum_row_0 = _mm256_add_epi32(sum_row_0, sum_row_3_0);
+      sum_row_1 = _mm256_add_epi32(sum_row_1, sum_row_3_1);
+    }
+
+    // Only read the chroma distortion when we reach a new chroma row.
+    if (ss_y == 0 || h % 2 == 0) {
+      uv_dist_0 = highbd_read_chroma_dist_row_8(ss_x, u_dist, v_dist);
+      uv_dist_1 = highbd_read_chroma_dist_row_8(ss_x, u_dist + uv_offset,
+                                                v_dist + uv_offset);
+      u_dist += DIST_STRIDE;
+      v_dist += DIST_STRIDE;
+    }
+    sum_row_0 = _mm256_add_epi32(sum_row_0, uv_dist_0);
+    sum_row_1 = _mm256_add_epi32(sum_row_1, uv_dist_1);
+
+    // Get modifier and store result
+    sum_row_0 =
+        highbd_average_8(sum_row_0, is_edge ? mul_edge_0 : mul_center_0,
+                         strength, rounding,
+                         is_top ? top_weight_0 : bottom_weight_0);
+    sum_row_1 =
+        highbd_average_8(sum_row_1, is_edge ? mul_edge_1 : mul_center_1,
+                         strength, rounding,
+                         is_top ? top_weight_1 : bottom_weight_1);
+    highbd_accumulate_and_store_8(sum_row_0, y_pre, y_count, y_accum);
+    highbd_accumulate_and_store_8(sum_row_1, y_pre + 8, y_count + 8,
+                                  y_accum + 8);
+
+    y_pre += y_pre_stride;
+    y_count += y_pre_stride;
+    y_accum += y_pre_stride;
+    y_dist += DIST_STRIDE;
+
+    // Shift the rows up
+    sum_row_1_0 = sum_row_2_0;
+    sum_row_1_1 = sum_row_2_1;
+    sum_row_2_0 = sum_row_3_0;
+    sum_row_2_1 = sum_row_3_1;
+    if (h + 2 < block_height) {
+      sum_row_3_0 = highbd_get_sum_8(y_dist + DIST_STRIDE);
+      sum_row_3_1 = highbd_get_sum_8(y_dist + DIST_STRIDE + 8);
+    }
+  }
+}
+
+// Perform temporal filter for the luma component.
+static void highbd_apply_temporal_filter_luma(
+    const uint16_t *y_pre, int y_pre_stride, unsigned int block_width,
+    unsigned int block_height, int ss_x, int ss_y, int strength,
+    const int *blk_fw, int use_whole_blk, uint32_t *y_accum, uint16_t *y_count,
+    const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist) {
+  const unsigned int blk_col_step = 16, uv_blk_col_step = 16 >> ss_x;
+  const unsigned int mid_width = block_width >> 1;
+  unsigned int blk_col, uv_blk_col;
+
+  for (blk_col = 0, uv_blk_col = 0; blk_col < block_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    // The subblock weights switch from left to right at mid_width, which may
+    // fall in the middle of this column when block_width is 16.
+    const int idx_0 = use_whole_blk ? 0 : blk_col >= mid_width;
+    const int idx_1 = use_whole_blk ? 0 : blk_col + 8 >= mid_width;
+    const int top_weight[2] = { blk_fw[idx_0], blk_fw[idx_1] };
+    const int bottom_weight[2] = { blk_fw[use_whole_blk ? 0 : 2 + idx_0],
+                                   blk_fw[use_whole_blk ? 0 : 2 + idx_1] };
+    const uint32_t *const *neighbors[4] = {
+      HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS, HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS,
+      HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS, HIGHBD_LUMA_MIDDLE_COLUMN_NEIGHBORS
+    };
+
+    if (blk_col == 0) neighbors[0] = HIGHBD_LUMA_LEFT_COLUMN_NEIGHBORS;
+    if (blk_col + blk_col_step == block_width) {
+      neighbors[3] = HIGHBD_LUMA_RIGHT_COLUMN_NEIGHBORS;
+    }
+
+    highbd_apply_temporal_filter_luma_16(
+        y_pre + blk_col, y_pre_stride, block_height, ss_x, ss_y, strength,
+        y_accum + blk_col, y_count + blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors, top_weight,
+        bottom_weight);
+  }
+}
+
+// Read a row of luma distortion that corresponds to 8 chroma mods. If we are
+// subsampling in x direction, then we have 16 lumas, else we have 8.
+static INLINE __m256i highbd_read_luma_dist_for_8_chroma(const uint32_t *y_dist,
+                                                         int ss_x, int ss_y) {
+  if (!ss_x) {
+    __m256i y_reg = _mm256_loadu_si256((const __m256i *)y_dist);
+    if (ss_y == 1) {
+      y_reg = _mm256_add_epi32(
+          y_reg, _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+    }
+    return y_reg;
+  } else {
+    __m256i y_fst = _mm256_loadu_si256((const __m256i *)y_dist);
+    __m256i y_snd = _mm256_loadu_si256((const __m256i *)(y_dist + 8));
+    if (ss_y == 1) {
+      y_fst = _mm256_add_epi32(
+          y_fst, _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+      y_snd = _mm256_add_epi32(
+          y_snd,
+          _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE + 8)));
+    }
+
+    // The horizontal add works within each lane, so reorder the 64-bit
+    // results to restore the column order.
+    return _mm256_permute4x64_epi64(_mm256_hadd_epi32(y_fst, y_snd), 0xd8);
+  }
+}
+
+// Apply temporal filter to the chroma components. This performs temporal
+// filtering on a chroma block of 8 X uv_block_height. The weight registers
+// hold a weight per column, top_weight for the top half of the rows and
+// bottom_weight for the rest.
+static void highbd_apply_temporal_filter_chroma_8(
+    const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride,
+    unsigned int uv_block_height, int ss_x, int ss_y, int strength,
+    uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist,
+    const uint32_t *const *neighbors_fst, const uint32_t *const *neighbors_snd,
+    const __m256i top_weight, const __m256i bottom_weight) {
+  const int rounding = (1 << strength) >> 1;
+  const __m256i mul_edge =
+      highbd_load_2x128(neighbors_fst[0], neighbors_snd[0]);
+  const __m256i mul_center =
+      highbd_load_2x128(neighbors_fst[1], neighbors_snd[1]);
+
+  __m256i u_sum_row_1 = _mm256_setzero_si256();
+  __m256i v_sum_row_1 = _mm256_setzero_si256();
+  __m256i u_sum_row_2 = highbd_get_sum_8(u_dist);
+  __m256i v_sum_row_2 = highbd_get_sum_8(v_dist);
+  __m256i u_sum_row_3 = highbd_get_sum_8(u_dist + DIST_STRIDE);
+  __m256i v_sum_row_3 = highbd_get_sum_8(v_dist + DIST_STRIDE);
+
+  // Loop variable
+  unsigned int h;
+
+  for (h = 0; h < uv_block_height; ++h) {
+    const __m256i mul = (h == 0 || h == uv_block_height - 1) ? mul_edge
+                                                             : mul_center;
+    const __m256i weight =
+        h < uv_block_height / 2 ? top_weight : bottom_weight;
+    const __m256i y_reg =
+        highbd_read_luma_dist_for_8_chroma(y_dist, ss_x, ss_y);
+    __m256i u_sum_row = _mm256_add_epi32(u_sum_row_2, y_reg);
+    __m256i v_sum_row = _mm256_add_epi32(v_sum_row_2, y_reg);
+
+    // Add chroma values
+    if (h > 0) {
+      u_sum_row = _mm256_add_epi32(u_sum_row, u_sum_row_1);
+      v_sum_row = _mm256_add_epi32(v_sum_row, v_sum_row_1);
+    }
+    if (h < uv_block_height - 1) {
+      u_sum_row = _mm256_add_epi32(u_sum_row, u_sum_row_3);
+      v_sum_row = _mm256_add_epi32(v_sum_row, v_sum_row_3);
+    }
+
+    // Get modifier and store result
+    u_sum_row = highbd_average_8(u_sum_row, mul, strength, rounding, weight);
+    v_sum_row = highbd_average_8(v_sum_row, mul, strength, rounding, weight);
+    highbd_accumulate_and_store_8(u_sum_row, u_pre, u_count, u_accum);
+    highbd_accumulate_and_store_8(v_sum_row, v_pre, v_count, v_accum);
+
+    u_pre += uv_pre_stride;
+    u_dist += DIST_STRIDE;
+    v_pre += uv_pre_stride;
+    v_dist += DIST_STRIDE;
+    u_count += uv_pre_stride;
+    u_accum += uv_pre_stride;
+    v_count += uv_pre_stride;
+    v_accum += uv_pre_stride;
+
+    y_dist += DIST_STRIDE * (1 + ss_y);
+
+    // Shift the rows up
+    u_sum_row_1 = u_sum_row_2;
+    v_sum_row_1 = v_sum_row_2;
+    u_sum_row_2 = u_sum_row_3;
+    v_sum_row_2 = v_sum_row_3;
+    if (h + 2 < uv_block_height) {
+      u_sum_row_3 = highbd_get_sum_8(u_dist + DIST_STRIDE);
+      v_sum_row_3 = highbd_get_sum_8(v_dist + DIST_STRIDE);
+    }
+  }
+}
+
+// Perform temporal filter for the chroma components.
+static void highbd_apply_temporal_filter_chroma(
+    const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride,
+    unsigned int block_width, unsigned int block_height, int ss_x, int ss_y,
+    int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    const uint32_t *y_dist, const uint32_t *u_dist, const uint32_t *v_dist) {
+  const unsigned int uv_width = block_width >> ss_x,
+                     uv_height = block_height >> ss_y;
+  const unsigned int uv_blk_col_step = 8, blk_col_step = 8 << ss_x;
+  const unsigned int uv_mid_width = uv_width >> 1;
+  unsigned int blk_col, uv_blk_col;
+  const uint32_t *const *neighbors_left;
+  const uint32_t *const *neighbors_middle;
+  const uint32_t *const *neighbors_right;
+
+  if (ss_x && ss_y) {
+    neighbors_left = HIGHBD_CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS;
+    neighbors_middle = HIGHBD_CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS;
+    neighbors_right = HIGHBD_CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS;
+  } else if (ss_x || ss_y) {
+    neighbors_left = HIGHBD_CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS;
+    neighbors_middle = HIGHBD_CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS;
+    neighbors_right = HIGHBD_CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS;
+  } else {
+    neighbors_left = HIGHBD_CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS;
+    neighbors_middle = HIGHBD_CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS;
+    neighbors_right = HIGHBD_CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS;
+  }
+
+  for (blk_col = 0, uv_blk_col = 0; uv_blk_col < uv_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    // When uv_width is 8 (subsampling in x direction on a 16x16 block), the
+    // left and right subblocks share this column, so each group of 4 gets its
+    // own weight.
+    const int idx_fst = use_whole_blk ? 0 : uv_blk_col >= uv_mid_width;
+    const int idx_snd = use_whole_blk ? 0 : uv_blk_col + 4 >= uv_mid_width;
+    const __m256i top_weight =
+        highbd_set_weight_pair(blk_fw[idx_fst], blk_fw[idx_snd]);
+    const __m256i bottom_weight =
+        use_whole_blk ? top_weight
+                      : highbd_set_weight_pair(blk_fw[2 + idx_fst],
+                                               blk_fw[2 + idx_snd]);
+    const uint32_t *const *neighbors_fst =
+        uv_blk_col == 0 ? neighbors_left : neighbors_middle;
+    const uint32_t *const *neighbors_snd =
+        uv_blk_col + uv_blk_col_step == uv_width ? neighbors_right
+                                                 : neighbors_middle;
+
+    highbd_apply_temporal_filter_chroma_8(
+        u_pre + uv_blk_col, v_pre + uv_blk_col, uv_pre_stride, uv_height, ss_x,
+        ss_y, strength, u_accum + uv_blk_col, u_count + uv_blk_col,
+        v_accum + uv_blk_col, v_count + uv_blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors_fst, neighbors_snd,
+        top_weight, bottom_weight);
+  }
+}
+
+void vp9_highbd_apply_temporal_filter_avx2(
+    const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+    int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src,
+    int uv_src_stride, const uint16_t *u_pre, const uint16_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, int strength, const int *const blk_fw,
+    int use_whole_blk, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+  const unsigned int chroma_height = block_height >> ss_y,
+                     chroma_width = block_width >> ss_x;
+
+  DECLARE_ALIGNED(32, uint32_t, y_dist[BH * DIST_STRIDE]) = { 0 };
+  DECLARE_ALIGNED(32, uint32_t, u_dist[BH * DIST_STRIDE]) = { 0 };
+  DECLARE_ALIGNED(32, uint32_t, v_dist[BH * DIST_STRIDE]) = { 0 };
+
+  uint32_t *y_dist_ptr = y_dist + 1, *u_dist_ptr = u_dist + 1,
+           *v_dist_ptr = v_dist + 1;
+  const uint16_t *y_src_ptr = y_src, *u_src_ptr = u_src, *v_src_ptr = v_src;
+  const uint16_t *y_pre_ptr = y_pre, *u_pre_ptr = u_pre, *v_pre_ptr = v_pre;
+
+  // Loop variables
+  unsigned int row, blk_col;
+
+  assert(block_width <= BW && "block width too large");
+  assert(block_height <= BH && "block height too large");
+  assert(block_width % 16 == 0 && "block width must be multiple of 16");
+  assert(block_height % 2 == 0 && "block height must be even");
+  assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+         "invalid chroma subsampling");
+  assert(strength >= 4 && strength <= 14 &&
+         "invalid adjusted temporal filter strength");
+  assert(blk_fw[0] >= 0 && "filter weight must be positive");
+  assert(
+      (use_whole_blk || (blk_fw[1] >= 0 && blk_fw[2] >= 0 && blk_fw[3] >= 0)) &&
+      "subblock filter weight must be positive");
+  assert(blk_fw[0] <= 2 && "sublock filter weight must be less than 2");
+  assert(
+      (use_whole_blk || (blk_fw[1] <= 2 && blk_fw[2] <= 2 && blk_fw[3] <= 2)) &&
+      "subblock filter weight must be less than 2");
+
+  // Precompute the difference squared
+  for (row = 0; row < block_height; row++) {
+    for (blk_col = 0; blk_col < block_width; blk_col += 8) {
+      highbd_store_dist_8(y_src_ptr + blk_col, y_pre_ptr + blk_col,
+                          y_dist_ptr + blk_col);
+    }
+    y_src_ptr += y_src_stride;
+    y_pre_ptr += y_pre_stride;
+    y_dist_ptr += DIST_STRIDE;
+  }
+
+  for (row = 0; row < chroma_height; row++) {
+    for (blk_col = 0; blk_col < chroma_width; blk_col += 8) {
+      highbd_store_dist_8(u_src_ptr + blk_col, u_pre_ptr + blk_col,
+                          u_dist_ptr + blk_col);
+      highbd_store_dist_8(v_src_ptr + blk_col, v_pre_ptr + blk_col,
+                          v_dist_ptr + blk_col);
+    }
+
+    u_src_ptr += uv_src_stride;
+    u_pre_ptr += uv_pre_stride;
+    u_dist_ptr += DIST_STRIDE;
+    v_src_ptr += uv_src_stride;
+    v_pre_ptr += uv_pre_stride;
+    v_dist_ptr += DIST_STRIDE;
+  }
+
+  y_dist_ptr = y_dist + 1;
+  u_dist_ptr = u_dist + 1;
+  v_dist_ptr = v_dist + 1;
+
+  highbd_apply_temporal_filter_luma(y_pre, y_pre_stride, block_width,
+                                    block_height, ss_x, ss_y, strength, blk_fw,
+                                    use_whole_blk, y_accum, y_count, y_dist_ptr,
+                                    u_dist_ptr, v_dist_ptr);
+
+  highbd_apply_temporal_filter_chroma(
+      u_pre, v_pre, uv_pre_stride, block_width, block_height, ss_x, ss_y,
+      strength, blk_fw, use_whole_blk, u_accum, u_count, v_accum, v_count,
+      y_dist_ptr, u_dist_ptr, v_dist_ptr);
+}
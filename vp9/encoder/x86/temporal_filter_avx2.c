@@ -0,0 +1,600 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+#include "vp9/encoder/vp9_encoder.h"
+#include "vp9/encoder/vp9_temporal_filter.h"
+#include "vp9/encoder/vp9_temporal_filter_constants.h"
+
+// This follows temporal_filter_sse4.c. Luma is filtered 16 pixels per
+// register. Chroma is filtered 8 pixels at a time with U in the low lane and
+// V in the high lane, so both planes share every load of the luma
+// distortion and every neighbor constant.
+//
+// All the sums are saturating adds of non-negative values, which give
+// min(sum, UINT16_MAX) in any order, matching the clamp in the C code.
+
+static INLINE __m256i load_2x128(const void *lo, const void *hi) {
+  const __m128i lo_reg = _mm_loadu_si128((const __m128i *)lo);
+  const __m128i hi_reg = _mm_loadu_si128((const __m128i *)hi);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lo_reg), hi_reg, 1);
+}
+
+static INLINE __m256i set_weight_pair(int lo, int hi) {
+  return _mm256_inserti128_si256(_mm256_set1_epi16(lo), _mm_set1_epi16(hi), 1);
+}
+
+// Compute (a - b)**2 for 16 pixels and store as unsigned 16-bit integers.
+static INLINE void store_dist_16(const uint8_t *a, const uint8_t *b,
+                                 uint16_t *dst) {
+  const __m256i a_reg =
+      _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)a));
+  const __m256i b_reg =
+      _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)b));
+  const __m256i diff = _mm256_sub_epi16(a_reg, b_reg);
+
+  _mm256_storeu_si256((__m256i *)dst, _mm256_mullo_epi16(diff, diff));
+}
+
+// Compute (a - b)**2 for 8 pixels of both U and V.
+static INLINE void store_dist_8_uv(const uint8_t *u_a, const uint8_t *u_b,
+                                   const uint8_t *v_a, const uint8_t *v_b,
+                                   uint16_t *u_dst, uint16_t *v_dst) {
+  const __m128i a_reg =
+      _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_a),
+                         _mm_loadl_epi64((const __m128i *)v_a));
+  const __m128i b_reg =
+      _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_b),
+                         _mm_loadl_epi64((const __m128i *)v_b));
+  __m256i diff = _mm256_sub_epi16(_mm256_cvtepu8_epi16(a_reg),
+                                  _mm256_cvtepu8_epi16(b_reg));
+
+  diff = _mm256_mullo_epi16(diff, diff);
+  _mm_storeu_si128((__m128i *)u_dst, _mm256_castsi256_si128(diff));
+  _mm_storeu_si128((__m128i *)v_dst, _mm256_extracti128_si256(diff, 1));
+}
+
+// For each index i, compute dist[i - 1] + dist[i] + dist[i + 1].
+static INLINE __m256i get_sum_16(const uint16_t *dist) {
+  const __m256i dist_reg = _mm256_loadu_si256((const __m256i *)dist);
+  const __m256i dist_left = _mm256_loadu_si256((const __m256i *)(dist - 1));
+  const __m256i dist_right = _mm256_loadu_si256((const __m256i *)(dist + 1));
+
+  return _mm256_adds_epu16(_mm256_adds_epu16(dist_reg, dist_left), dist_right);
+}
+
+static INLINE __m256i get_sum_8_uv(const uint16_t *u_dist,
+                                   const uint16_t *v_dist) {
+  const __m256i dist_reg = load_2x128(u_dist, v_dist);
+  const __m256i dist_left = load_2x128(u_dist - 1, v_dist - 1);
+  const __m256i dist_right = load_2x128(u_dist + 1, v_dist + 1);
+
+  return _mm256_adds_epu16(_mm256_adds_epu16(dist_reg, dist_left), dist_right);
+}
+
+// Read the U + V distortion that corresponds to a row of 16 luma values.
+static INLINE __m256i read_chroma_dist_row_16(int ss_x, const uint16_t *u_dist,
+                                              const uint16_t *v_dist) {
+  if (!ss_x) {
+    const __m256i u_reg = _mm256_loadu_si256((const __m256i *)u_dist);
+    const __m256i v_reg = _mm256_loadu_si256((const __m256i *)v_dist);
+    return _mm256_adds_epu16(u_reg, v_reg);
+  } else {
+    // Each chroma value covers two luma values.
+    const __m128i u_reg = _mm_loadu_si128((const __m128i *)u_dist);
+    const __m128i v_reg = _mm_loadu_si128((const __m128i *)v_dist);
+    const __m256i u_32 = _mm256_cvtepu16_epi32(u_reg);
+    const __m256i v_32 = _mm256_cvtepu16_epi32(v_reg);
+    const __m256i u_dup = _mm256_or_si256(u_32, _mm256_slli_epi32(u_32, 16));
+    const __m256i v_dup = _mm256_or_si256(v_32, _mm256_slli_epi32(v_32, 16));
+    return _mm256_adds_epu16(u_dup, v_dup);
+  }
+}
+
+// Read the luma distortion that corresponds to 8 chroma values, broadcast to
+// both lanes.
+static INLINE __m256i read_luma_dist_for_8_chroma(const uint16_t *y_dist,
+                                                  int ss_x, int ss_y) {
+  if (!ss_x) {
+    __m128i y_reg = _mm_loadu_si128((const __m128i *)y_dist);
+    if (ss_y == 1) {
+      y_reg = _mm_adds_epu16(
+          y_reg, _mm_loadu_si128((const __m128i *)(y_dist + DIST_STRIDE)));
+    }
+    return _mm256_broadcastsi128_si256(y_reg);
+  } else {
+    const __m256i mask = _mm256_set1_epi32(0xffff);
+    __m256i y_reg = _mm256_loadu_si256((const __m256i *)y_dist);
+    __m256i y_sum;
+    if (ss_y == 1) {
+      y_reg = _mm256_adds_epu16(
+          y_reg, _mm256_loadu_si256((const __m256i *)(y_dist + DIST_STRIDE)));
+    }
+
+    // Add horizontal pairs as 32-bit values, then saturate back to 16 bits.
+    y_sum = _mm256_add_epi32(_mm256_and_si256(y_reg, mask),
+                             _mm256_srli_epi32(y_reg, 16));
+    y_sum = _mm256_packus_epi32(y_sum, y_sum);
+    return _mm256_permute4x64_epi64(y_sum, 0x88);
+  }
+}
+
+// Average the value based on the number of values summed (9 for pixels away
+// from the border, 4 for pixels in corners, and 6 for other edge values).
+//
+// Add in the rounding factor and shift, clamp to 16, invert and shift. Multiply
+// by weight.
+static INLINE __m256i average_16(__m256i sum, const __m256i mul_constants,
+                                 const int strength, const int rounding,
+                                 const __m256i weight) {
+  const __m128i strength_u128 = _mm_cvtsi32_si128(strength);
+  const __m256i rounding_u16 = _mm256_set1_epi16(rounding);
+  const __m256i sixteen = _mm256_set1_epi16(16);
+
+  // modifier * 3 / index;
+  sum = _mm256_mulhi_epu16(sum, mul_constants);
+
+  sum = _mm256_adds_epu16(sum, rounding_u16);
+  sum = _mm256_srl_epi16(sum, strength_u128);
+  sum = _mm256_min_epu16(sum, sixteen);
+  sum = _mm256_sub_epi16(sixteen, sum);
+
+  return _mm256_mullo_epi16(sum, weight);
+}
+
+// Add 'sum_u16' to 'count'. Multiply by 'pred' and add to 'accumulator.'
+static INLINE void accumulate_and_store_16(const __m256i sum_u16,
+                                           const uint8_t *pred, uint16_t *count,
+                                           uint32_t *accumulator) {
+  const __m256i pred_u16 =
+      _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)pred));
+  __m256i count_u16 = _mm256_loadu_si256((const __m256i *)count);
+  __m256i mul_u16, accum_0_u32, accum_1_u32;
+
+  count_u16 = _mm256_adds_epu16(count_u16, sum_u16);
+  _mm256_storeu_si256((__m256i *)count, count_u16);
+
+  mul_u16 = _mm256_mullo_epi16(sum_u16, pred_u16);
+
+  accum_0_u32 = _mm256_loadu_si256((const __m256i *)accumulator);
+  accum_1_u32 = _mm256_loadu_si256((const __m256i *)(accumulator + 8));
+
+  accum_0_u32 = _mm256_add_epi32(
+      accum_0_u32, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mul_u16)));
+  accum_1_u32 = _mm256_add_epi32(
+      accum_1_u32, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mul_u16, 1)));
+
+  _mm256_storeu_si256((__m256i *)accumulator, accum_0_u32);
+  _mm256_storeu_si256((__m256i *)(accumulator + 8), accum_1_u32);
+}
+
+// As above for 8 U values in the low lane and 8 V values in the high lane.
+static INLINE void accumulate_and_store_8_uv(const __m256i sum_u16,
+                                             const uint8_t *u_pred,
+                                             const uint8_t *v_pred,
+                                             uint16_t *u_count,
+                                             uint16_t *v_count,
+                                             uint32_t *u_accum,
+                                             uint32_t *v_accum) {
+  const __m128i pred_u8 =
+      _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u_pred),
+                         _mm_loadl_epi64((const __m128i *)v_pred));
+  const __m256i pred_u16 = _mm256_cvtepu8_epi16(pred_u8);
+  __m256i count_u16 = load_2x128(u_count, v_count);
+  __m256i mul_u16, u_accum_u32, v_accum_u32;
+
+  count_u16 = _mm256_adds_epu16(count_u16, sum_u16);
+  _mm_storeu_si128((__m128i *)u_count, _mm256_castsi256_si128(count_u16));
+  _mm_storeu_si128((__m128i *)v_count, _mm256_extracti128_si256(count_u16, 1));
+
+  mul_u16 = _mm256_mullo_epi16(sum_u16, pred_u16);
+
+  u_accum_u32 = _mm256_loadu_si256((const __m256i *)u_accum);
+  v_accum_u32 = _mm256_loadu_si256((const __m256i *)v_accum);
+
+  u_accum_u32 = _mm256_add_epi32(
+      u_accum_u32, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mul_u16)));
+  v_accum_u32 = _mm256_add_epi32(
+      v_accum_u32, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mul_u16, 1)));
+
+  _mm256_storeu_si256((__m256i *)u_accum, u_accum_u32);
+  _mm256_storeu_si256((__m256i *)v_accum, v_accum_u32);
+}
+
+// Apply temporal filter to a luma column of 16 X block_height. top_weight is
+// used for the top half of the rows and bottom_weight for the rest.
+static void apply_temporal_filter_luma_16(
+    const uint8_t *y_pre, int y_pre_stride, unsigned int block_height, int ss_x,
+    int ss_y, int strength, uint32_t *y_accum, uint16_t *y_count,
+    const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist,
+    const int16_t *const *neighbors_first,
+    const int16_t *const *neighbors_second, const __m256i top_weight,
+    const __m256i bottom_weight) {
+  const int rounding = (1 << strength) >> 1;
+  const __m256i mul_edge = load_2x128(neighbors_first[0], neighbors_second[0]);
+  const __m256i mul_center =
+      load_2x128(neighbors_first[1], neighbors_second[1]);
+  __m256i sum_row_1 = _mm256_setzero_si256();
+  __m256i sum_row_2 = get_sum_16(y_dist);
+  __m256i sum_row_3 = get_sum_16(y_dist + DIST_STRIDE);
+  __m256i uv_dist = _mm256_setzero_si256();
+  unsigned int h;
+
+  assert(strength >= 0);
+  assert(strength <= 6);
+
+  for (h = 0; h < block_height; ++h) {
+    const int is_edge = h == 0 || h == block_height - 1;
+    __m256i sum_row = sum_row_2;
+
+    if (h > 0) sum_row = _mm256_adds_epu16(sum_row, sum_row_1);
+    if (h < block_height - 1) sum_row = _mm256_adds_epu16(sum_row, sum_row_3);
+
+    // Only read the chroma distortion when we reach a new chroma row.
+    if (ss_y == 0 || h % 2 == 0) {
+      uv_dist = read_chroma_dist_row_16(ss_x, u_dist, v_dist);
+      u_dist += DIST_STRIDE;
+      v_dist += DIST_STRIDE;
+    }
+    sum_row = _mm256_adds_epu16(sum_row, uv_dist);
+
+    sum_row = average_16(sum_row, is_edge ? mul_edge : mul_center, strength,
+                         rounding,
+                         h < block_height / 2 ? top_weight : bottom_weight);
+    accumulate_and_store_16(sum_row, y_pre, y_count, y_accum);
+
+    y_pre += y_pre_stride;
+    y_count += y_pre_stride;
+    y_accum += y_pre_stride;
+    y_dist += DIST_STRIDE;
+
+    sum_row_1 = sum_row_2;
+    sum_row_2 = sum_row_3;
+    if (h + 2 < block_height) sum_row_3 = get_sum_16(y_dist + DIST_STRIDE);
+  }
+}
+
+// Perform temporal filter for the luma component.
+static void apply_temporal_filter_luma(
+    const uint8_t *y_pre, int y_pre_stride, unsigned int block_width,
+    unsigned int block_height, int ss_x, int ss_y, int strength,
+    const int *blk_fw, int use_whole_blk, uint32_t *y_accum, uint16_t *y_count,
+    const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist) {
+  unsigned int blk_col = 0, uv_blk_col = 0;
+  const unsigned int blk_col_step = 16, uv_blk_col_step = 16 >> ss_x;
+  const unsigned int mid_width = block_width >> 1,
+                     last_width = block_width - blk_col_step;
+  __m256i top_weight = _mm256_set1_epi16(blk_fw[0]);
+  __m256i bottom_weight =
+      _mm256_set1_epi16(use_whole_blk ? blk_fw[0] : blk_fw[2]);
+  const int16_t *const *neighbors_first;
+  const int16_t *const *neighbors_second;
+
+  if (block_width == 16) {
+    // Special Case: The blockwidth is 16 and we are operating on a row of 16
+    // chroma pixels. In this case, we can't use the usual left-middle-right
+    // pattern. Each half of the register gets its own subblock weight.
+    if (!use_whole_blk) {
+      top_weight = set_weight_pair(blk_fw[0], blk_fw[1]);
+      bottom_weight = set_weight_pair(blk_fw[2], blk_fw[3]);
+    }
+    apply_temporal_filter_luma_16(
+        y_pre, y_pre_stride, block_height, ss_x, ss_y, strength, y_accum,
+        y_count, y_dist, u_dist, v_dist, LUMA_LEFT_COLUMN_NEIGHBORS,
+        LUMA_RIGHT_COLUMN_NEIGHBORS, top_weight, bottom_weight);
+    return;
+  }
+
+  // Left
+  neighbors_first = LUMA_LEFT_COLUMN_NEIGHBORS;
+  neighbors_second = LUMA_MIDDLE_COLUMN_NEIGHBORS;
+  apply_temporal_filter_luma_16(
+      y_pre + blk_col, y_pre_stride, block_height, ss_x, ss_y, strength,
+      y_accum + blk_col, y_count + blk_col, y_dist + blk_col,
+      u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors_first,
+      neighbors_second, top_weight, bottom_weight);
+
+  blk_col += blk_col_step;
+  uv_blk_col += uv_blk_col_step;
+
+  // Middle First
+  neighbors_first = LUMA_MIDDLE_COLUMN_NEIGHBORS;
+  for (; blk_col < mid_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    apply_temporal_filter_luma_16(
+        y_pre + blk_col, y_pre_stride, block_height, ss_x, ss_y, strength,
+        y_accum + blk_col, y_count + blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors_first,
+        neighbors_second, top_weight, bottom_weight);
+  }
+
+  if (!use_whole_blk) {
+    top_weight = _mm256_set1_epi16(blk_fw[1]);
+    bottom_weight = _mm256_set1_epi16(blk_fw[3]);
+  }
+
+  // Middle Second
+  for (; blk_col < last_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    apply_temporal_filter_luma_16(
+        y_pre + blk_col, y_pre_stride, block_height, ss_x, ss_y, strength,
+        y_accum + blk_col, y_count + blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors_first,
+        neighbors_second, top_weight, bottom_weight);
+  }
+
+  // Right
+  neighbors_second = LUMA_RIGHT_COLUMN_NEIGHBORS;
+  apply_temporal_filter_luma_16(
+      y_pre + blk_col, y_pre_stride, block_height, ss_x, ss_y, strength,
+      y_accum + blk_col, y_count + blk_col, y_dist + blk_col,
+      u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors_first,
+      neighbors_second, top_weight, bottom_weight);
+}
+
+// Apply temporal filter to a U and a V column of 8 X uv_block_height.
+// top_weight is used for the top half of the rows and bottom_weight for the
+// rest.
+static void apply_temporal_filter_chroma_8(
+    const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride,
+    unsigned int uv_block_height, int ss_x, int ss_y, int strength,
+    uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist,
+    const int16_t *const *neighbors, const __m256i top_weight,
+    const __m256i bottom_weight) {
+  const int rounding = (1 << strength) >> 1;
+  const __m256i mul_edge = _mm256_broadcastsi128_si256(
+      _mm_load_si128((const __m128i *)neighbors[0]));
+  const __m256i mul_center = _mm256_broadcastsi128_si256(
+      _mm_load_si128((const __m128i *)neighbors[1]));
+  __m256i sum_row_1 = _mm256_setzero_si256();
+  __m256i sum_row_2 = get_sum_8_uv(u_dist, v_dist);
+  __m256i sum_row_3 = get_sum_8_uv(u_dist + DIST_STRIDE, v_dist + DIST_STRIDE);
+  unsigned int h;
+
+  for (h = 0; h < uv_block_height; ++h) {
+    const int is_edge = h == 0 || h == uv_block_height - 1;
+    __m256i sum_row = sum_row_2;
+
+    if (h > 0) sum_row = _mm256_adds_epu16(sum_row, sum_row_1);
+    if (h < uv_block_height - 1) {
+      sum_row = _mm256_adds_epu16(sum_row, sum_row_3);
+    }
+
+    // Add luma values
+    sum_row = _mm256_adds_epu16(
+        sum_row, read_luma_dist_for_8_chroma(y_dist, ss_x, ss_y));
+
+    sum_row = average_16(sum_row, is_edge ? mul_edge : mul_center, strength,
+                         rounding,
+                         h < uv_block_height / 2 ? top_weight : bottom_weight);
+    accumulate_and_store_8_uv(sum_row, u_pre, v_pre, u_count, v_count, u_accum,
+                              v_accum);
+
+    u_pre += uv_pre_stride;
+    v_pre += uv_pre_stride;
+    u_count += uv_pre_stride;
+    v_count += uv_pre_stride;
+    u_accum += uv_pre_stride;
+    v_accum += uv_pre_stride;
+    u_dist += DIST_STRIDE;
+    v_dist += DIST_STRIDE;
+    y_dist += DIST_STRIDE * (1 + ss_y);
+
+    sum_row_1 = sum_row_2;
+    sum_row_2 = sum_row_3;
+    if (h + 2 < uv_block_height) {
+      sum_row_3 = get_sum_8_uv(u_dist + DIST_STRIDE, v_dist + DIST_STRIDE);
+    }
+  }
+}
+
+// Perform temporal filter for the chroma components.
+static void apply_temporal_filter_chroma(
+    const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride,
+    unsigned int block_width, unsigned int block_height, int ss_x, int ss_y,
+    int strength, const int *blk_fw, int use_whole_blk, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count,
+    const uint16_t *y_dist, const uint16_t *u_dist, const uint16_t *v_dist) {
+  const unsigned int uv_width = block_width >> ss_x,
+                     uv_height = block_height >> ss_y;
+
+  unsigned int blk_col = 0, uv_blk_col = 0;
+  const unsigned int uv_blk_col_step = 8, blk_col_step = 8 << ss_x;
+  const unsigned int uv_mid_width = uv_width >> 1,
+                     uv_last_width = uv_width - uv_blk_col_step;
+  __m256i top_weight = _mm256_set1_epi16(blk_fw[0]);
+  __m256i bottom_weight =
+      _mm256_set1_epi16(use_whole_blk ? blk_fw[0] : blk_fw[2]);
+  const int16_t *const *neighbors;
+
+  if (uv_width == 8) {
+    // Special Case: We are subsampling in x direction on a 16x16 block. Since
+    // we are operating on a row of 8 chroma pixels, we can't use the usual
+    // left-middle-right pattern.
+    assert(ss_x);
+
+    if (ss_y) {
+      neighbors = CHROMA_DOUBLE_SS_SINGLE_COLUMN_NEIGHBORS;
+    } else {
+      neighbors = CHROMA_SINGLE_SS_SINGLE_COLUMN_NEIGHBORS;
+    }
+
+    if (!use_whole_blk) {
+      top_weight = _mm256_broadcastsi128_si256(
+          _mm_setr_epi16(blk_fw[0], blk_fw[0], blk_fw[0], blk_fw[0], blk_fw[1],
+                         blk_fw[1], blk_fw[1], blk_fw[1]));
+      bottom_weight = _mm256_broadcastsi128_si256(
+          _mm_setr_epi16(blk_fw[2], blk_fw[2], blk_fw[2], blk_fw[2], blk_fw[3],
+                         blk_fw[3], blk_fw[3], blk_fw[3]));
+    }
+
+    apply_temporal_filter_chroma_8(u_pre, v_pre, uv_pre_stride, uv_height, ss_x,
+                                   ss_y, strength, u_accum, u_count, v_accum,
+                                   v_count, y_dist, u_dist, v_dist, neighbors,
+                                   top_weight, bottom_weight);
+    return;
+  }
+
+  // Left
+  if (ss_x && ss_y) {
+    neighbors = CHROMA_DOUBLE_SS_LEFT_COLUMN_NEIGHBORS;
+  } else if (ss_x || ss_y) {
+    neighbors = CHROMA_SINGLE_SS_LEFT_COLUMN_NEIGHBORS;
+  } else {
+    neighbors = CHROMA_NO_SS_LEFT_COLUMN_NEIGHBORS;
+  }
+
+  apply_temporal_filter_chroma_8(
+      u_pre + uv_blk_col, v_pre + uv_blk_col, uv_pre_stride, uv_height, ss_x,
+      ss_y, strength, u_accum + uv_blk_col, u_count + uv_blk_col,
+      v_accum + uv_blk_col, v_count + uv_blk_col, y_dist + blk_col,
+      u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors, top_weight,
+      bottom_weight);
+
+  blk_col += blk_col_step;
+  uv_blk_col += uv_blk_col_step;
+
+  // Middle First
+  if (ss_x && ss_y) {
+    neighbors = CHROMA_DOUBLE_SS_MIDDLE_COLUMN_NEIGHBORS;
+  } else if (ss_x || ss_y) {
+    neighbors = CHROMA_SINGLE_SS_MIDDLE_COLUMN_NEIGHBORS;
+  } else {
+    neighbors = CHROMA_NO_SS_MIDDLE_COLUMN_NEIGHBORS;
+  }
+
+  for (; uv_blk_col < uv_mid_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    apply_temporal_filter_chroma_8(
+        u_pre + uv_blk_col, v_pre + uv_blk_col, uv_pre_stride, uv_height, ss_x,
+        ss_y, strength, u_accum + uv_blk_col, u_count + uv_blk_col,
+        v_accum + uv_blk_col, v_count + uv_blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors, top_weight,
+        bottom_weight);
+  }
+
+  if (!use_whole_blk) {
+    top_weight = _mm256_set1_epi16(blk_fw[1]);
+    bottom_weight = _mm256_set1_epi16(blk_fw[3]);
+  }
+
+  // Middle Second
+  for (; uv_blk_col < uv_last_width;
+       blk_col += blk_col_step, uv_blk_col += uv_blk_col_step) {
+    apply_temporal_filter_chroma_8(
+        u_pre + uv_blk_col, v_pre + uv_blk_col, uv_pre_stride, uv_height, ss_x,
+        ss_y, strength, u_accum + uv_blk_col, u_count + uv_blk_col,
+        v_accum + uv_blk_col, v_count + uv_blk_col, y_dist + blk_col,
+        u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors, top_weight,
+        bottom_weight);
+  }
+
+  // Right
+  if (ss_x && ss_y) {
+    neighbors = CHROMA_DOUBLE_SS_RIGHT_COLUMN_NEIGHBORS;
+  } else if (ss_x || ss_y) {
+    neighbors = CHROMA_SINGLE_SS_RIGHT_COLUMN_NEIGHBORS;
+  } else {
+    neighbors = CHROMA_NO_SS_RIGHT_COLUMN_NEIGHBORS;
+  }
+
+  apply_temporal_filter_chroma_8(
+      u_pre + uv_blk_col, v_pre + uv_blk_col, uv_pre_stride, uv_height, ss_x,
+      ss_y, strength, u_accum + uv_blk_col, u_count + uv_blk_col,
+      v_accum + uv_blk_col, v_count + uv_blk_col, y_dist + blk_col,
+      u_dist + uv_blk_col, v_dist + uv_blk_col, neighbors, top_weight,
+      bottom_weight);
+}
+
+void vp9_apply_temporal_filter_avx2(
+    const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+    int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src,
+    int uv_src_stride, const uint8_t *u_pre, const uint8_t *v_pre,
+    int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, int strength, const int *const blk_fw,
+    int use_whole_blk, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+  const unsigned int chroma_height = block_height >> ss_y,
+                     chroma_width = block_width >> ss_x;
+
+  DECLARE_ALIGNED(32, uint16_t, y_dist[BH * DIST_STRIDE]) = { 0 };
+  DECLARE_ALIGNED(32, uint16_t, u_dist[BH * DIST_STRIDE]) = { 0 };
+  DECLARE_ALIGNED(32, uint16_t, v_dist[BH * DIST_STRIDE]) = { 0 };
+
+  uint16_t *y_dist_ptr = y_dist + 1, *u_dist_ptr = u_dist + 1,
+           *v_dist_ptr = v_dist + 1;
+  const uint8_t *y_src_ptr = y_src, *u_src_ptr = u_src, *v_src_ptr = v_src;
+  const uint8_t *y_pre_ptr = y_pre, *u_pre_ptr = u_pre, *v_pre_ptr = v_pre;
+
+  // Loop variables
+  unsigned int row, blk_col;
+
+  assert(block_width <= BW && "block width too large");
+  assert(block_height <= BH && "block height too large");
+  assert(block_width % 16 == 0 && "block width must be multiple of 16");
+  assert(block_height % 2 == 0 && "block height must be even");
+  assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) &&
+         "invalid chroma subsampling");
+  assert(strength >= 0 && strength <= 6 && "invalid temporal filter strength");
+  assert(blk_fw[0] >= 0 && "filter weight must be positive");
+  assert(
+      (use_whole_blk || (blk_fw[1] >= 0 && blk_fw[2] >= 0 && blk_fw[3] >= 0)) &&
+      "subblock filter weight must be positive");
+  assert(blk_fw[0] <= 2 && "subblock filter weight must be less than 2");
+  assert(
+      (use_whole_blk || (blk_fw[1] <= 2 && blk_fw[2] <= 2 && blk_fw[3] <= 2)) &&
+      "subblock filter weight must be less than 2");
+
+  // Precompute the difference squared
+  for (row = 0; row < block_height; row++) {
+    for (blk_col = 0; blk_col < block_width; blk_col += 16) {
+      store_dist_16(y_src_ptr + blk_col, y_pre_ptr + blk_col,
+                    y_dist_ptr + blk_col);
+    }
+    y_src_ptr += y_src_stride;
+    y_pre_ptr += y_pre_stride;
+    y_dist_ptr += DIST_STRIDE;
+  }
+
+  for (row = 0; row < chroma_height; row++) {
+    for (blk_col = 0; blk_col < chroma_width; blk_col += 8) {
+      store_dist_8_uv(u_src_ptr + blk_col, u_pre_ptr + blk_col,
+                      v_src_ptr + blk_col, v_pre_ptr + blk_col,
+                      u_dist_ptr + blk_col, v_dist_ptr + blk_col);
+    }
+
+    u_src_ptr += uv_src_stride;
+    u_pre_ptr += uv_pre_stride;
+    u_dist_ptr += DIST_STRIDE;
+    v_src_ptr += uv_src_stride;
+    v_pre_ptr += uv_pre_stride;
+    v_dist_ptr += DIST_STRIDE;
+  }
+
+  y_dist_ptr = y_dist + 1;
+  u_dist_ptr = u_dist + 1;
+  v_dist_ptr = v_dist + 1;
+
+  apply_temporal_filter_luma(y_pre, y_pre_stride, block_width, block_height,
+                             ss_x, ss_y, strength, blk_fw, use_whole_blk,
+                             y_accum, y_count, y_dist_ptr, u_dist_ptr,
+                             v_dist_ptr);
+
+  apply_temporal_filter_chroma(u_pre, v_pre, uv_pre_stride, block_width,
+                               block_height, ss_x, ss_y, strength, blk_fw,
+                               use_whole_blk, u_accum, u_count, v_accum,
+                               v_count, y_dist_ptr, u_dist_ptr, v_dist_ptr);
+}
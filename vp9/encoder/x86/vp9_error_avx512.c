@@ -0,0 +1,72 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX512
+
+#include "./vp9_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_dsp/vpx_dsp_common.h"
+#include "vpx_dsp/x86/bitdepth_conversion_avx512.h"
+
+// Widens the 16 unsigned double words of 'a' to quad words and adds them to
+// 'sum'. The madd of two squares may not fit a signed 32 bit value.
+static INLINE __m512i add_epu32_to_epi64(__m512i sum, __m512i a) {
+  sum = _mm512_add_epi64(sum,
+                         _mm512_cvtepu32_epi64(_mm512_castsi512_si256(a)));
+  return _mm512_add_epi64(
+      sum, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(a, 1)));
+}
+
+int64_t vp9_block_error_avx512(const tran_low_t *coeff,
+                               const tran_low_t *dqcoeff, intptr_t block_size,
+                               int64_t *ssz) {
+  __m512i sse_512 = _mm512_setzero_si512();
+  __m512i ssz_512 = _mm512_setzero_si512();
+  intptr_t i;
+
+  // A 4x4 block does not fill a register.
+  if (block_size < 32) {
+    return vp9_block_error_avx2(coeff, dqcoeff, block_size, ssz);
+  }
+  assert(block_size % 32 == 0);
+
+  for (i = 0; i < block_size; i += 32) {
+    const __m512i coeff_512 = load_tran_low(coeff + i);
+    const __m512i dqcoeff_512 = load_tran_low(dqcoeff + i);
+    const __m512i diff = _mm512_sub_epi16(dqcoeff_512, coeff_512);
+    sse_512 = add_epu32_to_epi64(sse_512, _mm512_madd_epi16(diff, diff));
+    ssz_512 =
+        add_epu32_to_epi64(ssz_512, _mm512_madd_epi16(coeff_512, coeff_512));
+  }
+
+  *ssz = _mm512_reduce_add_epi64(ssz_512);
+  return _mm512_reduce_add_epi64(sse_512);
+}
+
+int64_t vp9_block_error_fp_avx512(const tran_low_t *coeff,
+                                  const tran_low_t *dqcoeff, int block_size) {
+  __m512i sse_512 = _mm512_setzero_si512();
+  int i;
+
+  // A 4x4 block does not fill a register.
+  if (block_size < 32) {
+    return vp9_block_error_fp_avx2(coeff, dqcoeff, block_size);
+  }
+  assert(block_size % 32 == 0);
+
+  for (i = 0; i < block_size; i += 32) {
+    const __m512i diff =
+        _mm512_sub_epi16(load_tran_low(dqcoeff + i), load_tran_low(coeff + i));
+    sse_512 = add_epu32_to_epi64(sse_512, _mm512_madd_epi16(diff, diff));
+  }
+
+  return _mm512_reduce_add_epi64(sse_512);
+}
@@ -0,0 +1,300 @@
+/*
+ *  Copyright (c) 2024 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX2
+
+#include "./vp9_rtcd.h"
+#include "./vpx_dsp_rtcd.h"
+#include "./vpx_scale_rtcd.h"
+#include "vp9/common/vp9_filter.h"
+#include "vpx_scale/yv12config.h"
+
+// The kernels below produce 32 pixels per call. When only 16 pixels are left
+// in a row, the second half of the source is replaced by the first half so
+// that no more is read than in the SSSE3 version, and only the low 16 pixels
+// are stored.
+
+static INLINE __m256i scale_plane_2_to_1_phase_0_kernel(
+    const uint8_t *const src, const int half) {
+  const __m256i mask = _mm256_set1_epi16(0x00FF);
+  const __m256i a = _mm256_loadu_si256((const __m256i *)(&src[0]));
+  const __m256i b =
+      half ? a : _mm256_loadu_si256((const __m256i *)(&src[32]));
+  const __m256i a_and = _mm256_and_si256(a, mask);
+  const __m256i b_and = _mm256_and_si256(b, mask);
+  const __m256i d = _mm256_packus_epi16(a_and, b_and);
+  return _mm256_permute4x64_epi64(d, 0xd8);
+}
+
+// Pack the low byte of each 32-bit value of s[0..3] into 32 bytes in order.
+static INLINE __m256i pack_4_to_1_avx2(const __m256i *const s) {
+  const __m256i idx = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  const __m256i ab = _mm256_packus_epi32(s[0], s[1]);
+  const __m256i cd = _mm256_packus_epi32(s[2], s[3]);
+  return _mm256_permutevar8x32_epi32(_mm256_packus_epi16(ab, cd), idx);
+}
+
+static INLINE __m256i scale_plane_4_to_1_phase_0_kernel(
+    const uint8_t *const src, const int half) {
+  const __m256i mask = _mm256_set1_epi32(0x000000FF);
+  __m256i s[4];
+  int i;
+
+  for (i = 0; i < (half ? 2 : 4); ++i) {
+    const __m256i t = _mm256_loadu_si256((const __m256i *)(src + 32 * i));
+    s[i] = _mm256_and_si256(t, mask);
+  }
+  if (half) {
+    s[2] = s[0];
+    s[3] = s[1];
+  }
+  return pack_4_to_1_avx2(s);
+}
+
+static INLINE __m256i scale_plane_bilinear_kernel(const __m256i s,
+                                                  const __m256i c0c1) {
+  const __m256i k_64 = _mm256_set1_epi16(1 << 6);
+  const __m256i t = _mm256_adds_epi16(_mm256_maddubs_epi16(s, c0c1), k_64);
+  // round and shift by 7 bit each 16 bit
+  return _mm256_srai_epi16(t, 7);
+}
+
+static INLINE __m256i scale_plane_2_to_1_bilinear_row(const uint8_t *const src,
+                                                      const __m256i c0c1,
+                                                      const int half) {
+  const __m256i s0 = _mm256_loadu_si256((const __m256i *)(src + 0));
+  const __m256i s1 =
+      half ? s0 : _mm256_loadu_si256((const __m256i *)(src + 32));
+  // Lane 0 holds pixels 0-7 and 16-23, lane 1 pixels 8-15 and 24-31.
+  return _mm256_packus_epi16(scale_plane_bilinear_kernel(s0, c0c1),
+                             scale_plane_bilinear_kernel(s1, c0c1));
+}
+
+static INLINE __m256i scale_plane_2_to_1_bilinear_kernel(
+    const uint8_t *const src, const ptrdiff_t src_stride, const __m256i c0c1,
+    const int half) {
+  // Horizontal
+  const __m256i d0 = scale_plane_2_to_1_bilinear_row(src, c0c1, half);
+  const __m256i d1 =
+      scale_plane_2_to_1_bilinear_row(src + src_stride, c0c1, half);
+  // Vertical
+  const __m256i d = _mm256_packus_epi16(
+      scale_plane_bilinear_kernel(_mm256_unpacklo_epi8(d0, d1), c0c1),
+      scale_plane_bilinear_kernel(_mm256_unpackhi_epi8(d0, d1), c0c1));
+  return _mm256_permute4x64_epi64(d, 0xd8);
+}
+
+static INLINE __m256i scale_plane_4_to_1_bilinear_row(const uint8_t *const src,
+                                                      const __m256i c0c1,
+                                                      const int half) {
+  // Only the low 16 bits of each 32-bit result, which filter pixels 4 * i and
+  // 4 * i + 1, are kept. They are non-negative and fit in 8 bits.
+  const __m256i mask = _mm256_set1_epi32(0x0000FFFF);
+  __m256i s[4];
+  int i;
+
+  for (i = 0; i < (half ? 2 : 4); ++i) {
+    const __m256i t = _mm256_loadu_si256((const __m256i *)(src + 32 * i));
+    s[i] = _mm256_and_si256(scale_plane_bilinear_kernel(t, c0c1), mask);
+  }
+  if (half) {
+    s[2] = s[0];
+    s[3] = s[1];
+  }
+  return pack_4_to_1_avx2(s);
+}
+
+static INLINE __m256i scale_plane_4_to_1_bilinear_kernel(
+    const uint8_t *const src, const ptrdiff_t src_stride, const __m256i c0c1,
+    const int half) {
+  // Horizontal
+  const __m256i d0 = scale_plane_4_to_1_bilinear_row(src, c0c1, half);
+  const __m256i d1 =
+      scale_plane_4_to_1_bilinear_row(src + src_stride, c0c1, half);
+  // Vertical. The unpacks and the pack stay within each lane, so the output
+  // is in order.
+  return _mm256_packus_epi16(
+      scale_plane_bilinear_kernel(_mm256_unpacklo_epi8(d0, d1), c0c1),
+      scale_plane_bilinear_kernel(_mm256_unpackhi_epi8(d0, d1), c0c1));
+}
+
+static void scale_plane_2_to_1_phase_0(const uint8_t *src,
+                                       const ptrdiff_t src_stride, uint8_t *dst,
+                                       const ptrdiff_t dst_stride,
+                                       const int dst_w, const int dst_h) {
+  const int max_width = (dst_w + 15) & ~15;
+  int y = dst_h;
+
+  do {
+    int x = max_width;
+    while (x >= 32) {
+      _mm256_storeu_si256((__m256i *)dst,
+                          scale_plane_2_to_1_phase_0_kernel(src, 0));
+      src += 64;
+      dst += 32;
+      x -= 32;
+    }
+    if (x) {
+      const __m256i d = scale_plane_2_to_1_phase_0_kernel(src, 1);
+      _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(d));
+      src += 32;
+      dst += 16;
+    }
+    src += 2 * (src_stride - max_width);
+    dst += dst_stride - max_width;
+  } while (--y);
+}
+
+static void scale_plane_4_to_1_phase_0(const uint8_t *src,
+                                       const ptrdiff_t src_stride, uint8_t *dst,
+                                       const ptrdiff_t dst_stride,
+                                       const int dst_w, const int dst_h) {
+  const int max_width = (dst_w + 15) & ~15;
+  int y = dst_h;
+
+  do {
+    int x = max_width;
+    while (x >= 32) {
+      _mm256_storeu_si256((__m256i *)dst,
+                          scale_plane_4_to_1_phase_0_kernel(src, 0));
+      src += 128;
+      dst += 32;
+      x -= 32;
+    }
+    if (x) {
+      const __m256i d = scale_plane_4_to_1_phase_0_kernel(src, 1);
+      _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(d));
+      src += 64;
+      dst += 16;
+    }
+    src += 4 * (src_stride - max_width);
+    dst += dst_stride - max_width;
+  } while (--y);
+}
+
+static void scale_plane_2_to_1_bilinear(const uint8_t *src,
+                                        const ptrdiff_t src_stride,
+                                        uint8_t *dst,
+                                        const ptrdiff_t dst_stride,
+                                        const int dst_w, const int dst_h,
+                                        const __m256i c0c1) {
+  const int max_width = (dst_w + 15) & ~15;
+  int y = dst_h;
+
+  do {
+    int x = max_width;
+    while (x >= 32) {
+      _mm256_storeu_si256(
+          (__m256i *)dst,
+          scale_plane_2_to_1_bilinear_kernel(src, src_stride, c0c1, 0));
+      src += 64;
+      dst += 32;
+      x -= 32;
+    }
+    if (x) {
+      const __m256i d =
+          scale_plane_2_to_1_bilinear_kernel(src, src_stride, c0c1, 1);
+      _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(d));
+      src += 32;
+      dst += 16;
+    }
+    src += 2 * (src_stride - max_width);
+    dst += dst_stride - max_width;
+  } while (--y);
+}
+
+static void scale_plane_4_to_1_bilinear(const uint8_t *src,
+                                        const ptrdiff_t src_stride,
+                                        uint8_t *dst,
+                                        const ptrdiff_t dst_stride,
+                                        const int dst_w, const int dst_h,
+                                        const __m256i c0c1) {
+  const int max_width = (dst_w + 15) & ~15;
+  int y = dst_h;
+
+  do {
+    int x = max_width;
+    while (x >= 32) {
+      _mm256_storeu_si256(
+          (__m256i *)dst,
+          scale_plane_4_to_1_bilinear_kernel(src, src_stride, c0c1, 0));
+      src += 128;
+      dst += 32;
+      x -= 32;
+    }
+    if (x) {
+      const __m256i d =
+          scale_plane_4_to_1_bilinear_kernel(src, src_stride, c0c1, 1);
+      _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(d));
+      src += 64;
+      dst += 16;
+    }
+    src += 4 * (src_stride - max_width);
+    dst += dst_stride - max_width;
+  } while (--y);
+}
+
+void vp9_scale_and_extend_frame_avx2(const YV12_BUFFER_CONFIG *src,
+                                     YV12_BUFFER_CONFIG *dst,
+                                     uint8_t filter_type, int phase_scaler) {
+  const int src_w = src->y_crop_width;
+  const int src_h = src->y_crop_height;
+  const int dst_w = dst->y_crop_width;
+  const int dst_h = dst->y_crop_height;
+  const int dst_uv_w = dst->uv_crop_width;
+  const int dst_uv_h = dst->uv_crop_height;
+  const int is_2_to_1 = dst_w * 2 == src_w && dst_h * 2 == src_h;
+  const int is_4_to_1 = 4 * dst_w == src_w && 4 * dst_h == src_h;
+
+  // phase_scaler is usually 0 or 8.
+  assert(phase_scaler >= 0 && phase_scaler < 16);
+
+  if (is_2_to_1 && phase_scaler == 0) {
+    scale_plane_2_to_1_phase_0(src->y_buffer, src->y_stride, dst->y_buffer,
+                               dst->y_stride, dst_w, dst_h);
+    scale_plane_2_to_1_phase_0(src->u_buffer, src->uv_stride, dst->u_buffer,
+                               dst->uv_stride, dst_uv_w, dst_uv_h);
+    scale_plane_2_to_1_phase_0(src->v_buffer, src->uv_stride, dst->v_buffer,
+                               dst->uv_stride, dst_uv_w, dst_uv_h);
+  } else if (is_4_to_1 && phase_scaler == 0) {
+    scale_plane_4_to_1_phase_0(src->y_buffer, src->y_stride, dst->y_buffer,
+                               dst->y_stride, dst_w, dst_h);
+    scale_plane_4_to_1_phase_0(src->u_buffer, src->uv_stride, dst->u_buffer,
+                               dst->uv_stride, dst_uv_w, dst_uv_h);
+    scale_plane_4_to_1_phase_0(src->v_buffer, src->uv_stride, dst->v_buffer,
+                               dst->uv_stride, dst_uv_w, dst_uv_h);
+  } else if ((is_2_to_1 || is_4_to_1) && filter_type == BILINEAR) {
+    const int16_t c0 = vp9_filter_kernels[BILINEAR][phase_scaler][3];
+    const int16_t c1 = vp9_filter_kernels[BILINEAR][phase_scaler][4];
+    const __m256i c0c1 = _mm256_set1_epi16(c0 | (c1 << 8));  // c0 and c1 >= 0
+    if (is_2_to_1) {
+      scale_plane_2_to_1_bilinear(src->y_buffer, src->y_stride, dst->y_buffer,
+                                  dst->y_stride, dst_w, dst_h, c0c1);
+      scale_plane_2_to_1_bilinear(src->u_buffer, src->uv_stride, dst->u_buffer,
+                                  dst->uv_stride, dst_uv_w, dst_uv_h, c0c1);
+      scale_plane_2_to_1_bilinear(src->v_buffer, src->uv_stride, dst->v_buffer,
+                                  dst->uv_stride, dst_uv_w, dst_uv_h, c0c1);
+    } else {
+      scale_plane_4_to_1_bilinear(src->y_buffer, src->y_stride, dst->y_buffer,
+                                  dst->y_stride, dst_w, dst_h, c0c1);
+      scale_plane_4_to_1_bilinear(src->u_buffer, src->uv_stride, dst->u_buffer,
+                                  dst->uv_stride, dst_uv_w, dst_uv_h, c0c1);
+      scale_plane_4_to_1_bilinear(src->v_buffer, src->uv_stride, dst->v_buffer,
+                                  dst->uv_stride, dst_uv_w, dst_uv_h, c0c1);
+    }
+  } else {
+    // The general filters and the other scaling ratios use the SSSE3 version.
+    vp9_scale_and_extend_frame_ssse3(src, dst, filter_type, phase_scaler);
+    return;
+  }
+
+  vpx_extend_frame_borders(dst);
+}
@@ -0,0 +1,426 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// High bitdepth forward hybrid transforms, shared by the SSE4.1 and AVX2
+// implementations. The including file provides:
+//   HBD_LANES            number of int32 lanes in hbd_vec
+//   hbd_vec, hbd_wide    a vector of int32 and its 64-bit product
+//   hbd_set1, hbd_add, hbd_sub, hbd_slli, hbd_srai
+//   hbd_wmul             64-bit products of a vector and a constant
+//   hbd_wadd, hbd_wsub   64-bit sums of products
+//   hbd_wround           fdct_round_shift() of a 64-bit sum back to int32
+//   hbd_load, hbd_store, hbd_transpose_block
+//
+// The C transforms keep intermediate products in 64 bits when
+// CONFIG_VP9_HIGHBITDEPTH is set, so every multiply goes through hbd_wide to
+// stay bit-exact. Sums of unscaled coefficients always fit in 32 bits.
+//
+// An n x n block is held as in[g * n + r]: row r, columns
+// g * HBD_LANES .. g * HBD_LANES + HBD_LANES - 1.
+
+#include <string.h>
+
+#include "vp9/common/vp9_enums.h"
+#include "vpx_dsp/txfm_common.h"
+
+typedef void (*hbd_fht_1d)(hbd_vec *in);
+
+static INLINE hbd_wide hbd_wmadd(hbd_vec a, int ca, hbd_vec b, int cb) {
+  return hbd_wadd(hbd_wmul(a, ca), hbd_wmul(b, cb));
+}
+
+// fdct_round_shift(a * ca + b * cb)
+static INLINE hbd_vec hbd_btf(hbd_vec a, int ca, hbd_vec b, int cb) {
+  return hbd_wround(hbd_wmadd(a, ca, b, cb));
+}
+
+// fdct_round_shift(a * c)
+static INLINE hbd_vec hbd_mul_round(hbd_vec a, int c) {
+  return hbd_wround(hbd_wmul(a, c));
+}
+
+static INLINE hbd_vec hbd_neg(hbd_vec a) {
+  return hbd_sub(hbd_set1(0), a);
+}
+
+static INLINE void hbd_fdct4(hbd_vec *in) {
+  const hbd_vec s0 = hbd_add(in[0], in[3]);
+  const hbd_vec s1 = hbd_add(in[1], in[2]);
+  const hbd_vec s2 = hbd_sub(in[1], in[2]);
+  const hbd_vec s3 = hbd_sub(in[0], in[3]);
+
+  in[0] = hbd_mul_round(hbd_add(s0, s1), cospi_16_64);
+  in[2] = hbd_mul_round(hbd_sub(s0, s1), cospi_16_64);
+  in[1] = hbd_btf(s2, cospi_24_64, s3, cospi_8_64);
+  in[3] = hbd_btf(s2, -cospi_8_64, s3, cospi_24_64);
+}
+
+static INLINE void hbd_fadst4(hbd_vec *in) {
+  const hbd_wide s0 = hbd_wmul(in[0], sinpi_1_9);
+  const hbd_wide s1 = hbd_wmul(in[0], sinpi_4_9);
+  const hbd_wide s2 = hbd_wmul(in[1], sinpi_2_9);
+  const hbd_wide s3 = hbd_wmul(in[1], sinpi_1_9);
+  const hbd_wide s4 = hbd_wmul(in[2], sinpi_3_9);
+  const hbd_wide s5 = hbd_wmul(in[3], sinpi_4_9);
+  const hbd_wide s6 = hbd_wmul(in[3], sinpi_2_9);
+  const hbd_vec s7 = hbd_sub(hbd_add(in[0], in[1]), in[3]);
+
+  const hbd_wide x0 = hbd_wadd(hbd_wadd(s0, s2), s5);
+  const hbd_wide x1 = hbd_wmul(s7, sinpi_3_9);
+  const hbd_wide x2 = hbd_wadd(hbd_wsub(s1, s3), s6);
+  const hbd_wide x3 = s4;
+
+  in[0] = hbd_wround(hbd_wadd(x0, x3));
+  in[1] = hbd_wround(x1);
+  in[2] = hbd_wround(hbd_wsub(x2, x3));
+  in[3] = hbd_wround(hbd_wadd(hbd_wsub(x2, x0), x3));
+}
+
+// Even half of fdct8/fdct16: s[0..7] hold the stage 1 sums and differences
+// of an 8-point DCT, the results are written to out[0], out[stride], ...
+static INLINE void hbd_fdct8_core(const hbd_vec *s, hbd_vec *out,
+                                  int stride) {
+  hbd_vec x0, x1, x2, x3, t2, t3;
+
+  // fdct4(step, step);
+  x0 = hbd_add(s[0], s[3]);
+  x1 = hbd_add(s[1], s[2]);
+  x2 = hbd_sub(s[1], s[2]);
+  x3 = hbd_sub(s[0], s[3]);
+  out[0 * stride] = hbd_mul_round(hbd_add(x0, x1), cospi_16_64);
+  out[2 * stride] = hbd_btf(x2, cospi_24_64, x3, cospi_8_64);
+  out[4 * stride] = hbd_mul_round(hbd_sub(x0, x1), cospi_16_64);
+  out[6 * stride] = hbd_btf(x2, -cospi_8_64, x3, cospi_24_64);
+
+  // Stage 2
+  t2 = hbd_mul_round(hbd_sub(s[6], s[5]), cospi_16_64);
+  t3 = hbd_mul_round(hbd_add(s[6], s[5]), cospi_16_64);
+
+  // Stage 3
+  x0 = hbd_add(s[4], t2);
+  x1 = hbd_sub(s[4], t2);
+  x2 = hbd_sub(s[7], t3);
+  x3 = hbd_add(s[7], t3);
+
+  // Stage 4
+  out[1 * stride] = hbd_btf(x0, cospi_28_64, x3, cospi_4_64);
+  out[3 * stride] = hbd_btf(x2, cospi_12_64, x1, -cospi_20_64);
+  out[5 * stride] = hbd_btf(x1, cospi_12_64, x2, cospi_20_64);
+  out[7 * stride] = hbd_btf(x3, cospi_28_64, x0, -cospi_4_64);
+}
+
+static INLINE void hbd_fdct8(hbd_vec *in) {
+  hbd_vec s[8];
+
+  // stage 1
+  s[0] = hbd_add(in[0], in[7]);
+  s[1] = hbd_add(in[1], in[6]);
+  s[2] = hbd_add(in[2], in[5]);
+  s[3] = hbd_add(in[3], in[4]);
+  s[4] = hbd_sub(in[3], in[4]);
+  s[5] = hbd_sub(in[2], in[5]);
+  s[6] = hbd_sub(in[1], in[6]);
+  s[7] = hbd_sub(in[0], in[7]);
+
+  hbd_fdct8_core(s, in, 1);
+}
+
+static INLINE void hbd_fadst8(hbd_vec *in) {
+  hbd_wide s0, s1, s2, s3, s4, s5, s6, s7;
+  hbd_vec x0, x1, x2, x3, x4, x5, x6, x7;
+
+  // stage 1
+  s0 = hbd_wmadd(in[7], cospi_2_64, in[0], cospi_30_64);
+  s1 = hbd_wmadd(in[7], cospi_30_64, in[0], -cospi_2_64);
+  s2 = hbd_wmadd(in[5], cospi_10_64, in[2], cospi_22_64);
+  s3 = hbd_wmadd(in[5], cospi_22_64, in[2], -cospi_10_64);
+  s4 = hbd_wmadd(in[3], cospi_18_64, in[4], cospi_14_64);
+  s5 = hbd_wmadd(in[3], cospi_14_64, in[4], -cospi_18_64);
+  s6 = hbd_wmadd(in[1], cospi_26_64, in[6], cospi_6_64);
+  s7 = hbd_wmadd(in[1], cospi_6_64, in[6], -cospi_26_64);
+
+  x0 = hbd_wround(hbd_wadd(s0, s4));
+  x1 = hbd_wround(hbd_wadd(s1, s5));
+  x2 = hbd_wround(hbd_wadd(s2, s6));
+  x3 = hbd_wround(hbd_wadd(s3, s7));
+  x4 = hbd_wround(hbd_wsub(s0, s4));
+  x5 = hbd_wround(hbd_wsub(s1, s5));
+  x6 = hbd_wround(hbd_wsub(s2, s6));
+  x7 = hbd_wround(hbd_wsub(s3, s7));
+
+  // stage 2
+  s4 = hbd_wmadd(x4, cospi_8_64, x5, cospi_24_64);
+  s5 = hbd_wmadd(x4, cospi_24_64, x5, -cospi_8_64);
+  s6 = hbd_wmadd(x6, -cospi_24_64, x7, cospi_8_64);
+  s7 = hbd_wmadd(x6, cospi_8_64, x7, cospi_24_64);
+
+  in[0] = hbd_add(x0, x2);
+  in[7] = hbd_neg(hbd_add(x1, x3));
+  x2 = hbd_sub(x0, x2);
+  x3 = hbd_sub(x1, x3);
+  in[1] = hbd_neg(hbd_wround(hbd_wadd(s4, s6)));
+  in[6] = hbd_wround(hbd_wadd(s5, s7));
+  x6 = hbd_wround(hbd_wsub(s4, s6));
+  x7 = hbd_wround(hbd_wsub(s5, s7));
+
+  // stage 3
+  in[2] = hbd_mul_round(hbd_add(x6, x7), cospi_16_64);
+  in[3] = hbd_neg(hbd_mul_round(hbd_add(x2, x3), cospi_16_64));
+  in[4] = hbd_mul_round(hbd_sub(x2, x3), cospi_16_64);
+  in[5] = hbd_neg(hbd_mul_round(hbd_sub(x6, x7), cospi_16_64));
+}
+
+static INLINE void hbd_fdct16(hbd_vec *in) {
+  hbd_vec input[8], step1[8], step2[8], step3[8];
+  hbd_vec out[16];
+  int i;
+
+  // step 1
+  for (i = 0; i < 8; ++i) {
+    input[i] = hbd_add(in[i], in[15 - i]);
+    step1[i] = hbd_sub(in[7 - i], in[8 + i]);
+  }
+
+  // fdct8(step, step);
+  {
+    hbd_vec s[8];
+    s[0] = hbd_add(input[0], input[7]);
+    s[1] = hbd_add(input[1], input[6]);
+    s[2] = hbd_add(input[2], input[5]);
+    s[3] = hbd_add(input[3], input[4]);
+    s[4] = hbd_sub(input[3], input[4]);
+    s[5] = hbd_sub(input[2], input[5]);
+    s[6] = hbd_sub(input[1], input[6]);
+    s[7] = hbd_sub(input[0], input[7]);
+    hbd_fdct8_core(s, out, 2);
+  }
+
+  // step 2
+  step2[2] = hbd_mul_round(hbd_sub(step1[5], step1[2]), cospi_16_64);
+  step2[3] = hbd_mul_round(hbd_sub(step1[4], step1[3]), cospi_16_64);
+  step2[4] = hbd_mul_round(hbd_add(step1[4], step1[3]), cospi_16_64);
+  step2[5] = hbd_mul_round(hbd_add(step1[5], step1[2]), cospi_16_64);
+
+  // step 3
+  step3[0] = hbd_add(step1[0], step2[3]);
+  step3[1] = hbd_add(step1[1], step2[2]);
+  step3[2] = hbd_sub(step1[1], step2[2]);
+  step3[3] = hbd_sub(step1[0], step2[3]);
+  step3[4] = hbd_sub(step1[7], step2[4]);
+  step3[5] = hbd_sub(step1[6], step2[5]);
+  step3[6] = hbd_add(step1[6], step2[5]);
+  step3[7] = hbd_add(step1[7], step2[4]);
+
+  // step 4
+  step2[1] = hbd_btf(step3[1], -cospi_8_64, step3[6], cospi_24_64);
+  step2[2] = hbd_btf(step3[2], cospi_24_64, step3[5], cospi_8_64);
+  step2[5] = hbd_btf(step3[2], cospi_8_64, step3[5], -cospi_24_64);
+  step2[6] = hbd_btf(step3[1], cospi_24_64, step3[6], cospi_8_64);
+
+  // step 5
+  step1[0] = hbd_add(step3[0], step2[1]);
+  step1[1] = hbd_sub(step3[0], step2[1]);
+  step1[2] = hbd_add(step3[3], step2[2]);
+  step1[3] = hbd_sub(step3[3], step2[2]);
+  step1[4] = hbd_sub(step3[4], step2[5]);
+  step1[5] = hbd_add(step3[4], step2[5]);
+  step1[6] = hbd_sub(step3[7], step2[6]);
+  step1[7] = hbd_add(step3[7], step2[6]);
+
+  // step 6
+  out[1] = hbd_btf(step1[0], cospi_30_64, step1[7], cospi_2_64);
+  out[9] = hbd_btf(step1[1], cospi_14_64, step1[6], cospi_18_64);
+  out[5] = hbd_btf(step1[2], cospi_22_64, step1[5], cospi_10_64);
+  out[13] = hbd_btf(step1[3], cospi_6_64, step1[4], cospi_26_64);
+  out[3] = hbd_btf(step1[3], -cospi_26_64, step1[4], cospi_6_64);
+  out[11] = hbd_btf(step1[2], -cospi_10_64, step1[5], cospi_22_64);
+  out[7] = hbd_btf(step1[1], -cospi_18_64, step1[6], cospi_14_64);
+  out[15] = hbd_btf(step1[0], -cospi_2_64, step1[7], cospi_30_64);
+
+  memcpy(in, out, sizeof(out));
+}
+
+static INLINE void hbd_fadst16(hbd_vec *in) {
+  hbd_wide s[16];
+  hbd_vec x[16];
+  int i;
+
+  // stage 1
+  s[0] = hbd_wmadd(in[15], cospi_1_64, in[0], cospi_31_64);
+  s[1] = hbd_wmadd(in[15], cospi_31_64, in[0], -cospi_1_64);
+  s[2] = hbd_wmadd(in[13], cospi_5_64, in[2], cospi_27_64);
+  s[3] = hbd_wmadd(in[13], cospi_27_64, in[2], -cospi_5_64);
+  s[4] = hbd_wmadd(in[11], cospi_9_64, in[4], cospi_23_64);
+  s[5] = hbd_wmadd(in[11], cospi_23_64, in[4], -cospi_9_64);
+  s[6] = hbd_wmadd(in[9], cospi_13_64, in[6], cospi_19_64);
+  s[7] = hbd_wmadd(in[9], cospi_19_64, in[6], -cospi_13_64);
+  s[8] = hbd_wmadd(in[7], cospi_17_64, in[8], cospi_15_64);
+  s[9] = hbd_wmadd(in[7], cospi_15_64, in[8], -cospi_17_64);
+  s[10] = hbd_wmadd(in[5], cospi_21_64, in[10], cospi_11_64);
+  s[11] = hbd_wmadd(in[5], cospi_11_64, in[10], -cospi_21_64);
+  s[12] = hbd_wmadd(in[3], cospi_25_64, in[12], cospi_7_64);
+  s[13] = hbd_wmadd(in[3], cospi_7_64, in[12], -cospi_25_64);
+  s[14] = hbd_wmadd(in[1], cospi_29_64, in[14], cospi_3_64);
+  s[15] = hbd_wmadd(in[1], cospi_3_64, in[14], -cospi_29_64);
+
+  for (i = 0; i < 8; ++i) {
+    x[i] = hbd_wround(hbd_wadd(s[i], s[i + 8]));
+    x[i + 8] = hbd_wround(hbd_wsub(s[i], s[i + 8]));
+  }
+
+  // stage 2
+  s[8] = hbd_wmadd(x[8], cospi_4_64, x[9], cospi_28_64);
+  s[9] = hbd_wmadd(x[8], cospi_28_64, x[9], -cospi_4_64);
+  s[10] = hbd_wmadd(x[10], cospi_20_64, x[11], cospi_12_64);
+  s[11] = hbd_wmadd(x[10], cospi_12_64, x[11], -cospi_20_64);
+  s[12] = hbd_wmadd(x[12], -cospi_28_64, x[13], cospi_4_64);
+  s[13] = hbd_wmadd(x[12], cospi_4_64, x[13], cospi_28_64);
+  s[14] = hbd_wmadd(x[14], -cospi_12_64, x[15], cospi_20_64);
+  s[15] = hbd_wmadd(x[14], cospi_20_64, x[15], cospi_12_64);
+
+  for (i = 0; i < 4; ++i) {
+    const hbd_vec a = x[i];
+    const hbd_vec b = x[i + 4];
+    x[i] = hbd_add(a, b);
+    x[i + 4] = hbd_sub(a, b);
+    x[i + 8] = hbd_wround(hbd_wadd(s[i + 8], s[i + 12]));
+    x[i + 12] = hbd_wround(hbd_wsub(s[i + 8], s[i + 12]));
+  }
+
+  // stage 3
+  s[4] = hbd_wmadd(x[4], cospi_8_64, x[5], cospi_24_64);
+  s[5] = hbd_wmadd(x[4], cospi_24_64, x[5], -cospi_8_64);
+  s[6] = hbd_wmadd(x[6], -cospi_24_64, x[7], cospi_8_64);
+  s[7] = hbd_wmadd(x[6], cospi_8_64, x[7], cospi_24_64);
+  s[12] = hbd_wmadd(x[12], cospi_8_64, x[13], cospi_24_64);
+  s[13] = hbd_wmadd(x[12], cospi_24_64, x[13], -cospi_8_64);
+  s[14] = hbd_wmadd(x[14], -cospi_24_64, x[15], cospi_8_64);
+  s[15] = hbd_wmadd(x[14], cospi_8_64, x[15], cospi_24_64);
+
+  for (i = 0; i < 16; i += 8) {
+    const hbd_vec a0 = x[i + 0];
+    const hbd_vec a1 = x[i + 1];
+    x[i + 0] = hbd_add(a0, x[i + 2]);
+    x[i + 1] = hbd_add(a1, x[i + 3]);
+    x[i + 2] = hbd_sub(a0, x[i + 2]);
+    x[i + 3] = hbd_sub(a1, x[i + 3]);
+    x[i + 4] = hbd_wround(hbd_wadd(s[i + 4], s[i + 6]));
+    x[i + 5] = hbd_wround(hbd_wadd(s[i + 5], s[i + 7]));
+    x[i + 6] = hbd_wround(hbd_wsub(s[i + 4], s[i + 6]));
+    x[i + 7] = hbd_wround(hbd_wsub(s[i + 5], s[i + 7]));
+  }
+
+  // stage 4
+  in[0] = x[0];
+  in[1] = hbd_neg(x[8]);
+  in[2] = x[12];
+  in[3] = hbd_neg(x[4]);
+  in[4] = hbd_mul_round(hbd_add(x[6], x[7]), cospi_16_64);
+  in[5] = hbd_mul_round(hbd_add(x[14], x[15]), -cospi_16_64);
+  in[6] = hbd_mul_round(hbd_add(x[10], x[11]), cospi_16_64);
+  in[7] = hbd_mul_round(hbd_add(x[2], x[3]), -cospi_16_64);
+  in[8] = hbd_mul_round(hbd_sub(x[2], x[3]), cospi_16_64);
+  in[9] = hbd_mul_round(hbd_sub(x[11], x[10]), cospi_16_64);
+  in[10] = hbd_mul_round(hbd_sub(x[14], x[15]), cospi_16_64);
+  in[11] = hbd_mul_round(hbd_sub(x[7], x[6]), cospi_16_64);
+  in[12] = x[5];
+  in[13] = hbd_neg(x[13]);
+  in[14] = x[9];
+  in[15] = hbd_neg(x[1]);
+}
+
+// Loads an n x n block of residuals scaled by 1 << shift.
+static INLINE void hbd_load_buffer(const int16_t *input, int stride,
+                                   hbd_vec *in, int n, int shift) {
+  int g, r;
+  for (g = 0; g < n / HBD_LANES; ++g) {
+    for (r = 0; r < n; ++r) {
+      in[g * n + r] =
+          hbd_slli(hbd_load(input + r * stride + g * HBD_LANES), shift);
+    }
+  }
+}
+
+static INLINE void hbd_write_buffer(const hbd_vec *in, tran_low_t *output,
+                                    int n) {
+  int g, r;
+  for (g = 0; g < n / HBD_LANES; ++g) {
+    for (r = 0; r < n; ++r) {
+      hbd_store(output + r * n + g * HBD_LANES, in[g * n + r]);
+    }
+  }
+}
+
+static INLINE void hbd_transpose(hbd_vec *in, int n) {
+  hbd_vec out[16 * 16 / HBD_LANES];
+  const int groups = n / HBD_LANES;
+  int rg, cg;
+  for (rg = 0; rg < groups; ++rg) {
+    for (cg = 0; cg < groups; ++cg) {
+      hbd_transpose_block(in + cg * n + rg * HBD_LANES,
+                          out + rg * n + cg * HBD_LANES);
+    }
+  }
+  memcpy(in, out, n * groups * sizeof(*in));
+}
+
+// Runs |fn| down every column of the block, then transposes it so that the
+// next pass works along the rows.
+static INLINE void hbd_fht_pass(hbd_vec *in, int n, hbd_fht_1d fn) {
+  int g;
+  for (g = 0; g < n / HBD_LANES; ++g) fn(in + g * n);
+  hbd_transpose(in, n);
+}
+
+// (x + 1) >> 2
+static INLINE void hbd_round_shift_4(hbd_vec *in, int count) {
+  const hbd_vec one = hbd_set1(1);
+  int i;
+  for (i = 0; i < count; ++i) in[i] = hbd_srai(hbd_add(in[i], one), 2);
+}
+
+// (x + (x < 0)) >> 1
+static INLINE void hbd_round_shift_8(hbd_vec *in, int count) {
+  int i;
+  for (i = 0; i < count; ++i) {
+    in[i] = hbd_srai(hbd_sub(in[i], hbd_srai(in[i], 31)), 1);
+  }
+}
+
+// (x + 1 + (x < 0)) >> 2
+static INLINE void hbd_round_shift_16(hbd_vec *in, int count) {
+  const hbd_vec one = hbd_set1(1);
+  int i;
+  for (i = 0; i < count; ++i) {
+    const hbd_vec sign = hbd_srai(in[i], 31);
+    in[i] = hbd_srai(hbd_sub(hbd_add(in[i], one), sign), 2);
+  }
+}
+
+static INLINE hbd_fht_1d hbd_fht4_1d(int adst) {
+  return adst ? hbd_fadst4 : hbd_fdct4;
+}
+
+static INLINE hbd_fht_1d hbd_fht8_1d(int adst) {
+  return adst ? hbd_fadst8 : hbd_fdct8;
+}
+
+static INLINE hbd_fht_1d hbd_fht16_1d(int adst) {
+  return adst ? hbd_fadst16 : hbd_fdct16;
+}
+
+// The ADST/DCT split of each tx_type, see FHT_4 etc. in vp9_dct.c.
+static INLINE int hbd_col_is_adst(int tx_type) {
+  return tx_type == ADST_DCT || tx_type == ADST_ADST;
+}
+
+static INLINE int hbd_row_is_adst(int tx_type) {
+  return tx_type == DCT_ADST || tx_type == ADST_ADST;
+}
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX2
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_dsp/txfm_common.h"
+#include "vpx_ports/mem.h"
+
+#define HBD_LANES 8
+
+typedef __m256i hbd_vec;
+
+// 64-bit products of the even and odd int32 lanes.
+typedef struct {
+  __m256i even, odd;
+} hbd_wide;
+
+static INLINE __m256i hbd_set1(int a) { return _mm256_set1_epi32(a); }
+
+static INLINE __m256i hbd_add(__m256i a, __m256i b) {
+  return _mm256_add_epi32(a, b);
+}
+
+static INLINE __m256i hbd_sub(__m256i a, __m256i b) {
+  return _mm256_sub_epi32(a, b);
+}
+
+static INLINE __m256i hbd_slli(__m256i a, int bits) {
+  return _mm256_slli_epi32(a, bits);
+}
+
+static INLINE __m256i hbd_srai(__m256i a, int bits) {
+  return _mm256_srai_epi32(a, bits);
+}
+
+static INLINE hbd_wide hbd_wmul(__m256i a, int c) {
+  const __m256i k = _mm256_set1_epi32(c);
+  hbd_wide r;
+  r.even = _mm256_mul_epi32(a, k);
+  r.odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), k);
+  return r;
+}
+
+static INLINE hbd_wide hbd_wadd(hbd_wide a, hbd_wide b) {
+  hbd_wide r;
+  r.even = _mm256_add_epi64(a.even, b.even);
+  r.odd = _mm256_add_epi64(a.odd, b.odd);
+  return r;
+}
+
+static INLINE hbd_wide hbd_wsub(hbd_wide a, hbd_wide b) {
+  hbd_wide r;
+  r.even = _mm256_sub_epi64(a.even, b.even);
+  r.odd = _mm256_sub_epi64(a.odd, b.odd);
+  return r;
+}
+
+// Only the low 32 bits of each rounded product are kept, so a logical shift
+// gives the same result as the arithmetic shift in fdct_round_shift().
+static INLINE __m256i hbd_wround(hbd_wide a) {
+  const __m256i rounding = _mm256_set1_epi64x(DCT_CONST_ROUNDING);
+  const __m256i even =
+      _mm256_srli_epi64(_mm256_add_epi64(a.even, rounding), DCT_CONST_BITS);
+  const __m256i odd =
+      _mm256_slli_epi64(_mm256_add_epi64(a.odd, rounding), 32 - DCT_CONST_BITS);
+  return _mm256_blend_epi32(even, odd, 0xaa);
+}
+
+static INLINE __m256i hbd_load(const int16_t *src) {
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)src));
+}
+
+static INLINE void hbd_store(tran_low_t *dst, __m256i a) {
+  _mm256_storeu_si256((__m256i *)dst, a);
+}
+
+// Transposes the 8x8 block in[0], in[1], ... into out[0], out[1], ...
+static INLINE void hbd_transpose_block(const __m256i *in, __m256i *out) {
+  __m256i a[8], b[8];
+  int i;
+  for (i = 0; i < 8; i += 4) {
+    a[i + 0] = _mm256_unpacklo_epi32(in[i / 2 + 0], in[i / 2 + 1]);
+    a[i + 1] = _mm256_unpackhi_epi32(in[i / 2 + 0], in[i / 2 + 1]);
+    a[i + 2] = _mm256_unpacklo_epi32(in[i / 2 + 4], in[i / 2 + 5]);
+    a[i + 3] = _mm256_unpackhi_epi32(in[i / 2 + 4], in[i / 2 + 5]);
+  }
+  // a[0..3]: rows 0,1 and 4,5; a[4..7]: rows 2,3 and 6,7.
+  b[0] = _mm256_unpacklo_epi64(a[0], a[4]);
+  b[1] = _mm256_unpackhi_epi64(a[0], a[4]);
+  b[2] = _mm256_unpacklo_epi64(a[1], a[5]);
+  b[3] = _mm256_unpackhi_epi64(a[1], a[5]);
+  b[4] = _mm256_unpacklo_epi64(a[2], a[6]);
+  b[5] = _mm256_unpackhi_epi64(a[2], a[6]);
+  b[6] = _mm256_unpacklo_epi64(a[3], a[7]);
+  b[7] = _mm256_unpackhi_epi64(a[3], a[7]);
+  // b[0..3] hold columns 0-3 (low lane) and 4-7 (high lane) of rows 0-3,
+  // b[4..7] the same for rows 4-7.
+  for (i = 0; i < 4; ++i) {
+    out[i] = _mm256_permute2x128_si256(b[i], b[i + 4], 0x20);
+    out[i + 4] = _mm256_permute2x128_si256(b[i], b[i + 4], 0x31);
+  }
+}
+
+#include "vp9/encoder/x86/vp9_highbd_dct_impl.h"
+
+void vp9_highbd_fht8x8_avx2(const int16_t *input, tran_low_t *output,
+                            int stride, int tx_type) {
+  if (tx_type == DCT_DCT) {
+    vpx_highbd_fdct8x8_sse2(input, output, stride);
+  } else {
+    __m256i in[8];
+    assert(tx_type == ADST_DCT || tx_type == DCT_ADST ||
+           tx_type == ADST_ADST);
+    hbd_load_buffer(input, stride, in, 8, 2);
+    hbd_fht_pass(in, 8, hbd_fht8_1d(hbd_col_is_adst(tx_type)));
+    hbd_fht_pass(in, 8, hbd_fht8_1d(hbd_row_is_adst(tx_type)));
+    hbd_round_shift_8(in, 8);
+    hbd_write_buffer(in, output, 8);
+  }
+}
+
+void vp9_highbd_fht16x16_avx2(const int16_t *input, tran_low_t *output,
+                              int stride, int tx_type) {
+  if (tx_type == DCT_DCT) {
+    vpx_highbd_fdct16x16_sse2(input, output, stride);
+  } else {
+    __m256i in[32];
+    assert(tx_type == ADST_DCT || tx_type == DCT_ADST ||
+           tx_type == ADST_ADST);
+    hbd_load_buffer(input, stride, in, 16, 2);
+    hbd_fht_pass(in, 16, hbd_fht16_1d(hbd_col_is_adst(tx_type)));
+    hbd_round_shift_16(in, 32);
+    hbd_fht_pass(in, 16, hbd_fht16_1d(hbd_row_is_adst(tx_type)));
+    hbd_write_buffer(in, output, 16);
+  }
+}
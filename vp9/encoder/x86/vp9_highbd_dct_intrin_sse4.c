@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <smmintrin.h>  // SSE4.1
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_dsp/txfm_common.h"
+#include "vpx_ports/mem.h"
+
+#define HBD_LANES 4
+
+typedef __m128i hbd_vec;
+
+// 64-bit products of the even and odd int32 lanes.
+typedef struct {
+  __m128i even, odd;
+} hbd_wide;
+
+static INLINE __m128i hbd_set1(int a) { return _mm_set1_epi32(a); }
+
+static INLINE __m128i hbd_add(__m128i a, __m128i b) {
+  return _mm_add_epi32(a, b);
+}
+
+static INLINE __m128i hbd_sub(__m128i a, __m128i b) {
+  return _mm_sub_epi32(a, b);
+}
+
+static INLINE __m128i hbd_slli(__m128i a, int bits) {
+  return _mm_slli_epi32(a, bits);
+}
+
+static INLINE __m128i hbd_srai(__m128i a, int bits) {
+  return _mm_srai_epi32(a, bits);
+}
+
+static INLINE hbd_wide hbd_wmul(__m128i a, int c) {
+  const __m128i k = _mm_set1_epi32(c);
+  hbd_wide r;
+  r.even = _mm_mul_epi32(a, k);
+  r.odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), k);
+  return r;
+}
+
+static INLINE hbd_wide hbd_wadd(hbd_wide a, hbd_wide b) {
+  hbd_wide r;
+  r.even = _mm_add_epi64(a.even, b.even);
+  r.odd = _mm_add_epi64(a.odd, b.odd);
+  return r;
+}
+
+static INLINE hbd_wide hbd_wsub(hbd_wide a, hbd_wide b) {
+  hbd_wide r;
+  r.even = _mm_sub_epi64(a.even, b.even);
+  r.odd = _mm_sub_epi64(a.odd, b.odd);
+  return r;
+}
+
+// Only the low 32 bits of each rounded product are kept, so a logical shift
+// gives the same result as the arithmetic shift in fdct_round_shift().
+static INLINE __m128i hbd_wround(hbd_wide a) {
+  const __m128i rounding = _mm_set1_epi64x(DCT_CONST_ROUNDING);
+  const __m128i even =
+      _mm_srli_epi64(_mm_add_epi64(a.even, rounding), DCT_CONST_BITS);
+  const __m128i odd =
+      _mm_slli_epi64(_mm_add_epi64(a.odd, rounding), 32 - DCT_CONST_BITS);
+  return _mm_blend_epi16(even, odd, 0xcc);
+}
+
+static INLINE __m128i hbd_load(const int16_t *src) {
+  return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static INLINE void hbd_store(tran_low_t *dst, __m128i a) {
+  _mm_storeu_si128((__m128i *)dst, a);
+}
+
+// Transposes the 4x4 block in[0], in[1], ... into out[0], out[1], ...
+static INLINE void hbd_transpose_block(const __m128i *in, __m128i *out) {
+  const __m128i a0 = _mm_unpacklo_epi32(in[0], in[1]);
+  const __m128i a1 = _mm_unpacklo_epi32(in[2], in[3]);
+  const __m128i a2 = _mm_unpackhi_epi32(in[0], in[1]);
+  const __m128i a3 = _mm_unpackhi_epi32(in[2], in[3]);
+  out[0] = _mm_unpacklo_epi64(a0, a1);
+  out[1] = _mm_unpackhi_epi64(a0, a1);
+  out[2] = _mm_unpacklo_epi64(a2, a3);
+  out[3] = _mm_unpackhi_epi64(a2, a3);
+}
+
+#include "vp9/encoder/x86/vp9_highbd_dct_impl.h"
+
+void vp9_highbd_fht4x4_sse4_1(const int16_t *input, tran_low_t *output,
+                              int stride, int tx_type) {
+  if (tx_type == DCT_DCT) {
+    vpx_highbd_fdct4x4_sse2(input, output, stride);
+  } else {
+    __m128i in[4];
+    assert(tx_type == ADST_DCT || tx_type == DCT_ADST ||
+           tx_type == ADST_ADST);
+    hbd_load_buffer(input, stride, in, 4, 4);
+    // if (i == 0 && temp_in[0]) temp_in[0] += 1;
+    {
+      const __m128i nonzero_dc =
+          _mm_andnot_si128(_mm_cmpeq_epi32(in[0], _mm_setzero_si128()),
+                           _mm_setr_epi32(1, 0, 0, 0));
+      in[0] = _mm_add_epi32(in[0], nonzero_dc);
+    }
+    hbd_fht_pass(in, 4, hbd_fht4_1d(hbd_col_is_adst(tx_type)));
+    hbd_fht_pass(in, 4, hbd_fht4_1d(hbd_row_is_adst(tx_type)));
+    hbd_round_shift_4(in, 4);
+    hbd_write_buffer(in, output, 4);
+  }
+}
+
+void vp9_highbd_fht8x8_sse4_1(const int16_t *input, tran_low_t *output,
+                              int stride, int tx_type) {
+  if (tx_type == DCT_DCT) {
+    vpx_highbd_fdct8x8_sse2(input, output, stride);
+  } else {
+    __m128i in[16];
+    assert(tx_type == ADST_DCT || tx_type == DCT_ADST ||
+           tx_type == ADST_ADST);
+    hbd_load_buffer(input, stride, in, 8, 2);
+    hbd_fht_pass(in, 8, hbd_fht8_1d(hbd_col_is_adst(tx_type)));
+    hbd_fht_pass(in, 8, hbd_fht8_1d(hbd_row_is_adst(tx_type)));
+    hbd_round_shift_8(in, 16);
+    hbd_write_buffer(in, output, 8);
+  }
+}
+
+void vp9_highbd_fht16x16_sse4_1(const int16_t *input, tran_low_t *output,
+                                int stride, int tx_type) {
+  if (tx_type == DCT_DCT) {
+    vpx_highbd_fdct16x16_sse2(input, output, stride);
+  } else {
+    __m128i in[64];
+    assert(tx_type == ADST_DCT || tx_type == DCT_ADST ||
+           tx_type == ADST_ADST);
+    hbd_load_buffer(input, stride, in, 16, 2);
+    hbd_fht_pass(in, 16, hbd_fht16_1d(hbd_col_is_adst(tx_type)));
+    hbd_round_shift_16(in, 64);
+    hbd_fht_pass(in, 16, hbd_fht16_1d(hbd_row_is_adst(tx_type)));
+    hbd_write_buffer(in, output, 16);
+  }
+}
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX512
+
+#include "./vp9_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_dsp/vpx_dsp_common.h"
+#include "vpx_dsp/x86/bitdepth_conversion_avx512.h"
+#include "vp9/common/vp9_scan.h"
+#include "vp9/encoder/vp9_block.h"
+
+// Spreads the DC and AC values of an 8 entry table so that the first lane
+// holds the DC value and every other lane the AC value.
+static VPX_FORCE_INLINE __m512i load_dc_ac_avx512(const int16_t *ptr) {
+  const __m512i idx = _mm512_set_epi64(1, 1, 1, 1, 1, 1, 1, 0);
+  return _mm512_permutexvar_epi64(
+      idx, _mm512_castsi128_si512(_mm_load_si128((const __m128i *)ptr)));
+}
+
+static VPX_FORCE_INLINE void store_dqcoeff_avx512(__m512i qcoeff,
+                                                  __m512i dequant,
+                                                  tran_low_t *dqcoeff_ptr) {
+#if CONFIG_VP9_HIGHBITDEPTH
+  const __m512i q_lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(qcoeff));
+  const __m512i q_hi =
+      _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(qcoeff, 1));
+  const __m512i d_lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(dequant));
+  const __m512i d_hi =
+      _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(dequant, 1));
+  _mm512_storeu_si512((__m512i *)dqcoeff_ptr, _mm512_mullo_epi32(q_lo, d_lo));
+  _mm512_storeu_si512((__m512i *)(dqcoeff_ptr + 16),
+                      _mm512_mullo_epi32(q_hi, d_hi));
+#else
+  _mm512_storeu_si512((__m512i *)dqcoeff_ptr,
+                      _mm512_mullo_epi16(qcoeff, dequant));
+#endif
+}
+
+// Quantizes 32 coefficients. As in the AVX2 version, each group of 16
+// coefficients whose magnitudes are all at most 'thr' is set to zero.
+static VPX_FORCE_INLINE __m512i quantize_fp_32(
+    __m512i round, __m512i quant, __m512i dequant, __m512i thr,
+    const tran_low_t *coeff_ptr, const int16_t *iscan_ptr,
+    tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr, __m512i eob_max) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i coeff = load_tran_low(coeff_ptr);
+  const __m512i abs_coeff = _mm512_abs_epi16(coeff);
+  const __mmask32 nzflag = _mm512_cmpgt_epi16_mask(abs_coeff, thr);
+  const __mmask32 keep = ((nzflag & 0xffffu) ? 0xffffu : 0) |
+                         ((nzflag & 0xffff0000u) ? 0xffff0000u : 0);
+
+  if (keep == 0) {
+    store_zero_tran_low(qcoeff_ptr);
+    store_zero_tran_low(dqcoeff_ptr);
+    return eob_max;
+  }
+  {
+    const __m512i tmp_rnd = _mm512_adds_epi16(abs_coeff, round);
+    const __m512i abs_qcoeff =
+        _mm512_maskz_mulhi_epi16(keep, tmp_rnd, quant);
+    const __mmask32 neg_mask = _mm512_movepi16_mask(coeff);
+    const __m512i qcoeff =
+        _mm512_mask_sub_epi16(abs_qcoeff, neg_mask, zero, abs_qcoeff);
+    const __mmask32 nz_mask = _mm512_cmpgt_epi16_mask(abs_qcoeff, zero);
+    const __m512i iscan = _mm512_loadu_si512((const __m512i *)iscan_ptr);
+
+    store_tran_low(qcoeff, qcoeff_ptr);
+    store_dqcoeff_avx512(qcoeff, dequant, dqcoeff_ptr);
+    return _mm512_mask_max_epi16(eob_max, nz_mask, eob_max, iscan);
+  }
+}
+
+static VPX_FORCE_INLINE uint16_t get_max_eob(__m512i eob512) {
+  const __m256i eob256 = _mm256_max_epi16(_mm512_castsi512_si256(eob512),
+                                          _mm512_extracti64x4_epi64(eob512, 1));
+  return (uint16_t)_mm512_reduce_max_epi32(_mm512_cvtepi16_epi32(eob256));
+}
+
+void vp9_quantize_fp_avx512(const tran_low_t *coeff_ptr, intptr_t n_coeffs,
+                            const struct macroblock_plane *const mb_plane,
+                            tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr,
+                            const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                            const struct ScanOrder *const scan_order) {
+  __m512i round, quant, dequant, thr;
+  __m512i eob_max = _mm512_setzero_si512();
+  const int16_t *iscan = scan_order->iscan;
+  intptr_t i;
+
+  // A 4x4 block does not fill a register.
+  if (n_coeffs < 32) {
+    vp9_quantize_fp_avx2(coeff_ptr, n_coeffs, mb_plane, qcoeff_ptr,
+                         dqcoeff_ptr, dequant_ptr, eob_ptr, scan_order);
+    return;
+  }
+  assert(n_coeffs % 32 == 0);
+
+  round = load_dc_ac_avx512(mb_plane->round_fp);
+  quant = load_dc_ac_avx512(mb_plane->quant_fp);
+  dequant = load_dc_ac_avx512(dequant_ptr);
+
+  // The first 16 coefficients are only skipped when they are all zero.
+  thr = _mm512_maskz_srai_epi16(0xffff0000u, dequant, 1);
+
+  eob_max = quantize_fp_32(round, quant, dequant, thr, coeff_ptr, iscan,
+                           qcoeff_ptr, dqcoeff_ptr, eob_max);
+
+  // remove dc constants
+  round = _mm512_unpackhi_epi64(round, round);
+  quant = _mm512_unpackhi_epi64(quant, quant);
+  dequant = _mm512_unpackhi_epi64(dequant, dequant);
+  thr = _mm512_srai_epi16(dequant, 1);
+
+  // AC only loop
+  for (i = 32; i < n_coeffs; i += 32) {
+    eob_max = quantize_fp_32(round, quant, dequant, thr, coeff_ptr + i,
+                             iscan + i, qcoeff_ptr + i, dqcoeff_ptr + i,
+                             eob_max);
+  }
+
+  *eob_ptr = get_max_eob(eob_max);
+}
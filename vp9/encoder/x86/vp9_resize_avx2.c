@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2024 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  // AVX2
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+
+// Pair up the 8 taps so that each 32-bit value holds taps 2 * k and 2 * k + 1.
+static INLINE void get_filter_pairs_avx2(const int16_t *const filter,
+                                         __m256i *const f) {
+  int k;
+  for (k = 0; k < 4; ++k) {
+    f[k] = _mm256_set1_epi32(
+        (int)((uint16_t)filter[2 * k] |
+              ((uint32_t)(uint16_t)filter[2 * k + 1] << 16)));
+  }
+}
+
+static INLINE __m256i round_shift_avx2(const __m256i s) {
+  const __m256i rounding = _mm256_set1_epi32(1 << 6);
+  return _mm256_srai_epi32(_mm256_add_epi32(s, rounding), 7);
+}
+
+void vp9_resize_vert_8tap_avx2(const uint8_t *const *src,
+                               const int16_t *filter, uint8_t *dst, int w) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i f[4];
+  int x = 0;
+
+  get_filter_pairs_avx2(filter, f);
+
+  for (; x + 32 <= w; x += 32) {
+    __m256i sum[4] = { zero, zero, zero, zero };
+    __m256i lo, hi;
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+      const __m256i a = _mm256_loadu_si256((const __m256i *)(src[2 * k] + x));
+      const __m256i b =
+          _mm256_loadu_si256((const __m256i *)(src[2 * k + 1] + x));
+      const __m256i ab_lo = _mm256_unpacklo_epi8(a, b);
+      const __m256i ab_hi = _mm256_unpackhi_epi8(a, b);
+      sum[0] = _mm256_add_epi32(
+          sum[0], _mm256_madd_epi16(_mm256_unpacklo_epi8(ab_lo, zero), f[k]));
+      sum[1] = _mm256_add_epi32(
+          sum[1], _mm256_madd_epi16(_mm256_unpackhi_epi8(ab_lo, zero), f[k]));
+      sum[2] = _mm256_add_epi32(
+          sum[2], _mm256_madd_epi16(_mm256_unpacklo_epi8(ab_hi, zero), f[k]));
+      sum[3] = _mm256_add_epi32(
+          sum[3], _mm256_madd_epi16(_mm256_unpackhi_epi8(ab_hi, zero), f[k]));
+    }
+    // The unpacks and the packs stay within each lane, so the output is in
+    // order.
+    lo = _mm256_packs_epi32(round_shift_avx2(sum[0]), round_shift_avx2(sum[1]));
+    hi = _mm256_packs_epi32(round_shift_avx2(sum[2]), round_shift_avx2(sum[3]));
+    _mm256_storeu_si256((__m256i *)(dst + x), _mm256_packus_epi16(lo, hi));
+  }
+
+  if (x < w) {
+    const uint8_t *rows[8];
+    int k;
+    for (k = 0; k < 8; ++k) rows[k] = src[k] + x;
+    vp9_resize_vert_8tap_sse2(rows, filter, dst + x, w - x);
+  }
+}
+
+#if CONFIG_VP9_HIGHBITDEPTH
+void vp9_highbd_resize_vert_8tap_avx2(const uint16_t *const *src,
+                                      const int16_t *filter, uint16_t *dst,
+                                      int w, int bd) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i max = _mm256_set1_epi16((1 << bd) - 1);
+  __m256i f[4];
+  int x = 0;
+
+  get_filter_pairs_avx2(filter, f);
+
+  for (; x + 16 <= w; x += 16) {
+    __m256i sum_lo = zero, sum_hi = zero, res;
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+      const __m256i a = _mm256_loadu_si256((const __m256i *)(src[2 * k] + x));
+      const __m256i b =
+          _mm256_loadu_si256((const __m256i *)(src[2 * k + 1] + x));
+      sum_lo = _mm256_add_epi32(
+          sum_lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), f[k]));
+      sum_hi = _mm256_add_epi32(
+          sum_hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), f[k]));
+    }
+    res = _mm256_packs_epi32(round_shift_avx2(sum_lo),
+                             round_shift_avx2(sum_hi));
+    res = _mm256_min_epi16(_mm256_max_epi16(res, zero), max);
+    _mm256_storeu_si256((__m256i *)(dst + x), res);
+  }
+
+  if (x < w) {
+    const uint16_t *rows[8];
+    int k;
+    for (k = 0; k < 8; ++k) rows[k] = src[k] + x;
+    vp9_highbd_resize_vert_8tap_sse2(rows, filter, dst + x, w - x, bd);
+  }
+}
+#endif  // CONFIG_VP9_HIGHBITDEPTH
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2024 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>  // SSE2
+
+#include "./vp9_rtcd.h"
+#include "./vpx_config.h"
+#include "vpx/vpx_integer.h"
+
+// Pair up the 8 taps so that each 32-bit value holds taps 2 * k and 2 * k + 1.
+static INLINE void get_filter_pairs_sse2(const int16_t *const filter,
+                                         __m128i *const f) {
+  int k;
+  for (k = 0; k < 4; ++k) {
+    f[k] = _mm_set1_epi32((int)((uint16_t)filter[2 * k] |
+                                ((uint32_t)(uint16_t)filter[2 * k + 1] << 16)));
+  }
+}
+
+static INLINE __m128i round_shift_sse2(const __m128i s) {
+  const __m128i rounding = _mm_set1_epi32(1 << 6);
+  return _mm_srai_epi32(_mm_add_epi32(s, rounding), 7);
+}
+
+void vp9_resize_vert_8tap_sse2(const uint8_t *const *src,
+                               const int16_t *filter, uint8_t *dst, int w) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i f[4];
+  int x = 0;
+
+  get_filter_pairs_sse2(filter, f);
+
+  for (; x + 16 <= w; x += 16) {
+    __m128i sum[4] = { zero, zero, zero, zero };
+    __m128i lo, hi;
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+      const __m128i a = _mm_loadu_si128((const __m128i *)(src[2 * k] + x));
+      const __m128i b = _mm_loadu_si128((const __m128i *)(src[2 * k + 1] + x));
+      // Interleave the two rows and widen to 16 bits: each 32-bit value holds
+      // one column of rows 2 * k and 2 * k + 1.
+      const __m128i ab_lo = _mm_unpacklo_epi8(a, b);
+      const __m128i ab_hi = _mm_unpackhi_epi8(a, b);
+      sum[0] = _mm_add_epi32(
+          sum[0], _mm_madd_epi16(_mm_unpacklo_epi8(ab_lo, zero), f[k]));
+      sum[1] = _mm_add_epi32(
+          sum[1], _mm_madd_epi16(_mm_unpackhi_epi8(ab_lo, zero), f[k]));
+      sum[2] = _mm_add_epi32(
+          sum[2], _mm_madd_epi16(_mm_unpacklo_epi8(ab_hi, zero), f[k]));
+      sum[3] = _mm_add_epi32(
+          sum[3], _mm_madd_epi16(_mm_unpackhi_epi8(ab_hi, zero), f[k]));
+    }
+    lo = _mm_packs_epi32(round_shift_sse2(sum[0]), round_shift_sse2(sum[1]));
+    hi = _mm_packs_epi32(round_shift_sse2(sum[2]), round_shift_sse2(sum[3]));
+    _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+  }
+
+  if (x < w) {
+    const uint8_t *rows[8];
+    int k;
+    for (k = 0; k < 8; ++k) rows[k] = src[k] + x;
+    vp9_resize_vert_8tap_c(rows, filter, dst + x, w - x);
+  }
+}
+
+#if CONFIG_VP9_HIGHBITDEPTH
+void vp9_highbd_resize_vert_8tap_sse2(const uint16_t *const *src,
+                                      const int16_t *filter, uint16_t *dst,
+                                      int w, int bd) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i max = _mm_set1_epi16((1 << bd) - 1);
+  __m128i f[4];
+  int x = 0;
+
+  get_filter_pairs_sse2(filter, f);
+
+  for (; x + 8 <= w; x += 8) {
+    __m128i sum_lo = zero, sum_hi = zero, res;
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+      const __m128i a = _mm_loadu_si128((const __m128i *)(src[2 * k] + x));
+      const __m128i b = _mm_loadu_si128((const __m128i *)(src[2 * k + 1] + x));
+      sum_lo = _mm_add_epi32(sum_lo,
+                             _mm_madd_epi16(_mm_unpacklo_epi16(a, b), f[k]));
+      sum_hi = _mm_add_epi32(sum_hi,
+                             _mm_madd_epi16(_mm_unpackhi_epi16(a, b), f[k]));
+    }
+    res = _mm_packs_epi32(round_shift_sse2(sum_lo), round_shift_sse2(sum_hi));
+    res = _mm_min_epi16(_mm_max_epi16(res, zero), max);
+    _mm_storeu_si128((__m128i *)(dst + x), res);
+  }
+
+  if (x < w) {
+    const uint16_t *rows[8];
+    int k;
+    for (k = 0; k < 8; ++k) rows[k] = src[k] + x;
+    vp9_highbd_resize_vert_8tap_c(rows, filter, dst + x, w - x, bd);
+  }
+}
+#endif  // CONFIG_VP9_HIGHBITDEPTH
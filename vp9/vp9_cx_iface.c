@@ -19,6 +19,7 @@
 #include "vpx_dsp/psnr.h"
 #include "vpx_ports/static_assert.h"
 #include "vpx_ports/system_state.h"
+#include "vpx_util/vpx_thread.h"
 #include "vpx_util/vpx_timestamp.h"
 #include "vpx/internal/vpx_codec_internal.h"
 #include "./vpx_version.h"
@@ -68,6 +69,8 @@ typedef struct vp9_extracfg {
   unsigned int row_mt;
   unsigned int motion_vector_unit_test;
   int delta_q_uv;
+  int fp_mv_seeds;
+  unsigned int frame_time_budget;
 } vp9_extracfg;
 
 static struct vp9_extracfg default_extra_cfg = {
@@ -107,8 +110,52 @@ static struct vp9_extracfg default_extra_cfg = {
   0,                     // row_mt
   0,                     // motion_vector_unit_test
   0,                     // delta_q_uv
+  0,                     // fp_mv_seeds
+  0,                     // frame_time_budget
 };
 
+// A packet of a GOP encoded in parallel. The frame data is kept at 'offset' in
+// the data of the GopOutput, which may move while the GOP is encoded.
+typedef struct GopPacket {
+  vpx_codec_cx_pkt_t pkt;
+  size_t offset;
+} GopPacket;
+
+typedef struct GopOutput {
+  GopPacket *pkts;
+  int num_pkts;
+  int max_pkts;
+  uint8_t *data;
+  size_t data_sz;
+  size_t max_data_sz;
+} GopOutput;
+
+typedef struct GopFrame {
+  vpx_image_t *img;
+  vpx_codec_pts_t pts;
+  unsigned long duration;
+  vpx_enc_frame_flags_t flags;
+  vpx_enc_deadline_t deadline;
+} GopFrame;
+
+// A closed GOP encoded by an encoder instance of its own on 'worker', see
+// VP9E_SET_GOP_PARALLEL.
+typedef struct GopEncoder {
+  VPxWorker worker;
+  vpx_codec_ctx_t codec;
+  vpx_codec_enc_cfg_t cfg;
+  // First pass stats of the frames of the GOP followed by their total.
+  FIRSTPASS_STATS *stats;
+  GopFrame *frames;
+  int num_frames;
+  // Set from the first frame of the GOP until its packets have been output.
+  int in_use;
+  int launched;
+  vpx_codec_err_t res;
+  char err_detail[80];
+  GopOutput out;
+} GopEncoder;
+
 struct vpx_codec_alg_priv {
   vpx_codec_priv_t base;
   vpx_codec_enc_cfg_t cfg;
@@ -134,6 +181,29 @@ struct vpx_codec_alg_priv {
   BufferPool *buffer_pool;
   vpx_fixed_buf_t global_headers;
   int global_header_subsampling;
+  // Closed GOPs encoded in parallel. GOP i is encoded by
+  // gops[i % gop_parallel], gops is NULL when the mode is not in use.
+  unsigned int gop_parallel;
+  GopEncoder *gops;
+  // Number of frames per GOP and target bandwidth of each GOP.
+  int gop_frames;
+  int64_t *gop_bandwidth;
+  int num_gop_stats_frames;
+  int64_t gop_frames_in;
+  int gop_next_out;
+  // Packets of the GOP returned by encoder_get_cxdata().
+  GopOutput gop_out;
+  char gop_err_detail[80];
+  // Input images lent by the application, see VP9E_SET_ZERO_COPY_INPUT.
+  vpx_zero_copy_input_t zero_copy_input;
+  // Buffers of the application the frames are written into, see
+  // VP9E_SET_OUTPUT_BUFFERS. output_buf is the buffer the next frame packet
+  // is written into, it starts with the pending invisible frames if any.
+  vpx_output_buffers_t output_buffers;
+  vpx_fixed_buf_t output_buf;
+  // Stage times of the GOP encoders that have completed, see
+  // VP9E_SET_COMPONENT_TIMING.
+  vpx_enc_component_timing_t gop_timing;
 };
 
 // Called by encoder_set_config() and encoder_encode() only. Must not be called
@@ -289,6 +359,7 @@ static vpx_codec_err_t validate_config(vpx_codec_alg_priv_t *ctx,
   RANGE_CHECK(cfg, g_input_bit_depth, 8, 12);
   RANGE_CHECK(extra_cfg, content, VP9E_CONTENT_DEFAULT,
               VP9E_CONTENT_INVALID - 1);
+  RANGE_CHECK(extra_cfg, fp_mv_seeds, 0, 1);
 
 #if !CONFIG_REALTIME_ONLY
   if (cfg->g_pass == VPX_RC_LAST_PASS) {
@@ -341,6 +412,14 @@ static vpx_codec_err_t validate_config(vpx_codec_alg_priv_t *ctx,
       if ((int)(stats->count + 0.5) != n_packets - 1)
         ERROR("rc_twopass_stats_in missing EOS stats packet");
     }
+
+    if (extra_cfg->fp_mv_seeds && cfg->rc_firstpass_mb_stats_in.buf != NULL) {
+      int mi_rows, mi_cols, mi_stride, mb_rows, mb_cols, num_mbs;
+      vp9_set_mi_size(&mi_rows, &mi_cols, &mi_stride, cfg->g_w, cfg->g_h);
+      vp9_set_mb_size(&mb_rows, &mb_cols, &num_mbs, mi_rows, mi_cols);
+      if (cfg->rc_firstpass_mb_stats_in.sz % (num_mbs * sizeof(int_mv)))
+        ERROR("rc_firstpass_mb_stats_in.sz indicates truncated packet.");
+    }
   }
 #endif  // !CONFIG_REALTIME_ONLY
 
@@ -644,6 +723,15 @@ static vpx_codec_err_t set_encoder_config(
 
   oxcf->delta_q_uv = extra_cfg->delta_q_uv;
 
+  oxcf->fp_mv_seeds = extra_cfg->fp_mv_seeds && cfg->ss_number_layers <= 1 &&
+                      cfg->ts_number_layers <= 1;
+  oxcf->fp_motion_field_in = cfg->rc_firstpass_mb_stats_in;
+
+  oxcf->frame_time_budget =
+      cfg->ss_number_layers <= 1 && cfg->ts_number_layers <= 1
+          ? extra_cfg->frame_time_budget
+          : 0;
+
   for (sl = 0; sl < oxcf->ss_number_layers; ++sl) {
     for (tl = 0; tl < oxcf->ts_number_layers; ++tl) {
       const int layer = sl * oxcf->ts_number_layers + tl;
@@ -1109,6 +1197,74 @@ static vpx_codec_err_t ctrl_enable_motion_vector_unit_test(
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static vpx_codec_err_t ctrl_set_gop_parallel(vpx_codec_alg_priv_t *ctx,
+                                             va_list args) {
+  if (ctx->pts_offset_initialized || ctx->gops != NULL)
+    ERROR("GOP parallel mode must be set before the first frame");
+  ctx->gop_parallel = CAST(VP9E_SET_GOP_PARALLEL, args);
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_set_zero_copy_input(vpx_codec_alg_priv_t *ctx,
+                                                va_list args) {
+  const vpx_zero_copy_input_t *const data =
+      va_arg(args, vpx_zero_copy_input_t *);
+  if (data == NULL) return VPX_CODEC_INVALID_PARAM;
+  ctx->zero_copy_input = *data;
+  return VPX_CODEC_OK;
+}
+
+static void release_output_buffer(vpx_codec_alg_priv_t *ctx) {
+  if (ctx->output_buf.buf != NULL) {
+    ctx->output_buffers.release_cb(ctx->output_buffers.cb_priv,
+                                   &ctx->output_buf);
+  }
+  ctx->output_buf.buf = NULL;
+  ctx->output_buf.sz = 0;
+}
+
+static vpx_codec_err_t ctrl_set_output_buffers(vpx_codec_alg_priv_t *ctx,
+                                               va_list args) {
+  const vpx_output_buffers_t *const data = va_arg(args, vpx_output_buffers_t *);
+  if (data == NULL || (data->get_cb != NULL && data->release_cb == NULL))
+    return VPX_CODEC_INVALID_PARAM;
+  if (ctx->pending_cx_data != NULL)
+    ERROR("Output buffers cannot be changed while frames are pending");
+  release_output_buffer(ctx);
+  ctx->output_buffers = *data;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_set_component_timing(vpx_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  ctx->cpi->time_stages = CAST(VP9E_SET_COMPONENT_TIMING, args) != 0;
+  vp9_zero(ctx->cpi->stage_timing);
+  vp9_zero(ctx->gop_timing);
+  return VPX_CODEC_OK;
+}
+
+static void add_component_timing(vpx_enc_component_timing_t *sum,
+                                 const vpx_enc_component_timing_t *timing) {
+  sum->frames += timing->frames;
+  sum->total_us += timing->total_us;
+  sum->first_pass_us += timing->first_pass_us;
+  sum->temporal_filter_us += timing->temporal_filter_us;
+  sum->tpl_us += timing->tpl_us;
+  sum->encode_frame_us += timing->encode_frame_us;
+  sum->loop_filter_us += timing->loop_filter_us;
+  sum->pack_bitstream_us += timing->pack_bitstream_us;
+}
+
+static vpx_codec_err_t ctrl_get_component_timing(vpx_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  vpx_enc_component_timing_t *const arg =
+      va_arg(args, vpx_enc_component_timing_t *);
+  if (arg == NULL) return VPX_CODEC_INVALID_PARAM;
+  *arg = ctx->cpi->stage_timing;
+  add_component_timing(arg, &ctx->gop_timing);
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_err_t ctrl_get_level(vpx_codec_alg_priv_t *ctx, va_list args) {
   int *const arg = va_arg(args, int *);
   if (arg == NULL) return VPX_CODEC_INVALID_PARAM;
@@ -1159,7 +1315,351 @@ static vpx_codec_err_t encoder_init(vpx_codec_ctx_t *ctx,
   return res;
 }
 
+#if !CONFIG_REALTIME_ONLY
+static int gop_parallel_supported(const vpx_codec_alg_priv_t *ctx) {
+  const vpx_codec_enc_cfg_t *const cfg = &ctx->cfg;
+  return ctx->gop_parallel > 1 && cfg->g_pass == VPX_RC_LAST_PASS &&
+         cfg->kf_mode == VPX_KF_AUTO && cfg->kf_max_dist > 0 &&
+         cfg->ss_number_layers <= 1 && cfg->ts_number_layers <= 1;
+}
+
+static void free_gop_output(GopOutput *out) {
+  free(out->pkts);
+  free(out->data);
+  memset(out, 0, sizeof(*out));
+}
+
+static void free_gops(vpx_codec_alg_priv_t *ctx) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  unsigned int i;
+  int j;
+
+  if (ctx->gops == NULL) return;
+  for (i = 0; i < ctx->gop_parallel; ++i) {
+    GopEncoder *const gop = &ctx->gops[i];
+    winterface->end(&gop->worker);
+    if (gop->in_use) vpx_codec_destroy(&gop->codec);
+    if (gop->frames != NULL) {
+      for (j = 0; j < ctx->gop_frames; ++j) vpx_img_free(gop->frames[j].img);
+    }
+    free(gop->frames);
+    free(gop->stats);
+    free_gop_output(&gop->out);
+  }
+  free(ctx->gops);
+  ctx->gops = NULL;
+  free(ctx->gop_bandwidth);
+  ctx->gop_bandwidth = NULL;
+  free_gop_output(&ctx->gop_out);
+}
+
+static int add_gop_packet(GopOutput *out, const vpx_codec_cx_pkt_t *pkt) {
+  GopPacket *gop_pkt;
+  if (out->num_pkts == out->max_pkts) {
+    const int max_pkts = VPXMAX(2 * out->max_pkts, 64);
+    GopPacket *const pkts =
+        (GopPacket *)realloc(out->pkts, max_pkts * sizeof(*pkts));
+    if (pkts == NULL) return 0;
+    out->pkts = pkts;
+    out->max_pkts = max_pkts;
+  }
+  gop_pkt = &out->pkts[out->num_pkts++];
+  gop_pkt->pkt = *pkt;
+  gop_pkt->offset = 0;
+  if (pkt->kind == VPX_CODEC_CX_FRAME_PKT) {
+    const size_t sz = pkt->data.frame.sz;
+    if (out->data_sz + sz > out->max_data_sz) {
+      const size_t max_data_sz = VPXMAX(2 * out->max_data_sz, out->data_sz + sz);
+      uint8_t *const data = (uint8_t *)realloc(out->data, max_data_sz);
+      if (data == NULL) return 0;
+      out->data = data;
+      out->max_data_sz = max_data_sz;
+    }
+    memcpy(out->data + out->data_sz, pkt->data.frame.buf, sz);
+    gop_pkt->offset = out->data_sz;
+    out->data_sz += sz;
+  }
+  return 1;
+}
+
+// Encodes the frames of the GOP in arg1 (GopEncoder) and flushes the encoder.
+static int gop_worker_hook(void *arg1, void *arg2) {
+  GopEncoder *const gop = (GopEncoder *)arg1;
+  const vpx_enc_deadline_t flush_deadline =
+      gop->frames[gop->num_frames - 1].deadline;
+  int i;
+  (void)arg2;
+
+  for (i = 0; i <= gop->num_frames; ++i) {
+    const GopFrame *const frame = i < gop->num_frames ? &gop->frames[i] : NULL;
+    int got_pkts;
+    do {
+      vpx_codec_iter_t iter = NULL;
+      const vpx_codec_cx_pkt_t *pkt;
+      if (frame != NULL) {
+        gop->res = vpx_codec_encode(&gop->codec, frame->img, frame->pts,
+                                    frame->duration, frame->flags,
+                                    frame->deadline);
+      } else {
+        gop->res = vpx_codec_encode(&gop->codec, NULL, 0, 0, 0, flush_deadline);
+      }
+      if (gop->res != VPX_CODEC_OK) {
+        const char *const detail = vpx_codec_error_detail(&gop->codec);
+        snprintf(gop->err_detail, sizeof(gop->err_detail), "%s",
+                 detail != NULL ? detail : vpx_codec_error(&gop->codec));
+        return 0;
+      }
+      got_pkts = 0;
+      while ((pkt = vpx_codec_get_cx_data(&gop->codec, &iter)) != NULL) {
+        got_pkts = 1;
+        if (pkt->kind != VPX_CODEC_CX_FRAME_PKT &&
+            pkt->kind != VPX_CODEC_PSNR_PKT)
+          continue;
+        if (!add_gop_packet(&gop->out, pkt)) {
+          gop->res = VPX_CODEC_MEM_ERROR;
+          snprintf(gop->err_detail, sizeof(gop->err_detail),
+                   "Failed to allocate GOP packets");
+          return 0;
+        }
+      }
+    } while (frame == NULL && got_pkts);
+  }
+  return 1;
+}
+
+static vpx_codec_err_t alloc_gops(vpx_codec_alg_priv_t *ctx) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  const FIRSTPASS_STATS *const stats =
+      (const FIRSTPASS_STATS *)ctx->cfg.rc_twopass_stats_in.buf;
+  const FRAME_INFO frame_info = vp9_get_frame_info(&ctx->oxcf);
+  int num_gops;
+  unsigned int i;
+
+  ctx->gop_frames = (int)ctx->cfg.kf_max_dist;
+  ctx->num_gop_stats_frames =
+      (int)(ctx->cfg.rc_twopass_stats_in.sz / sizeof(*stats)) - 1;
+  num_gops =
+      (ctx->num_gop_stats_frames + ctx->gop_frames - 1) / ctx->gop_frames;
+  ctx->gop_frames_in = 0;
+  ctx->gop_next_out = 0;
+
+  ctx->gops = (GopEncoder *)calloc(ctx->gop_parallel, sizeof(*ctx->gops));
+  ctx->gop_bandwidth =
+      (int64_t *)malloc(num_gops * sizeof(*ctx->gop_bandwidth));
+  if (ctx->gops == NULL || ctx->gop_bandwidth == NULL) {
+    free_gops(ctx);
+    return VPX_CODEC_MEM_ERROR;
+  }
+  vp9_split_two_pass_bandwidth(&ctx->oxcf, &frame_info, stats,
+                               ctx->num_gop_stats_frames, ctx->gop_frames,
+                               ctx->gop_bandwidth);
+
+  for (i = 0; i < ctx->gop_parallel; ++i) {
+    GopEncoder *const gop = &ctx->gops[i];
+    winterface->init(&gop->worker);
+    gop->worker.hook = gop_worker_hook;
+    gop->worker.data1 = gop;
+    gop->frames = (GopFrame *)calloc(ctx->gop_frames, sizeof(*gop->frames));
+    gop->stats = (FIRSTPASS_STATS *)malloc((ctx->gop_frames + 1) *
+                                           sizeof(*gop->stats));
+    if (gop->frames == NULL || gop->stats == NULL ||
+        !winterface->reset(&gop->worker)) {
+      free_gops(ctx);
+      return VPX_CODEC_MEM_ERROR;
+    }
+  }
+  return VPX_CODEC_OK;
+}
+
+// Sets up gop to encode the GOP with index gop_index.
+static vpx_codec_err_t start_gop(vpx_codec_alg_priv_t *ctx, GopEncoder *gop,
+                                 int gop_index) {
+  const int first = gop_index * ctx->gop_frames;
+  const int count = VPXMIN(ctx->gop_frames, ctx->num_gop_stats_frames - first);
+  const int64_t bitrate = (ctx->gop_bandwidth[gop_index] + 500) / 1000;
+  vpx_codec_err_t res;
+
+  if (count <= 0) ERROR("More frames than in rc_twopass_stats_in");
+
+  vp9_get_first_pass_section(
+      (const FIRSTPASS_STATS *)ctx->cfg.rc_twopass_stats_in.buf, first, count,
+      gop->stats);
+  gop->cfg = ctx->cfg;
+  gop->cfg.rc_twopass_stats_in.buf = gop->stats;
+  gop->cfg.rc_twopass_stats_in.sz = (count + 1) * sizeof(*gop->stats);
+  if (ctx->cfg.rc_firstpass_mb_stats_in.buf != NULL) {
+    // The motion fields of the frames before the GOP are skipped.
+    const size_t frame_sz = ctx->cpi->frame_info.num_mbs * sizeof(int_mv);
+    const size_t offset = VPXMIN(first * frame_sz,
+                                 ctx->cfg.rc_firstpass_mb_stats_in.sz);
+    gop->cfg.rc_firstpass_mb_stats_in.buf =
+        (uint8_t *)ctx->cfg.rc_firstpass_mb_stats_in.buf + offset;
+    gop->cfg.rc_firstpass_mb_stats_in.sz =
+        ctx->cfg.rc_firstpass_mb_stats_in.sz - offset;
+  }
+  gop->cfg.rc_target_bitrate = (unsigned int)VPXMAX(VPXMIN(bitrate, 1000000), 1);
+
+  res = vpx_codec_enc_init(&gop->codec, vpx_codec_vp9_cx(), &gop->cfg,
+                           ctx->base.init_flags);
+  if (res != VPX_CODEC_OK) {
+    ctx->base.err_detail = "Failed to initialize the GOP encoder";
+    return res;
+  }
+  res = update_extra_cfg((vpx_codec_alg_priv_t *)gop->codec.priv,
+                         &ctx->extra_cfg);
+  if (res != VPX_CODEC_OK) {
+    vpx_codec_destroy(&gop->codec);
+    return res;
+  }
+  ((vpx_codec_alg_priv_t *)gop->codec.priv)->cpi->time_stages =
+      ctx->cpi->time_stages;
+  gop->num_frames = 0;
+  gop->launched = 0;
+  gop->res = VPX_CODEC_OK;
+  gop->out.num_pkts = 0;
+  gop->out.data_sz = 0;
+  gop->in_use = 1;
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t add_gop_frame(GopFrame *frame, const vpx_image_t *img) {
+  const int bytes = (img->fmt & VPX_IMG_FMT_HIGHBITDEPTH) ? 2 : 1;
+  const int num_planes = img->fmt == VPX_IMG_FMT_NV12 ? 2 : 3;
+  int plane, row;
+
+  if (frame->img == NULL || frame->img->fmt != img->fmt ||
+      frame->img->d_w != img->d_w || frame->img->d_h != img->d_h) {
+    vpx_img_free(frame->img);
+    frame->img = vpx_img_alloc(NULL, img->fmt, img->d_w, img->d_h, 16);
+    if (frame->img == NULL) return VPX_CODEC_MEM_ERROR;
+  }
+  frame->img->bit_depth = img->bit_depth;
+  frame->img->cs = img->cs;
+  frame->img->range = img->range;
+  frame->img->r_w = img->r_w;
+  frame->img->r_h = img->r_h;
+
+  for (plane = 0; plane < num_planes; ++plane) {
+    const unsigned int x_shift = plane ? img->x_chroma_shift : 0;
+    const unsigned int y_shift = plane ? img->y_chroma_shift : 0;
+    const int w = (int)((img->d_w + x_shift) >> x_shift) *
+                  (img->fmt == VPX_IMG_FMT_NV12 && plane ? 2 : 1);
+    const int h = (int)((img->d_h + y_shift) >> y_shift);
+    for (row = 0; row < h; ++row) {
+      memcpy(frame->img->planes[plane] + row * frame->img->stride[plane],
+             img->planes[plane] + row * img->stride[plane], w * bytes);
+    }
+  }
+  return VPX_CODEC_OK;
+}
+
+// Waits for the next GOP to be encoded and makes its packets the output of
+// encoder_get_cxdata(). gop is free again once this returns.
+static vpx_codec_err_t output_gop(vpx_codec_alg_priv_t *ctx, GopEncoder *gop) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  const GopOutput out = ctx->gop_out;
+  vpx_codec_err_t res = VPX_CODEC_OK;
+  int i;
+
+  assert(gop == &ctx->gops[ctx->gop_next_out % ctx->gop_parallel]);
+  if (!gop->launched) {
+    gop->launched = 1;
+    winterface->launch(&gop->worker);
+  }
+  if (!winterface->sync(&gop->worker)) {
+    memcpy(ctx->gop_err_detail, gop->err_detail, sizeof(ctx->gop_err_detail));
+    ctx->base.err_detail = ctx->gop_err_detail;
+    res = gop->res;
+  }
+  add_component_timing(
+      &ctx->gop_timing,
+      &((vpx_codec_alg_priv_t *)gop->codec.priv)->cpi->stage_timing);
+  vpx_codec_destroy(&gop->codec);
+  gop->in_use = 0;
+  ++ctx->gop_next_out;
+
+  // Swap the buffers so that gop can take the next GOP while the packets are
+  // being returned.
+  ctx->gop_out = gop->out;
+  gop->out = out;
+  for (i = 0; i < ctx->gop_out.num_pkts; ++i) {
+    GopPacket *const gop_pkt = &ctx->gop_out.pkts[i];
+    if (gop_pkt->pkt.kind == VPX_CODEC_CX_FRAME_PKT)
+      gop_pkt->pkt.data.frame.buf = ctx->gop_out.data + gop_pkt->offset;
+  }
+  return res;
+}
+
+static vpx_codec_err_t encode_gops(vpx_codec_alg_priv_t *ctx,
+                                   const vpx_image_t *img, vpx_codec_pts_t pts,
+                                   unsigned long duration,
+                                   vpx_enc_frame_flags_t flags,
+                                   vpx_enc_deadline_t deadline) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  vpx_codec_err_t res = VPX_CODEC_OK;
+
+  ctx->gop_out.num_pkts = 0;
+  ctx->gop_out.data_sz = 0;
+
+  if (img != NULL) {
+    const int gop_index = (int)(ctx->gop_frames_in / ctx->gop_frames);
+    GopEncoder *const gop = &ctx->gops[gop_index % ctx->gop_parallel];
+    GopFrame *frame;
+
+    res = validate_img(ctx, img);
+    if (res != VPX_CODEC_OK) return res;
+
+    if (ctx->gop_frames_in % ctx->gop_frames == 0) {
+      // The GOP that used gop last is the oldest one that has not been
+      // output yet.
+      if (gop->in_use) res = output_gop(ctx, gop);
+      if (res == VPX_CODEC_OK) res = start_gop(ctx, gop, gop_index);
+      if (res != VPX_CODEC_OK) return res;
+    }
+
+    frame = &gop->frames[gop->num_frames];
+    res = add_gop_frame(frame, img);
+    if (res != VPX_CODEC_OK) return res;
+    // The GOP encoders work on copies of the input.
+    if (ctx->zero_copy_input.release_cb != NULL) {
+      ctx->zero_copy_input.release_cb(ctx->zero_copy_input.cb_priv,
+                                      img->user_priv);
+    }
+    frame->pts = pts;
+    frame->duration = duration;
+    frame->flags = flags | ctx->next_frame_flags;
+    frame->deadline = deadline;
+    ctx->next_frame_flags = 0;
+    ++ctx->gop_frames_in;
+
+    if (++gop->num_frames == ctx->gop_frames) {
+      gop->launched = 1;
+      winterface->launch(&gop->worker);
+    }
+  } else {
+    // Flush: output the remaining GOPs one per call.
+    GopEncoder *const gop = &ctx->gops[ctx->gop_next_out % ctx->gop_parallel];
+    if (gop->in_use) res = output_gop(ctx, gop);
+  }
+  return res;
+}
+
+static const vpx_codec_cx_pkt_t *get_gop_cxdata(vpx_codec_alg_priv_t *ctx,
+                                                vpx_codec_iter_t *iter) {
+  const GopPacket *gop_pkt = (const GopPacket *)*iter;
+  if (gop_pkt == NULL) gop_pkt = ctx->gop_out.pkts;
+  if (gop_pkt == NULL || gop_pkt - ctx->gop_out.pkts >= ctx->gop_out.num_pkts)
+    return NULL;
+  *iter = gop_pkt + 1;
+  return &gop_pkt->pkt;
+}
+#endif  // !CONFIG_REALTIME_ONLY
+
 static vpx_codec_err_t encoder_destroy(vpx_codec_alg_priv_t *ctx) {
+#if !CONFIG_REALTIME_ONLY
+  free_gops(ctx);
+#endif
+  release_output_buffer(ctx);
   free(ctx->cx_data);
   free(ctx->global_headers.buf);
   vp9_remove_compressor(ctx->cpi);
@@ -1219,6 +1719,11 @@ static vpx_codec_err_t pick_quickcompress_mode(vpx_codec_alg_priv_t *ctx,
 // Turn on to test if supplemental superframe data breaks decoding
 // #define TEST_SUPPLEMENTAL_SUPERFRAME_DATA
 static int write_superframe_index(vpx_codec_alg_priv_t *ctx) {
+  // The pending frames are either in the output buffer of the application
+  // or at the start of cx_data.
+  const size_t buf_sz = ctx->pending_cx_data == ctx->output_buf.buf
+                            ? ctx->output_buf.sz
+                            : ctx->cx_data_sz;
   uint8_t marker = 0xc0;
   unsigned int mask;
   int mag, index_sz;
@@ -1239,7 +1744,7 @@ static int write_superframe_index(vpx_codec_alg_priv_t *ctx) {
 
   // Write the index
   index_sz = 2 + (mag + 1) * ctx->pending_frame_count;
-  if (ctx->pending_cx_data_sz + index_sz < ctx->cx_data_sz) {
+  if (ctx->pending_cx_data_sz + index_sz < buf_sz) {
     uint8_t *x = ctx->pending_cx_data + ctx->pending_cx_data_sz;
     int i, j;
 #ifdef TEST_SUPPLEMENTAL_SUPERFRAME_DATA
@@ -1315,9 +1820,66 @@ get_first_pass_stats_pkt(FIRSTPASS_STATS *stats) {
   pkt.data.twopass_stats.sz = sizeof(*stats);
   return pkt;
 }
+
+// Like get_first_pass_stats_pkt(), the motion field must not change until the
+// packet is processed.
+static INLINE vpx_codec_cx_pkt_t
+get_first_pass_mb_stats_pkt(const VP9_COMP *cpi) {
+  vpx_codec_cx_pkt_t pkt;
+  pkt.kind = VPX_CODEC_FPMB_STATS_PKT;
+  pkt.data.firstpass_mb_stats.buf = cpi->twopass.fp_motion_field;
+  pkt.data.firstpass_mb_stats.sz =
+      cpi->common.MBs * sizeof(*cpi->twopass.fp_motion_field);
+  return pkt;
+}
 #endif
 
 const size_t kMinCompressedSize = 8192;
+// A marker byte on each end and up to 4 bytes for each of 8 frames.
+static const size_t kMaxSuperframeIndexSize = 2 + 4 * 8;
+
+// Points cx_data to the free part of the output buffer of the application,
+// after the pending invisible frames. A new buffer is obtained if the last
+// one was handed out with a packet. Room is kept at its end for the
+// superframe index, so that it is written in place.
+static void get_output_buffer(vpx_codec_alg_priv_t *ctx,
+                              unsigned char **cx_data, size_t *cx_data_sz) {
+  const size_t min_size = ctx->cx_data_sz + kMaxSuperframeIndexSize;
+  const size_t used = ctx->pending_cx_data ? ctx->pending_cx_data_sz : 0;
+
+  // The frame size may have grown since the buffer was obtained.
+  if (ctx->output_buf.sz < min_size && used == 0) release_output_buffer(ctx);
+  if (ctx->output_buf.buf == NULL) {
+    if (ctx->output_buffers.get_cb(ctx->output_buffers.cb_priv, min_size,
+                                   &ctx->output_buf) != 0 ||
+        ctx->output_buf.buf == NULL) {
+      ctx->output_buf.buf = NULL;
+      ctx->output_buf.sz = 0;
+      vpx_internal_error(&ctx->cpi->common.error, VPX_CODEC_MEM_ERROR,
+                         "Failed to get an output buffer");
+    }
+    if (ctx->output_buf.sz < min_size) {
+      release_output_buffer(ctx);
+      vpx_internal_error(&ctx->cpi->common.error, VPX_CODEC_MEM_ERROR,
+                         "Output buffer too small");
+    }
+  }
+  assert(ctx->pending_cx_data == NULL ||
+         ctx->pending_cx_data == ctx->output_buf.buf);
+  assert(used + kMaxSuperframeIndexSize <= ctx->output_buf.sz);
+  *cx_data = (unsigned char *)ctx->output_buf.buf + used;
+  *cx_data_sz = ctx->output_buf.sz - used - kMaxSuperframeIndexSize;
+}
+
+// Hands the output buffer over to the application with the packet written
+// into it, and gets the buffer of the next packet.
+static void next_output_buffer(vpx_codec_alg_priv_t *ctx,
+                               unsigned char **cx_data, size_t *cx_data_sz) {
+  ctx->output_buf.buf = NULL;
+  ctx->output_buf.sz = 0;
+  get_output_buffer(ctx, cx_data, cx_data_sz);
+}
+
 static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
                                       const vpx_image_t *img,
                                       vpx_codec_pts_t pts_val,
@@ -1335,6 +1897,17 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
 
   if (cpi == NULL) return VPX_CODEC_INVALID_PARAM;
 
+#if !CONFIG_REALTIME_ONLY
+  if (ctx->gops == NULL && img != NULL && !ctx->pts_offset_initialized &&
+      gop_parallel_supported(ctx)) {
+    res = alloc_gops(ctx);
+    if (res != VPX_CODEC_OK) return res;
+  }
+  if (ctx->gops != NULL) {
+    return encode_gops(ctx, img, pts_val, duration, enc_flags, deadline);
+  }
+#endif
+
   cpi->last_coded_width = ctx->oxcf.width;
   cpi->last_coded_height = ctx->oxcf.height;
 
@@ -1404,6 +1977,8 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
   }
 
   if (res == VPX_CODEC_OK) {
+    const int use_output_buffers =
+        ctx->output_buffers.get_cb != NULL && cpi->oxcf.pass != 1;
     unsigned int lib_flags = 0;
     size_t size, cx_data_sz;
     unsigned char *cx_data;
@@ -1456,8 +2031,14 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
 
       // Store the original flags in to the frame buffer. Will extract the
       // key frame flag when we actually encode this frame.
-      if (vp9_receive_raw_frame(cpi, flags | ctx->next_frame_flags, &sd,
-                                dst_time_stamp, dst_end_time_stamp)) {
+      if (ctx->zero_copy_input.release_cb != NULL) {
+        if (vp9_receive_lent_frame(cpi, flags | ctx->next_frame_flags, &sd,
+                                   dst_time_stamp, dst_end_time_stamp,
+                                   &ctx->zero_copy_input, img->user_priv)) {
+          res = update_error_state(ctx, &cpi->common.error);
+        }
+      } else if (vp9_receive_raw_frame(cpi, flags | ctx->next_frame_flags, &sd,
+                                       dst_time_stamp, dst_end_time_stamp)) {
         res = update_error_state(ctx, &cpi->common.error);
       }
       ctx->next_frame_flags = 0;
@@ -1466,8 +2047,12 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
     cx_data = ctx->cx_data;
     cx_data_sz = ctx->cx_data_sz;
 
-    /* Any pending invisible frames? */
-    if (ctx->pending_cx_data) {
+    if (use_output_buffers) {
+      // The frames are written into the buffer of the application, after
+      // the pending invisible frames.
+      if (cx_data != NULL) get_output_buffer(ctx, &cx_data, &cx_data_sz);
+    } else if (ctx->pending_cx_data) {
+      /* Any pending invisible frames? */
       assert(cx_data_sz >= ctx->pending_cx_data_sz);
       memmove(cx_data, ctx->pending_cx_data, ctx->pending_cx_data_sz);
       ctx->pending_cx_data = cx_data;
@@ -1502,6 +2087,10 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
         assert(ret == 0);
         fps_pkt = get_first_pass_stats_pkt(&cpi->twopass.this_frame_stats);
         vpx_codec_pkt_list_add(&ctx->pkt_list.head, &fps_pkt);
+        if (cpi->twopass.fp_motion_field != NULL) {
+          fps_pkt = get_first_pass_mb_stats_pkt(cpi);
+          vpx_codec_pkt_list_add(&ctx->pkt_list.head, &fps_pkt);
+        }
       } else {
         if (!cpi->twopass.first_pass_done) {
           vpx_codec_cx_pkt_t fps_pkt;
@@ -1568,6 +2157,8 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
               ctx->pending_frame_magnitude = 0;
               ctx->output_cx_pkt_cb.output_cx_pkt(
                   &pkt, ctx->output_cx_pkt_cb.user_priv);
+              if (use_output_buffers)
+                next_output_buffer(ctx, &cx_data, &cx_data_sz);
             }
             continue;
           }
@@ -1611,8 +2202,12 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
           else
             vpx_codec_pkt_list_add(&ctx->pkt_list.head, &pkt);
 
-          cx_data += size;
-          cx_data_sz -= size;
+          if (use_output_buffers) {
+            next_output_buffer(ctx, &cx_data, &cx_data_sz);
+          } else {
+            cx_data += size;
+            cx_data_sz -= size;
+          }
           if (is_one_pass_svc(cpi) && (cpi->svc.spatial_layer_id ==
                                        cpi->svc.number_spatial_layers - 1)) {
             // Encoded all spatial layers; exit loop.
@@ -1629,6 +2224,9 @@ static vpx_codec_err_t encoder_encode(vpx_codec_alg_priv_t *ctx,
 
 static const vpx_codec_cx_pkt_t *encoder_get_cxdata(vpx_codec_alg_priv_t *ctx,
                                                     vpx_codec_iter_t *iter) {
+#if !CONFIG_REALTIME_ONLY
+  if (ctx->gops != NULL) return get_gop_cxdata(ctx, iter);
+#endif
   return vpx_codec_pkt_list_get(&ctx->pkt_list.head, iter);
 }
 
@@ -1725,6 +2323,9 @@ static vpx_image_t *encoder_get_preview(vpx_codec_alg_priv_t *ctx) {
   vp9_ppflags_t flags;
   vp9_zero(flags);
 
+  // The frames are reconstructed by the GOP encoders, out of order.
+  if (ctx->gops != NULL) return NULL;
+
   if (ctx->preview_ppcfg.post_proc_flag) {
     flags.post_proc_flag = ctx->preview_ppcfg.post_proc_flag;
     flags.deblocking_level = ctx->preview_ppcfg.deblocking_level;
@@ -1751,6 +2352,23 @@ static vpx_codec_err_t ctrl_set_roi_map(vpx_codec_alg_priv_t *ctx,
   return VPX_CODEC_INVALID_PARAM;
 }
 
+static vpx_codec_err_t ctrl_set_motion_hints(vpx_codec_alg_priv_t *ctx,
+                                             va_list args) {
+  const vpx_motion_hint_map_t *const map =
+      va_arg(args, vpx_motion_hint_map_t *);
+
+  if (map == NULL) return VPX_CODEC_INVALID_PARAM;
+  return vp9_set_motion_hints(ctx->cpi, map);
+}
+
+static vpx_codec_err_t ctrl_set_mode_info(vpx_codec_alg_priv_t *ctx,
+                                          va_list args) {
+  const vpx_mode_info_map_t *const map = va_arg(args, vpx_mode_info_map_t *);
+
+  if (map == NULL) return VPX_CODEC_INVALID_PARAM;
+  return vp9_set_mode_info(ctx->cpi, map);
+}
+
 static vpx_codec_err_t ctrl_set_active_map(vpx_codec_alg_priv_t *ctx,
                                            va_list args) {
   vpx_active_map_t *const map = va_arg(args, vpx_active_map_t *);
@@ -1966,6 +2584,34 @@ static vpx_codec_err_t ctrl_set_delta_q_uv(vpx_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static vpx_codec_err_t ctrl_set_fp_mv_seeds(vpx_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  struct vp9_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.fp_mv_seeds = CAST(VP9E_SET_FP_MV_SEEDS, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static vpx_codec_err_t ctrl_set_frame_time_budget(vpx_codec_alg_priv_t *ctx,
+                                                  va_list args) {
+  struct vp9_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.frame_time_budget = CAST(VP9E_SET_FRAME_TIME_BUDGET, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+static vpx_codec_err_t ctrl_get_speed_control_stats(vpx_codec_alg_priv_t *ctx,
+                                                    va_list args) {
+  vpx_speed_control_stats_t *const stats =
+      va_arg(args, vpx_speed_control_stats_t *);
+  const SPEED_CONTROL *const sc = &ctx->cpi->speed_control;
+  if (stats == NULL) return VPX_CODEC_INVALID_PARAM;
+  stats->speed = sc->budget_us > 0 ? sc->speed : ctx->cpi->oxcf.speed;
+  stats->frames = sc->frames;
+  stats->frames_over_budget = sc->frames_over_budget;
+  stats->speed_changes = sc->speed_changes;
+  stats->avg_frame_us = (uint64_t)sc->avg_us;
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_err_t ctrl_register_cx_callback(vpx_codec_alg_priv_t *ctx,
                                                  va_list args) {
   vpx_codec_priv_output_cx_pkt_cb_pair_t *cbp =
@@ -2156,6 +2802,14 @@ static vpx_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { VP9E_SET_EXTERNAL_RATE_CONTROL, ctrl_set_external_rate_control },
   { VP9E_SET_QUANTIZER_ONE_PASS, ctrl_set_quantizer_one_pass },
   { VP9E_ENABLE_EXTERNAL_RC_TPL, ctrl_enable_external_rc_tpl },
+  { VP9E_SET_GOP_PARALLEL, ctrl_set_gop_parallel },
+  { VP9E_SET_ZERO_COPY_INPUT, ctrl_set_zero_copy_input },
+  { VP9E_SET_OUTPUT_BUFFERS, ctrl_set_output_buffers },
+  { VP9E_SET_COMPONENT_TIMING, ctrl_set_component_timing },
+  { VP9E_SET_FP_MV_SEEDS, ctrl_set_fp_mv_seeds },
+  { VP9E_SET_MOTION_HINTS, ctrl_set_motion_hints },
+  { VP9E_SET_MODE_INFO, ctrl_set_mode_info },
+  { VP9E_SET_FRAME_TIME_BUDGET, ctrl_set_frame_time_budget },
 
   // Getters
   { VP8E_GET_LAST_QUANTIZER, ctrl_get_quantizer },
@@ -2167,6 +2821,8 @@ static vpx_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { VP9E_GET_ACTIVEMAP, ctrl_get_active_map },
   { VP9E_GET_LEVEL, ctrl_get_level },
   { VP9E_GET_SVC_REF_FRAME_CONFIG, ctrl_get_svc_ref_frame_config },
+  { VP9E_GET_COMPONENT_TIMING, ctrl_get_component_timing },
+  { VP9E_GET_SPEED_CONTROL_STATS, ctrl_get_speed_control_stats },
 
   { -1, NULL },
 };
@@ -2484,6 +3140,8 @@ void vp9_dump_encoder_config(const VP9EncoderConfig *oxcf, FILE *fp) {
   DUMP_STRUCT_VALUE(fp, oxcf, row_mt);
   DUMP_STRUCT_VALUE(fp, oxcf, motion_vector_unit_test);
   DUMP_STRUCT_VALUE(fp, oxcf, delta_q_uv);
+  DUMP_STRUCT_VALUE(fp, oxcf, fp_mv_seeds);
+  DUMP_STRUCT_VALUE(fp, oxcf, frame_time_budget);
   DUMP_STRUCT_VALUE(fp, oxcf, use_simple_encode_api);
 }
 
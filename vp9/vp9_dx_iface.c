@@ -8,6 +8,8 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <assert.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -19,11 +21,14 @@
 #include "vpx/vpx_decoder.h"
 #include "vpx_dsp/bitreader_buffer.h"
 #include "vpx_dsp/vpx_dsp_common.h"
+#include "vpx_ports/vpx_timer.h"
+#include "vpx_util/vpx_thread.h"
 
 #include "vp9/common/vp9_alloccommon.h"
 #include "vp9/common/vp9_frame_buffers.h"
 
 #include "vp9/decoder/vp9_decodeframe.h"
+#include "vp9/decoder/vp9_dthread.h"
 
 #include "vp9/vp9_dx_iface.h"
 #include "vp9/vp9_iface_common.h"
@@ -55,17 +60,52 @@ static vpx_codec_err_t decoder_init(vpx_codec_ctx_t *ctx,
   return VPX_CODEC_OK;
 }
 
+static void remove_frame_workers(vpx_codec_alg_priv_t *ctx) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  int i;
+
+  for (i = 0; i < ctx->num_frame_workers; ++i) {
+    VPxWorker *const worker = &ctx->frame_workers[i];
+    FrameWorkerData *const frame_worker_data = (FrameWorkerData *)worker->data1;
+    winterface->end(worker);
+    if (frame_worker_data != NULL) {
+      if (frame_worker_data->pbi != NULL)
+        vp9_decoder_remove(frame_worker_data->pbi);
+      vpx_free(frame_worker_data->data);
+      vpx_free(frame_worker_data);
+    }
+  }
+  vpx_free(ctx->frame_workers);
+  ctx->frame_workers = NULL;
+  ctx->num_frame_workers = 0;
+  ctx->pbi = NULL;
+}
+
+static void free_buffer_pool(vpx_codec_alg_priv_t *ctx) {
+#if CONFIG_MULTITHREAD
+  if (ctx->frame_parallel_decode) {
+    pthread_mutex_destroy(&ctx->buffer_pool->progress_mutex);
+    pthread_cond_destroy(&ctx->buffer_pool->progress_cond);
+  }
+#endif
+  vpx_free(ctx->buffer_pool);
+  ctx->buffer_pool = NULL;
+}
+
 static vpx_codec_err_t decoder_destroy(vpx_codec_alg_priv_t *ctx) {
-  if (ctx->pbi != NULL) {
+  if (ctx->frame_workers != NULL) {
+    remove_frame_workers(ctx);
+  } else if (ctx->pbi != NULL) {
     vp9_decoder_remove(ctx->pbi);
   }
 
   if (ctx->buffer_pool) {
     vp9_free_ref_frame_buffers(ctx->buffer_pool);
     vp9_free_internal_frame_buffers(&ctx->buffer_pool->int_frame_buffers);
+    free_buffer_pool(ctx);
   }
 
-  vpx_free(ctx->buffer_pool);
+  vpx_free(ctx->seg_map);
   vpx_free(ctx);
   return VPX_CODEC_OK;
 }
@@ -200,13 +240,29 @@ static vpx_codec_err_t update_error_state(
   return error->error_code;
 }
 
+// Returns the number of VP9Decoder instances: one per frame worker in frame
+// parallel decode, ctx->pbi otherwise.
+static int get_num_decoders(const vpx_codec_alg_priv_t *ctx) {
+  return ctx->frame_parallel_decode ? ctx->num_frame_workers : 1;
+}
+
+static VP9Decoder *get_decoder(const vpx_codec_alg_priv_t *ctx, int i) {
+  if (!ctx->frame_parallel_decode) return ctx->pbi;
+  return ((FrameWorkerData *)ctx->frame_workers[i].data1)->pbi;
+}
+
 static vpx_codec_err_t init_buffer_callbacks(vpx_codec_alg_priv_t *ctx) {
   VP9_COMMON *const cm = &ctx->pbi->common;
   BufferPool *const pool = cm->buffer_pool;
-
-  cm->new_fb_idx = INVALID_IDX;
-  cm->byte_alignment = ctx->byte_alignment;
-  cm->skip_loop_filter = ctx->skip_loop_filter;
+  int i;
+
+  for (i = 0; i < get_num_decoders(ctx); ++i) {
+    VP9_COMMON *const decoder_cm = &get_decoder(ctx, i)->common;
+    decoder_cm->new_fb_idx = INVALID_IDX;
+    decoder_cm->byte_alignment = ctx->byte_alignment;
+    decoder_cm->skip_loop_filter = ctx->skip_loop_filter;
+    get_decoder(ctx, i)->time_stages = ctx->time_stages;
+  }
 
   if (ctx->get_ext_fb_cb != NULL && ctx->release_ext_fb_cb != NULL) {
     pool->get_fb_cb = ctx->get_ext_fb_cb;
@@ -254,6 +310,73 @@ static void set_ppflags(const vpx_codec_alg_priv_t *ctx, vp9_ppflags_t *flags) {
       ERROR(#memb " out of range [" #lo ".." #hi "]");                   \
   } while (0)
 
+static vpx_codec_err_t init_frame_workers(vpx_codec_alg_priv_t *ctx) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  const int num_frame_workers = VPXMIN((int)ctx->cfg.threads, MAX_FRAME_WORKERS);
+  int i;
+
+#if CONFIG_MULTITHREAD
+  if (pthread_mutex_init(&ctx->buffer_pool->progress_mutex, NULL)) {
+    set_error_detail(ctx, "Failed to allocate buffer pool mutex");
+    return VPX_CODEC_MEM_ERROR;
+  }
+  if (pthread_cond_init(&ctx->buffer_pool->progress_cond, NULL)) {
+    pthread_mutex_destroy(&ctx->buffer_pool->progress_mutex);
+    set_error_detail(ctx, "Failed to allocate buffer pool cond");
+    return VPX_CODEC_MEM_ERROR;
+  }
+  for (i = 0; i < FRAME_BUFFERS; ++i) {
+    vpx_atomic_init(&ctx->buffer_pool->frame_bufs[i].row, INT_MAX);
+  }
+#endif
+
+  ctx->frame_workers = (VPxWorker *)vpx_calloc(
+      num_frame_workers, sizeof(*ctx->frame_workers));
+  if (ctx->frame_workers == NULL) {
+    set_error_detail(ctx, "Failed to allocate frame workers");
+    return VPX_CODEC_MEM_ERROR;
+  }
+
+  for (i = 0; i < num_frame_workers; ++i) {
+    VPxWorker *const worker = &ctx->frame_workers[i];
+    FrameWorkerData *frame_worker_data;
+    VP9Decoder *pbi;
+
+    winterface->init(worker);
+    ++ctx->num_frame_workers;
+
+    frame_worker_data =
+        (FrameWorkerData *)vpx_calloc(1, sizeof(*frame_worker_data));
+    worker->data1 = frame_worker_data;
+    if (frame_worker_data == NULL) {
+      set_error_detail(ctx, "Failed to allocate frame worker data");
+      return VPX_CODEC_MEM_ERROR;
+    }
+
+    pbi = vp9_decoder_create(ctx->buffer_pool);
+    frame_worker_data->pbi = pbi;
+    if (pbi == NULL) {
+      set_error_detail(ctx, "Failed to allocate decoder");
+      return VPX_CODEC_MEM_ERROR;
+    }
+    // Each frame is decoded by a single thread.
+    pbi->max_threads = 1;
+    pbi->inv_tile_order = ctx->invert_tile_order;
+    pbi->frame_parallel_decode = 1;
+
+    worker->hook = vp9_frameworker_hook;
+    worker->data2 = NULL;
+    if (!winterface->reset(worker)) {
+      set_error_detail(ctx, "Frame worker thread creation failed");
+      return VPX_CODEC_ERROR;
+    }
+  }
+
+  ctx->pbi = get_decoder(ctx, 0);
+  ctx->seg_map_seq = -1;
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_err_t init_decoder(vpx_codec_alg_priv_t *ctx) {
   vpx_codec_err_t res;
   ctx->last_show_frame = -1;
@@ -263,21 +386,37 @@ static vpx_codec_err_t init_decoder(vpx_codec_alg_priv_t *ctx) {
   ctx->buffer_pool = (BufferPool *)vpx_calloc(1, sizeof(BufferPool));
   if (ctx->buffer_pool == NULL) return VPX_CODEC_MEM_ERROR;
 
-  ctx->pbi = vp9_decoder_create(ctx->buffer_pool);
-  if (ctx->pbi == NULL) {
-    vpx_free(ctx->buffer_pool);
-    ctx->buffer_pool = NULL;
-    set_error_detail(ctx, "Failed to allocate decoder");
-    return VPX_CODEC_MEM_ERROR;
-  }
-  ctx->pbi->max_threads = ctx->cfg.threads;
-  ctx->pbi->inv_tile_order = ctx->invert_tile_order;
+  // Frame parallel decode returns the frames as they were decoded, it is not
+  // available with postprocessing.
+  ctx->frame_parallel_decode =
+      CONFIG_MULTITHREAD && ctx->cfg.threads > 1 &&
+      (ctx->base.init_flags & VPX_CODEC_USE_FRAME_THREADING) &&
+      !(ctx->base.init_flags & VPX_CODEC_USE_POSTPROC);
+
+  if (ctx->frame_parallel_decode) {
+    res = init_frame_workers(ctx);
+    if (res != VPX_CODEC_OK) {
+      remove_frame_workers(ctx);
+      free_buffer_pool(ctx);
+      return res;
+    }
+  } else {
+    ctx->pbi = vp9_decoder_create(ctx->buffer_pool);
+    if (ctx->pbi == NULL) {
+      vpx_free(ctx->buffer_pool);
+      ctx->buffer_pool = NULL;
+      set_error_detail(ctx, "Failed to allocate decoder");
+      return VPX_CODEC_MEM_ERROR;
+    }
+    ctx->pbi->max_threads = ctx->cfg.threads;
+    ctx->pbi->inv_tile_order = ctx->invert_tile_order;
 
-  RANGE_CHECK(ctx, row_mt, 0, 1);
-  ctx->pbi->row_mt = ctx->row_mt;
+    RANGE_CHECK(ctx, row_mt, 0, 1);
+    ctx->pbi->row_mt = ctx->row_mt;
 
-  RANGE_CHECK(ctx, lpf_opt, 0, 1);
-  ctx->pbi->lpf_mt_opt = ctx->lpf_opt;
+    RANGE_CHECK(ctx, lpf_opt, 0, 1);
+    ctx->pbi->lpf_mt_opt = ctx->lpf_opt;
+  }
 
   // If postprocessing was enabled by the application and a
   // configuration has not been provided, default it.
@@ -286,10 +425,13 @@ static vpx_codec_err_t init_decoder(vpx_codec_alg_priv_t *ctx) {
 
   res = init_buffer_callbacks(ctx);
   if (res != VPX_CODEC_OK) {
-    vpx_free(ctx->buffer_pool);
-    ctx->buffer_pool = NULL;
-    vp9_decoder_remove(ctx->pbi);
-    ctx->pbi = NULL;
+    if (ctx->frame_parallel_decode) {
+      remove_frame_workers(ctx);
+    } else {
+      vp9_decoder_remove(ctx->pbi);
+      ctx->pbi = NULL;
+    }
+    free_buffer_pool(ctx);
   }
   return res;
 }
@@ -302,9 +444,319 @@ static INLINE void check_resync(vpx_codec_alg_priv_t *const ctx,
     ctx->need_resync = 0;
 }
 
+static int uses_backward_adaptation(const VP9_COMMON *const cm) {
+  return !cm->show_existing_frame && cm->refresh_frame_context &&
+         !cm->error_resilient_mode && !cm->frame_parallel_decoding_mode;
+}
+
+static int has_free_frame_buffer(const BufferPool *const pool) {
+  int i;
+  for (i = 0; i < FRAME_BUFFERS; ++i) {
+    if (pool->frame_bufs[i].ref_count == 0) return 1;
+  }
+  return 0;
+}
+
+// Releases the frames returned by decoder_get_frame() since the last call to
+// decoder_decode().
+static void release_output_frames(vpx_codec_alg_priv_t *ctx) {
+  BufferPool *const pool = ctx->buffer_pool;
+  int i;
+
+  for (i = 0; i < ctx->num_output_frames; ++i) {
+    decrease_ref_count(ctx->output_fb_idx[i], pool->frame_bufs, pool);
+  }
+  ctx->num_output_frames = 0;
+}
+
+// Queues a finished frame for decoder_get_frame(). The caller holds a
+// reference on the frame buffer. The oldest frame is dropped if the
+// application does not retrieve the frames.
+static void cache_frame(vpx_codec_alg_priv_t *ctx, int fb_idx,
+                        void *user_priv) {
+  BufferPool *const pool = ctx->buffer_pool;
+  FrameCacheEntry *entry;
+
+  if (ctx->frame_cache_count == FRAME_CACHE_SIZE) {
+    decrease_ref_count(ctx->frame_cache[ctx->frame_cache_read].fb_idx,
+                       pool->frame_bufs, pool);
+    ctx->frame_cache_read = (ctx->frame_cache_read + 1) % FRAME_CACHE_SIZE;
+    --ctx->frame_cache_count;
+  }
+
+  entry = &ctx->frame_cache[(ctx->frame_cache_read + ctx->frame_cache_count) %
+                            FRAME_CACHE_SIZE];
+  entry->fb_idx = fb_idx;
+  entry->user_priv = user_priv;
+  ++ctx->frame_cache_count;
+}
+
+// Saves the segmentation map of a finished frame for the next frame that has
+// segmentation enabled.
+static void save_seg_map(vpx_codec_alg_priv_t *ctx,
+                         const FrameWorkerData *const frame_worker_data) {
+  const VP9_COMMON *const cm = &frame_worker_data->pbi->common;
+  const int seg_map_size = cm->mi_rows * cm->mi_cols;
+
+  if (cm->show_existing_frame || !cm->seg.enabled ||
+      frame_worker_data->frame_seq < ctx->seg_map_reset_seq)
+    return;
+
+  if (ctx->seg_map_size != seg_map_size) {
+    vpx_free(ctx->seg_map);
+    ctx->seg_map = (uint8_t *)vpx_malloc(seg_map_size);
+    ctx->seg_map_size = ctx->seg_map != NULL ? seg_map_size : 0;
+    if (ctx->seg_map == NULL) return;
+  }
+  // The current and last maps have been swapped by the end of the frame.
+  memcpy(ctx->seg_map, cm->last_frame_seg_map, seg_map_size);
+  ctx->seg_map_seq = frame_worker_data->frame_seq;
+}
+
+// Sets up the segmentation map that 'cm' predicts from. All the previous
+// frames must be finished.
+static void load_seg_map(const vpx_codec_alg_priv_t *ctx, VP9_COMMON *cm) {
+  const int seg_map_size = cm->mi_rows * cm->mi_cols;
+
+  if (ctx->seg_map_seq >= ctx->seg_map_reset_seq &&
+      ctx->seg_map_size == seg_map_size) {
+    memcpy(cm->last_frame_seg_map, ctx->seg_map, seg_map_size);
+  } else {
+    memset(cm->last_frame_seg_map, 0, seg_map_size);
+  }
+}
+
+// Returns 1 if the data held by 'frame_worker_data' continues with another
+// frame after its decoded frame, skipping the padding left by the encoder.
+static int has_trailing_frame(const vpx_codec_alg_priv_t *ctx,
+                              const FrameWorkerData *const frame_worker_data) {
+  const uint8_t *data = frame_worker_data->frame_end;
+  const uint8_t *const data_end =
+      frame_worker_data->data + frame_worker_data->frame_size;
+  while (data < data_end) {
+    if (read_marker(ctx->decrypt_cb, ctx->decrypt_state, data)) return 1;
+    ++data;
+  }
+  return 0;
+}
+
+// Waits for the oldest frame in flight and finishes it.
+static vpx_codec_err_t finish_oldest_frame(vpx_codec_alg_priv_t *ctx) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  const int worker_id =
+      (ctx->next_submit_worker_id - ctx->num_pending_frames +
+       ctx->num_frame_workers) %
+      ctx->num_frame_workers;
+  VPxWorker *const worker = &ctx->frame_workers[worker_id];
+  FrameWorkerData *const frame_worker_data = (FrameWorkerData *)worker->data1;
+  VP9Decoder *const pbi = frame_worker_data->pbi;
+  VP9_COMMON *const cm = &pbi->common;
+  RefCntBuffer *const frame_bufs = ctx->buffer_pool->frame_bufs;
+  const int fb_idx = cm->new_fb_idx;
+  const int failed = !winterface->sync(worker);
+
+  assert(frame_worker_data->frame_pending);
+  frame_worker_data->frame_pending = 0;
+  --ctx->num_pending_frames;
+
+  if (failed) {
+    int i;
+    vp9_finish_decoding_frame(pbi, 1);
+    frame_bufs[fb_idx].buf.corrupted = 1;
+    pbi->need_resync = 1;
+    ctx->pbi->need_resync = 1;
+    ctx->need_resync = 1;
+    // The frames in flight may reference the corrupted frame.
+    for (i = 0; i < ctx->num_frame_workers; ++i) {
+      ((FrameWorkerData *)ctx->frame_workers[i].data1)->output = 0;
+    }
+    return update_error_state(ctx, &cm->error);
+  }
+
+  // Hold the frame until it has been returned by decoder_get_frame().
+  if (frame_worker_data->output) ++frame_bufs[fb_idx].ref_count;
+
+  vp9_finish_decoding_frame(pbi, 0);
+  save_seg_map(ctx, frame_worker_data);
+
+  if (frame_worker_data->output) {
+    cache_frame(ctx, fb_idx, frame_worker_data->user_priv);
+  } else if (frame_bufs[fb_idx].ref_count == 0 &&
+             !frame_bufs[fb_idx].released) {
+    // Release a frame that is neither shown nor referenced before its frame
+    // buffer is reused by another frame worker.
+    ctx->buffer_pool->release_fb_cb(ctx->buffer_pool->cb_priv,
+                                    &frame_bufs[fb_idx].raw_frame_buffer);
+    frame_bufs[fb_idx].released = 1;
+  }
+
+  // The frames following it were not decoded (see find_frame_end()), and the
+  // frames in flight may reference them.
+  if (frame_worker_data->check_end &&
+      has_trailing_frame(ctx, frame_worker_data)) {
+    int i;
+    pbi->need_resync = 1;
+    ctx->pbi->need_resync = 1;
+    ctx->need_resync = 1;
+    for (i = 0; i < ctx->num_frame_workers; ++i) {
+      ((FrameWorkerData *)ctx->frame_workers[i].data1)->output = 0;
+    }
+    set_error_detail(ctx,
+                     "Frame parallel decode needs a superframe index for "
+                     "data following a shown frame");
+    return VPX_CODEC_UNSUP_BITSTREAM;
+  }
+  return VPX_CODEC_OK;
+}
+
+// Finishes all the frames in flight. Returns the first error.
+static vpx_codec_err_t drain_frames(vpx_codec_alg_priv_t *ctx) {
+  vpx_codec_err_t res = VPX_CODEC_OK;
+  while (ctx->num_pending_frames > 0) {
+    const vpx_codec_err_t frame_res = finish_oldest_frame(ctx);
+    if (res == VPX_CODEC_OK) res = frame_res;
+  }
+  return res;
+}
+
+// Reads the headers of a frame on the calling thread and hands the tiles to
+// the next frame worker.
+static vpx_codec_err_t decode_one_frame_parallel(vpx_codec_alg_priv_t *ctx,
+                                                 const uint8_t **data,
+                                                 unsigned int data_sz,
+                                                 void *user_priv,
+                                                 int last_frame) {
+  const VPxWorkerInterface *const winterface = vpx_get_worker_interface();
+  VPxWorker *const worker = &ctx->frame_workers[ctx->next_submit_worker_id];
+  FrameWorkerData *const frame_worker_data = (FrameWorkerData *)worker->data1;
+  VP9Decoder *const pbi = frame_worker_data->pbi;
+  VP9Decoder *const prev_pbi = ctx->pbi;
+  VP9_COMMON *const cm = &pbi->common;
+  const uint8_t *source;
+  int last_width, last_height;
+  vpx_codec_err_t res = VPX_CODEC_OK;
+  vpx_codec_err_t frame_res;
+
+  // All the frame workers are busy: the oldest frame is held by this one.
+  if (frame_worker_data->frame_pending) {
+    assert(ctx->num_pending_frames == ctx->num_frame_workers);
+    res = finish_oldest_frame(ctx);
+  }
+
+  // With backward adaptation the frame contexts of the previous frame are
+  // only known once its tiles have been decoded.
+  if (ctx->num_pending_frames > 0 &&
+      uses_backward_adaptation(&prev_pbi->common)) {
+    frame_res = drain_frames(ctx);
+    if (res == VPX_CODEC_OK) res = frame_res;
+  }
+
+  // Keep a frame buffer available for the new frame.
+  while (ctx->num_pending_frames > 0 &&
+         !has_free_frame_buffer(ctx->buffer_pool)) {
+    frame_res = finish_oldest_frame(ctx);
+    if (res == VPX_CODEC_OK) res = frame_res;
+  }
+
+  if (pbi != prev_pbi) vp9_frameworker_copy_context(pbi, prev_pbi);
+
+  if (frame_worker_data->data_size < data_sz) {
+    vpx_free(frame_worker_data->data);
+    frame_worker_data->data = (uint8_t *)vpx_malloc(data_sz);
+    frame_worker_data->data_size = frame_worker_data->data ? data_sz : 0;
+    if (frame_worker_data->data == NULL) {
+      set_error_detail(ctx, "Failed to allocate frame data");
+      return VPX_CODEC_MEM_ERROR;
+    }
+  }
+  memcpy(frame_worker_data->data, *data, data_sz);
+
+  pbi->decrypt_cb = ctx->decrypt_cb;
+  pbi->decrypt_state = ctx->decrypt_state;
+
+  last_width = cm->last_width;
+  last_height = cm->last_height;
+  source = frame_worker_data->data;
+  if (vp9_receive_compressed_data(pbi, data_sz, &source)) {
+    pbi->cur_buf->buf.corrupted = 1;
+    // The next frame continues from the previous one.
+    prev_pbi->need_resync = 1;
+    ctx->need_resync = 1;
+    drain_frames(ctx);
+    return update_error_state(ctx, &cm->error);
+  }
+  *data += source - frame_worker_data->data;
+  frame_worker_data->frame_size = data_sz;
+  frame_worker_data->frame_end = source;
+  frame_worker_data->check_end = 0;
+
+  check_resync(ctx, pbi);
+  ctx->pbi = pbi;
+
+  frame_worker_data->user_priv = user_priv;
+  frame_worker_data->frame_seq = ctx->frame_seq++;
+
+  if (!cm->show_existing_frame) {
+    if (frame_is_intra_only(cm) || cm->error_resilient_mode ||
+        cm->width != last_width || cm->height != last_height) {
+      ctx->seg_map_reset_seq = frame_worker_data->frame_seq;
+    }
+    // The segmentation map is predicted from the previous frame with
+    // segmentation enabled, which may have been decoded by any worker.
+    if (cm->seg.enabled) {
+      frame_res = drain_frames(ctx);
+      if (res == VPX_CODEC_OK) res = frame_res;
+      load_seg_map(ctx, cm);
+    }
+#if CONFIG_MULTITHREAD
+    vpx_atomic_store_release(&pbi->cur_buf->row, -1);
+#endif
+  }
+
+  frame_worker_data->output = last_frame && cm->show_frame && !ctx->need_resync;
+  frame_worker_data->frame_pending = 1;
+  ++ctx->num_pending_frames;
+  ctx->next_submit_worker_id =
+      (ctx->next_submit_worker_id + 1) % ctx->num_frame_workers;
+  winterface->launch(worker);
+
+  return res;
+}
+
+// Frame parallel decode of a buffer without a superframe index: the end of the
+// frame submitted last is only known once its tiles have been decoded. A
+// hidden frame is waited for, since it is normally followed by the frame that
+// shows it. Data following a shown frame is reported as an error when the
+// frame is finished.
+static vpx_codec_err_t find_frame_end(vpx_codec_alg_priv_t *ctx,
+                                      const uint8_t *frame_start,
+                                      const uint8_t **data) {
+  const int worker_id =
+      (ctx->next_submit_worker_id + ctx->num_frame_workers - 1) %
+      ctx->num_frame_workers;
+  FrameWorkerData *const frame_worker_data =
+      (FrameWorkerData *)ctx->frame_workers[worker_id].data1;
+  const VP9_COMMON *const cm = &frame_worker_data->pbi->common;
+  vpx_codec_err_t res;
+
+  // The end of a frame showing an existing frame is read with its header.
+  if (cm->show_existing_frame) return VPX_CODEC_OK;
+
+  if (cm->show_frame) {
+    frame_worker_data->check_end = 1;
+    return VPX_CODEC_OK;
+  }
+
+  res = drain_frames(ctx);
+  if (res != VPX_CODEC_OK) return res;
+  *data =
+      frame_start + (frame_worker_data->frame_end - frame_worker_data->data);
+  return VPX_CODEC_OK;
+}
+
 static vpx_codec_err_t decode_one(vpx_codec_alg_priv_t *ctx,
                                   const uint8_t **data, unsigned int data_sz,
-                                  void *user_priv) {
+                                  void *user_priv, int last_frame) {
   // Determine the stream parameters. Note that we rely on peek_si to
   // validate that we have a buffer that does not wrap around the top
   // of the heap.
@@ -318,6 +770,11 @@ static vpx_codec_err_t decode_one(vpx_codec_alg_priv_t *ctx,
     if (!ctx->si.is_kf && !is_intra_only) return VPX_CODEC_ERROR;
   }
 
+  if (ctx->frame_parallel_decode) {
+    return decode_one_frame_parallel(ctx, data, data_sz, user_priv,
+                                     last_frame);
+  }
+
   ctx->user_priv = user_priv;
 
   // Set these even if already initialized.  The caller may have changed the
@@ -337,17 +794,20 @@ static vpx_codec_err_t decode_one(vpx_codec_alg_priv_t *ctx,
   return VPX_CODEC_OK;
 }
 
-static vpx_codec_err_t decoder_decode(vpx_codec_alg_priv_t *ctx,
-                                      const uint8_t *data, unsigned int data_sz,
-                                      void *user_priv) {
+static vpx_codec_err_t decode_data(vpx_codec_alg_priv_t *ctx,
+                                   const uint8_t *data, unsigned int data_sz,
+                                   void *user_priv) {
   const uint8_t *data_start = data;
   vpx_codec_err_t res;
   uint32_t frame_sizes[8];
   int frame_count;
 
+  // The frames returned by decoder_get_frame() are no longer used.
+  if (ctx->frame_parallel_decode) release_output_frames(ctx);
+
   if (data == NULL && data_sz == 0) {
     ctx->flushed = 1;
-    return VPX_CODEC_OK;
+    return ctx->frame_parallel_decode ? drain_frames(ctx) : VPX_CODEC_OK;
   }
 
   // Reset flushed when receiving a valid frame.
@@ -379,7 +839,8 @@ static vpx_codec_err_t decoder_decode(vpx_codec_alg_priv_t *ctx,
         return VPX_CODEC_CORRUPT_FRAME;
       }
 
-      res = decode_one(ctx, &data_start_copy, frame_size, user_priv);
+      res = decode_one(ctx, &data_start_copy, frame_size, user_priv,
+                       i == frame_count - 1);
       if (res != VPX_CODEC_OK) return res;
 
       data_start += frame_size;
@@ -387,10 +848,16 @@ static vpx_codec_err_t decoder_decode(vpx_codec_alg_priv_t *ctx,
   } else {
     const uint8_t *const data_end = data + data_sz;
     while (data_start < data_end) {
+      const uint8_t *const frame_start = data_start;
       const uint32_t frame_size = (uint32_t)(data_end - data_start);
-      res = decode_one(ctx, &data_start, frame_size, user_priv);
+      res = decode_one(ctx, &data_start, frame_size, user_priv, 1);
       if (res != VPX_CODEC_OK) return res;
 
+      if (ctx->frame_parallel_decode) {
+        res = find_frame_end(ctx, frame_start, &data_start);
+        if (res != VPX_CODEC_OK) return res;
+      }
+
       // Account for suboptimal termination by the encoder.
       while (data_start < data_end) {
         const uint8_t marker =
@@ -404,6 +871,21 @@ static vpx_codec_err_t decoder_decode(vpx_codec_alg_priv_t *ctx,
   return res;
 }
 
+static vpx_codec_err_t decoder_decode(vpx_codec_alg_priv_t *ctx,
+                                      const uint8_t *data, unsigned int data_sz,
+                                      void *user_priv) {
+  struct vpx_usec_timer timer;
+  vpx_codec_err_t res;
+
+  vpx_usec_timer_start(&timer);
+  res = decode_data(ctx, data, data_sz, user_priv);
+  if (ctx->time_stages) {
+    vpx_usec_timer_mark(&timer);
+    ctx->decode_time_us += vpx_usec_timer_elapsed(&timer);
+  }
+  return res;
+}
+
 static vpx_image_t *decoder_get_frame(vpx_codec_alg_priv_t *ctx,
                                       vpx_codec_iter_t *iter) {
   vpx_image_t *img = NULL;
@@ -412,6 +894,29 @@ static vpx_image_t *decoder_get_frame(vpx_codec_alg_priv_t *ctx,
   // always return only 1 frame per decode call.
   (void)iter;
 
+  // Frame parallel decode returns the finished frames in decode order, which
+  // may be several per decode call.
+  if (ctx->frame_parallel_decode) {
+    // Only one decode call's worth of frames is in flight, so the frames
+    // returned since the last decode call fit in output_fb_idx.
+    assert(ctx->num_output_frames < MAX_OUTPUT_FRAMES ||
+           ctx->frame_cache_count == 0);
+    if (ctx->frame_cache_count > 0 &&
+        ctx->num_output_frames < MAX_OUTPUT_FRAMES) {
+      const FrameCacheEntry *const entry =
+          &ctx->frame_cache[ctx->frame_cache_read];
+      RefCntBuffer *const buf = &ctx->buffer_pool->frame_bufs[entry->fb_idx];
+      ctx->frame_cache_read = (ctx->frame_cache_read + 1) % FRAME_CACHE_SIZE;
+      --ctx->frame_cache_count;
+      ctx->output_fb_idx[ctx->num_output_frames++] = entry->fb_idx;
+      ctx->last_show_frame = entry->fb_idx;
+      yuvconfig2image(&ctx->img, &buf->buf, entry->user_priv);
+      ctx->img.fb_priv = buf->raw_frame_buffer.priv;
+      img = &ctx->img;
+    }
+    return img;
+  }
+
   if (ctx->pbi != NULL) {
     YV12_BUFFER_CONFIG sd;
     vp9_ppflags_t flags = { 0, 0, 0 };
@@ -454,6 +959,7 @@ static vpx_codec_err_t ctrl_set_reference(vpx_codec_alg_priv_t *ctx,
   if (data) {
     vpx_ref_frame_t *const frame = (vpx_ref_frame_t *)data;
     YV12_BUFFER_CONFIG sd;
+    if (ctx->frame_parallel_decode) drain_frames(ctx);
     image2yuvconfig(&frame->img, &sd);
     return vp9_set_reference_dec(
         &ctx->pbi->common, ref_frame_to_vp9_reframe(frame->frame_type), &sd);
@@ -469,6 +975,7 @@ static vpx_codec_err_t ctrl_copy_reference(vpx_codec_alg_priv_t *ctx,
   if (data) {
     vpx_ref_frame_t *frame = (vpx_ref_frame_t *)data;
     YV12_BUFFER_CONFIG sd;
+    if (ctx->frame_parallel_decode) drain_frames(ctx);
     image2yuvconfig(&frame->img, &sd);
     return vp9_copy_reference_dec(ctx->pbi, (VP9_REFFRAME)frame->frame_type,
                                   &sd);
@@ -483,7 +990,10 @@ static vpx_codec_err_t ctrl_get_reference(vpx_codec_alg_priv_t *ctx,
 
   if (data) {
     if (ctx->pbi) {
-      const int fb_idx = ctx->pbi->common.cur_show_frame_fb_idx;
+      // In frame parallel decode the frames are shown once finished.
+      const int fb_idx = ctx->frame_parallel_decode
+                             ? ctx->last_show_frame
+                             : ctx->pbi->common.cur_show_frame_fb_idx;
       YV12_BUFFER_CONFIG *fb = get_buf_frame(&ctx->pbi->common, fb_idx);
       if (fb == NULL) return VPX_CODEC_ERROR;
       yuvconfig2image(&data->img, fb, NULL);
@@ -546,6 +1056,13 @@ static vpx_codec_err_t ctrl_get_frame_corrupted(vpx_codec_alg_priv_t *ctx,
   if (corrupted) {
     if (ctx->pbi != NULL) {
       RefCntBuffer *const frame_bufs = ctx->pbi->common.buffer_pool->frame_bufs;
+      if (ctx->frame_parallel_decode) {
+        // Frames are output with a delay: report on the last one returned,
+        // if any.
+        *corrupted = ctx->last_show_frame >= 0 &&
+                     frame_bufs[ctx->last_show_frame].buf.corrupted;
+        return VPX_CODEC_OK;
+      }
       if (ctx->pbi->common.frame_to_show == NULL) return VPX_CODEC_ERROR;
       if (ctx->last_show_frame >= 0)
         *corrupted = frame_bufs[ctx->last_show_frame].buf.corrupted;
@@ -640,7 +1157,9 @@ static vpx_codec_err_t ctrl_set_byte_alignment(vpx_codec_alg_priv_t *ctx,
 
   ctx->byte_alignment = byte_alignment;
   if (ctx->pbi != NULL) {
-    ctx->pbi->common.byte_alignment = byte_alignment;
+    int i;
+    for (i = 0; i < get_num_decoders(ctx); ++i)
+      get_decoder(ctx, i)->common.byte_alignment = byte_alignment;
   }
   return VPX_CODEC_OK;
 }
@@ -650,7 +1169,9 @@ static vpx_codec_err_t ctrl_set_skip_loop_filter(vpx_codec_alg_priv_t *ctx,
   ctx->skip_loop_filter = va_arg(args, int);
 
   if (ctx->pbi != NULL) {
-    ctx->pbi->common.skip_loop_filter = ctx->skip_loop_filter;
+    int i;
+    for (i = 0; i < get_num_decoders(ctx); ++i)
+      get_decoder(ctx, i)->common.skip_loop_filter = ctx->skip_loop_filter;
   }
 
   return VPX_CODEC_OK;
@@ -680,6 +1201,60 @@ static vpx_codec_err_t ctrl_enable_lpf_opt(vpx_codec_alg_priv_t *ctx,
   return VPX_CODEC_OK;
 }
 
+static vpx_codec_err_t ctrl_set_component_timing(vpx_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  ctx->time_stages = va_arg(args, int) != 0;
+  ctx->decode_time_us = 0;
+
+  if (ctx->pbi != NULL) {
+    int i;
+    // The frame workers read time_stages.
+    if (ctx->frame_parallel_decode) drain_frames(ctx);
+    for (i = 0; i < get_num_decoders(ctx); ++i) {
+      VP9Decoder *const pbi = get_decoder(ctx, i);
+      pbi->time_stages = ctx->time_stages;
+      vp9_zero(pbi->stage_timing);
+      vp9_zero(pbi->frame_timing);
+    }
+  }
+
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_get_component_timing(vpx_codec_alg_priv_t *ctx,
+                                                 va_list args) {
+  vpx_dec_component_timing_t *const timing =
+      va_arg(args, vpx_dec_component_timing_t *);
+  if (timing == NULL) return VPX_CODEC_INVALID_PARAM;
+
+  memset(timing, 0, sizeof(*timing));
+  timing->total_us = ctx->decode_time_us;
+  if (ctx->pbi != NULL) {
+    int i, col;
+    for (i = 0; i < get_num_decoders(ctx); ++i) {
+      const vpx_dec_component_timing_t *const stage_timing =
+          &get_decoder(ctx, i)->stage_timing;
+      timing->frames += stage_timing->frames;
+      timing->parse_us += stage_timing->parse_us;
+      timing->recon_us += stage_timing->recon_us;
+      timing->loop_filter_us += stage_timing->loop_filter_us;
+      for (col = 0; col < VPX_MAX_TILE_COLS; ++col)
+        timing->tile_us[col] += stage_timing->tile_us[col];
+    }
+  }
+  return VPX_CODEC_OK;
+}
+
+static vpx_codec_err_t ctrl_get_mode_info(vpx_codec_alg_priv_t *ctx,
+                                          va_list args) {
+  vpx_mode_info_map_t *const map = va_arg(args, vpx_mode_info_map_t *);
+  if (map == NULL) return VPX_CODEC_INVALID_PARAM;
+  if (ctx->frame_parallel_decode) return VPX_CODEC_INCAPABLE;
+  if (ctx->pbi == NULL || ctx->pbi->common.frame_to_show == NULL)
+    return VPX_CODEC_ERROR;
+  return vp9_get_mode_info(ctx->pbi, map);
+}
+
 static vpx_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   { VP8_COPY_REFERENCE, ctrl_copy_reference },
 
@@ -693,6 +1268,7 @@ static vpx_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   { VP9_DECODE_SVC_SPATIAL_LAYER, ctrl_set_spatial_layer_svc },
   { VP9D_SET_ROW_MT, ctrl_set_row_mt },
   { VP9D_SET_LOOP_FILTER_OPT, ctrl_enable_lpf_opt },
+  { VP9D_SET_COMPONENT_TIMING, ctrl_set_component_timing },
 
   // Getters
   { VPXD_GET_LAST_QUANTIZER, ctrl_get_quantizer },
@@ -702,6 +1278,8 @@ static vpx_codec_ctrl_fn_map_t decoder_ctrl_maps[] = {
   { VP9D_GET_DISPLAY_SIZE, ctrl_get_render_size },
   { VP9D_GET_BIT_DEPTH, ctrl_get_bit_depth },
   { VP9D_GET_FRAME_SIZE, ctrl_get_frame_size },
+  { VP9D_GET_COMPONENT_TIMING, ctrl_get_component_timing },
+  { VP9D_GET_MODE_INFO, ctrl_get_mode_info },
 
   { -1, NULL },
 };
@@ -716,6 +1294,7 @@ CODEC_INTERFACE(vpx_codec_vp9_dx) = {
   VPX_CODEC_CAP_HIGHBITDEPTH |
 #endif
       VPX_CODEC_CAP_DECODER | VP9_CAP_POSTPROC |
+      VPX_CODEC_CAP_FRAME_THREADING |
       VPX_CODEC_CAP_EXTERNAL_FRAME_BUFFER,  // vpx_codec_caps_t
   decoder_init,                             // vpx_codec_init_fn_t
   decoder_destroy,                          // vpx_codec_destroy_fn_t
@@ -11,10 +11,28 @@
 #ifndef VPX_VP9_VP9_DX_IFACE_H_
 #define VPX_VP9_VP9_DX_IFACE_H_
 
+#include "vpx_util/vpx_thread.h"
 #include "vp9/decoder/vp9_decoder.h"
+#include "vp9/decoder/vp9_dthread.h"
 
 typedef vpx_codec_stream_info_t vp9_stream_info_t;
 
+// Frame parallel decode: maximum number of frames decoded at the same time.
+#define MAX_FRAME_WORKERS 4
+// Frame parallel decode: maximum number of finished frames waiting to be
+// returned by decoder_get_frame().
+#define FRAME_CACHE_SIZE MAX_FRAME_WORKERS
+// Frame parallel decode: maximum number of frames returned by
+// decoder_get_frame() between two calls to decoder_decode(). The controls
+// that drain the frame workers can add up to MAX_FRAME_WORKERS frames to the
+// cache after it has been emptied.
+#define MAX_OUTPUT_FRAMES (FRAME_CACHE_SIZE + MAX_FRAME_WORKERS)
+
+typedef struct {
+  int fb_idx;
+  void *user_priv;
+} FrameCacheEntry;
+
 struct vpx_codec_alg_priv {
   vpx_codec_priv_t base;
   vpx_codec_dec_cfg_t cfg;
@@ -47,6 +65,34 @@ struct vpx_codec_alg_priv {
   int svc_spatial_layer;
   int row_mt;
   int lpf_opt;
+  // Stage timing, see VP9D_SET_COMPONENT_TIMING. decode_time_us is the time
+  // spent in decoder_decode().
+  int time_stages;
+  uint64_t decode_time_us;
+
+  // Frame parallel decode (VPX_CODEC_USE_FRAME_THREADING). Each frame worker
+  // owns a VP9Decoder sharing buffer_pool, and pbi points to the decoder of
+  // the last frame submitted.
+  int frame_parallel_decode;
+  VPxWorker *frame_workers;
+  int num_frame_workers;
+  int next_submit_worker_id;
+  int num_pending_frames;
+  int64_t frame_seq;
+  FrameCacheEntry frame_cache[FRAME_CACHE_SIZE];
+  int frame_cache_read;
+  int frame_cache_count;
+  // Frames returned by decoder_get_frame(). They are held until the next call
+  // to decoder_decode().
+  int output_fb_idx[MAX_OUTPUT_FRAMES];
+  int num_output_frames;
+  // Segmentation map of the last finished frame with segmentation enabled.
+  // It is valid for the next frame if seg_map_seq is not older than the last
+  // frame that reset the map (seg_map_reset_seq).
+  uint8_t *seg_map;
+  int seg_map_size;
+  int64_t seg_map_seq;
+  int64_t seg_map_reset_seq;
 };
 
 #endif  // VPX_VP9_VP9_DX_IFACE_H_
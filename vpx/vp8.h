@@ -112,6 +112,38 @@ typedef struct vp9_ref_frame {
   vpx_image_t img; /**< img structure to populate (output) */
 } vp9_ref_frame_t;
 
+/*!\brief VP9 mode info of a block
+ *
+ * The coding decisions of the block that covers an 8x8 area of a frame. A
+ * block larger than 8x8 is repeated for every 8x8 area it covers.
+ */
+typedef struct vpx_mode_info {
+  uint8_t block_width;  /**< Width of the block, 4 to 64 pixels */
+  uint8_t block_height; /**< Height of the block, 4 to 64 pixels */
+  /*!\brief Prediction mode as coded in the bitstream: DC_PRED (0) to TM_PRED
+   * (9) for intra blocks and NEARESTMV (10) to NEWMV (13) for inter blocks.
+   * Blocks smaller than 8x8 report the mode of their last 4x4 sub-block.
+   */
+  uint8_t mode;
+  /*!\brief Reference frames: 0 intra, 1 last, 2 golden, 3 altref, -1 none.
+   * ref_frame[1] is -1 unless the block uses compound prediction.
+   */
+  int8_t ref_frame[2];
+  int16_t mv_row[2]; /**< Motion vector rows, 1/8 pel */
+  int16_t mv_col[2]; /**< Motion vector columns, 1/8 pel */
+} vpx_mode_info_t;
+
+/*!\brief VP9 mode info of a frame
+ *
+ * See VP9D_GET_MODE_INFO and VP9E_SET_MODE_INFO.
+ */
+typedef struct vpx_mode_info_map {
+  /*! rows * cols entries, one per 8x8 area in raster order. */
+  vpx_mode_info_t *info;
+  unsigned int rows; /**< Number of 8x8 rows, (height + 7) / 8 */
+  unsigned int cols; /**< Number of 8x8 columns, (width + 7) / 8 */
+} vpx_mode_info_map_t;
+
 /*!\cond */
 /*!\brief vp8 decoder control function parameter type
  *
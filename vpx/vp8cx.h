@@ -778,6 +778,181 @@ enum vp8e_enc_control_id {
    * Supported in codecs: VP9
    */
   VP9E_ENABLE_EXTERNAL_RC_TPL,
+
+  /*!\brief Codec control function to encode closed GOPs in parallel,
+   * unsigned int parameter.
+   *
+   * In the last pass of a two pass encode, the frames are split into closed
+   * GOPs of kf_max_dist frames, each starting with a key frame. Up to the
+   * given number of GOPs are encoded at the same time, each by its own
+   * encoder instance using g_threads threads. The bits of the clip are split
+   * between the GOPs up front from the first pass stats, and the packets
+   * are returned in order once a GOP is complete, so the output lags the
+   * input by up to this many GOPs and the source frames of these GOPs are
+   * buffered. Only the configuration and the controls that are part of the
+   * encoder configuration apply to the GOPs.
+   *
+   * 0 or 1 : off (default)
+   * n > 1  : encode up to n GOPs in parallel
+   *
+   * Must be set before the first frame is encoded. Ignored unless g_pass is
+   * VPX_RC_LAST_PASS, kf_mode is VPX_KF_AUTO and no layers are used.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_GOP_PARALLEL,
+
+  /*!\brief Codec control function to encode the input images in place,
+   * vpx_zero_copy_input_t* parameter.
+   *
+   * By default the encoder copies each input image into a frame buffer of
+   * its own. Once this is set with a non NULL release_cb, the images passed
+   * to vpx_codec_encode() are lent to the encoder instead: they must stay
+   * valid and unchanged until release_cb is called with their user_priv.
+   * release_cb is called exactly once for every image accepted while this
+   * is set, at the latest when the encoder is destroyed.
+   *
+   * An image is used in place if it has the layout of the encoder's own
+   * frame buffers: planar (not NV12), each plane surrounded by a writable
+   * border of 160 pixels (80 for subsampled chroma) past its width and
+   * height rounded up to a multiple of 8, and a luma stride of that padded
+   * width rounded up to a multiple of 32 (the chroma stride being the luma
+   * stride shifted by x_chroma_shift). The application confirms the border
+   * with the border field, since the encoder cannot tell it from the image,
+   * and extends the frame edges into it. Other images, and all images while noise sensitivity is
+   * set, are copied and released right away. The application needs a pool
+   * of at least g_lag_in_frames + 2 images to avoid waiting on the encoder.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_ZERO_COPY_INPUT,
+
+  /*!\brief Codec control function to write the compressed frames into
+   * buffers of the application, vpx_output_buffers_t* parameter.
+   *
+   * By default the packets returned by vpx_codec_get_cx_data() point into
+   * storage of the encoder that is reused by the next call to
+   * vpx_codec_encode(). Once this is set with a non NULL get_cb, every
+   * frame packet is written at the start of a buffer returned by get_cb,
+   * superframe index included, and the buffer belongs to the application
+   * from the moment the packet is returned. get_cb is called with the
+   * largest size a frame can take before a frame is encoded into a new
+   * buffer. Buffers that were obtained but are not handed back in a packet
+   * are returned with release_cb, at the latest when the encoder is
+   * destroyed or this is changed. vpx_codec_encode() returns
+   * VPX_CODEC_MEM_ERROR if get_cb fails.
+   *
+   * Not used by the first pass and in GOP parallel mode.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_OUTPUT_BUFFERS,
+
+  /*!\brief Codec control function to time the stages of the encoder, int
+   * parameter.
+   *
+   * 0 : off (default)
+   * 1 : on, the stage times are reset and accumulated from here on
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_COMPONENT_TIMING,
+
+  /*!\brief Codec control function to get the time spent in the stages of the
+   * encoder since VP9E_SET_COMPONENT_TIMING was set,
+   * vpx_enc_component_timing_t* parameter.
+   *
+   * The stages overlap: encode_frame_us includes the trial packing of the
+   * recode loop, and all of them are part of total_us.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_GET_COMPONENT_TIMING,
+
+  /*!\brief Codec control function to seed the motion search of the last pass
+   * with the motion found in the first pass, int parameter.
+   *
+   * In the first pass, a #VPX_CODEC_FPMB_STATS_PKT is returned for every
+   * frame next to its stats packet. It holds the full pixel motion vector of
+   * every 16x16 block of the frame to the previous frame, as an array of
+   * 4 byte (row, col) pairs in raster order. In the last pass, the packets of
+   * the first pass, concatenated, are read from rc_firstpass_mb_stats_in.
+   * The first pass motion, scaled by the distance to the reference frame,
+   * is tried as an additional start point of the full pixel search, and the
+   * search window is narrowed around it when it is at least as good as the
+   * predicted motion vector.
+   *
+   * 0 : off (default)
+   * 1 : on, must be set in both passes
+   *
+   * Ignored with spatial or temporal layers.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_FP_MV_SEEDS,
+
+  /*!\brief Codec control function to pass motion hints for the next frame
+   * to the encoder, vpx_motion_hint_map_t* parameter.
+   *
+   * The hints are candidate motion vectors, e.g. the motion of a decoded
+   * source in a transcoder. The motion search of a block for the reference
+   * frame of its hint starts from the hint, if it predicts the block at
+   * least as well as the predicted motion vector, and searches a narrower
+   * window around it. With refine_only set, the search always starts from
+   * the hint and only refines it by a few pixels.
+   *
+   * The hints are used for the next frame that is encoded only, they are
+   * meant to be set before every call to vpx_codec_encode() with
+   * g_lag_in_frames set to 0. A NULL hints pointer clears them.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_MOTION_HINTS,
+
+  /*!\brief Codec control function to pass the mode info of the source frame
+   * of a transcode for the next frame to the encoder, vpx_mode_info_map_t*
+   * parameter.
+   *
+   * The mode info, as returned by VP9D_GET_MODE_INFO, is taken as the starting
+   * decision instead of a full search: the frame is partitioned as the source
+   * was, only the one level larger and smaller partitions are tried in the rd
+   * search, the blocks only search the reference frames of the source block
+   * and the motion search refines the source motion vectors. The source frame
+   * is expected to have the same size and use the same reference frames.
+   *
+   * The mode info is used for the next frame that is encoded only, it is
+   * meant to be set before every call to vpx_codec_encode() with
+   * g_lag_in_frames set to 0. A NULL info pointer clears it.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_MODE_INFO,
+
+  /*!\brief Codec control function to set a target encode time per frame in
+   * microseconds, unsigned int parameter.
+   *
+   * The encoder measures the time it spends on every frame and adapts the
+   * speed between frames to stay within the budget: it encodes faster than
+   * the speed set with VP8E_SET_CPUUSED when the recent inter frames took
+   * longer than the budget, and goes back towards it once they take well
+   * below it for a while. Key frames are not taken into account.
+   *
+   * 0 : off (default)
+   *
+   * Only used with the VPX_DL_REALTIME deadline in one pass mode, and
+   * ignored with spatial or temporal layers.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_SET_FRAME_TIME_BUDGET,
+
+  /*!\brief Codec control function to get the state of the speed adaptation
+   * set up with VP9E_SET_FRAME_TIME_BUDGET, vpx_speed_control_stats_t*
+   * parameter.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9E_GET_SPEED_CONTROL_STATS,
 };
 
 /*!\brief vpx 1-D scaling mode
@@ -842,6 +1017,33 @@ typedef struct vpx_roi_map {
   unsigned int static_threshold[4];
 } vpx_roi_map_t;
 
+/*!\brief vpx motion hint
+ *
+ * A candidate motion vector for a block.
+ */
+typedef struct vpx_motion_hint {
+  int16_t mv_row; /**< Vertical component, in 1/8 pixels. */
+  int16_t mv_col; /**< Horizontal component, in 1/8 pixels. */
+  /*! Reference frame the motion vector points into: 1 for last, 2 for
+   * golden and 3 for altref. Any other value means no hint. */
+  int8_t ref_frame;
+} vpx_motion_hint_t;
+
+/*!\brief vpx motion hint map
+ *
+ * Motion hints for the blocks of a frame, see VP9E_SET_MOTION_HINTS.
+ */
+typedef struct vpx_motion_hint_map {
+  /*! rows * cols hints in raster order. */
+  vpx_motion_hint_t *hints;
+  unsigned int rows; /**< Number of rows. */
+  unsigned int cols; /**< Number of columns. */
+  /*! Width and height of the blocks in pixels, 8 or 16. */
+  unsigned int block_size;
+  /*! Only refine the hints instead of searching around them. */
+  int refine_only;
+} vpx_motion_hint_map_t;
+
 /*!\brief  vpx active region map
  *
  * These defines the data structures for active region map
@@ -969,6 +1171,85 @@ typedef struct vpx_svc_spatial_layer_sync {
   int base_layer_intra_only; /**< Flag for setting Intra-only frame on base */
 } vpx_svc_spatial_layer_sync_t;
 
+/*!\brief Callback returning an input image lent to the encoder.
+ *
+ * \param[in] cb_priv   The cb_priv of the vpx_zero_copy_input_t
+ * \param[in] user_priv The user_priv of the vpx_image_t that was encoded
+ */
+typedef void (*vpx_release_input_cb_fn_t)(void *cb_priv, void *user_priv);
+
+/*!\brief vp9 zero copy input configuration
+ *
+ * Configures the input images lent to the encoder, see
+ * VP9E_SET_ZERO_COPY_INPUT.
+ */
+typedef struct vpx_zero_copy_input {
+  vpx_release_input_cb_fn_t release_cb; /**< NULL turns zero copy off */
+  void *cb_priv;                        /**< Passed to release_cb */
+  /*!\brief Writable border of the images around the luma plane, in pixels.
+   * Images are only used in place if it is at least 160. */
+  int border;
+} vpx_zero_copy_input_t;
+
+/*!\brief Callback getting an output buffer from the application.
+ *
+ * \param[in]  cb_priv   The cb_priv of the vpx_output_buffers_t
+ * \param[in]  min_size  Minimum size of the buffer in bytes
+ * \param[out] buf       The buffer
+ *
+ * \return 0 on success, a buffer of at least min_size bytes is in buf.
+ */
+typedef int (*vpx_get_output_buffer_cb_fn_t)(void *cb_priv, size_t min_size,
+                                             vpx_fixed_buf_t *buf);
+
+/*!\brief Callback returning an output buffer the encoder did not use.
+ *
+ * \param[in] cb_priv The cb_priv of the vpx_output_buffers_t
+ * \param[in] buf     The buffer returned by the get callback
+ */
+typedef void (*vpx_release_output_buffer_cb_fn_t)(void *cb_priv,
+                                                  vpx_fixed_buf_t *buf);
+
+/*!\brief vp9 output buffer configuration
+ *
+ * Configures the buffers the encoder writes the compressed frames into, see
+ * VP9E_SET_OUTPUT_BUFFERS.
+ */
+typedef struct vpx_output_buffers {
+  vpx_get_output_buffer_cb_fn_t get_cb; /**< NULL uses internal storage */
+  vpx_release_output_buffer_cb_fn_t release_cb; /**< Returns unused buffers */
+  void *cb_priv; /**< Passed to the callbacks */
+} vpx_output_buffers_t;
+
+/*!\brief vp9 encoder stage times
+ *
+ * Wall clock time in microseconds spent in the stages of the encoder, see
+ * VP9E_GET_COMPONENT_TIMING.
+ */
+typedef struct vpx_enc_component_timing {
+  unsigned int frames;         /**< Frames encoded while timing */
+  uint64_t total_us;           /**< Time in vpx_codec_encode() */
+  uint64_t first_pass_us;      /**< First pass analysis */
+  uint64_t temporal_filter_us; /**< Alt-ref temporal filtering */
+  uint64_t tpl_us;             /**< Temporal dependency model */
+  uint64_t encode_frame_us;    /**< Mode decision and recode loop */
+  uint64_t loop_filter_us;     /**< Filter level search and filtering */
+  uint64_t pack_bitstream_us;  /**< Writing the final bitstream */
+} vpx_enc_component_timing_t;
+
+/*!\brief vp9 encoder speed adaptation state
+ *
+ * See VP9E_GET_SPEED_CONTROL_STATS. The counts start when the frame time
+ * budget is set.
+ */
+typedef struct vpx_speed_control_stats {
+  int speed;                       /**< Speed of the next frame */
+  unsigned int frames;             /**< Frames encoded with the budget */
+  unsigned int frames_over_budget; /**< Frames that took longer */
+  unsigned int speed_changes;      /**< Number of speed changes */
+  uint64_t avg_frame_us;           /**< Recent average inter frame time */
+} vpx_speed_control_stats_t;
+
 /*!\cond */
 /*!\brief VP8 encoder control function parameter type
  *
@@ -1110,6 +1391,26 @@ VPX_CTRL_USE_TYPE(VP9E_SET_QUANTIZER_ONE_PASS, int)
 #define VPX_CTRL_VP9E_SET_QUANTIZER_ONE_PASS
 VPX_CTRL_USE_TYPE(VP9E_ENABLE_EXTERNAL_RC_TPL, int)
 #define VPX_CTRL_VP9E_ENABLE_EXTERNAL_RC_TPL
+VPX_CTRL_USE_TYPE(VP9E_SET_GOP_PARALLEL, unsigned int)
+#define VPX_CTRL_VP9E_SET_GOP_PARALLEL
+VPX_CTRL_USE_TYPE(VP9E_SET_ZERO_COPY_INPUT, vpx_zero_copy_input_t *)
+#define VPX_CTRL_VP9E_SET_ZERO_COPY_INPUT
+VPX_CTRL_USE_TYPE(VP9E_SET_OUTPUT_BUFFERS, vpx_output_buffers_t *)
+#define VPX_CTRL_VP9E_SET_OUTPUT_BUFFERS
+VPX_CTRL_USE_TYPE(VP9E_SET_COMPONENT_TIMING, int)
+#define VPX_CTRL_VP9E_SET_COMPONENT_TIMING
+VPX_CTRL_USE_TYPE(VP9E_GET_COMPONENT_TIMING, vpx_enc_component_timing_t *)
+#define VPX_CTRL_VP9E_GET_COMPONENT_TIMING
+VPX_CTRL_USE_TYPE(VP9E_SET_FP_MV_SEEDS, int)
+#define VPX_CTRL_VP9E_SET_FP_MV_SEEDS
+VPX_CTRL_USE_TYPE(VP9E_SET_MOTION_HINTS, vpx_motion_hint_map_t *)
+#define VPX_CTRL_VP9E_SET_MOTION_HINTS
+VPX_CTRL_USE_TYPE(VP9E_SET_MODE_INFO, vpx_mode_info_map_t *)
+#define VPX_CTRL_VP9E_SET_MODE_INFO
+VPX_CTRL_USE_TYPE(VP9E_SET_FRAME_TIME_BUDGET, unsigned int)
+#define VPX_CTRL_VP9E_SET_FRAME_TIME_BUDGET
+VPX_CTRL_USE_TYPE(VP9E_GET_SPEED_CONTROL_STATS, vpx_speed_control_stats_t *)
+#define VPX_CTRL_VP9E_GET_SPEED_CONTROL_STATS
 
 /*!\endcond */
 /*! @} - end defgroup vp8_encoder */
@@ -158,6 +158,42 @@ enum vp8_dec_control_id {
    */
   VP9D_SET_LOOP_FILTER_OPT,
 
+  /*!\brief Codec control function to time the stages of the decoder, int
+   * parameter.
+   *
+   * 0 : off (default)
+   * 1 : on, the stage times are reset and accumulated from here on
+   *
+   * Supported in codecs: VP9
+   */
+  VP9D_SET_COMPONENT_TIMING,
+
+  /*!\brief Codec control function to get the time spent in the stages of the
+   * decoder since VP9D_SET_COMPONENT_TIMING was set,
+   * vpx_dec_component_timing_t* parameter.
+   *
+   * In frame parallel mode the frames still being decoded are not included.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9D_GET_COMPONENT_TIMING,
+
+  /*!\brief Codec control function to get the mode info of the last decoded
+   * frame, vpx_mode_info_map_t* parameter.
+   *
+   * The caller allocates the map, whose rows and cols must match the frame
+   * size reported by VP9D_GET_FRAME_SIZE. The result can be passed to the
+   * encoder with VP9E_SET_MODE_INFO to transcode the frame. Not available in
+   * frame parallel mode.
+   *
+   * Returns VPX_CODEC_ERROR if the last frame decoded shows an existing frame
+   * (show_existing_frame): no mode info is coded for it, and the frame it
+   * shows may not be the last one coded.
+   *
+   * Supported in codecs: VP9
+   */
+  VP9D_GET_MODE_INFO,
+
   VP8_DECODER_CTRL_ID_MAX
 };
 
@@ -179,6 +215,32 @@ typedef struct vpx_decrypt_init {
   void *decrypt_state;
 } vpx_decrypt_init;
 
+/*!\brief Maximum number of tile columns of a frame. */
+#define VPX_MAX_TILE_COLS 64
+
+/*!\brief vp9 decoder stage times
+ *
+ * Wall clock time in microseconds spent in the stages of the decoder, see
+ * VP9D_GET_COMPONENT_TIMING. Work done on several threads at once is summed
+ * over the threads, so the stages may add up to more than total_us.
+ */
+typedef struct vpx_dec_component_timing {
+  /*! Frames decoded while timing. */
+  unsigned int frames;
+  /*! Time in vpx_codec_decode(). */
+  uint64_t total_us;
+  /*! Frame headers, and the tile data when it is parsed ahead of the
+   * reconstruction by row based multi-threading. */
+  uint64_t parse_us;
+  /*! Tile data, including its parsing unless that is done ahead. */
+  uint64_t recon_us;
+  /*! Loop filtering, or the time waited for it when it runs on a thread of
+   * its own next to single threaded tile decoding. */
+  uint64_t loop_filter_us;
+  /*! Parsing and reconstruction per tile column, summed over tile rows. */
+  uint64_t tile_us[VPX_MAX_TILE_COLS];
+} vpx_dec_component_timing_t;
+
 /*!\cond */
 /*!\brief VP8 decoder control function parameter type
  *
@@ -217,6 +279,12 @@ VPX_CTRL_USE_TYPE(VP9D_SET_ROW_MT, int)
 #define VPX_CTRL_VP9_DECODE_SET_ROW_MT
 VPX_CTRL_USE_TYPE(VP9D_SET_LOOP_FILTER_OPT, int)
 #define VPX_CTRL_VP9_SET_LOOP_FILTER_OPT
+VPX_CTRL_USE_TYPE(VP9D_SET_COMPONENT_TIMING, int)
+#define VPX_CTRL_VP9D_SET_COMPONENT_TIMING
+VPX_CTRL_USE_TYPE(VP9D_GET_COMPONENT_TIMING, vpx_dec_component_timing_t *)
+#define VPX_CTRL_VP9D_GET_COMPONENT_TIMING
+VPX_CTRL_USE_TYPE(VP9D_GET_MODE_INFO, vpx_mode_info_map_t *)
+#define VPX_CTRL_VP9D_GET_MODE_INFO
 
 /*!\endcond */
 /*! @} - end defgroup vp8_decoder */
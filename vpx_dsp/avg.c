@@ -367,6 +367,30 @@ int16_t vpx_int_pro_col_c(const uint8_t *ref, const int width) {
   return sum;
 }
 
+// Projects width (a multiple of 16) columns onto hbuf[0, width), 16 at a
+// time. Built on vpx_int_pro_row() so targets without a batched version
+// still use their single strip kernel.
+void vpx_int_pro_row_batch_c(int16_t *hbuf, const uint8_t *ref,
+                             const int ref_stride, const int width,
+                             const int height) {
+  int idx;
+  for (idx = 0; idx < width; idx += 16) {
+    vpx_int_pro_row(&hbuf[idx], ref + idx, ref_stride, height);
+  }
+}
+
+// Projects height rows of width pixels onto vbuf[0, height), each sum
+// shifted down by norm_factor.
+void vpx_int_pro_col_batch_c(int16_t *vbuf, const uint8_t *ref,
+                             const int ref_stride, const int width,
+                             const int height, const int norm_factor) {
+  int idx;
+  for (idx = 0; idx < height; ++idx) {
+    vbuf[idx] = vpx_int_pro_col(ref, width) >> norm_factor;
+    ref += ref_stride;
+  }
+}
+
 // ref: [0 - 510]
 // src: [0 - 510]
 // bwl: {2, 3, 4}
@@ -517,3 +517,146 @@ int vpx_highbd_satd_avx2(const tran_low_t *coeff, int length) {
   }
 }
 #endif  // CONFIG_VP9_HIGHBITDEPTH
+
+void vpx_int_pro_row_avx2(int16_t hbuf[16], const uint8_t *ref,
+                          const int ref_stride, const int height) {
+  // Two accumulators to keep the adds independent. The sums are at most
+  // 64 * 255, so 16 bits do not overflow.
+  __m256i s0 = _mm256_setzero_si256();
+  __m256i s1 = _mm256_setzero_si256();
+  const int shift = height == 64 ? 5 : height == 32 ? 4 : 3;
+  int i;
+
+  for (i = 0; i < height; i += 2) {
+    s0 = _mm256_add_epi16(
+        s0, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)ref)));
+    s1 = _mm256_add_epi16(s1, _mm256_cvtepu8_epi16(_mm_loadu_si128(
+                                  (const __m128i *)(ref + ref_stride))));
+    ref += 2 * ref_stride;
+  }
+
+  s0 = _mm256_srai_epi16(_mm256_add_epi16(s0, s1), shift);
+  _mm256_storeu_si256((__m256i *)hbuf, s0);
+}
+
+void vpx_int_pro_row_batch_avx2(int16_t *hbuf, const uint8_t *ref,
+                                const int ref_stride, const int width,
+                                const int height) {
+  const int shift = height == 64 ? 5 : height == 32 ? 4 : 3;
+  int c = 0;
+
+  // Walk the rows once for each 64 columns rather than once per 16.
+  for (; c + 64 <= width; c += 64) {
+    const uint8_t *r = ref + c;
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = _mm256_setzero_si256();
+    __m256i s2 = _mm256_setzero_si256();
+    __m256i s3 = _mm256_setzero_si256();
+    int i;
+    for (i = 0; i < height; ++i) {
+      s0 = _mm256_add_epi16(
+          s0, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)r)));
+      s1 = _mm256_add_epi16(
+          s1, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(r + 16))));
+      s2 = _mm256_add_epi16(
+          s2, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(r + 32))));
+      s3 = _mm256_add_epi16(
+          s3, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(r + 48))));
+      r += ref_stride;
+    }
+    _mm256_storeu_si256((__m256i *)(hbuf + c), _mm256_srai_epi16(s0, shift));
+    _mm256_storeu_si256((__m256i *)(hbuf + c + 16),
+                        _mm256_srai_epi16(s1, shift));
+    _mm256_storeu_si256((__m256i *)(hbuf + c + 32),
+                        _mm256_srai_epi16(s2, shift));
+    _mm256_storeu_si256((__m256i *)(hbuf + c + 48),
+                        _mm256_srai_epi16(s3, shift));
+  }
+
+  for (; c < width; c += 16) {
+    vpx_int_pro_row_avx2(hbuf + c, ref + c, ref_stride, height);
+  }
+}
+
+// Returns the sum of width pixels as 4 partial 64-bit sums.
+static INLINE __m256i row_sum_avx2(const uint8_t *ref, const int width) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i s;
+  int i;
+
+  if (width == 16) {
+    return _mm256_castsi128_si256(_mm_sad_epu8(
+        _mm_loadu_si128((const __m128i *)ref), _mm_setzero_si128()));
+  }
+
+  s = _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)ref), zero);
+  for (i = 32; i < width; i += 32) {
+    s = _mm256_add_epi64(
+        s, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)(ref + i)),
+                           zero));
+  }
+  return s;
+}
+
+int16_t vpx_int_pro_col_avx2(const uint8_t *ref, const int width) {
+  const __m256i s = row_sum_avx2(ref, width);
+  __m128i sum = _mm256_castsi256_si128(s);
+  if (width > 16) sum = _mm_add_epi64(sum, _mm256_extracti128_si256(s, 1));
+  sum = _mm_add_epi64(sum, _mm_srli_si128(sum, 8));
+  return (int16_t)_mm_cvtsi128_si32(sum);
+}
+
+void vpx_int_pro_col_batch_avx2(int16_t *vbuf, const uint8_t *ref,
+                                const int ref_stride, const int width,
+                                const int height, const int norm_factor) {
+  const __m128i shift = _mm_cvtsi32_si128(norm_factor);
+  int r;
+
+  // The row sums fit in 16 bits, so the partial sums of 4 rows are packed
+  // into the 4 words of each 64-bit lane and reduced together.
+  for (r = 0; r + 4 <= height; r += 4) {
+    const __m256i s0 = row_sum_avx2(ref, width);
+    const __m256i s1 = row_sum_avx2(ref + ref_stride, width);
+    const __m256i s2 = row_sum_avx2(ref + 2 * ref_stride, width);
+    const __m256i s3 = row_sum_avx2(ref + 3 * ref_stride, width);
+    const __m256i s = _mm256_or_si256(
+        _mm256_or_si256(s0, _mm256_slli_epi64(s1, 16)),
+        _mm256_or_si256(_mm256_slli_epi64(s2, 32), _mm256_slli_epi64(s3, 48)));
+    __m128i sum = _mm256_castsi256_si128(s);
+    if (width > 16) sum = _mm_add_epi16(sum, _mm256_extracti128_si256(s, 1));
+    sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+    _mm_storel_epi64((__m128i *)(vbuf + r), _mm_srl_epi16(sum, shift));
+    ref += 4 * ref_stride;
+  }
+
+  for (; r < height; ++r) {
+    vbuf[r] = vpx_int_pro_col_avx2(ref, width) >> norm_factor;
+    ref += ref_stride;
+  }
+}
+
+int vpx_vector_var_avx2(const int16_t *ref, const int16_t *src, const int bwl) {
+  const int width = 4 << bwl;
+  __m256i sum = _mm256_setzero_si256();
+  __m256i sse = _mm256_setzero_si256();
+  int mean, var, i;
+
+  for (i = 0; i < width; i += 16) {
+    const __m256i r = _mm256_loadu_si256((const __m256i *)(ref + i));
+    const __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+    const __m256i diff = _mm256_sub_epi16(r, s);
+    sum = _mm256_add_epi16(sum, diff);
+    sse = _mm256_add_epi32(sse, _mm256_madd_epi16(diff, diff));
+  }
+
+  {  // 32 bit horizontal add
+    const __m256i a =
+        _mm256_hadd_epi32(_mm256_madd_epi16(sum, _mm256_set1_epi16(1)), sse);
+    const __m256i b = _mm256_hadd_epi32(a, a);
+    const __m128i c = _mm_add_epi32(_mm256_castsi256_si128(b),
+                                    _mm256_extracti128_si256(b, 1));
+    mean = _mm_cvtsi128_si32(c);
+    var = _mm_extract_epi32(c, 1) - ((mean * mean) >> (bwl + 2));
+  }
+  return var;
+}
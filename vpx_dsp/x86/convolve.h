@@ -269,9 +269,9 @@ typedef void highbd_filter8_1dfunction(const uint16_t *src_ptr,
                                                y0_q4, y_step_q4, w, h, bd);    \
       }                                                                        \
     } else {                                                                   \
-      vpx_highbd_convolve8_##avg##c(src, src_stride, dst, dst_stride, filter,  \
-                                    x0_q4, x_step_q4, y0_q4, y_step_q4, w, h,  \
-                                    bd);                                       \
+      highbd_convolve8_##avg##scaled_##opt(                                    \
+          src, src_stride, dst, dst_stride, filter, x0_q4, x_step_q4, y0_q4,   \
+          y_step_q4, w, h, bd);                                                \
     }                                                                          \
   }
 
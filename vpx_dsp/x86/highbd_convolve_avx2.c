@@ -1438,6 +1438,200 @@ static void vpx_highbd_filter_block1d16_v4_avx2(
                                      dst_stride, height, kernel, bd);
 }
 
+// -----------------------------------------------------------------------------
+// Scaled 2D filtering
+
+// Filter 8 horizontally scaled outputs. Output k reads 8 pixels at src[k] with
+// filter[k]; outputs k and k + 4 share a register, one per lane.
+static INLINE __m128i highbd_filter_horiz_scaled_8_avx2(
+    const uint16_t *const src[8], const int16_t *const filter[8],
+    const __m256i max) {
+  const __m256i rounding = _mm256_set1_epi32(1 << (FILTER_BITS - 1));
+  __m256i m[4], sum;
+  int k;
+
+  for (k = 0; k < 4; ++k) {
+    const __m256i f = mm256_loadu2_si128(filter[k], filter[k + 4]);
+    m[k] = _mm256_madd_epi16(mm256_loadu2_si128(src[k], src[k + 4]), f);
+  }
+  // Lane 0 holds the sums of outputs 0-3 and lane 1 those of outputs 4-7.
+  sum = _mm256_hadd_epi32(_mm256_hadd_epi32(m[0], m[1]),
+                          _mm256_hadd_epi32(m[2], m[3]));
+  sum = _mm256_srai_epi32(_mm256_add_epi32(sum, rounding), FILTER_BITS);
+  sum = _mm256_packus_epi32(sum, sum);
+  sum = _mm256_permute4x64_epi64(sum, 0x08);
+  return _mm_min_epu16(_mm256_castsi256_si128(sum),
+                       _mm256_castsi256_si128(max));
+}
+
+static void highbd_convolve_horiz_scaled_avx2(
+    const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *x_filters, int x0_q4,
+    int x_step_q4, int w, int h, int bd) {
+  const __m256i max = _mm256_set1_epi16((1 << bd) - 1);
+  int x, y, k;
+  src -= SUBPEL_TAPS / 2 - 1;
+
+  for (y = 0; y < h; ++y) {
+    int x_q4 = x0_q4;
+    for (x = 0; x < w; x += 8) {
+      const uint16_t *src_x[8];
+      const int16_t *x_filter[8];
+      for (k = 0; k < 8; ++k) {
+        // A width of 4 repeats the first 4 outputs so that the full 8 values
+        // written to the intermediate buffer are initialized.
+        const int q4 = x_q4 + (w == 4 ? (k & 3) : k) * x_step_q4;
+        src_x[k] = &src[q4 >> SUBPEL_BITS];
+        x_filter[k] = x_filters[q4 & SUBPEL_MASK];
+      }
+      _mm_storeu_si128((__m128i *)&dst[x],
+                       highbd_filter_horiz_scaled_8_avx2(src_x, x_filter, max));
+      x_q4 += 8 * x_step_q4;
+    }
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+// Filter 16 columns of one vertically scaled output row.
+static INLINE __m256i highbd_filter_vert_scaled_16_avx2(const uint16_t *src,
+                                                        ptrdiff_t src_stride,
+                                                        const __m256i *f,
+                                                        const __m256i max) {
+  const __m256i rounding = _mm256_set1_epi32(1 << (FILTER_BITS - 1));
+  __m256i sum_lo = rounding, sum_hi = rounding;
+  int k;
+
+  for (k = 0; k < 4; ++k) {
+    const __m256i s0 =
+        _mm256_loadu_si256((const __m256i *)(src + 2 * k * src_stride));
+    const __m256i s1 =
+        _mm256_loadu_si256((const __m256i *)(src + (2 * k + 1) * src_stride));
+    sum_lo = _mm256_add_epi32(
+        sum_lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), f[k]));
+    sum_hi = _mm256_add_epi32(
+        sum_hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), f[k]));
+  }
+  sum_lo = _mm256_srai_epi32(sum_lo, FILTER_BITS);
+  sum_hi = _mm256_srai_epi32(sum_hi, FILTER_BITS);
+  // The unpacks and the pack stay within each lane, so the output is in order.
+  return _mm256_min_epu16(_mm256_packus_epi32(sum_lo, sum_hi), max);
+}
+
+// Filter 8 columns of one vertically scaled output row.
+static INLINE __m128i highbd_filter_vert_scaled_8_avx2(const uint16_t *src,
+                                                       ptrdiff_t src_stride,
+                                                       const __m256i *f,
+                                                       const __m256i max) {
+  __m256i sum = _mm256_set1_epi32(1 << (FILTER_BITS - 1));
+  int k;
+
+  for (k = 0; k < 4; ++k) {
+    const __m128i s0 =
+        _mm_loadu_si128((const __m128i *)(src + 2 * k * src_stride));
+    const __m128i s1 =
+        _mm_loadu_si128((const __m128i *)(src + (2 * k + 1) * src_stride));
+    const __m256i s = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_unpacklo_epi16(s0, s1)),
+        _mm_unpackhi_epi16(s0, s1), 1);
+    sum = _mm256_add_epi32(sum, _mm256_madd_epi16(s, f[k]));
+  }
+  sum = _mm256_srai_epi32(sum, FILTER_BITS);
+  sum = _mm256_packus_epi32(sum, sum);
+  sum = _mm256_permute4x64_epi64(sum, 0x08);
+  return _mm_min_epu16(_mm256_castsi256_si128(sum),
+                       _mm256_castsi256_si128(max));
+}
+
+static void highbd_convolve_vert_scaled_avx2(
+    const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *y_filters, int y0_q4,
+    int y_step_q4, int w, int h, int bd, int is_avg) {
+  const __m256i max = _mm256_set1_epi16((1 << bd) - 1);
+  int x, y, k;
+  int y_q4 = y0_q4;
+
+  src -= src_stride * (SUBPEL_TAPS / 2 - 1);
+  for (y = 0; y < h; ++y) {
+    const uint16_t *const src_y = &src[(y_q4 >> SUBPEL_BITS) * src_stride];
+    const int16_t *const y_filter = y_filters[y_q4 & SUBPEL_MASK];
+    __m256i f[4];
+
+    for (k = 0; k < 4; ++k) {
+      f[k] = _mm256_set1_epi32((int)((uint16_t)y_filter[2 * k] |
+                                     ((uint32_t)y_filter[2 * k + 1] << 16)));
+    }
+
+    if (w >= 16) {
+      for (x = 0; x < w; x += 16) {
+        __m256i res =
+            highbd_filter_vert_scaled_16_avx2(src_y + x, src_stride, f, max);
+        if (is_avg) {
+          res = _mm256_avg_epu16(
+              res, _mm256_loadu_si256((const __m256i *)&dst[x]));
+        }
+        _mm256_storeu_si256((__m256i *)&dst[x], res);
+      }
+    } else {
+      __m128i res = highbd_filter_vert_scaled_8_avx2(src_y, src_stride, f, max);
+      if (w == 8) {
+        if (is_avg) {
+          res = _mm_avg_epu16(res, _mm_loadu_si128((const __m128i *)dst));
+        }
+        _mm_storeu_si128((__m128i *)dst, res);
+      } else {
+        if (is_avg) {
+          res = _mm_avg_epu16(res, _mm_loadl_epi64((const __m128i *)dst));
+        }
+        _mm_storel_epi64((__m128i *)dst, res);
+      }
+    }
+    y_q4 += y_step_q4;
+    dst += dst_stride;
+  }
+}
+
+static void highbd_convolve_scaled_avx2(const uint16_t *src,
+                                        ptrdiff_t src_stride, uint16_t *dst,
+                                        ptrdiff_t dst_stride,
+                                        const InterpKernel *filter, int x0_q4,
+                                        int x_step_q4, int y0_q4, int y_step_q4,
+                                        int w, int h, int bd, int is_avg) {
+  // See highbd_convolve() in vpx_dsp/vpx_convolve.c for the derivation of the
+  // temp buffer size.
+  DECLARE_ALIGNED(32, uint16_t, temp[64 * 135]);
+  const int intermediate_height =
+      (((h - 1) * y_step_q4 + y0_q4) >> SUBPEL_BITS) + SUBPEL_TAPS;
+
+  assert(w <= 64);
+  assert(h <= 64);
+  assert(y_step_q4 <= 32);
+  assert(x_step_q4 <= 32);
+
+  highbd_convolve_horiz_scaled_avx2(src - src_stride * (SUBPEL_TAPS / 2 - 1),
+                                    src_stride, temp, 64, filter, x0_q4,
+                                    x_step_q4, w, intermediate_height, bd);
+  highbd_convolve_vert_scaled_avx2(temp + 64 * (SUBPEL_TAPS / 2 - 1), 64, dst,
+                                   dst_stride, filter, y0_q4, y_step_q4, w, h,
+                                   bd, is_avg);
+}
+
+static void highbd_convolve8_scaled_avx2(
+    const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *filter, int x0_q4, int x_step_q4,
+    int y0_q4, int y_step_q4, int w, int h, int bd) {
+  highbd_convolve_scaled_avx2(src, src_stride, dst, dst_stride, filter, x0_q4,
+                              x_step_q4, y0_q4, y_step_q4, w, h, bd, 0);
+}
+
+static void highbd_convolve8_avg_scaled_avx2(
+    const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *filter, int x0_q4, int x_step_q4,
+    int y0_q4, int y_step_q4, int w, int h, int bd) {
+  highbd_convolve_scaled_avx2(src, src_stride, dst, dst_stride, filter, x0_q4,
+                              x_step_q4, y0_q4, y_step_q4, w, h, bd, 1);
+}
+
 // From vpx_dsp/x86/vpx_high_subpixel_8t_sse2.asm.
 highbd_filter8_1dfunction vpx_highbd_filter_block1d4_h8_sse2;
 highbd_filter8_1dfunction vpx_highbd_filter_block1d4_v8_sse2;
@@ -0,0 +1,309 @@
+/*
+ *  Copyright (c) 2024 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+// As in intrapred_avx2.c, each predictor writes its filtered edge pixels to a
+// buffer in prediction order and every row is a shifted copy of that buffer.
+// A row of bs pixels is bs / 16 vectors.
+
+// (x + 2 * y + z + 2) >> 2, computed as avg(avg(x, z) - ((x ^ z) & 1), y).
+static INLINE __m256i avg3_epu16(const __m256i x, const __m256i y,
+                                 const __m256i z) {
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i a = _mm256_avg_epu16(x, z);
+  const __m256i b =
+      _mm256_subs_epu16(a, _mm256_and_si256(_mm256_xor_si256(x, z), one));
+  return _mm256_avg_epu16(b, y);
+}
+
+// Returns words [1, 17) of the 32 word vector a:b, with a in the low half.
+static INLINE __m256i shr1_epi16(const __m256i a, const __m256i b) {
+  return _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a, 2);
+}
+
+// Returns words [2, 18) of the 32 word vector a:b, with a in the low half.
+static INLINE __m256i shr2_epi16(const __m256i a, const __m256i b) {
+  return _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a, 4);
+}
+
+// Reverses the order of the 16 words in a.
+static INLINE __m256i reverse_epi16(const __m256i a) {
+  const __m256i rev =
+      _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                       14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, rev), 0x4e);
+}
+
+// Returns the even words of a in the low half and the odd ones in the high
+// half.
+static INLINE __m256i deinterleave_epi16(const __m256i a) {
+  const __m256i even_odd =
+      _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15, 0,
+                       1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+  return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, even_odd), 0xd8);
+}
+
+// Interleaves the words of a and b into lo (words [0, 8)) and hi ([8, 16)).
+static INLINE void interleave_epi16(const __m256i a, const __m256i b,
+                                    __m256i *lo, __m256i *hi) {
+  const __m256i l = _mm256_unpacklo_epi16(a, b);
+  const __m256i h = _mm256_unpackhi_epi16(a, b);
+  *lo = _mm256_permute2x128_si256(l, h, 0x20);
+  *hi = _mm256_permute2x128_si256(l, h, 0x31);
+}
+
+// Replaces word 15 of a with that of v.
+static INLINE __m256i fill_last_epi16(const __m256i a, const __m256i v) {
+  return _mm256_blend_epi32(_mm256_blend_epi16(a, v, 0x80), a, 0x0f);
+}
+
+static INLINE void store_rows(uint16_t *dst, ptrdiff_t stride,
+                              const uint16_t *edge, int step, int bs) {
+  int r, c;
+  for (r = 0; r < bs; ++r) {
+    for (c = 0; c < bs; c += 16) {
+      _mm256_storeu_si256((__m256i *)(dst + c),
+                          _mm256_loadu_si256((const __m256i *)(edge + c)));
+    }
+    dst += stride;
+    edge += step;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// D45 and D63 use |above| only. Row r of D45 starts at AVG3 output r; entries
+// past bs - 2 are the last above pixel. D63 does the same every other row,
+// alternating between AVG2 and AVG3 of |above|.
+
+static INLINE void d45_avx2(uint16_t *dst, ptrdiff_t stride,
+                            const uint16_t *above, int bs) {
+  DECLARE_ALIGNED(32, uint16_t, edge[64]);
+  const __m256i ar = _mm256_set1_epi16((int16_t)above[bs - 1]);
+  __m256i a = _mm256_loadu_si256((const __m256i *)above);
+  int c;
+  for (c = 0; c < bs; c += 16) {
+    const __m256i next = _mm256_loadu_si256((const __m256i *)(above + c + 16));
+    const __m256i avg3 =
+        avg3_epu16(a, shr1_epi16(a, next), shr2_epi16(a, next));
+    _mm256_store_si256((__m256i *)(edge + c),
+                       c + 16 < bs ? avg3 : fill_last_epi16(avg3, ar));
+    _mm256_store_si256((__m256i *)(edge + bs + c), ar);
+    a = next;
+  }
+  store_rows(dst, stride, edge, 1, bs);
+}
+
+static INLINE void d63_avx2(uint16_t *dst, ptrdiff_t stride,
+                            const uint16_t *above, int bs) {
+  DECLARE_ALIGNED(32, uint16_t, edge2[64]);
+  DECLARE_ALIGNED(32, uint16_t, edge3[64]);
+  const __m256i ar = _mm256_set1_epi16((int16_t)above[bs - 1]);
+  __m256i a = _mm256_loadu_si256((const __m256i *)above);
+  int r, c;
+  for (c = 0; c < bs; c += 16) {
+    const __m256i next = _mm256_loadu_si256((const __m256i *)(above + c + 16));
+    const __m256i b = shr1_epi16(a, next);
+    const __m256i avg2 = _mm256_avg_epu16(a, b);
+    const __m256i avg3 = avg3_epu16(a, b, shr2_epi16(a, next));
+    // The first two rows use the unclamped averages.
+    _mm256_storeu_si256((__m256i *)(dst + c), avg2);
+    _mm256_storeu_si256((__m256i *)(dst + stride + c), avg3);
+    _mm256_store_si256((__m256i *)(edge2 + c),
+                       c + 16 < bs ? avg2 : fill_last_epi16(avg2, ar));
+    _mm256_store_si256((__m256i *)(edge3 + c),
+                       c + 16 < bs ? avg3 : fill_last_epi16(avg3, ar));
+    _mm256_store_si256((__m256i *)(edge2 + bs + c), ar);
+    _mm256_store_si256((__m256i *)(edge3 + bs + c), ar);
+    a = next;
+  }
+  // Rows 2k and 2k + 1 start at entry k.
+  for (r = 1; r < bs / 2; ++r) {
+    for (c = 0; c < bs; c += 16) {
+      _mm256_storeu_si256(
+          (__m256i *)(dst + 2 * r * stride + c),
+          _mm256_loadu_si256((const __m256i *)(edge2 + r + c)));
+      _mm256_storeu_si256(
+          (__m256i *)(dst + (2 * r + 1) * stride + c),
+          _mm256_loadu_si256((const __m256i *)(edge3 + r + c)));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// D207 uses |left| only, extended with its last pixel. The AVG2 and AVG3
+// columns are interleaved and row r starts 2 * r entries in.
+
+static INLINE void d207_avx2(uint16_t *dst, ptrdiff_t stride,
+                             const uint16_t *left, int bs) {
+  DECLARE_ALIGNED(32, uint16_t, edge[96]);
+  const __m256i lr = _mm256_set1_epi16((int16_t)left[bs - 1]);
+  __m256i l = _mm256_loadu_si256((const __m256i *)left);
+  int c;
+  for (c = 0; c < bs; c += 16) {
+    const __m256i next =
+        c + 16 < bs ? _mm256_loadu_si256((const __m256i *)(left + c + 16))
+                    : lr;
+    const __m256i l1 = shr1_epi16(l, next);
+    const __m256i avg2 = _mm256_avg_epu16(l, l1);
+    const __m256i avg3 = avg3_epu16(l, l1, shr2_epi16(l, next));
+    __m256i lo, hi;
+    interleave_epi16(avg2, avg3, &lo, &hi);
+    _mm256_store_si256((__m256i *)(edge + 2 * c), lo);
+    _mm256_store_si256((__m256i *)(edge + 2 * c + 16), hi);
+    _mm256_store_si256((__m256i *)(edge + 2 * bs + c), lr);
+    l = next;
+  }
+  store_rows(dst, stride, edge, 2, bs);
+}
+
+// -----------------------------------------------------------------------------
+// D117, D135 and D153 use the border running from left[bs - 1] up to
+// above[-1] and on to above[bs - 1]:
+//   e[t] = left[bs - 1 - t], e[bs] = above[-1], e[bs + 1 + i] = above[i].
+// avg3[t] = AVG3(e[t], e[t + 1], e[t + 2]) and avg2[t] = AVG2(e[t], e[t + 1]),
+// each held as 2 * bs / 16 vectors.
+
+static INLINE void border_avx2(const uint16_t *above, const uint16_t *left,
+                               int bs, __m256i *avg2, __m256i *avg3) {
+  const int n = bs / 16;
+  __m256i e[5];
+  int i;
+  for (i = 0; i < n; ++i) {
+    e[i] = reverse_epi16(
+        _mm256_loadu_si256((const __m256i *)(left + bs - 16 - 16 * i)));
+    e[n + i] = _mm256_loadu_si256((const __m256i *)(above - 1 + 16 * i));
+  }
+  e[2 * n] = _mm256_set1_epi16((int16_t)above[bs - 1]);
+  for (i = 0; i < 2 * n; ++i) {
+    const __m256i e1 = shr1_epi16(e[i], e[i + 1]);
+    avg2[i] = _mm256_avg_epu16(e[i], e1);
+    avg3[i] = avg3_epu16(e[i], e1, shr2_epi16(e[i], e[i + 1]));
+  }
+}
+
+// Row r of D135 starts at avg3[bs - 1 - r].
+static INLINE void d135_avx2(uint16_t *dst, ptrdiff_t stride,
+                             const uint16_t *above, const uint16_t *left,
+                             int bs) {
+  DECLARE_ALIGNED(32, uint16_t, edge[64]);
+  __m256i avg2[4], avg3[4];
+  int i;
+  border_avx2(above, left, bs, avg2, avg3);
+  for (i = 0; i < bs / 8; ++i) {
+    _mm256_store_si256((__m256i *)(edge + 16 * i), avg3[i]);
+  }
+  store_rows(dst, stride, edge + bs - 1, -1, bs);
+}
+
+// D153 interleaves avg2[0, bs) with avg3[0, bs) and continues with
+// avg3[bs, 2 * bs - 1). Row r starts 2 * (bs - 1 - r) entries in.
+static INLINE void d153_avx2(uint16_t *dst, ptrdiff_t stride,
+                             const uint16_t *above, const uint16_t *left,
+                             int bs) {
+  DECLARE_ALIGNED(32, uint16_t, edge[96]);
+  __m256i avg2[4], avg3[4];
+  int i;
+  border_avx2(above, left, bs, avg2, avg3);
+  for (i = 0; i < bs / 16; ++i) {
+    __m256i lo, hi;
+    interleave_epi16(avg2[i], avg3[i], &lo, &hi);
+    _mm256_store_si256((__m256i *)(edge + 32 * i), lo);
+    _mm256_store_si256((__m256i *)(edge + 32 * i + 16), hi);
+    _mm256_store_si256((__m256i *)(edge + 2 * bs + 16 * i),
+                       avg3[bs / 16 + i]);
+  }
+  store_rows(dst, stride, edge + 2 * bs - 2, -2, bs);
+}
+
+// D117 alternates between two edges. Even rows use the even entries of
+// avg3[0, bs) followed by avg2[bs, 2 * bs), odd rows the odd entries of
+// avg3[0, bs) followed by avg3[bs, 2 * bs - 1). Rows 2k and 2k + 1 start
+// bs / 2 - k entries in, with the odd edge offset by one.
+static INLINE void d117_avx2(uint16_t *dst, ptrdiff_t stride,
+                             const uint16_t *above, const uint16_t *left,
+                             int bs) {
+  DECLARE_ALIGNED(32, uint16_t, even[64]);
+  DECLARE_ALIGNED(32, uint16_t, odd[64]);
+  const int n = bs / 16;
+  __m256i avg2[4], avg3[4];
+  int r, c;
+  border_avx2(above, left, bs, avg2, avg3);
+  for (c = 0; c < n; ++c) {
+    const __m256i eo = deinterleave_epi16(avg3[c]);
+    _mm_store_si128((__m128i *)(even + 8 * c), _mm256_castsi256_si128(eo));
+    _mm_storeu_si128((__m128i *)(odd + 1 + 8 * c),
+                     _mm256_extracti128_si256(eo, 1));
+  }
+  for (c = 0; c < n; ++c) {
+    _mm256_storeu_si256((__m256i *)(even + bs / 2 + 16 * c), avg2[n + c]);
+    _mm256_storeu_si256((__m256i *)(odd + bs / 2 + 1 + 16 * c), avg3[n + c]);
+  }
+  for (r = 0; r < bs / 2; ++r) {
+    for (c = 0; c < bs; c += 16) {
+      _mm256_storeu_si256(
+          (__m256i *)(dst + c),
+          _mm256_loadu_si256((const __m256i *)(even + bs / 2 - r + c)));
+      _mm256_storeu_si256(
+          (__m256i *)(dst + stride + c),
+          _mm256_loadu_si256((const __m256i *)(odd + bs / 2 - r + c)));
+    }
+    dst += 2 * stride;
+  }
+}
+
+#define HIGHBD_DIRECTIONAL_AVX2(size)                                        \
+  void vpx_highbd_d45_predictor_##size##x##size##_avx2(                      \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)left;                                                              \
+    (void)bd;                                                                \
+    d45_avx2(dst, stride, above, size);                                      \
+  }                                                                          \
+  void vpx_highbd_d63_predictor_##size##x##size##_avx2(                      \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)left;                                                              \
+    (void)bd;                                                                \
+    d63_avx2(dst, stride, above, size);                                      \
+  }                                                                          \
+  void vpx_highbd_d117_predictor_##size##x##size##_avx2(                     \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)bd;                                                                \
+    d117_avx2(dst, stride, above, left, size);                               \
+  }                                                                          \
+  void vpx_highbd_d135_predictor_##size##x##size##_avx2(                     \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)bd;                                                                \
+    d135_avx2(dst, stride, above, left, size);                               \
+  }                                                                          \
+  void vpx_highbd_d153_predictor_##size##x##size##_avx2(                     \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)bd;                                                                \
+    d153_avx2(dst, stride, above, left, size);                               \
+  }                                                                          \
+  void vpx_highbd_d207_predictor_##size##x##size##_avx2(                     \
+      uint16_t *dst, ptrdiff_t stride, const uint16_t *above,                \
+      const uint16_t *left, int bd) {                                        \
+    (void)above;                                                             \
+    (void)bd;                                                                \
+    d207_avx2(dst, stride, left, size);                                      \
+  }
+
+HIGHBD_DIRECTIONAL_AVX2(16)
+HIGHBD_DIRECTIONAL_AVX2(32)
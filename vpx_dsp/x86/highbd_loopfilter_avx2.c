@@ -0,0 +1,419 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  // AVX2
+
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_ports/mem.h"
+
+// All kernels below operate on 16 pixels per __m256i. The pixels along the
+// filtered edge are held in x[0..15] = p7 .. p0, q0 .. q7; the 4 and 8 tap
+// filters only use x[4..11] = p3 .. q3. The low 128-bit lane carries the first
+// 8 pixels (or rows) of the edge and the high lane the next 8, which lets the
+// _dual variants use different thresholds per lane.
+
+typedef struct {
+  __m256i blimit;
+  __m256i limit;
+  __m256i thresh;
+} highbd_lpf_thresh;
+
+static INLINE __m256i set_thresh_pair(uint8_t t0, uint8_t t1, int bd) {
+  const __m128i lo = _mm_set1_epi16((int16_t)(t0 << (bd - 8)));
+  const __m128i hi = _mm_set1_epi16((int16_t)(t1 << (bd - 8)));
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static INLINE highbd_lpf_thresh get_thresh(
+    const uint8_t *blimit0, const uint8_t *limit0, const uint8_t *thresh0,
+    const uint8_t *blimit1, const uint8_t *limit1, const uint8_t *thresh1,
+    int bd) {
+  highbd_lpf_thresh t;
+  t.blimit = set_thresh_pair(*blimit0, *blimit1, bd);
+  t.limit = set_thresh_pair(*limit0, *limit1, bd);
+  t.thresh = set_thresh_pair(*thresh0, *thresh1, bd);
+  return t;
+}
+
+static INLINE __m256i abs_diff16(const __m256i a, const __m256i b) {
+  return _mm256_or_si256(_mm256_subs_epu16(a, b), _mm256_subs_epu16(b, a));
+}
+
+static INLINE __m256i clamp_bd(const __m256i v, const __m256i min,
+                               const __m256i max) {
+  return _mm256_max_epi16(_mm256_min_epi16(v, max), min);
+}
+
+// Equivalent of highbd_filter4() in loopfilter.c, in place on p1 .. q1.
+static INLINE void highbd_filter4_avx2(const __m256i mask, const __m256i hev,
+                                       __m256i *p1, __m256i *p0, __m256i *q0,
+                                       __m256i *q1, int bd) {
+  const int shift = bd - 8;
+  const __m256i offset = _mm256_set1_epi16(0x80 << shift);
+  const __m256i max = _mm256_set1_epi16((128 << shift) - 1);
+  const __m256i min = _mm256_set1_epi16(-(128 << shift));
+  const __m256i ps1 = _mm256_sub_epi16(*p1, offset);
+  const __m256i ps0 = _mm256_sub_epi16(*p0, offset);
+  const __m256i qs0 = _mm256_sub_epi16(*q0, offset);
+  const __m256i qs1 = _mm256_sub_epi16(*q1, offset);
+  const __m256i qs0ps0 = _mm256_sub_epi16(qs0, ps0);
+  __m256i filter, filter1, filter2;
+
+  // Add outer taps if we have high edge variance.
+  filter = _mm256_and_si256(clamp_bd(_mm256_sub_epi16(ps1, qs1), min, max),
+                            hev);
+  // Inner taps. With at most 12-bit input the sum cannot overflow 16 bits.
+  filter = _mm256_add_epi16(filter, qs0ps0);
+  filter = _mm256_add_epi16(filter, _mm256_add_epi16(qs0ps0, qs0ps0));
+  filter = _mm256_and_si256(clamp_bd(filter, min, max), mask);
+
+  filter1 = _mm256_srai_epi16(
+      clamp_bd(_mm256_add_epi16(filter, _mm256_set1_epi16(4)), min, max), 3);
+  filter2 = _mm256_srai_epi16(
+      clamp_bd(_mm256_add_epi16(filter, _mm256_set1_epi16(3)), min, max), 3);
+
+  *q0 = _mm256_add_epi16(clamp_bd(_mm256_sub_epi16(qs0, filter1), min, max),
+                         offset);
+  *p0 = _mm256_add_epi16(clamp_bd(_mm256_add_epi16(ps0, filter2), min, max),
+                         offset);
+
+  // Outer tap adjustments.
+  filter = _mm256_add_epi16(filter1, _mm256_set1_epi16(1));
+  filter = _mm256_andnot_si256(hev, _mm256_srai_epi16(filter, 1));
+
+  *q1 = _mm256_add_epi16(clamp_bd(_mm256_sub_epi16(qs1, filter), min, max),
+                         offset);
+  *p1 = _mm256_add_epi16(clamp_bd(_mm256_add_epi16(ps1, filter), min, max),
+                         offset);
+}
+
+// Applies the flat filter over the n pixels in x: output k is the rounded
+// average of x[k - n / 2 + 1 .. k + n / 2 - 1], edges replicated, with x[k]
+// counted twice. n = 8 gives the 7-tap filter and n = 16 the 15-tap one.
+// A 16-tap sum of 12-bit pixels fits in an unsigned 16-bit lane, and the
+// running sum is updated modulo 2^16, so no widening is needed.
+static INLINE void highbd_flat_filter_avx2(const __m256i *x, __m256i *out,
+                                           int n, int bits) {
+  const int r = n / 2 - 1;
+  __m256i sum = _mm256_set1_epi16(1 << (bits - 1));
+  int j, k;
+
+  for (j = 1 - r; j <= 1 + r; ++j) {
+    sum = _mm256_add_epi16(sum, x[j < 0 ? 0 : j]);
+  }
+  sum = _mm256_add_epi16(sum, x[1]);
+  out[1] = _mm256_srli_epi16(sum, bits);
+
+  for (k = 1; k < n - 2; ++k) {
+    const int add = k + r + 1 > n - 1 ? n - 1 : k + r + 1;
+    const int sub = k - r < 0 ? 0 : k - r;
+    sum = _mm256_add_epi16(sum, _mm256_sub_epi16(x[add], x[sub]));
+    sum = _mm256_add_epi16(sum, _mm256_sub_epi16(x[k + 1], x[k]));
+    out[k + 1] = _mm256_srli_epi16(sum, bits);
+  }
+}
+
+static void highbd_lpf_avx2(__m256i *x, int taps, int wide,
+                            const highbd_lpf_thresh *t, int bd) {
+  const __m256i ffff = _mm256_set1_epi16((int16_t)0xffff);
+  const __m256i flat_thresh = _mm256_set1_epi16(1 << (bd - 8));
+  const __m256i p3 = x[4], p2 = x[5], p1 = x[6], p0 = x[7];
+  const __m256i q0 = x[8], q1 = x[9], q2 = x[10], q3 = x[11];
+  const __m256i abs_p1p0 = abs_diff16(p1, p0);
+  const __m256i abs_q1q0 = abs_diff16(q1, q0);
+  __m256i f4[4];
+  __m256i mask, hev, flat, work;
+  int i;
+
+  // filter_mask
+  work = _mm256_max_epi16(abs_p1p0, abs_q1q0);
+  hev = _mm256_cmpgt_epi16(work, t->thresh);
+  work = _mm256_max_epi16(work, abs_diff16(p3, p2));
+  work = _mm256_max_epi16(work, abs_diff16(p2, p1));
+  work = _mm256_max_epi16(work, abs_diff16(q2, q1));
+  work = _mm256_max_epi16(work, abs_diff16(q3, q2));
+  mask = _mm256_cmpgt_epi16(work, t->limit);
+  work = _mm256_adds_epu16(_mm256_slli_epi16(abs_diff16(p0, q0), 1),
+                           _mm256_srli_epi16(abs_diff16(p1, q1), 1));
+  mask = _mm256_or_si256(mask, _mm256_cmpgt_epi16(work, t->blimit));
+  mask = _mm256_xor_si256(mask, ffff);
+  // Only the low lane holds pixels for the single 8-pixel variants.
+  if (!wide) mask = _mm256_permute2x128_si256(mask, mask, 0x80);
+
+  f4[0] = p1;
+  f4[1] = p0;
+  f4[2] = q0;
+  f4[3] = q1;
+  highbd_filter4_avx2(mask, hev, &f4[0], &f4[1], &f4[2], &f4[3], bd);
+
+  if (taps == 4) {
+    for (i = 0; i < 4; ++i) x[6 + i] = f4[i];
+    return;
+  }
+
+  // flat_mask4
+  work = _mm256_max_epi16(abs_p1p0, abs_q1q0);
+  work = _mm256_max_epi16(work, abs_diff16(p2, p0));
+  work = _mm256_max_epi16(work, abs_diff16(q2, q0));
+  work = _mm256_max_epi16(work, abs_diff16(p3, p0));
+  work = _mm256_max_epi16(work, abs_diff16(q3, q0));
+  flat = _mm256_andnot_si256(_mm256_cmpgt_epi16(work, flat_thresh), mask);
+
+  if (_mm256_testz_si256(flat, flat)) {
+    for (i = 0; i < 4; ++i) x[6 + i] = f4[i];
+    return;
+  }
+
+  {
+    __m256i out8[8], out16[16], flat2 = _mm256_setzero_si256();
+
+    if (taps == 16) {
+      // flat_mask5 over p7 .. p4 and q4 .. q7.
+      work = _mm256_setzero_si256();
+      for (i = 0; i < 4; ++i) {
+        work = _mm256_max_epi16(work, abs_diff16(x[i], p0));
+        work = _mm256_max_epi16(work, abs_diff16(x[12 + i], q0));
+      }
+      flat2 = _mm256_andnot_si256(_mm256_cmpgt_epi16(work, flat_thresh), flat);
+      // Both flat filters read the unfiltered pixels.
+      if (!_mm256_testz_si256(flat2, flat2)) {
+        highbd_flat_filter_avx2(x, out16, 16, 4);
+      }
+    }
+
+    highbd_flat_filter_avx2(x + 4, out8, 8, 3);
+    x[5] = _mm256_blendv_epi8(p2, out8[1], flat);
+    for (i = 0; i < 4; ++i) {
+      x[6 + i] = _mm256_blendv_epi8(f4[i], out8[2 + i], flat);
+    }
+    x[10] = _mm256_blendv_epi8(q2, out8[6], flat);
+
+    if (!_mm256_testz_si256(flat2, flat2)) {
+      for (i = 1; i < 15; ++i) {
+        x[i] = _mm256_blendv_epi8(x[i], out16[i], flat2);
+      }
+    }
+  }
+}
+
+static INLINE __m256i load_pixels(const uint16_t *s, int wide) {
+  if (wide) return _mm256_loadu_si256((const __m256i *)s);
+  return _mm256_inserti128_si256(_mm256_setzero_si256(),
+                                 _mm_loadu_si128((const __m128i *)s), 0);
+}
+
+static INLINE void store_pixels(uint16_t *s, const __m256i v, int wide) {
+  if (wide) {
+    _mm256_storeu_si256((__m256i *)s, v);
+  } else {
+    _mm_storeu_si128((__m128i *)s, _mm256_castsi256_si128(v));
+  }
+}
+
+static void highbd_lpf_horizontal_avx2(uint16_t *s, int pitch, int taps,
+                                       int wide, const highbd_lpf_thresh *t,
+                                       int bd) {
+  const int rows = taps == 16 ? 8 : 4;
+  const int modified = taps == 16 ? 7 : taps == 8 ? 3 : 2;
+  __m256i x[16];
+  int i;
+
+  for (i = -rows; i < rows; ++i) x[8 + i] = load_pixels(s + i * pitch, wide);
+  highbd_lpf_avx2(x, taps, wide, t, bd);
+  for (i = -modified; i < modified; ++i) {
+    store_pixels(s + i * pitch, x[8 + i], wide);
+  }
+}
+
+// Transposes the 8x8 block held in each 128-bit lane of in[0..7].
+static INLINE void transpose_16bit_8x8_avx2(const __m256i *in, __m256i *out) {
+  const __m256i a0 = _mm256_unpacklo_epi16(in[0], in[1]);
+  const __m256i a1 = _mm256_unpacklo_epi16(in[2], in[3]);
+  const __m256i a2 = _mm256_unpacklo_epi16(in[4], in[5]);
+  const __m256i a3 = _mm256_unpacklo_epi16(in[6], in[7]);
+  const __m256i a4 = _mm256_unpackhi_epi16(in[0], in[1]);
+  const __m256i a5 = _mm256_unpackhi_epi16(in[2], in[3]);
+  const __m256i a6 = _mm256_unpackhi_epi16(in[4], in[5]);
+  const __m256i a7 = _mm256_unpackhi_epi16(in[6], in[7]);
+
+  const __m256i b0 = _mm256_unpacklo_epi32(a0, a1);
+  const __m256i b1 = _mm256_unpacklo_epi32(a2, a3);
+  const __m256i b2 = _mm256_unpacklo_epi32(a4, a5);
+  const __m256i b3 = _mm256_unpacklo_epi32(a6, a7);
+  const __m256i b4 = _mm256_unpackhi_epi32(a0, a1);
+  const __m256i b5 = _mm256_unpackhi_epi32(a2, a3);
+  const __m256i b6 = _mm256_unpackhi_epi32(a4, a5);
+  const __m256i b7 = _mm256_unpackhi_epi32(a6, a7);
+
+  out[0] = _mm256_unpacklo_epi64(b0, b1);
+  out[1] = _mm256_unpackhi_epi64(b0, b1);
+  out[2] = _mm256_unpacklo_epi64(b4, b5);
+  out[3] = _mm256_unpackhi_epi64(b4, b5);
+  out[4] = _mm256_unpacklo_epi64(b2, b3);
+  out[5] = _mm256_unpackhi_epi64(b2, b3);
+  out[6] = _mm256_unpacklo_epi64(b6, b7);
+  out[7] = _mm256_unpackhi_epi64(b6, b7);
+}
+
+// Loads 8 columns starting at s for 8 rows (16 when wide), with rows 8 .. 15
+// in the high lane, and transposes them so that out[i] holds column i.
+static INLINE void load_transpose_8_cols(const uint16_t *s, int pitch,
+                                         int wide, __m256i *out) {
+  __m256i in[8];
+  int i;
+  for (i = 0; i < 8; ++i) {
+    const __m128i lo = _mm_loadu_si128((const __m128i *)(s + i * pitch));
+    const __m128i hi =
+        wide ? _mm_loadu_si128((const __m128i *)(s + (i + 8) * pitch))
+             : _mm_setzero_si128();
+    in[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+  }
+  transpose_16bit_8x8_avx2(in, out);
+}
+
+static INLINE void transpose_store_8_cols(uint16_t *s, int pitch, int wide,
+                                          const __m256i *in) {
+  __m256i out[8];
+  int i;
+  transpose_16bit_8x8_avx2(in, out);
+  for (i = 0; i < 8; ++i) {
+    _mm_storeu_si128((__m128i *)(s + i * pitch),
+                     _mm256_castsi256_si128(out[i]));
+    if (wide) {
+      _mm_storeu_si128((__m128i *)(s + (i + 8) * pitch),
+                       _mm256_extracti128_si256(out[i], 1));
+    }
+  }
+}
+
+static void highbd_lpf_vertical_avx2(uint16_t *s, int pitch, int taps,
+                                     int wide, const highbd_lpf_thresh *t,
+                                     int bd) {
+  __m256i x[16];
+  if (taps == 16) {
+    load_transpose_8_cols(s - 8, pitch, wide, x);
+    load_transpose_8_cols(s, pitch, wide, x + 8);
+    highbd_lpf_avx2(x, taps, wide, t, bd);
+    transpose_store_8_cols(s - 8, pitch, wide, x);
+    transpose_store_8_cols(s, pitch, wide, x + 8);
+  } else {
+    load_transpose_8_cols(s - 4, pitch, wide, x + 4);
+    highbd_lpf_avx2(x, taps, wide, t, bd);
+    transpose_store_8_cols(s - 4, pitch, wide, x + 4);
+  }
+}
+
+void vpx_highbd_lpf_horizontal_16_avx2(uint16_t *s, int pitch,
+                                       const uint8_t *blimit,
+                                       const uint8_t *limit,
+                                       const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 16, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_horizontal_16_dual_avx2(uint16_t *s, int pitch,
+                                            const uint8_t *blimit,
+                                            const uint8_t *limit,
+                                            const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 16, 1, &t, bd);
+}
+
+void vpx_highbd_lpf_horizontal_8_avx2(uint16_t *s, int pitch,
+                                      const uint8_t *blimit,
+                                      const uint8_t *limit,
+                                      const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 8, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_horizontal_8_dual_avx2(
+    uint16_t *s, int pitch, const uint8_t *blimit0, const uint8_t *limit0,
+    const uint8_t *thresh0, const uint8_t *blimit1, const uint8_t *limit1,
+    const uint8_t *thresh1, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit0, limit0, thresh0, blimit1, limit1, thresh1, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 8, 1, &t, bd);
+}
+
+void vpx_highbd_lpf_horizontal_4_avx2(uint16_t *s, int pitch,
+                                      const uint8_t *blimit,
+                                      const uint8_t *limit,
+                                      const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 4, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_horizontal_4_dual_avx2(
+    uint16_t *s, int pitch, const uint8_t *blimit0, const uint8_t *limit0,
+    const uint8_t *thresh0, const uint8_t *blimit1, const uint8_t *limit1,
+    const uint8_t *thresh1, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit0, limit0, thresh0, blimit1, limit1, thresh1, bd);
+  highbd_lpf_horizontal_avx2(s, pitch, 4, 1, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_16_avx2(uint16_t *s, int pitch,
+                                     const uint8_t *blimit,
+                                     const uint8_t *limit,
+                                     const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 16, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_16_dual_avx2(uint16_t *s, int pitch,
+                                          const uint8_t *blimit,
+                                          const uint8_t *limit,
+                                          const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 16, 1, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_8_avx2(uint16_t *s, int pitch,
+                                    const uint8_t *blimit,
+                                    const uint8_t *limit,
+                                    const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 8, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_8_dual_avx2(
+    uint16_t *s, int pitch, const uint8_t *blimit0, const uint8_t *limit0,
+    const uint8_t *thresh0, const uint8_t *blimit1, const uint8_t *limit1,
+    const uint8_t *thresh1, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit0, limit0, thresh0, blimit1, limit1, thresh1, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 8, 1, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_4_avx2(uint16_t *s, int pitch,
+                                    const uint8_t *blimit,
+                                    const uint8_t *limit,
+                                    const uint8_t *thresh, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit, limit, thresh, blimit, limit, thresh, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 4, 0, &t, bd);
+}
+
+void vpx_highbd_lpf_vertical_4_dual_avx2(
+    uint16_t *s, int pitch, const uint8_t *blimit0, const uint8_t *limit0,
+    const uint8_t *thresh0, const uint8_t *blimit1, const uint8_t *limit1,
+    const uint8_t *thresh1, int bd) {
+  const highbd_lpf_thresh t =
+      get_thresh(blimit0, limit0, thresh0, blimit1, limit1, thresh1, bd);
+  highbd_lpf_vertical_avx2(s, pitch, 4, 1, &t, bd);
+}
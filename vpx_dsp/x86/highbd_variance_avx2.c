@@ -0,0 +1,367 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <assert.h>
+#include <immintrin.h>  // AVX2
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_ports/mem.h"
+
+// Number of 32-bit squared-error accumulations per lane before the sums are
+// widened to 64 bits. A 12-bit diff pair contributes at most 2 * 4095^2, so
+// 16 rounds stay far below INT32_MAX.
+#define SSE_FLUSH_INTERVAL 16
+
+static INLINE void accumulate_diff(const __m256i s, const __m256i r,
+                                   __m256i *sse32, __m256i *sum32) {
+  const __m256i diff = _mm256_sub_epi16(s, r);
+  *sse32 = _mm256_add_epi32(*sse32, _mm256_madd_epi16(diff, diff));
+  *sum32 = _mm256_add_epi32(*sum32,
+                            _mm256_madd_epi16(diff, _mm256_set1_epi16(1)));
+}
+
+static INLINE void flush_sse(__m256i *sse32, __m256i *sse64) {
+  const __m256i lo = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(*sse32));
+  const __m256i hi = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(*sse32, 1));
+  *sse64 = _mm256_add_epi64(*sse64, _mm256_add_epi64(lo, hi));
+  *sse32 = _mm256_setzero_si256();
+}
+
+static INLINE __m256i load_2_rows(const uint16_t *p, int stride) {
+  const __m128i r0 = _mm_loadu_si128((const __m128i *)p);
+  const __m128i r1 = _mm_loadu_si128((const __m128i *)(p + stride));
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(r0), r1, 1);
+}
+
+static INLINE __m256i load_4_rows(const uint16_t *p, int stride) {
+  const __m128i r0 = _mm_loadl_epi64((const __m128i *)p);
+  const __m128i r1 = _mm_loadl_epi64((const __m128i *)(p + stride));
+  const __m128i r2 = _mm_loadl_epi64((const __m128i *)(p + 2 * stride));
+  const __m128i r3 = _mm_loadl_epi64((const __m128i *)(p + 3 * stride));
+  const __m128i r01 = _mm_unpacklo_epi64(r0, r1);
+  const __m128i r23 = _mm_unpacklo_epi64(r2, r3);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(r01), r23, 1);
+}
+
+static void highbd_variance64_avx2(const uint16_t *src, int src_stride,
+                                   const uint16_t *ref, int ref_stride, int w,
+                                   int h, uint64_t *sse, int64_t *sum) {
+  __m256i sse32 = _mm256_setzero_si256();
+  __m256i sse64 = _mm256_setzero_si256();
+  __m256i sum32 = _mm256_setzero_si256();
+  __m128i sse128, sum128;
+  uint64_t sse_total;
+  int i, j, rounds = 0;
+
+  if (w >= 16) {
+    for (i = 0; i < h; ++i) {
+      for (j = 0; j < w; j += 16) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + j));
+        const __m256i r = _mm256_loadu_si256((const __m256i *)(ref + j));
+        accumulate_diff(s, r, &sse32, &sum32);
+        if (++rounds == SSE_FLUSH_INTERVAL) {
+          flush_sse(&sse32, &sse64);
+          rounds = 0;
+        }
+      }
+      src += src_stride;
+      ref += ref_stride;
+    }
+  } else if (w == 8) {
+    for (i = 0; i < h; i += 2) {
+      const __m256i s = load_2_rows(src, src_stride);
+      const __m256i r = load_2_rows(ref, ref_stride);
+      accumulate_diff(s, r, &sse32, &sum32);
+      src += 2 * src_stride;
+      ref += 2 * ref_stride;
+    }
+  } else {
+    assert(w == 4);
+    for (i = 0; i < h; i += 4) {
+      const __m256i s = load_4_rows(src, src_stride);
+      const __m256i r = load_4_rows(ref, ref_stride);
+      accumulate_diff(s, r, &sse32, &sum32);
+      src += 4 * src_stride;
+      ref += 4 * ref_stride;
+    }
+  }
+  flush_sse(&sse32, &sse64);
+
+  sse128 = _mm_add_epi64(_mm256_castsi256_si128(sse64),
+                         _mm256_extracti128_si256(sse64, 1));
+  sse128 = _mm_add_epi64(sse128, _mm_srli_si128(sse128, 8));
+  sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum32),
+                         _mm256_extracti128_si256(sum32, 1));
+  sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 8));
+  sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 4));
+
+  _mm_storel_epi64((__m128i *)&sse_total, sse128);
+  *sse = sse_total;
+  *sum = _mm_cvtsi128_si32(sum128);
+}
+
+static uint32_t highbd_8_variance_avx2(const uint16_t *src, int src_stride,
+                                       const uint16_t *ref, int ref_stride,
+                                       int w, int h, int shift,
+                                       uint32_t *sse) {
+  uint64_t sse_long;
+  int64_t sum_long;
+  int sum;
+  highbd_variance64_avx2(src, src_stride, ref, ref_stride, w, h, &sse_long,
+                         &sum_long);
+  *sse = (uint32_t)sse_long;
+  sum = (int)sum_long;
+  return *sse - (uint32_t)(((int64_t)sum * sum) >> shift);
+}
+
+static uint32_t highbd_10_variance_avx2(const uint16_t *src, int src_stride,
+                                        const uint16_t *ref, int ref_stride,
+                                        int w, int h, int shift,
+                                        uint32_t *sse) {
+  uint64_t sse_long;
+  int64_t sum_long, var;
+  int sum;
+  highbd_variance64_avx2(src, src_stride, ref, ref_stride, w, h, &sse_long,
+                         &sum_long);
+  *sse = (uint32_t)ROUND_POWER_OF_TWO(sse_long, 4);
+  sum = (int)ROUND_POWER_OF_TWO(sum_long, 2);
+  var = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);
+  return (var >= 0) ? (uint32_t)var : 0;
+}
+
+static uint32_t highbd_12_variance_avx2(const uint16_t *src, int src_stride,
+                                        const uint16_t *ref, int ref_stride,
+                                        int w, int h, int shift,
+                                        uint32_t *sse) {
+  uint64_t sse_long;
+  int64_t sum_long, var;
+  int sum;
+  highbd_variance64_avx2(src, src_stride, ref, ref_stride, w, h, &sse_long,
+                         &sum_long);
+  *sse = (uint32_t)ROUND_POWER_OF_TWO(sse_long, 8);
+  sum = (int)ROUND_POWER_OF_TWO(sum_long, 4);
+  var = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);
+  return (var >= 0) ? (uint32_t)var : 0;
+}
+
+#define HIGHBD_VAR_FN(w, h, shift)                                           \
+  uint32_t vpx_highbd_8_variance##w##x##h##_avx2(                            \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,        \
+      int ref_stride, uint32_t *sse) {                                       \
+    return highbd_8_variance_avx2(CONVERT_TO_SHORTPTR(src_ptr), src_stride,  \
+                                  CONVERT_TO_SHORTPTR(ref_ptr), ref_stride,  \
+                                  w, h, shift, sse);                         \
+  }                                                                          \
+                                                                             \
+  uint32_t vpx_highbd_10_variance##w##x##h##_avx2(                           \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,        \
+      int ref_stride, uint32_t *sse) {                                       \
+    return highbd_10_variance_avx2(CONVERT_TO_SHORTPTR(src_ptr), src_stride, \
+                                   CONVERT_TO_SHORTPTR(ref_ptr), ref_stride, \
+                                   w, h, shift, sse);                        \
+  }                                                                          \
+                                                                             \
+  uint32_t vpx_highbd_12_variance##w##x##h##_avx2(                           \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,        \
+      int ref_stride, uint32_t *sse) {                                       \
+    return highbd_12_variance_avx2(CONVERT_TO_SHORTPTR(src_ptr), src_stride, \
+                                   CONVERT_TO_SHORTPTR(ref_ptr), ref_stride, \
+                                   w, h, shift, sse);                        \
+  }
+
+HIGHBD_VAR_FN(64, 64, 12)
+HIGHBD_VAR_FN(64, 32, 11)
+HIGHBD_VAR_FN(32, 64, 11)
+HIGHBD_VAR_FN(32, 32, 10)
+HIGHBD_VAR_FN(32, 16, 9)
+HIGHBD_VAR_FN(16, 32, 9)
+HIGHBD_VAR_FN(16, 16, 8)
+HIGHBD_VAR_FN(16, 8, 7)
+HIGHBD_VAR_FN(8, 16, 7)
+HIGHBD_VAR_FN(8, 8, 6)
+HIGHBD_VAR_FN(8, 4, 5)
+HIGHBD_VAR_FN(4, 8, 5)
+HIGHBD_VAR_FN(4, 4, 4)
+
+#undef HIGHBD_VAR_FN
+
+// Bilinear filter one pass, matching highbd_var_filter_block2d_bil_*_pass().
+// The tap pair for 'offset' is (128 - 16 * offset, 16 * offset); it is packed
+// into each 32-bit lane so that a single madd applies both taps.
+static void highbd_bil_filter_avx2(const uint16_t *src, int src_stride,
+                                   int pixel_step, uint16_t *dst, int w, int h,
+                                   int offset) {
+  const int32_t taps = ((16 * offset) << 16) | (128 - 16 * offset);
+  int i, j;
+
+  if (w >= 16) {
+    const __m256i filter = _mm256_set1_epi32(taps);
+    const __m256i round = _mm256_set1_epi32(1 << 6);
+    for (i = 0; i < h; ++i) {
+      for (j = 0; j < w; j += 16) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(src + j));
+        const __m256i b =
+            _mm256_loadu_si256((const __m256i *)(src + j + pixel_step));
+        __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), filter);
+        __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), filter);
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), 7);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), 7);
+        _mm256_storeu_si256((__m256i *)(dst + j), _mm256_packus_epi32(lo, hi));
+      }
+      src += src_stride;
+      dst += w;
+    }
+  } else {
+    const __m128i filter = _mm_set1_epi32(taps);
+    const __m128i round = _mm_set1_epi32(1 << 6);
+    for (i = 0; i < h; ++i) {
+      if (w == 8) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)src);
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + pixel_step));
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), filter);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), filter);
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 7);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), 7);
+        _mm_storeu_si128((__m128i *)dst, _mm_packus_epi32(lo, hi));
+      } else {
+        const __m128i a = _mm_loadl_epi64((const __m128i *)src);
+        const __m128i b = _mm_loadl_epi64((const __m128i *)(src + pixel_step));
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), filter);
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 7);
+        _mm_storel_epi64((__m128i *)dst, _mm_packus_epi32(lo, lo));
+      }
+      src += src_stride;
+      dst += w;
+    }
+  }
+}
+
+// Produces the sub-pixel prediction for (x_offset, y_offset). A zero offset
+// leaves the pixels unchanged, so that pass is skipped and, for the full-pel
+// case, the source itself is returned. 'fdata' must hold (h + 1) * w samples
+// and 'temp' h * w samples.
+static const uint16_t *highbd_subpel_pred_avx2(const uint16_t *src,
+                                               int src_stride, int x_offset,
+                                               int y_offset, int w, int h,
+                                               uint16_t *fdata, uint16_t *temp,
+                                               int *pred_stride) {
+  const uint16_t *first = src;
+  int first_stride = src_stride;
+
+  if (y_offset == 0) {
+    if (x_offset == 0) {
+      *pred_stride = src_stride;
+      return src;
+    }
+    highbd_bil_filter_avx2(src, src_stride, 1, temp, w, h, x_offset);
+    *pred_stride = w;
+    return temp;
+  }
+
+  if (x_offset != 0) {
+    highbd_bil_filter_avx2(src, src_stride, 1, fdata, w, h + 1, x_offset);
+    first = fdata;
+    first_stride = w;
+  }
+  highbd_bil_filter_avx2(first, first_stride, first_stride, temp, w, h,
+                         y_offset);
+  *pred_stride = w;
+  return temp;
+}
+
+static void highbd_comp_avg_avx2(uint16_t *dst, const uint16_t *pred,
+                                 int pred_stride, const uint16_t *second_pred,
+                                 int w, int h) {
+  int i, j;
+  if (w >= 16) {
+    for (i = 0; i < h; ++i) {
+      for (j = 0; j < w; j += 16) {
+        const __m256i p = _mm256_loadu_si256((const __m256i *)(pred + j));
+        const __m256i s =
+            _mm256_loadu_si256((const __m256i *)(second_pred + j));
+        _mm256_storeu_si256((__m256i *)(dst + j), _mm256_avg_epu16(p, s));
+      }
+      pred += pred_stride;
+      second_pred += w;
+      dst += w;
+    }
+  } else if (w == 8) {
+    for (i = 0; i < h; ++i) {
+      const __m128i p = _mm_loadu_si128((const __m128i *)pred);
+      const __m128i s = _mm_loadu_si128((const __m128i *)second_pred);
+      _mm_storeu_si128((__m128i *)dst, _mm_avg_epu16(p, s));
+      pred += pred_stride;
+      second_pred += w;
+      dst += w;
+    }
+  } else {
+    for (i = 0; i < h; ++i) {
+      const __m128i p = _mm_loadl_epi64((const __m128i *)pred);
+      const __m128i s = _mm_loadl_epi64((const __m128i *)second_pred);
+      _mm_storel_epi64((__m128i *)dst, _mm_avg_epu16(p, s));
+      pred += pred_stride;
+      second_pred += w;
+      dst += w;
+    }
+  }
+}
+
+#define HIGHBD_SUBPIX_VAR_FN(bd, w, h, shift)                                 \
+  uint32_t vpx_highbd_##bd##_sub_pixel_variance##w##x##h##_avx2(              \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,     \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse) {                \
+    DECLARE_ALIGNED(32, uint16_t, fdata[(h + 1) * w]);                        \
+    DECLARE_ALIGNED(32, uint16_t, temp[h * w]);                               \
+    int pred_stride;                                                          \
+    const uint16_t *pred = highbd_subpel_pred_avx2(                           \
+        CONVERT_TO_SHORTPTR(src_ptr), src_stride, x_offset, y_offset, w, h,   \
+        fdata, temp, &pred_stride);                                           \
+    return highbd_##bd##_variance_avx2(pred, pred_stride,                     \
+                                       CONVERT_TO_SHORTPTR(ref_ptr),          \
+                                       ref_stride, w, h, shift, sse);         \
+  }                                                                           \
+                                                                              \
+  uint32_t vpx_highbd_##bd##_sub_pixel_avg_variance##w##x##h##_avx2(          \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,     \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse,                  \
+      const uint8_t *second_pred) {                                           \
+    DECLARE_ALIGNED(32, uint16_t, fdata[(h + 1) * w]);                        \
+    DECLARE_ALIGNED(32, uint16_t, temp[h * w]);                               \
+    int pred_stride;                                                          \
+    const uint16_t *pred = highbd_subpel_pred_avx2(                           \
+        CONVERT_TO_SHORTPTR(src_ptr), src_stride, x_offset, y_offset, w, h,   \
+        fdata, temp, &pred_stride);                                           \
+    highbd_comp_avg_avx2(temp, pred, pred_stride,                             \
+                         CONVERT_TO_SHORTPTR(second_pred), w, h);             \
+    return highbd_##bd##_variance_avx2(temp, w, CONVERT_TO_SHORTPTR(ref_ptr), \
+                                       ref_stride, w, h, shift, sse);         \
+  }
+
+#define HIGHBD_SUBPIX_VAR_FNS(w, h, shift) \
+  HIGHBD_SUBPIX_VAR_FN(8, w, h, shift)     \
+  HIGHBD_SUBPIX_VAR_FN(10, w, h, shift)    \
+  HIGHBD_SUBPIX_VAR_FN(12, w, h, shift)
+
+HIGHBD_SUBPIX_VAR_FNS(64, 64, 12)
+HIGHBD_SUBPIX_VAR_FNS(64, 32, 11)
+HIGHBD_SUBPIX_VAR_FNS(32, 64, 11)
+HIGHBD_SUBPIX_VAR_FNS(32, 32, 10)
+HIGHBD_SUBPIX_VAR_FNS(32, 16, 9)
+HIGHBD_SUBPIX_VAR_FNS(16, 32, 9)
+HIGHBD_SUBPIX_VAR_FNS(16, 16, 8)
+HIGHBD_SUBPIX_VAR_FNS(16, 8, 7)
+HIGHBD_SUBPIX_VAR_FNS(8, 16, 7)
+HIGHBD_SUBPIX_VAR_FNS(8, 8, 6)
+HIGHBD_SUBPIX_VAR_FNS(8, 4, 5)
+HIGHBD_SUBPIX_VAR_FNS(4, 8, 5)
+HIGHBD_SUBPIX_VAR_FNS(4, 4, 4)
+
+#undef HIGHBD_SUBPIX_VAR_FNS
+#undef HIGHBD_SUBPIX_VAR_FN
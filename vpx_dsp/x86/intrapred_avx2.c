@@ -0,0 +1,362 @@
+/*
+ *  Copyright (c) 2024 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "./vpx_config.h"
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_ports/mem.h"
+
+// All the directional predictors below are built the same way: the
+// (AVG2/AVG3 filtered) edge pixels a block is made of are written to a small
+// buffer in the order they appear along the prediction direction, and every
+// row of the block is then a contiguous, shifted copy of that buffer.
+
+// (x + 2 * y + z + 2) >> 2, computed as avg(avg(x, z) - ((x ^ z) & 1), y).
+static INLINE __m256i avg3_epu8(const __m256i x, const __m256i y,
+                                const __m256i z) {
+  const __m256i one = _mm256_set1_epi8(1);
+  const __m256i a = _mm256_avg_epu8(x, z);
+  const __m256i b =
+      _mm256_subs_epu8(a, _mm256_and_si256(_mm256_xor_si256(x, z), one));
+  return _mm256_avg_epu8(b, y);
+}
+
+// Returns bytes [1, 33) of the 64 byte vector a:b, with a in the low half.
+static INLINE __m256i shr1_epi8(const __m256i a, const __m256i b) {
+  return _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a, 1);
+}
+
+// Returns bytes [2, 34) of the 64 byte vector a:b, with a in the low half.
+static INLINE __m256i shr2_epi8(const __m256i a, const __m256i b) {
+  return _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a, 2);
+}
+
+// Reverses the order of the 32 bytes in a.
+static INLINE __m256i reverse_epi8(const __m256i a) {
+  const __m256i rev = _mm256_setr_epi8(
+      15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11,
+      10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, rev), 0x4e);
+}
+
+// Sets bytes [n, 32) of a to v.
+static INLINE __m256i fill_from_epi8(const __m256i a, const __m256i v, int n) {
+  const __m256i idx = _mm256_setr_epi8(
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+      21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+  const __m256i mask = _mm256_cmpgt_epi8(idx, _mm256_set1_epi8(n - 1));
+  return _mm256_blendv_epi8(a, v, mask);
+}
+
+// The 16x16 rows are read back with 16 byte loads, which cannot be forwarded
+// from a 32 byte store they straddle the halves of; store the halves
+// separately instead.
+static INLINE void store_edge_16(uint8_t *edge, const __m256i v) {
+  _mm_store_si128((__m128i *)edge, _mm256_castsi256_si128(v));
+  _mm_store_si128((__m128i *)(edge + 16), _mm256_extracti128_si256(v, 1));
+}
+
+static INLINE void store_rows_16(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *edge, int step) {
+  int r;
+  for (r = 0; r < 16; ++r) {
+    _mm_storeu_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)edge));
+    dst += stride;
+    edge += step;
+  }
+}
+
+static INLINE void store_rows_32(uint8_t *dst, ptrdiff_t stride,
+                                 const uint8_t *edge, int step) {
+  int r;
+  for (r = 0; r < 32; ++r) {
+    _mm256_storeu_si256((__m256i *)dst,
+                        _mm256_loadu_si256((const __m256i *)edge));
+    dst += stride;
+    edge += step;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// D45 and D63 use |above| only. Row r of D45 starts at AVG3 output r; entries
+// past bs - 2 are the last above pixel. D63 does the same every other row,
+// alternating between AVG2 and AVG3 of |above|.
+
+void vpx_d45_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                  const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[32]);
+  const __m256i a = _mm256_loadu_si256((const __m256i *)above);
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[15]);
+  const __m256i avg3 = avg3_epu8(a, shr1_epi8(a, ar), shr2_epi8(a, ar));
+  (void)left;
+  store_edge_16(edge, fill_from_epi8(avg3, ar, 15));
+  store_rows_16(dst, stride, edge, 1);
+}
+
+void vpx_d45_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                  const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[64]);
+  const __m256i a0 = _mm256_loadu_si256((const __m256i *)above);
+  const __m256i a1 = _mm256_loadu_si256((const __m256i *)(above + 32));
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[31]);
+  const __m256i avg3 = avg3_epu8(a0, shr1_epi8(a0, a1), shr2_epi8(a0, a1));
+  (void)left;
+  _mm256_store_si256((__m256i *)edge, fill_from_epi8(avg3, ar, 31));
+  _mm256_store_si256((__m256i *)(edge + 32), ar);
+  store_rows_32(dst, stride, edge, 1);
+}
+
+void vpx_d63_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                  const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge2[32]);
+  DECLARE_ALIGNED(32, uint8_t, edge3[32]);
+  const __m256i a = _mm256_loadu_si256((const __m256i *)above);
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[15]);
+  const __m256i a1 = shr1_epi8(a, ar);
+  const __m256i avg2 = _mm256_avg_epu8(a, a1);
+  const __m256i avg3 = avg3_epu8(a, a1, shr2_epi8(a, ar));
+  (void)left;
+  store_edge_16(edge2, fill_from_epi8(avg2, ar, 15));
+  store_edge_16(edge3, fill_from_epi8(avg3, ar, 15));
+  // The first two rows use the unclamped averages.
+  _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(avg2));
+  _mm_storeu_si128((__m128i *)(dst + stride), _mm256_castsi256_si128(avg3));
+  // Rows 2k and 2k + 1 start at entry k.
+  {
+    int r;
+    for (r = 1; r < 8; ++r) {
+      _mm_storeu_si128((__m128i *)(dst + 2 * r * stride),
+                       _mm_loadu_si128((const __m128i *)(edge2 + r)));
+      _mm_storeu_si128((__m128i *)(dst + (2 * r + 1) * stride),
+                       _mm_loadu_si128((const __m128i *)(edge3 + r)));
+    }
+  }
+}
+
+void vpx_d63_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                  const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge2[64]);
+  DECLARE_ALIGNED(32, uint8_t, edge3[64]);
+  const __m256i a0 = _mm256_loadu_si256((const __m256i *)above);
+  const __m256i a1 = _mm256_loadu_si256((const __m256i *)(above + 32));
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[31]);
+  const __m256i b = shr1_epi8(a0, a1);
+  const __m256i avg2 = _mm256_avg_epu8(a0, b);
+  const __m256i avg3 = avg3_epu8(a0, b, shr2_epi8(a0, a1));
+  (void)left;
+  _mm256_store_si256((__m256i *)edge2, fill_from_epi8(avg2, ar, 31));
+  _mm256_store_si256((__m256i *)(edge2 + 32), ar);
+  _mm256_store_si256((__m256i *)edge3, fill_from_epi8(avg3, ar, 31));
+  _mm256_store_si256((__m256i *)(edge3 + 32), ar);
+  // The first two rows use the unclamped averages.
+  _mm256_storeu_si256((__m256i *)dst, avg2);
+  _mm256_storeu_si256((__m256i *)(dst + stride), avg3);
+  // Rows 2k and 2k + 1 start at entry k.
+  {
+    int r;
+    for (r = 1; r < 16; ++r) {
+      _mm256_storeu_si256((__m256i *)(dst + 2 * r * stride),
+                          _mm256_loadu_si256((const __m256i *)(edge2 + r)));
+      _mm256_storeu_si256((__m256i *)(dst + (2 * r + 1) * stride),
+                          _mm256_loadu_si256((const __m256i *)(edge3 + r)));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// D207 uses |left| only, extended with its last pixel. The AVG2 and AVG3
+// columns are interleaved and row r starts 2 * r entries in.
+
+void vpx_d207_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[64]);
+  const __m256i lr = _mm256_set1_epi8((int8_t)left[15]);
+  const __m256i l = _mm256_inserti128_si256(
+      lr, _mm_loadu_si128((const __m128i *)left), 0);
+  const __m256i l1 = shr1_epi8(l, lr);
+  const __m256i avg2 = _mm256_avg_epu8(l, l1);
+  const __m256i avg3 = avg3_epu8(l, l1, shr2_epi8(l, lr));
+  const __m256i lo = _mm256_unpacklo_epi8(avg2, avg3);
+  const __m256i hi = _mm256_unpackhi_epi8(avg2, avg3);
+  (void)above;
+  store_edge_16(edge, _mm256_permute2x128_si256(lo, hi, 0x20));
+  store_edge_16(edge + 32, _mm256_permute2x128_si256(lo, hi, 0x31));
+  store_rows_16(dst, stride, edge, 2);
+}
+
+void vpx_d207_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[96]);
+  const __m256i lr = _mm256_set1_epi8((int8_t)left[31]);
+  const __m256i l = _mm256_loadu_si256((const __m256i *)left);
+  const __m256i l1 = shr1_epi8(l, lr);
+  const __m256i avg2 = _mm256_avg_epu8(l, l1);
+  const __m256i avg3 = avg3_epu8(l, l1, shr2_epi8(l, lr));
+  const __m256i lo = _mm256_unpacklo_epi8(avg2, avg3);
+  const __m256i hi = _mm256_unpackhi_epi8(avg2, avg3);
+  (void)above;
+  _mm256_store_si256((__m256i *)edge, _mm256_permute2x128_si256(lo, hi, 0x20));
+  _mm256_store_si256((__m256i *)(edge + 32),
+                     _mm256_permute2x128_si256(lo, hi, 0x31));
+  _mm256_store_si256((__m256i *)(edge + 64), lr);
+  store_rows_32(dst, stride, edge, 2);
+}
+
+// -----------------------------------------------------------------------------
+// D117, D135 and D153 use the border running from left[bs - 1] up to
+// above[-1] and on to above[bs - 1]:
+//   e[t] = left[bs - 1 - t], e[bs] = above[-1], e[bs + 1 + i] = above[i].
+// avg3[t] = AVG3(e[t], e[t + 1], e[t + 2]) and avg2[t] = AVG2(e[t], e[t + 1]).
+// For 16x16 the low and high halves of the border share a vector.
+
+static INLINE void border_16(const uint8_t *above, const uint8_t *left,
+                             __m256i *avg2, __m256i *avg3) {
+  const __m128i rev = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+                                    3, 2, 1, 0);
+  const __m128i rev_left =
+      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)left), rev);
+  const __m256i e = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(rev_left),
+      _mm_loadu_si128((const __m128i *)(above - 1)), 1);
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[15]);
+  const __m256i e1 = shr1_epi8(e, ar);
+  *avg2 = _mm256_avg_epu8(e, e1);
+  *avg3 = avg3_epu8(e, e1, shr2_epi8(e, ar));
+}
+
+static INLINE void border_32(const uint8_t *above, const uint8_t *left,
+                             __m256i *avg2, __m256i *avg3) {
+  const __m256i e0 = reverse_epi8(_mm256_loadu_si256((const __m256i *)left));
+  const __m256i e1 = _mm256_loadu_si256((const __m256i *)(above - 1));
+  const __m256i ar = _mm256_set1_epi8((int8_t)above[31]);
+  const __m256i e0_1 = shr1_epi8(e0, e1);
+  const __m256i e1_1 = shr1_epi8(e1, ar);
+  avg2[0] = _mm256_avg_epu8(e0, e0_1);
+  avg2[1] = _mm256_avg_epu8(e1, e1_1);
+  avg3[0] = avg3_epu8(e0, e0_1, shr2_epi8(e0, e1));
+  avg3[1] = avg3_epu8(e1, e1_1, shr2_epi8(e1, ar));
+}
+
+// Row r of D135 starts at avg3[bs - 1 - r].
+void vpx_d135_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[32]);
+  __m256i avg2, avg3;
+  border_16(above, left, &avg2, &avg3);
+  store_edge_16(edge, avg3);
+  store_rows_16(dst, stride, edge + 15, -1);
+}
+
+void vpx_d135_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[64]);
+  __m256i avg2[2], avg3[2];
+  border_32(above, left, avg2, avg3);
+  _mm256_store_si256((__m256i *)edge, avg3[0]);
+  _mm256_store_si256((__m256i *)(edge + 32), avg3[1]);
+  store_rows_32(dst, stride, edge + 31, -1);
+}
+
+// D153 interleaves avg2[0, bs) with avg3[0, bs) and continues with
+// avg3[bs, 2 * bs - 1). Row r starts 2 * (bs - 1 - r) entries in.
+void vpx_d153_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[48]);
+  __m256i avg2, avg3;
+  border_16(above, left, &avg2, &avg3);
+  {
+    const __m128i a2 = _mm256_castsi256_si128(avg2);
+    const __m128i a3 = _mm256_castsi256_si128(avg3);
+    _mm_store_si128((__m128i *)edge, _mm_unpacklo_epi8(a2, a3));
+    _mm_store_si128((__m128i *)(edge + 16), _mm_unpackhi_epi8(a2, a3));
+    _mm_store_si128((__m128i *)(edge + 32), _mm256_extracti128_si256(avg3, 1));
+  }
+  store_rows_16(dst, stride, edge + 30, -2);
+}
+
+void vpx_d153_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, edge[96]);
+  __m256i avg2[2], avg3[2];
+  border_32(above, left, avg2, avg3);
+  {
+    const __m256i lo = _mm256_unpacklo_epi8(avg2[0], avg3[0]);
+    const __m256i hi = _mm256_unpackhi_epi8(avg2[0], avg3[0]);
+    _mm256_store_si256((__m256i *)edge,
+                       _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_store_si256((__m256i *)(edge + 32),
+                       _mm256_permute2x128_si256(lo, hi, 0x31));
+    _mm256_store_si256((__m256i *)(edge + 64), avg3[1]);
+  }
+  store_rows_32(dst, stride, edge + 62, -2);
+}
+
+// D117 alternates between two edges. Even rows use the even entries of
+// avg3[0, bs) followed by avg2[bs, 2 * bs), odd rows the odd entries of
+// avg3[0, bs) followed by avg3[bs, 2 * bs - 1). Rows 2k and 2k + 1 start
+// bs / 2 - k entries in, with the odd edge offset by one.
+static INLINE __m256i deinterleave_epi8(const __m256i a) {
+  const __m256i even_odd = _mm256_setr_epi8(
+      0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10,
+      12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+  return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, even_odd), 0xd8);
+}
+
+void vpx_d117_predictor_16x16_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, even[32]);
+  DECLARE_ALIGNED(32, uint8_t, odd[32]);
+  __m256i avg2, avg3;
+  int r;
+  border_16(above, left, &avg2, &avg3);
+  {
+    // Even entries land in the low 8 bytes, odd ones in the high 8.
+    const __m128i even_odd = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5,
+                                           7, 9, 11, 13, 15);
+    const __m128i eo =
+        _mm_shuffle_epi8(_mm256_castsi256_si128(avg3), even_odd);
+    _mm_storel_epi64((__m128i *)even, eo);
+    _mm_storeu_si128((__m128i *)(even + 8), _mm256_extracti128_si256(avg2, 1));
+    _mm_storel_epi64((__m128i *)(odd + 1), _mm_srli_si128(eo, 8));
+    _mm_storeu_si128((__m128i *)(odd + 9), _mm256_extracti128_si256(avg3, 1));
+  }
+  for (r = 0; r < 8; ++r) {
+    _mm_storeu_si128((__m128i *)dst,
+                     _mm_loadu_si128((const __m128i *)(even + 8 - r)));
+    _mm_storeu_si128((__m128i *)(dst + stride),
+                     _mm_loadu_si128((const __m128i *)(odd + 8 - r)));
+    dst += 2 * stride;
+  }
+}
+
+void vpx_d117_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t stride,
+                                   const uint8_t *above, const uint8_t *left) {
+  DECLARE_ALIGNED(32, uint8_t, even[64]);
+  DECLARE_ALIGNED(32, uint8_t, odd[64]);
+  __m256i avg2[2], avg3[2];
+  int r;
+  border_32(above, left, avg2, avg3);
+  {
+    const __m256i eo = deinterleave_epi8(avg3[0]);
+    _mm_store_si128((__m128i *)even, _mm256_castsi256_si128(eo));
+    _mm256_storeu_si256((__m256i *)(even + 16), avg2[1]);
+    _mm_storeu_si128((__m128i *)(odd + 1), _mm256_extracti128_si256(eo, 1));
+    _mm256_storeu_si256((__m256i *)(odd + 17), avg3[1]);
+  }
+  for (r = 0; r < 16; ++r) {
+    _mm256_storeu_si256((__m256i *)dst,
+                        _mm256_loadu_si256((const __m256i *)(even + 16 - r)));
+    _mm256_storeu_si256((__m256i *)(dst + stride),
+                        _mm256_loadu_si256((const __m256i *)(odd + 16 - r)));
+    dst += 2 * stride;
+  }
+}
@@ -0,0 +1,131 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "./vpx_dsp_rtcd.h"
+#include "vpx/vpx_integer.h"
+#include "vpx_dsp/x86/bitdepth_conversion_avx512.h"
+#include "vp9/common/vp9_scan.h"
+#include "vp9/encoder/vp9_block.h"
+
+// Spreads the DC and AC values of an 8 entry table so that the first lane
+// holds the DC value and every other lane the AC value.
+static VPX_FORCE_INLINE __m512i load_dc_ac_avx512(const int16_t *ptr) {
+  const __m512i idx = _mm512_set_epi64(1, 1, 1, 1, 1, 1, 1, 0);
+  return _mm512_permutexvar_epi64(
+      idx, _mm512_castsi128_si512(_mm_load_si128((const __m128i *)ptr)));
+}
+
+// Drops the DC value, leaving the AC value in every lane.
+static VPX_FORCE_INLINE __m512i ac_only_avx512(__m512i v) {
+  return _mm512_unpackhi_epi64(v, v);
+}
+
+static VPX_FORCE_INLINE void store_dqcoeff_avx512(__m512i qcoeff,
+                                                  __m512i dequant,
+                                                  tran_low_t *dqcoeff_ptr) {
+#if CONFIG_VP9_HIGHBITDEPTH
+  const __m512i q_lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(qcoeff));
+  const __m512i q_hi =
+      _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(qcoeff, 1));
+  const __m512i d_lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(dequant));
+  const __m512i d_hi =
+      _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(dequant, 1));
+  _mm512_storeu_si512((__m512i *)dqcoeff_ptr, _mm512_mullo_epi32(q_lo, d_lo));
+  _mm512_storeu_si512((__m512i *)(dqcoeff_ptr + 16),
+                      _mm512_mullo_epi32(q_hi, d_hi));
+#else
+  _mm512_storeu_si512((__m512i *)dqcoeff_ptr,
+                      _mm512_mullo_epi16(qcoeff, dequant));
+#endif
+}
+
+static VPX_FORCE_INLINE __m512i quantize_b_32(
+    const tran_low_t *coeff_ptr, tran_low_t *qcoeff_ptr,
+    tran_low_t *dqcoeff_ptr, const int16_t *iscan, __m512i zbin, __m512i round,
+    __m512i quant, __m512i dequant, __m512i quant_shift, __m512i eobmax) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i coeff = load_tran_low(coeff_ptr);
+  const __m512i abs_coeff = _mm512_abs_epi16(coeff);
+  const __mmask32 zbin_mask = _mm512_cmpge_epi16_mask(abs_coeff, zbin);
+
+  if (zbin_mask == 0) {
+    store_zero_tran_low(qcoeff_ptr);
+    store_zero_tran_low(dqcoeff_ptr);
+    return eobmax;
+  }
+  {
+    // tmp = abs_coeff >= zbin ? clamp(abs_coeff + round) : 0
+    const __m512i tmp_rnd =
+        _mm512_maskz_adds_epi16(zbin_mask, abs_coeff, round);
+    const __m512i tmp32_a = _mm512_mulhi_epi16(tmp_rnd, quant);
+    const __m512i tmp32_b = _mm512_add_epi16(tmp32_a, tmp_rnd);
+    const __m512i tmp32 = _mm512_mulhi_epi16(tmp32_b, quant_shift);
+    const __mmask32 nz_mask = _mm512_cmpgt_epi16_mask(tmp32, zero);
+    const __mmask32 neg_mask = _mm512_movepi16_mask(coeff);
+    const __m512i qcoeff = _mm512_mask_sub_epi16(tmp32, neg_mask, zero, tmp32);
+    const __m512i v_iscan = _mm512_loadu_si512((const __m512i *)iscan);
+
+    store_tran_low(qcoeff, qcoeff_ptr);
+    store_dqcoeff_avx512(qcoeff, dequant, dqcoeff_ptr);
+    return _mm512_mask_max_epi16(eobmax, nz_mask, eobmax, v_iscan);
+  }
+}
+
+static VPX_FORCE_INLINE uint16_t accumulate_eob512(__m512i eob512) {
+  const __m256i eob256 = _mm256_max_epi16(_mm512_castsi512_si256(eob512),
+                                          _mm512_extracti64x4_epi64(eob512, 1));
+  return (uint16_t)_mm512_reduce_max_epi32(_mm512_cvtepi16_epi32(eob256));
+}
+
+void vpx_quantize_b_avx512(const tran_low_t *coeff_ptr, intptr_t n_coeffs,
+                           const struct macroblock_plane *const mb_plane,
+                           tran_low_t *qcoeff_ptr, tran_low_t *dqcoeff_ptr,
+                           const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                           const struct ScanOrder *const scan_order) {
+  __m512i zbin, round, quant, dequant, quant_shift;
+  __m512i eobmax = _mm512_setzero_si512();
+  const int16_t *iscan = scan_order->iscan;
+  intptr_t i;
+
+  // A 4x4 block does not fill a register.
+  if (n_coeffs < 32) {
+    vpx_quantize_b_avx2(coeff_ptr, n_coeffs, mb_plane, qcoeff_ptr, dqcoeff_ptr,
+                        dequant_ptr, eob_ptr, scan_order);
+    return;
+  }
+  assert(n_coeffs % 32 == 0);
+
+  zbin = load_dc_ac_avx512(mb_plane->zbin);
+  round = load_dc_ac_avx512(mb_plane->round);
+  quant = load_dc_ac_avx512(mb_plane->quant);
+  dequant = load_dc_ac_avx512(dequant_ptr);
+  quant_shift = load_dc_ac_avx512(mb_plane->quant_shift);
+
+  // Do DC and first 31 AC.
+  eobmax = quantize_b_32(coeff_ptr, qcoeff_ptr, dqcoeff_ptr, iscan, zbin,
+                         round, quant, dequant, quant_shift, eobmax);
+
+  zbin = ac_only_avx512(zbin);
+  round = ac_only_avx512(round);
+  quant = ac_only_avx512(quant);
+  dequant = ac_only_avx512(dequant);
+  quant_shift = ac_only_avx512(quant_shift);
+
+  for (i = 32; i < n_coeffs; i += 32) {
+    eobmax = quantize_b_32(coeff_ptr + i, qcoeff_ptr + i, dqcoeff_ptr + i,
+                           iscan + i, zbin, round, quant, dequant, quant_shift,
+                           eobmax);
+  }
+
+  *eob_ptr = accumulate_eob512(eobmax);
+}
@@ -9,6 +9,7 @@
  */
 #include <immintrin.h>
 #include "./vpx_dsp_rtcd.h"
+#include "vpx_dsp/vpx_dsp_common.h"
 #include "vpx_ports/mem.h"
 
 static INLINE unsigned int sad64xh_avx2(const uint8_t *src_ptr, int src_stride,
@@ -206,3 +207,65 @@ FSADAVG32
 #undef FSADAVG32
 #undef FSADAVG64_H
 #undef FSADAVG32_H
+
+// Computes the SADs of a w x h block against the 8 reference positions
+// starting at |ref_ptr| with mpsadbw. Each 8-pixel source group is split
+// between the two lanes: the low lane matches source bytes 0-3 against ref
+// offset 0, the high lane source bytes 4-7 against ref offset 4.
+static INLINE void sad_wxhx8_avx2(const uint8_t *src_ptr, int src_stride,
+                                  const uint8_t *ref_ptr, int ref_stride,
+                                  int w, int h, uint32_t sad_array[8]) {
+  // Every mpsadbw lane result is at most 4 * 255, so the 16-bit sums can take
+  // 64 of them before they need to be widened.
+  const int rows = VPXMIN(h, 512 / w);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i sum_lo = zero, sum_hi = zero;
+  __m128i sad_lo, sad_hi;
+  int i, j, x;
+
+  for (i = 0; i < h; i += rows) {
+    __m256i sum = zero;
+    for (j = 0; j < rows; ++j) {
+      for (x = 0; x < w; x += 8) {
+        const __m256i r = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)(ref_ptr + x)));
+        const __m256i s = _mm256_broadcastq_epi64(
+            _mm_loadl_epi64((const __m128i *)(src_ptr + x)));
+        sum = _mm256_add_epi16(sum, _mm256_mpsadbw_epu8(r, s, 0x28));
+      }
+      src_ptr += src_stride;
+      ref_ptr += ref_stride;
+    }
+    sum_lo = _mm256_add_epi32(sum_lo, _mm256_unpacklo_epi16(sum, zero));
+    sum_hi = _mm256_add_epi32(sum_hi, _mm256_unpackhi_epi16(sum, zero));
+  }
+
+  sad_lo = _mm_add_epi32(_mm256_castsi256_si128(sum_lo),
+                         _mm256_extracti128_si256(sum_lo, 1));
+  sad_hi = _mm_add_epi32(_mm256_castsi256_si128(sum_hi),
+                         _mm256_extracti128_si256(sum_hi, 1));
+  _mm_storeu_si128((__m128i *)sad_array, sad_lo);
+  _mm_storeu_si128((__m128i *)(sad_array + 4), sad_hi);
+}
+
+#define FSADX8(w, h)                                                         \
+  void vpx_sad##w##x##h##x8_avx2(const uint8_t *src_ptr, int src_stride,     \
+                                 const uint8_t *ref_ptr, int ref_stride,     \
+                                 uint32_t sad_array[8]) {                    \
+    sad_wxhx8_avx2(src_ptr, src_stride, ref_ptr, ref_stride, w, h,           \
+                   sad_array);                                               \
+  }
+
+FSADX8(64, 64)
+FSADX8(64, 32)
+FSADX8(32, 64)
+FSADX8(32, 32)
+FSADX8(32, 16)
+FSADX8(16, 32)
+FSADX8(16, 16)
+FSADX8(16, 8)
+FSADX8(8, 16)
+FSADX8(8, 8)
+FSADX8(8, 4)
+
+#undef FSADX8
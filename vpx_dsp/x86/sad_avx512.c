@@ -0,0 +1,157 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <immintrin.h>  // AVX512
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_ports/mem.h"
+
+// Loads two rows of 32 pixels into the low and high halves of a register.
+static INLINE __m512i load_32x2(const uint8_t *ptr, int stride) {
+  const __m256i lo = _mm256_loadu_si256((const __m256i *)ptr);
+  const __m256i hi = _mm256_loadu_si256((const __m256i *)(ptr + stride));
+  return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+static INLINE unsigned int sad64xh_avx512(const uint8_t *src_ptr,
+                                          int src_stride,
+                                          const uint8_t *ref_ptr,
+                                          int ref_stride, int h) {
+  int i;
+  __m512i sum_sad = _mm512_setzero_si512();
+  for (i = 0; i < h; i++) {
+    const __m512i src_reg = _mm512_loadu_si512((const __m512i *)src_ptr);
+    const __m512i ref_reg = _mm512_loadu_si512((const __m512i *)ref_ptr);
+    sum_sad = _mm512_add_epi32(sum_sad, _mm512_sad_epu8(src_reg, ref_reg));
+    ref_ptr += ref_stride;
+    src_ptr += src_stride;
+  }
+  return (unsigned int)_mm512_reduce_add_epi32(sum_sad);
+}
+
+static INLINE unsigned int sad32xh_avx512(const uint8_t *src_ptr,
+                                          int src_stride,
+                                          const uint8_t *ref_ptr,
+                                          int ref_stride, int h) {
+  int i;
+  __m512i sum_sad = _mm512_setzero_si512();
+  for (i = 0; i < h; i += 2) {
+    const __m512i src_reg = load_32x2(src_ptr, src_stride);
+    const __m512i ref_reg = load_32x2(ref_ptr, ref_stride);
+    sum_sad = _mm512_add_epi32(sum_sad, _mm512_sad_epu8(src_reg, ref_reg));
+    ref_ptr += 2 * ref_stride;
+    src_ptr += 2 * src_stride;
+  }
+  return (unsigned int)_mm512_reduce_add_epi32(sum_sad);
+}
+
+#define FSAD64_H(h)                                                           \
+  unsigned int vpx_sad64x##h##_avx512(const uint8_t *src_ptr, int src_stride, \
+                                      const uint8_t *ref_ptr,                 \
+                                      int ref_stride) {                       \
+    return sad64xh_avx512(src_ptr, src_stride, ref_ptr, ref_stride, h);       \
+  }
+
+#define FSADS64_H(h)                                                  \
+  unsigned int vpx_sad_skip_64x##h##_avx512(                          \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, \
+      int ref_stride) {                                               \
+    return 2 * sad64xh_avx512(src_ptr, src_stride * 2, ref_ptr,       \
+                              ref_stride * 2, h / 2);                 \
+  }
+
+#define FSAD32_H(h)                                                           \
+  unsigned int vpx_sad32x##h##_avx512(const uint8_t *src_ptr, int src_stride, \
+                                      const uint8_t *ref_ptr,                 \
+                                      int ref_stride) {                       \
+    return sad32xh_avx512(src_ptr, src_stride, ref_ptr, ref_stride, h);       \
+  }
+
+#define FSADS32_H(h)                                                  \
+  unsigned int vpx_sad_skip_32x##h##_avx512(                          \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr, \
+      int ref_stride) {                                               \
+    return 2 * sad32xh_avx512(src_ptr, src_stride * 2, ref_ptr,       \
+                              ref_stride * 2, h / 2);                 \
+  }
+
+#define FSAD64  \
+  FSAD64_H(64)  \
+  FSAD64_H(32)  \
+  FSADS64_H(64) \
+  FSADS64_H(32)
+
+#define FSAD32  \
+  FSAD32_H(64)  \
+  FSAD32_H(32)  \
+  FSADS32_H(64) \
+  FSADS32_H(32)
+
+FSAD64
+FSAD32
+
+#undef FSAD64
+#undef FSAD32
+#undef FSAD64_H
+#undef FSAD32_H
+#undef FSADS64_H
+#undef FSADS32_H
+
+#define FSADAVG64_H(h)                                                        \
+  unsigned int vpx_sad64x##h##_avg_avx512(                                    \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride, const uint8_t *second_pred) {                           \
+    int i;                                                                    \
+    __m512i sum_sad = _mm512_setzero_si512();                                 \
+    for (i = 0; i < h; i++) {                                                 \
+      const __m512i src_reg = _mm512_loadu_si512((const __m512i *)src_ptr);   \
+      const __m512i ref_reg = _mm512_avg_epu8(                                \
+          _mm512_loadu_si512((const __m512i *)ref_ptr),                       \
+          _mm512_loadu_si512((const __m512i *)second_pred));                  \
+      sum_sad = _mm512_add_epi32(sum_sad, _mm512_sad_epu8(src_reg, ref_reg)); \
+      ref_ptr += ref_stride;                                                  \
+      src_ptr += src_stride;                                                  \
+      second_pred += 64;                                                      \
+    }                                                                         \
+    return (unsigned int)_mm512_reduce_add_epi32(sum_sad);                    \
+  }
+
+#define FSADAVG32_H(h)                                                        \
+  unsigned int vpx_sad32x##h##_avg_avx512(                                    \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,         \
+      int ref_stride, const uint8_t *second_pred) {                           \
+    int i;                                                                    \
+    __m512i sum_sad = _mm512_setzero_si512();                                 \
+    for (i = 0; i < h; i += 2) {                                              \
+      const __m512i src_reg = load_32x2(src_ptr, src_stride);                 \
+      const __m512i ref_reg =                                                 \
+          _mm512_avg_epu8(load_32x2(ref_ptr, ref_stride),                     \
+                          _mm512_loadu_si512((const __m512i *)second_pred));  \
+      sum_sad = _mm512_add_epi32(sum_sad, _mm512_sad_epu8(src_reg, ref_reg)); \
+      ref_ptr += 2 * ref_stride;                                              \
+      src_ptr += 2 * src_stride;                                              \
+      second_pred += 64;                                                      \
+    }                                                                         \
+    return (unsigned int)_mm512_reduce_add_epi32(sum_sad);                    \
+  }
+
+#define FSADAVG64 \
+  FSADAVG64_H(64) \
+  FSADAVG64_H(32)
+
+#define FSADAVG32 \
+  FSADAVG32_H(64) \
+  FSADAVG32_H(32)
+
+FSADAVG64
+FSADAVG32
+
+#undef FSADAVG64
+#undef FSADAVG32
+#undef FSADAVG64_H
+#undef FSADAVG32_H
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>  // AVX512
+
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_ports/mem.h"
+
+// The blocks are processed 64 pixels at a time: one row of a 64 wide block,
+// or two rows of a 32 wide block.
+static INLINE __m512i load_rows(const uint8_t *ptr, int stride, int w) {
+  if (w == 64) return _mm512_loadu_si512((const __m512i *)ptr);
+  return _mm512_inserti64x4(
+      _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)ptr)),
+      _mm256_loadu_si256((const __m256i *)(ptr + stride)), 1);
+}
+
+static INLINE void variance_kernel_avx512(const __m512i src, const __m512i ref,
+                                          __m512i *const sse,
+                                          __m512i *const sum) {
+  const __m512i one = _mm512_set1_epi16(1);
+  const __m512i src_lo = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(src));
+  const __m512i src_hi =
+      _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(src, 1));
+  const __m512i ref_lo = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(ref));
+  const __m512i ref_hi =
+      _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(ref, 1));
+  const __m512i diff_lo = _mm512_sub_epi16(src_lo, ref_lo);
+  const __m512i diff_hi = _mm512_sub_epi16(src_hi, ref_hi);
+
+  // accumulate the squares and the differences as 32 bit
+  *sse = _mm512_add_epi32(*sse, _mm512_madd_epi16(diff_lo, diff_lo));
+  *sse = _mm512_add_epi32(*sse, _mm512_madd_epi16(diff_hi, diff_hi));
+  *sum = _mm512_add_epi32(
+      *sum, _mm512_madd_epi16(_mm512_add_epi16(diff_lo, diff_hi), one));
+}
+
+static INLINE void variance_avx512(const uint8_t *src, int src_stride,
+                                   const uint8_t *ref, int ref_stride, int w,
+                                   int h, unsigned int *sse, int *sum) {
+  const int rows = 64 / w;
+  __m512i vsse = _mm512_setzero_si512();
+  __m512i vsum = _mm512_setzero_si512();
+  int i;
+
+  for (i = 0; i < h; i += rows) {
+    variance_kernel_avx512(load_rows(src, src_stride, w),
+                           load_rows(ref, ref_stride, w), &vsse, &vsum);
+    src += rows * src_stride;
+    ref += rows * ref_stride;
+  }
+  *sse = (unsigned int)_mm512_reduce_add_epi32(vsse);
+  *sum = _mm512_reduce_add_epi32(vsum);
+}
+
+#define VAR(w, h, shift)                                                 \
+  unsigned int vpx_variance##w##x##h##_avx512(                           \
+      const uint8_t *src_ptr, int src_stride, const uint8_t *ref_ptr,    \
+      int ref_stride, unsigned int *sse) {                               \
+    int sum;                                                             \
+    variance_avx512(src_ptr, src_stride, ref_ptr, ref_stride, w, h, sse, \
+                    &sum);                                               \
+    return *sse - (uint32_t)(((int64_t)sum * sum) >> (shift));           \
+  }
+
+VAR(64, 64, 12)
+VAR(64, 32, 11)
+VAR(32, 64, 11)
+VAR(32, 32, 10)
+
+#undef VAR
+
+// Applies the 2 tap bilinear filter 'offset' to the pixel pairs in 'a' and
+// 'b'. The filter taps are (16 - 2 * offset, 2 * offset), which round the same
+// as the 7 bit taps of the C code.
+static INLINE __m512i bilinear_avx512(const __m512i a, const __m512i b,
+                                      const __m512i filter) {
+  const __m512i round = _mm512_set1_epi16(8);
+  __m512i lo = _mm512_maddubs_epi16(_mm512_unpacklo_epi8(a, b), filter);
+  __m512i hi = _mm512_maddubs_epi16(_mm512_unpackhi_epi8(a, b), filter);
+  lo = _mm512_srli_epi16(_mm512_add_epi16(lo, round), 4);
+  hi = _mm512_srli_epi16(_mm512_add_epi16(hi, round), 4);
+  return _mm512_packus_epi16(lo, hi);
+}
+
+static INLINE __m512i bilinear_filter_avx512(int offset) {
+  return _mm512_set1_epi16((int16_t)(((2 * offset) << 8) | (16 - 2 * offset)));
+}
+
+// Filters 'h' rows of 'w' pixels with the pixels 'pixel_step' away. The output
+// is stored contiguously, so two rows of a 32 wide block fill a register.
+static INLINE void bilinear_pass_avx512(const uint8_t *src, int src_stride,
+                                        int pixel_step, uint8_t *dst, int w,
+                                        int h, int offset) {
+  const __m512i filter = bilinear_filter_avx512(offset);
+  const int rows = 64 / w;
+  int i;
+
+  for (i = 0; i + rows <= h; i += rows) {
+    const __m512i a = load_rows(src, src_stride, w);
+    const __m512i b = load_rows(src + pixel_step, src_stride, w);
+    _mm512_store_si512((__m512i *)dst, bilinear_avx512(a, b, filter));
+    src += rows * src_stride;
+    dst += 64;
+  }
+  if (i < h) {
+    // The odd row of a 32 wide block.
+    const __m512i a =
+        _mm512_zextsi256_si512(_mm256_loadu_si256((const __m256i *)src));
+    const __m512i b = _mm512_zextsi256_si512(
+        _mm256_loadu_si256((const __m256i *)(src + pixel_step)));
+    _mm256_store_si256((__m256i *)dst,
+                       _mm512_castsi512_si256(bilinear_avx512(a, b, filter)));
+  }
+}
+
+static INLINE uint32_t sub_pixel_variance_avx512(
+    const uint8_t *src, int src_stride, int x_offset, int y_offset,
+    const uint8_t *ref, int ref_stride, const uint8_t *second_pred, int w,
+    int h, int shift, uint32_t *sse) {
+  DECLARE_ALIGNED(64, uint8_t, fdata[(64 + 1) * 64]);
+  DECLARE_ALIGNED(64, uint8_t, vdata[64 * 64]);
+  const uint8_t *pred = src;
+  int pred_stride = src_stride;
+  int sum;
+
+  if (x_offset) {
+    bilinear_pass_avx512(pred, pred_stride, 1, fdata, w, h + (y_offset != 0),
+                         x_offset);
+    pred = fdata;
+    pred_stride = w;
+  }
+  if (y_offset) {
+    bilinear_pass_avx512(pred, pred_stride, pred_stride, vdata, w, h,
+                         y_offset);
+    pred = vdata;
+    pred_stride = w;
+  }
+  if (second_pred) {
+    const int rows = 64 / w;
+    int i;
+    for (i = 0; i < h; i += rows) {
+      const __m512i p = load_rows(pred + i * pred_stride, pred_stride, w);
+      const __m512i sec =
+          _mm512_loadu_si512((const __m512i *)(second_pred + i * w));
+      _mm512_store_si512((__m512i *)(vdata + i * w), _mm512_avg_epu8(p, sec));
+    }
+    pred = vdata;
+    pred_stride = w;
+  }
+
+  variance_avx512(pred, pred_stride, ref, ref_stride, w, h, sse, &sum);
+  return *sse - (uint32_t)(((int64_t)sum * sum) >> shift);
+}
+
+#define SUBPIX_VAR(w, h, shift)                                              \
+  uint32_t vpx_sub_pixel_variance##w##x##h##_avx512(                         \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse) {               \
+    return sub_pixel_variance_avx512(src_ptr, src_stride, x_offset,          \
+                                     y_offset, ref_ptr, ref_stride, NULL, w, \
+                                     h, shift, sse);                         \
+  }                                                                          \
+                                                                             \
+  uint32_t vpx_sub_pixel_avg_variance##w##x##h##_avx512(                     \
+      const uint8_t *src_ptr, int src_stride, int x_offset, int y_offset,    \
+      const uint8_t *ref_ptr, int ref_stride, uint32_t *sse,                 \
+      const uint8_t *second_pred) {                                          \
+    return sub_pixel_variance_avx512(src_ptr, src_stride, x_offset,          \
+                                     y_offset, ref_ptr, ref_stride,          \
+                                     second_pred, w, h, shift, sse);         \
+  }
+
+SUBPIX_VAR(64, 64, 12)
+SUBPIX_VAR(64, 32, 11)
+SUBPIX_VAR(32, 64, 11)
+SUBPIX_VAR(32, 32, 10)
+
+#undef SUBPIX_VAR
@@ -1146,6 +1146,10 @@ HIGH_FUN_CONV_1D(avg_horiz, x0_q4, x_step_q4, h, src, avg_, sse2, 1)
 HIGH_FUN_CONV_1D(avg_vert, y0_q4, y_step_q4, v,
                  src - src_stride * (num_taps / 2 - 1), avg_, sse2, 1)
 
+// Scaled steps fall back to C.
+#define highbd_convolve8_scaled_sse2 vpx_highbd_convolve8_c
+#define highbd_convolve8_avg_scaled_sse2 vpx_highbd_convolve8_avg_c
+
 // void vpx_highbd_convolve8_sse2(const uint8_t *src, ptrdiff_t src_stride,
 //                                uint8_t *dst, ptrdiff_t dst_stride,
 //                                const InterpKernel *filter, int x0_q4,
@@ -10,12 +10,14 @@
 
 #include <immintrin.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "./vpx_dsp_rtcd.h"
 #include "vpx_dsp/x86/convolve.h"
 #include "vpx_dsp/x86/convolve_avx2.h"
 #include "vpx_dsp/x86/convolve_sse2.h"
 #include "vpx_dsp/x86/convolve_ssse3.h"
+#include "vpx_dsp/x86/mem_sse2.h"
 #include "vpx_ports/mem.h"
 
 // filters for 16_h8
@@ -1371,4 +1373,277 @@ FUN_CONV_1D(avg_vert, y0_q4, y_step_q4, v,
 //                              int w, int h);
 FUN_CONV_2D(, avx2, 0)
 FUN_CONV_2D(avg_, avx2, 1)
+
+// Filter one column of 8 taps for 8 rows starting at src_lo and 8 rows
+// starting at src_hi, one group per lane. The results go to dst_lo and dst_hi.
+static void filter_horiz_w8x2_avx2(const uint8_t *const src_lo,
+                                   const uint8_t *const src_hi,
+                                   const ptrdiff_t src_stride,
+                                   uint8_t *const dst_lo, uint8_t *const dst_hi,
+                                   const int16_t *const x_filter) {
+  __m256i s[8], a[4], b[4], ss[4], f[4], temp;
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    s[i] = mm256_loadu2_epi64(src_lo + i * src_stride, src_hi + i * src_stride);
+  }
+
+  // Transpose the 16 bit tap pairs within each lane to get, per lane:
+  // ss[0]: 00 01 10 11 20 21 30 31  40 41 50 51 60 61 70 71
+  // ss[1]: 02 03 12 13 22 23 32 33  42 43 52 53 62 63 72 73
+  // ss[2]: 04 05 14 15 24 25 34 35  44 45 54 55 64 65 74 75
+  // ss[3]: 06 07 16 17 26 27 36 37  46 47 56 57 66 67 76 77
+  a[0] = _mm256_unpacklo_epi16(s[0], s[1]);
+  a[1] = _mm256_unpacklo_epi16(s[2], s[3]);
+  a[2] = _mm256_unpacklo_epi16(s[4], s[5]);
+  a[3] = _mm256_unpacklo_epi16(s[6], s[7]);
+  b[0] = _mm256_unpacklo_epi32(a[0], a[1]);
+  b[1] = _mm256_unpacklo_epi32(a[2], a[3]);
+  b[2] = _mm256_unpackhi_epi32(a[0], a[1]);
+  b[3] = _mm256_unpackhi_epi32(a[2], a[3]);
+  ss[0] = _mm256_unpacklo_epi64(b[0], b[1]);
+  ss[1] = _mm256_unpackhi_epi64(b[0], b[1]);
+  ss[2] = _mm256_unpacklo_epi64(b[2], b[3]);
+  ss[3] = _mm256_unpackhi_epi64(b[2], b[3]);
+
+  shuffle_filter_avx2(x_filter, f);
+  temp = convolve8_16_avx2(ss, f);
+  // shrink to 8 bit each 16 bits
+  temp = _mm256_packus_epi16(temp, temp);
+  _mm_storel_epi64((__m128i *)dst_lo, _mm256_castsi256_si128(temp));
+  _mm_storel_epi64((__m128i *)dst_hi, _mm256_extracti128_si256(temp, 1));
+}
+
+// Transpose the 8x8 blocks at src and src + 64 back to rows 0-7 and 8-15 of
+// dst. Only the first block is stored when rows is 8.
+static void transpose8x8x2_to_dst(const uint8_t *const src, uint8_t *const dst,
+                                  const ptrdiff_t dst_stride, const int rows) {
+  __m256i s[8], a[4], b[4], c[4];
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    s[i] = mm256_loadu2_epi64(src + i * 8, src + 64 + i * 8);
+  }
+
+  a[0] = _mm256_unpacklo_epi8(s[0], s[1]);
+  a[1] = _mm256_unpacklo_epi8(s[2], s[3]);
+  a[2] = _mm256_unpacklo_epi8(s[4], s[5]);
+  a[3] = _mm256_unpacklo_epi8(s[6], s[7]);
+  b[0] = _mm256_unpacklo_epi16(a[0], a[1]);
+  b[1] = _mm256_unpackhi_epi16(a[0], a[1]);
+  b[2] = _mm256_unpacklo_epi16(a[2], a[3]);
+  b[3] = _mm256_unpackhi_epi16(a[2], a[3]);
+  // c[i] holds rows 2 * i and 2 * i + 1 in each lane.
+  c[0] = _mm256_unpacklo_epi32(b[0], b[2]);
+  c[1] = _mm256_unpackhi_epi32(b[0], b[2]);
+  c[2] = _mm256_unpacklo_epi32(b[1], b[3]);
+  c[3] = _mm256_unpackhi_epi32(b[1], b[3]);
+
+  for (i = 0; i < 4; ++i) {
+    const __m128i lo = _mm256_castsi256_si128(c[i]);
+    _mm_storel_epi64((__m128i *)(dst + (2 * i) * dst_stride), lo);
+    _mm_storeh_epi64((__m128i *)(dst + (2 * i + 1) * dst_stride), lo);
+    if (rows == 16) {
+      const __m128i hi = _mm256_extracti128_si256(c[i], 1);
+      _mm_storel_epi64((__m128i *)(dst + (2 * i + 8) * dst_stride), hi);
+      _mm_storeh_epi64((__m128i *)(dst + (2 * i + 9) * dst_stride), hi);
+    }
+  }
+}
+
+static void scaledconvolve_horiz_w8_avx2(const uint8_t *src,
+                                         const ptrdiff_t src_stride,
+                                         uint8_t *dst,
+                                         const ptrdiff_t dst_stride,
+                                         const InterpKernel *const x_filters,
+                                         const int x0_q4, const int x_step_q4,
+                                         const int w, const int h) {
+  DECLARE_ALIGNED(16, uint8_t, temp[2 * 8 * 8]);
+  int x, y, z;
+  src -= SUBPEL_TAPS / 2 - 1;
+
+  // This function processes 16x8 areas, with an 8x8 area for the last rows
+  // when needed. As in the SSSE3 version, the intermediate height is forced to
+  // a multiple of 8.
+  y = h + (8 - (h & 0x7));
+
+  do {
+    // When only 8 rows are left, the high lane repeats the low lane so that
+    // no rows past the SSSE3 version are read.
+    const int rows = y >= 16 ? 16 : 8;
+    const uint8_t *const src_hi = src + (rows - 8) * src_stride;
+    int x_q4 = x0_q4;
+    for (x = 0; x < w; x += 8) {
+      // process 8 src_x steps
+      for (z = 0; z < 8; ++z) {
+        const int offset = x_q4 >> SUBPEL_BITS;
+        const int16_t *const x_filter = x_filters[x_q4 & SUBPEL_MASK];
+        if (x_q4 & SUBPEL_MASK) {
+          filter_horiz_w8x2_avx2(src + offset, src_hi + offset, src_stride,
+                                 temp + z * 8, temp + 64 + z * 8, x_filter);
+        } else {
+          int i;
+          for (i = 0; i < 8; ++i) {
+            temp[z * 8 + i] = src[offset + i * src_stride + 3];
+            temp[64 + z * 8 + i] = src_hi[offset + i * src_stride + 3];
+          }
+        }
+        x_q4 += x_step_q4;
+      }
+
+      // transpose the filtered values back to dst
+      transpose8x8x2_to_dst(temp, dst + x, dst_stride, rows);
+    }
+
+    src += src_stride * rows;
+    dst += dst_stride * rows;
+    y -= rows;
+  } while (y);
+}
+
+static void filter_vert_w16_avx2(const uint8_t *const src,
+                                 const ptrdiff_t src_stride, uint8_t *const dst,
+                                 const int16_t *const filter) {
+  __m128i s[8], s_lo[4], s_hi[4], f[4], temp_lo, temp_hi;
+
+  shuffle_filter_ssse3(filter, f);
+  loadu_8bit_16x8(src, src_stride, s);
+  s_lo[0] = _mm_unpacklo_epi8(s[0], s[1]);
+  s_hi[0] = _mm_unpackhi_epi8(s[0], s[1]);
+  s_lo[1] = _mm_unpacklo_epi8(s[2], s[3]);
+  s_hi[1] = _mm_unpackhi_epi8(s[2], s[3]);
+  s_lo[2] = _mm_unpacklo_epi8(s[4], s[5]);
+  s_hi[2] = _mm_unpackhi_epi8(s[4], s[5]);
+  s_lo[3] = _mm_unpacklo_epi8(s[6], s[7]);
+  s_hi[3] = _mm_unpackhi_epi8(s[6], s[7]);
+  temp_lo = convolve8_8_ssse3(s_lo, f);
+  temp_hi = convolve8_8_ssse3(s_hi, f);
+  _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(temp_lo, temp_hi));
+}
+
+// Filter 16 pixels of two output rows at once, one row per lane. Each row has
+// its own source position and filter.
+static void filter_vert_w16x2_avx2(const uint8_t *const src0,
+                                   const uint8_t *const src1,
+                                   const ptrdiff_t src_stride,
+                                   uint8_t *const dst0, uint8_t *const dst1,
+                                   const int16_t *const filter0,
+                                   const int16_t *const filter1) {
+  const __m256i f_values = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i *)filter0)),
+      _mm_load_si128((const __m128i *)filter1), 1);
+  __m256i s[8], s_lo[4], s_hi[4], f[4], temp;
+  int i;
+
+  // pack and duplicate the filter values
+  f[0] = _mm256_shuffle_epi8(f_values, _mm256_set1_epi16(0x0200u));
+  f[1] = _mm256_shuffle_epi8(f_values, _mm256_set1_epi16(0x0604u));
+  f[2] = _mm256_shuffle_epi8(f_values, _mm256_set1_epi16(0x0a08u));
+  f[3] = _mm256_shuffle_epi8(f_values, _mm256_set1_epi16(0x0e0cu));
+
+  for (i = 0; i < 8; ++i) {
+    s[i] = mm256_loadu2_si128(src0 + i * src_stride, src1 + i * src_stride);
+  }
+  for (i = 0; i < 4; ++i) {
+    s_lo[i] = _mm256_unpacklo_epi8(s[2 * i], s[2 * i + 1]);
+    s_hi[i] = _mm256_unpackhi_epi8(s[2 * i], s[2 * i + 1]);
+  }
+  temp = _mm256_packus_epi16(convolve8_16_avx2(s_lo, f),
+                             convolve8_16_avx2(s_hi, f));
+  _mm_storeu_si128((__m128i *)dst0, _mm256_castsi256_si128(temp));
+  _mm_storeu_si128((__m128i *)dst1, _mm256_extracti128_si256(temp, 1));
+}
+
+static void filter_vert_w32_avx2(const uint8_t *src, const ptrdiff_t src_stride,
+                                 uint8_t *const dst,
+                                 const int16_t *const filter, const int w) {
+  __m256i f[4];
+  int i;
+
+  shuffle_filter_avx2(filter, f);
+
+  for (i = 0; i < w; i += 32) {
+    __m256i s[8], s_lo[4], s_hi[4];
+    int k;
+
+    for (k = 0; k < 8; ++k) {
+      s[k] = _mm256_loadu_si256((const __m256i *)(src + k * src_stride));
+    }
+    for (k = 0; k < 4; ++k) {
+      s_lo[k] = _mm256_unpacklo_epi8(s[2 * k], s[2 * k + 1]);
+      s_hi[k] = _mm256_unpackhi_epi8(s[2 * k], s[2 * k + 1]);
+    }
+    // The unpacks and the pack stay within each lane, so the output is in
+    // order.
+    _mm256_storeu_si256((__m256i *)&dst[i],
+                        _mm256_packus_epi16(convolve8_16_avx2(s_lo, f),
+                                            convolve8_16_avx2(s_hi, f)));
+    src += 32;
+  }
+}
+
+static void scaledconvolve_vert_w16_avx2(
+    const uint8_t *src, const ptrdiff_t src_stride, uint8_t *const dst,
+    const ptrdiff_t dst_stride, const InterpKernel *const y_filters,
+    const int y0_q4, const int y_step_q4, const int w, const int h) {
+  int y = 0;
+  int y_q4 = y0_q4;
+
+  src -= src_stride * (SUBPEL_TAPS / 2 - 1);
+  while (y < h) {
+    const uint8_t *const src_y = &src[(y_q4 >> SUBPEL_BITS) * src_stride];
+    const int y1_q4 = y_q4 + y_step_q4;
+
+    if (w == 16 && y + 1 < h && (y_q4 & SUBPEL_MASK) &&
+        (y1_q4 & SUBPEL_MASK)) {
+      filter_vert_w16x2_avx2(src_y, &src[(y1_q4 >> SUBPEL_BITS) * src_stride],
+                             src_stride, &dst[y * dst_stride],
+                             &dst[(y + 1) * dst_stride],
+                             y_filters[y_q4 & SUBPEL_MASK],
+                             y_filters[y1_q4 & SUBPEL_MASK]);
+      y_q4 += 2 * y_step_q4;
+      y += 2;
+      continue;
+    }
+
+    if (!(y_q4 & SUBPEL_MASK)) {
+      memcpy(&dst[y * dst_stride], &src_y[3 * src_stride], w);
+    } else if (w == 16) {
+      filter_vert_w16_avx2(src_y, src_stride, &dst[y * dst_stride],
+                           y_filters[y_q4 & SUBPEL_MASK]);
+    } else {
+      filter_vert_w32_avx2(src_y, src_stride, &dst[y * dst_stride],
+                           y_filters[y_q4 & SUBPEL_MASK], w);
+    }
+    y_q4 += y_step_q4;
+    ++y;
+  }
+}
+
+void vpx_scaled_2d_avx2(const uint8_t *src, ptrdiff_t src_stride, uint8_t *dst,
+                        ptrdiff_t dst_stride, const InterpKernel *filter,
+                        int x0_q4, int x_step_q4, int y0_q4, int y_step_q4,
+                        int w, int h) {
+  // See vpx_scaled_2d_ssse3() for the derivation of the temp buffer size.
+  DECLARE_ALIGNED(32, uint8_t, temp[(135 + 8) * 64]);
+  const int intermediate_height =
+      (((h - 1) * y_step_q4 + y0_q4) >> SUBPEL_BITS) + SUBPEL_TAPS;
+
+  assert(w <= 64);
+  assert(h <= 64);
+  assert(y_step_q4 <= 32 || (y_step_q4 <= 64 && h <= 32));
+  assert(x_step_q4 <= 64);
+
+  if (w < 16) {
+    vpx_scaled_2d_ssse3(src, src_stride, dst, dst_stride, filter, x0_q4,
+                        x_step_q4, y0_q4, y_step_q4, w, h);
+    return;
+  }
+
+  scaledconvolve_horiz_w8_avx2(src - src_stride * (SUBPEL_TAPS / 2 - 1),
+                               src_stride, temp, 64, filter, x0_q4, x_step_q4,
+                               w, intermediate_height);
+  scaledconvolve_vert_w16_avx2(temp + 64 * (SUBPEL_TAPS / 2 - 1), 64, dst,
+                               dst_stride, filter, y0_q4, y_step_q4, w, h);
+}
 #endif  // HAVE_AX2 && HAVE_SSSE3
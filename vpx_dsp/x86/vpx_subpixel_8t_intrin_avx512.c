@@ -0,0 +1,427 @@
+/*
+ *  Copyright (c) 2026 The WebM project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <assert.h>
+#include <immintrin.h>  // AVX512
+
+#include "./vpx_dsp_rtcd.h"
+#include "vpx_dsp/vpx_filter.h"
+#include "vpx_ports/compiler_attributes.h"
+#include "vpx_ports/mem.h"
+
+// The 8 tap kernels filter blocks 32 or 64 pixels wide, narrower columns are
+// left to the AVX2 functions. The 4 and 2 tap filters are applied as 8 tap
+// filters with zero outer taps, which gives the same result.
+
+// Pairs of adjacent pixels for the 4 filter tap pairs of the 8 outputs in each
+// 128 bit lane.
+DECLARE_ALIGNED(16, static const uint8_t, filt_avx512[4][16]) = {
+  { 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8 },
+  { 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10 },
+  { 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12 },
+  { 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14 },
+};
+
+static INLINE void shuffle_filter_avx512(const int16_t *const filter,
+                                         __m512i *const f) {
+  const __m512i f_values =
+      _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)filter));
+  // pack and duplicate the filter values
+  f[0] = _mm512_shuffle_epi8(f_values, _mm512_set1_epi16(0x0200u));
+  f[1] = _mm512_shuffle_epi8(f_values, _mm512_set1_epi16(0x0604u));
+  f[2] = _mm512_shuffle_epi8(f_values, _mm512_set1_epi16(0x0a08u));
+  f[3] = _mm512_shuffle_epi8(f_values, _mm512_set1_epi16(0x0e0cu));
+}
+
+static INLINE __m512i convolve8_32_avx512(const __m512i *const s,
+                                          const __m512i *const f) {
+  // multiply 2 adjacent elements with the filter and add the result
+  const __m512i k_64 = _mm512_set1_epi16(1 << 6);
+  const __m512i x0 = _mm512_maddubs_epi16(s[0], f[0]);
+  const __m512i x1 = _mm512_maddubs_epi16(s[1], f[1]);
+  const __m512i x2 = _mm512_maddubs_epi16(s[2], f[2]);
+  const __m512i x3 = _mm512_maddubs_epi16(s[3], f[3]);
+  __m512i sum1, sum2;
+
+  // sum the results together, saturating only on the final step
+  // adding x0 with x2 and x1 with x3 is the only order that prevents
+  // outranges for all filters
+  sum1 = _mm512_add_epi16(x0, x2);
+  sum2 = _mm512_add_epi16(x1, x3);
+  // add the rounding offset early to avoid another saturated add
+  sum1 = _mm512_add_epi16(sum1, k_64);
+  sum1 = _mm512_adds_epi16(sum1, sum2);
+  // round and shift by 7 bit each 16 bit
+  return _mm512_srai_epi16(sum1, 7);
+}
+
+// Filters 32 pixels horizontally. Lane k of the result holds outputs 8 * k to
+// 8 * k + 7 as 16 bit values.
+static INLINE __m512i convolve8_h_32_avx512(const uint8_t *src,
+                                            const __m512i *const filt,
+                                            const __m512i *const f) {
+  // Only the 39 bytes used by the filter are read.
+  const __m512i idx = _mm512_setr_epi64(0, 1, 1, 2, 2, 3, 3, 4);
+  const __m512i src_reg = _mm512_permutexvar_epi64(
+      idx, _mm512_maskz_loadu_epi8(0x7fffffffffULL, src - 3));
+  __m512i s[4];
+  s[0] = _mm512_shuffle_epi8(src_reg, filt[0]);
+  s[1] = _mm512_shuffle_epi8(src_reg, filt[1]);
+  s[2] = _mm512_shuffle_epi8(src_reg, filt[2]);
+  s[3] = _mm512_shuffle_epi8(src_reg, filt[3]);
+  return convolve8_32_avx512(s, f);
+}
+
+// Packs two sets of 32 outputs of convolve8_h_32_avx512() to 8 bit, in order.
+static INLINE __m512i pack_h_64_avx512(const __m512i a, const __m512i b) {
+  const __m512i idx = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+  return _mm512_permutexvar_epi64(idx, _mm512_packus_epi16(a, b));
+}
+
+static INLINE __m512i load_32x2(const uint8_t *ptr, ptrdiff_t stride) {
+  return _mm512_inserti64x4(
+      _mm512_castsi256_si512(_mm256_loadu_si256((const __m256i *)ptr)),
+      _mm256_loadu_si256((const __m256i *)(ptr + stride)), 1);
+}
+
+static INLINE void store_32x2(uint8_t *ptr, ptrdiff_t stride,
+                              const __m512i v) {
+  _mm256_storeu_si256((__m256i *)ptr, _mm512_castsi512_si256(v));
+  _mm256_storeu_si256((__m256i *)(ptr + stride),
+                      _mm512_extracti64x4_epi64(v, 1));
+}
+
+static INLINE void filter_block1d64_h8_avx512(const uint8_t *src_ptr,
+                                              ptrdiff_t src_stride,
+                                              uint8_t *dst_ptr,
+                                              ptrdiff_t dst_stride, int h,
+                                              const int16_t *filter, int avg) {
+  __m512i f[4], filt[4];
+  int i;
+
+  shuffle_filter_avx512(filter, f);
+  for (i = 0; i < 4; ++i) {
+    filt[i] =
+        _mm512_broadcast_i32x4(_mm_load_si128((const __m128i *)filt_avx512[i]));
+  }
+
+  for (i = 0; i < h; ++i) {
+    const __m512i a = convolve8_h_32_avx512(src_ptr, filt, f);
+    const __m512i b = convolve8_h_32_avx512(src_ptr + 32, filt, f);
+    __m512i out = pack_h_64_avx512(a, b);
+    if (avg) {
+      out = _mm512_avg_epu8(out, _mm512_loadu_si512((const __m512i *)dst_ptr));
+    }
+    _mm512_storeu_si512((__m512i *)dst_ptr, out);
+    src_ptr += src_stride;
+    dst_ptr += dst_stride;
+  }
+}
+
+static INLINE void filter_block1d32_h8_avx512(const uint8_t *src_ptr,
+                                              ptrdiff_t src_stride,
+                                              uint8_t *dst_ptr,
+                                              ptrdiff_t dst_stride, int h,
+                                              const int16_t *filter, int avg) {
+  __m512i f[4], filt[4];
+  int i;
+
+  shuffle_filter_avx512(filter, f);
+  for (i = 0; i < 4; ++i) {
+    filt[i] =
+        _mm512_broadcast_i32x4(_mm_load_si128((const __m128i *)filt_avx512[i]));
+  }
+
+  // two rows at a time
+  for (i = 0; i + 1 < h; i += 2) {
+    const __m512i a = convolve8_h_32_avx512(src_ptr, filt, f);
+    const __m512i b = convolve8_h_32_avx512(src_ptr + src_stride, filt, f);
+    __m512i out = pack_h_64_avx512(a, b);
+    if (avg) out = _mm512_avg_epu8(out, load_32x2(dst_ptr, dst_stride));
+    store_32x2(dst_ptr, dst_stride, out);
+    src_ptr += 2 * src_stride;
+    dst_ptr += 2 * dst_stride;
+  }
+
+  // the last row if the height is odd
+  if (i < h) {
+    const __m512i a = convolve8_h_32_avx512(src_ptr, filt, f);
+    __m256i out = _mm512_castsi512_si256(pack_h_64_avx512(a, a));
+    if (avg) {
+      out = _mm256_avg_epu8(out, _mm256_loadu_si256((const __m256i *)dst_ptr));
+    }
+    _mm256_storeu_si256((__m256i *)dst_ptr, out);
+  }
+}
+
+// Filters a row of 64 outputs from the low and high interleaved source rows.
+static INLINE __m512i convolve8_v_avx512(const __m512i *const s_lo,
+                                         const __m512i *const s_hi,
+                                         const __m512i *const f) {
+  return _mm512_packus_epi16(convolve8_32_avx512(s_lo, f),
+                             convolve8_32_avx512(s_hi, f));
+}
+
+// 'src_ptr' points to the row of the first filter tap.
+static INLINE void filter_block1d64_v8_avx512(const uint8_t *src_ptr,
+                                              ptrdiff_t src_stride,
+                                              uint8_t *dst_ptr,
+                                              ptrdiff_t dst_stride, int h,
+                                              const int16_t *filter, int avg) {
+  __m512i f[4];
+  // interleaved source rows for the even (s) and odd (t) output rows
+  __m512i s_lo[4], s_hi[4], t_lo[4], t_hi[4];
+  __m512i r[7];
+  int i;
+
+  assert(!(h & 1));
+  shuffle_filter_avx512(filter, f);
+
+  for (i = 0; i < 7; ++i) {
+    r[i] = _mm512_loadu_si512((const __m512i *)(src_ptr + i * src_stride));
+  }
+  for (i = 0; i < 3; ++i) {
+    s_lo[i] = _mm512_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+    s_hi[i] = _mm512_unpackhi_epi8(r[2 * i], r[2 * i + 1]);
+    t_lo[i] = _mm512_unpacklo_epi8(r[2 * i + 1], r[2 * i + 2]);
+    t_hi[i] = _mm512_unpackhi_epi8(r[2 * i + 1], r[2 * i + 2]);
+  }
+  src_ptr += 7 * src_stride;
+
+  for (i = 0; i < h; i += 2) {
+    const __m512i r7 = _mm512_loadu_si512((const __m512i *)src_ptr);
+    const __m512i r8 =
+        _mm512_loadu_si512((const __m512i *)(src_ptr + src_stride));
+    __m512i out0, out1;
+    s_lo[3] = _mm512_unpacklo_epi8(r[6], r7);
+    s_hi[3] = _mm512_unpackhi_epi8(r[6], r7);
+    t_lo[3] = _mm512_unpacklo_epi8(r7, r8);
+    t_hi[3] = _mm512_unpackhi_epi8(r7, r8);
+
+    out0 = convolve8_v_avx512(s_lo, s_hi, f);
+    out1 = convolve8_v_avx512(t_lo, t_hi, f);
+    if (avg) {
+      out0 =
+          _mm512_avg_epu8(out0, _mm512_loadu_si512((const __m512i *)dst_ptr));
+      out1 = _mm512_avg_epu8(
+          out1, _mm512_loadu_si512((const __m512i *)(dst_ptr + dst_stride)));
+    }
+    _mm512_storeu_si512((__m512i *)dst_ptr, out0);
+    _mm512_storeu_si512((__m512i *)(dst_ptr + dst_stride), out1);
+
+    // shift down by two rows
+    s_lo[0] = s_lo[1];
+    s_hi[0] = s_hi[1];
+    s_lo[1] = s_lo[2];
+    s_hi[1] = s_hi[2];
+    s_lo[2] = s_lo[3];
+    s_hi[2] = s_hi[3];
+    t_lo[0] = t_lo[1];
+    t_hi[0] = t_hi[1];
+    t_lo[1] = t_lo[2];
+    t_hi[1] = t_hi[2];
+    t_lo[2] = t_lo[3];
+    t_hi[2] = t_hi[3];
+    r[6] = r8;
+    src_ptr += 2 * src_stride;
+    dst_ptr += 2 * dst_stride;
+  }
+}
+
+// Same as filter_block1d64_v8_avx512(), with two rows of 32 pixels per
+// register: the low halves filter the even output rows and the high halves
+// the odd ones.
+static INLINE void filter_block1d32_v8_avx512(const uint8_t *src_ptr,
+                                              ptrdiff_t src_stride,
+                                              uint8_t *dst_ptr,
+                                              ptrdiff_t dst_stride, int h,
+                                              const int16_t *filter, int avg) {
+  __m512i f[4], s_lo[4], s_hi[4];
+  __m512i r[6];
+  __m256i last;
+  int i;
+
+  assert(!(h & 1));
+  shuffle_filter_avx512(filter, f);
+
+  for (i = 0; i < 6; ++i) {
+    r[i] = load_32x2(src_ptr + i * src_stride, src_stride);
+  }
+  for (i = 0; i < 3; ++i) {
+    s_lo[i] = _mm512_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+    s_hi[i] = _mm512_unpackhi_epi8(r[2 * i], r[2 * i + 1]);
+  }
+  last = _mm512_extracti64x4_epi64(r[5], 1);
+  src_ptr += 7 * src_stride;
+
+  for (i = 0; i < h; i += 2) {
+    const __m256i r7 = _mm256_loadu_si256((const __m256i *)src_ptr);
+    const __m256i r8 =
+        _mm256_loadu_si256((const __m256i *)(src_ptr + src_stride));
+    const __m512i r67 =
+        _mm512_inserti64x4(_mm512_castsi256_si512(last), r7, 1);
+    const __m512i r78 = _mm512_inserti64x4(_mm512_castsi256_si512(r7), r8, 1);
+    __m512i out;
+    s_lo[3] = _mm512_unpacklo_epi8(r67, r78);
+    s_hi[3] = _mm512_unpackhi_epi8(r67, r78);
+
+    out = convolve8_v_avx512(s_lo, s_hi, f);
+    if (avg) out = _mm512_avg_epu8(out, load_32x2(dst_ptr, dst_stride));
+    store_32x2(dst_ptr, dst_stride, out);
+
+    // shift down by two rows
+    s_lo[0] = s_lo[1];
+    s_hi[0] = s_hi[1];
+    s_lo[1] = s_lo[2];
+    s_hi[1] = s_hi[2];
+    s_lo[2] = s_lo[3];
+    s_hi[2] = s_hi[3];
+    last = r8;
+    src_ptr += 2 * src_stride;
+    dst_ptr += 2 * dst_stride;
+  }
+}
+
+static INLINE void convolve8_horiz_avx512(
+    const uint8_t *src, ptrdiff_t src_stride, uint8_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *filter, int x0_q4, int x_step_q4,
+    int y0_q4, int y_step_q4, int w, int h, int avg) {
+  const int16_t *const filter_row = filter[x0_q4];
+  int x = 0;
+  assert(filter_row[3] != 128);
+  assert(x_step_q4 == 16);
+
+  for (; x + 64 <= w; x += 64) {
+    filter_block1d64_h8_avx512(src + x, src_stride, dst + x, dst_stride, h,
+                               filter_row, avg);
+  }
+  if (x + 32 <= w) {
+    filter_block1d32_h8_avx512(src + x, src_stride, dst + x, dst_stride, h,
+                               filter_row, avg);
+    x += 32;
+  }
+  if (x < w) {
+    if (avg) {
+      vpx_convolve8_avg_horiz_avx2(src + x, src_stride, dst + x, dst_stride,
+                                   filter, x0_q4, x_step_q4, y0_q4, y_step_q4,
+                                   w - x, h);
+    } else {
+      vpx_convolve8_horiz_avx2(src + x, src_stride, dst + x, dst_stride,
+                               filter, x0_q4, x_step_q4, y0_q4, y_step_q4,
+                               w - x, h);
+    }
+  }
+}
+
+static INLINE void convolve8_vert_avx512(
+    const uint8_t *src, ptrdiff_t src_stride, uint8_t *dst,
+    ptrdiff_t dst_stride, const InterpKernel *filter, int x0_q4, int x_step_q4,
+    int y0_q4, int y_step_q4, int w, int h, int avg) {
+  const int16_t *const filter_row = filter[y0_q4];
+  const uint8_t *const src_start = src - 3 * src_stride;
+  int x = 0;
+  assert(filter_row[3] != 128);
+  assert(y_step_q4 == 16);
+
+  for (; x + 64 <= w; x += 64) {
+    filter_block1d64_v8_avx512(src_start + x, src_stride, dst + x, dst_stride,
+                               h, filter_row, avg);
+  }
+  if (x + 32 <= w) {
+    filter_block1d32_v8_avx512(src_start + x, src_stride, dst + x, dst_stride,
+                               h, filter_row, avg);
+    x += 32;
+  }
+  if (x < w) {
+    if (avg) {
+      vpx_convolve8_avg_vert_avx2(src + x, src_stride, dst + x, dst_stride,
+                                  filter, x0_q4, x_step_q4, y0_q4, y_step_q4,
+                                  w - x, h);
+    } else {
+      vpx_convolve8_vert_avx2(src + x, src_stride, dst + x, dst_stride, filter,
+                              x0_q4, x_step_q4, y0_q4, y_step_q4, w - x, h);
+    }
+  }
+}
+
+void vpx_convolve8_horiz_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                                uint8_t *dst, ptrdiff_t dst_stride,
+                                const InterpKernel *filter, int x0_q4,
+                                int x_step_q4, int y0_q4, int y_step_q4, int w,
+                                int h) {
+  convolve8_horiz_avx512(src, src_stride, dst, dst_stride, filter, x0_q4,
+                         x_step_q4, y0_q4, y_step_q4, w, h, 0);
+}
+
+void vpx_convolve8_avg_horiz_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                                    uint8_t *dst, ptrdiff_t dst_stride,
+                                    const InterpKernel *filter, int x0_q4,
+                                    int x_step_q4, int y0_q4, int y_step_q4,
+                                    int w, int h) {
+  convolve8_horiz_avx512(src, src_stride, dst, dst_stride, filter, x0_q4,
+                         x_step_q4, y0_q4, y_step_q4, w, h, 1);
+}
+
+void vpx_convolve8_vert_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                               uint8_t *dst, ptrdiff_t dst_stride,
+                               const InterpKernel *filter, int x0_q4,
+                               int x_step_q4, int y0_q4, int y_step_q4, int w,
+                               int h) {
+  convolve8_vert_avx512(src, src_stride, dst, dst_stride, filter, x0_q4,
+                        x_step_q4, y0_q4, y_step_q4, w, h, 0);
+}
+
+void vpx_convolve8_avg_vert_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                                   uint8_t *dst, ptrdiff_t dst_stride,
+                                   const InterpKernel *filter, int x0_q4,
+                                   int x_step_q4, int y0_q4, int y_step_q4,
+                                   int w, int h) {
+  convolve8_vert_avx512(src, src_stride, dst, dst_stride, filter, x0_q4,
+                        x_step_q4, y0_q4, y_step_q4, w, h, 1);
+}
+
+void vpx_convolve8_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                          uint8_t *dst, ptrdiff_t dst_stride,
+                          const InterpKernel *filter, int x0_q4, int x_step_q4,
+                          int y0_q4, int y_step_q4, int w, int h) {
+  DECLARE_ALIGNED(64, uint8_t, fdata[64 * 71] VPX_UNINITIALIZED);
+  assert(w <= 64);
+  assert(h <= 64);
+  if (w & 31) {
+    vpx_convolve8_avx2(src, src_stride, dst, dst_stride, filter, x0_q4,
+                       x_step_q4, y0_q4, y_step_q4, w, h);
+    return;
+  }
+  vpx_convolve8_horiz_avx512(src - 3 * src_stride, src_stride, fdata, 64,
+                             filter, x0_q4, x_step_q4, y0_q4, y_step_q4, w,
+                             h + 7);
+  vpx_convolve8_vert_avx512(fdata + 3 * 64, 64, dst, dst_stride, filter, x0_q4,
+                            x_step_q4, y0_q4, y_step_q4, w, h);
+}
+
+void vpx_convolve8_avg_avx512(const uint8_t *src, ptrdiff_t src_stride,
+                              uint8_t *dst, ptrdiff_t dst_stride,
+                              const InterpKernel *filter, int x0_q4,
+                              int x_step_q4, int y0_q4, int y_step_q4, int w,
+                              int h) {
+  DECLARE_ALIGNED(64, uint8_t, fdata[64 * 71] VPX_UNINITIALIZED);
+  assert(w <= 64);
+  assert(h <= 64);
+  if (w & 31) {
+    vpx_convolve8_avg_avx2(src, src_stride, dst, dst_stride, filter, x0_q4,
+                           x_step_q4, y0_q4, y_step_q4, w, h);
+    return;
+  }
+  vpx_convolve8_horiz_avx512(src - 3 * src_stride, src_stride, fdata, 64,
+                             filter, x0_q4, x_step_q4, y0_q4, y_step_q4, w,
+                             h + 7);
+  vpx_convolve8_avg_vert_avx512(fdata + 3 * 64, 64, dst, dst_stride, filter,
+                                x0_q4, x_step_q4, y0_q4, y_step_q4, w, h);
+}
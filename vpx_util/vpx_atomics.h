@@ -38,6 +38,7 @@ extern "C" {
 #else
 // Use platform-specific asm barriers.
 #if defined(_MSC_VER)
+#include <intrin.h>
 // TODO(pbos): This assumes that newer versions of MSVC are building with the
 // default /volatile:ms (or older, where this is always true. Consider adding
 // support for using <atomic> instead of stdatomic.h when building C++11 under
@@ -99,6 +100,56 @@ static INLINE int vpx_atomic_load_acquire(const vpx_atomic_int *atomic) {
 #endif  // defined(VPX_USE_ATOMIC_BUILTINS)
 }
 
+// Adds 'value' to the atomic and returns its previous value. Sequentially
+// consistent.
+static INLINE int vpx_atomic_fetch_add(vpx_atomic_int *atomic, int value) {
+#if defined(VPX_USE_ATOMIC_BUILTINS)
+  return __atomic_fetch_add(&atomic->value, value, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+  return (int)_InterlockedExchangeAdd((volatile long *)&atomic->value,
+                                      (long)value);
+#else
+  return __sync_fetch_and_add(&atomic->value, value);
+#endif  // defined(VPX_USE_ATOMIC_BUILTINS)
+}
+
+// Stores 'value' in the atomic and returns its previous value. Sequentially
+// consistent.
+static INLINE int vpx_atomic_exchange(vpx_atomic_int *atomic, int value) {
+#if defined(VPX_USE_ATOMIC_BUILTINS)
+  return __atomic_exchange_n(&atomic->value, value, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+  return (int)_InterlockedExchange((volatile long *)&atomic->value,
+                                   (long)value);
+#else
+  // __sync_lock_test_and_set() is only an acquire barrier.
+  __sync_synchronize();
+  return __sync_lock_test_and_set(&atomic->value, value);
+#endif  // defined(VPX_USE_ATOMIC_BUILTINS)
+}
+
+// Stores 'desired' if the atomic holds '*expected' and returns 1. Otherwise
+// copies the current value to '*expected' and returns 0. Sequentially
+// consistent.
+static INLINE int vpx_atomic_compare_exchange(vpx_atomic_int *atomic,
+                                              int *expected, int desired) {
+#if defined(VPX_USE_ATOMIC_BUILTINS)
+  return __atomic_compare_exchange_n(&atomic->value, expected, desired, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+  const int prev =
+#if defined(_MSC_VER)
+      (int)_InterlockedCompareExchange((volatile long *)&atomic->value,
+                                       (long)desired, (long)*expected);
+#else
+      __sync_val_compare_and_swap(&atomic->value, *expected, desired);
+#endif  // defined(_MSC_VER)
+  if (prev == *expected) return 1;
+  *expected = prev;
+  return 0;
+#endif  // defined(VPX_USE_ATOMIC_BUILTINS)
+}
+
 #undef VPX_USE_ATOMIC_BUILTINS
 #undef vpx_atomic_memory_barrier
 
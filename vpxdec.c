@@ -77,7 +77,8 @@ static const arg_def_t outputfile =
 static const arg_def_t threadsarg =
     ARG_DEF("t", "threads", 1, "Max threads to use");
 static const arg_def_t frameparallelarg =
-    ARG_DEF(NULL, "frame-parallel", 0, "Frame parallel decode (ignored)");
+    ARG_DEF(NULL, "frame-parallel", 0,
+            "Frame parallel decode (VP9 only, requires --threads > 1)");
 static const arg_def_t verbosearg =
     ARG_DEF("v", "verbose", 0, "Show version string");
 static const arg_def_t error_concealment =
@@ -103,6 +104,9 @@ static const arg_def_t rowmtarg =
 static const arg_def_t lpfoptarg =
     ARG_DEF(NULL, "lpf-opt", 1,
             "Do loopfilter without waiting for all threads to sync.");
+static const arg_def_t componenttimingarg =
+    ARG_DEF(NULL, "component-timing", 0,
+            "Show time spent per decoder stage (VP9 only)");
 
 static const arg_def_t *all_args[] = { &help,
                                        &codecarg,
@@ -132,6 +136,7 @@ static const arg_def_t *all_args[] = { &help,
                                        &framestatsarg,
                                        &rowmtarg,
                                        &lpfoptarg,
+                                       &componenttimingarg,
                                        NULL };
 
 #if CONFIG_VP8_DECODER
@@ -362,6 +367,32 @@ static void show_progress(int frame_in, int frame_out, uint64_t dx_time) {
           (double)frame_out * 1000000.0 / (double)dx_time);
 }
 
+#if CONFIG_VP9_DECODER
+static void show_stage_time(const char *name, uint64_t us, uint64_t total_us) {
+  fprintf(stderr, "  %-12s %12" PRId64 " us %6.2f%%\n", name, (int64_t)us,
+          total_us > 0 ? us * 100.0 / total_us : 0.0);
+}
+
+static void show_component_timing(vpx_codec_ctx_t *decoder) {
+  vpx_dec_component_timing_t timing;
+  int col;
+
+  if (vpx_codec_control(decoder, VP9D_GET_COMPONENT_TIMING, &timing)) return;
+
+  fprintf(stderr, "Component timing (%u frames)\n", timing.frames);
+  show_stage_time("total", timing.total_us, timing.total_us);
+  show_stage_time("parse", timing.parse_us, timing.total_us);
+  show_stage_time("recon", timing.recon_us, timing.total_us);
+  show_stage_time("loop filter", timing.loop_filter_us, timing.total_us);
+  for (col = 0; col < VPX_MAX_TILE_COLS; ++col) {
+    char name[16];
+    if (timing.tile_us[col] == 0) continue;
+    snprintf(name, sizeof(name), "tile col %d", col);
+    show_stage_time(name, timing.tile_us[col], timing.total_us);
+  }
+}
+#endif
+
 struct ExternalFrameBuffer {
   uint8_t *data;
   size_t size;
@@ -530,6 +561,7 @@ static int main_loop(int argc, const char **argv_) {
   int keep_going = 0;
   int enable_row_mt = 0;
   int enable_lpf_opt = 0;
+  int component_timing = 0;
   const VpxInterface *interface = NULL;
   const VpxInterface *fourcc_interface = NULL;
   uint64_t dx_time = 0;
@@ -551,6 +583,7 @@ static int main_loop(int argc, const char **argv_) {
 #endif
   int frames_corrupted = 0;
   int dec_flags = 0;
+  int frame_parallel = 0;
   int do_scale = 0;
   vpx_image_t *scaled_img = NULL;
 #if CONFIG_VP9_HIGHBITDEPTH
@@ -629,9 +662,8 @@ static int main_loop(int argc, const char **argv_) {
     else if (arg_match(&arg, &threadsarg, argi))
       cfg.threads = arg_parse_uint(&arg);
 #if CONFIG_VP9_DECODER
-    else if (arg_match(&arg, &frameparallelarg, argi)) {
-      /* ignored for compatibility */
-    }
+    else if (arg_match(&arg, &frameparallelarg, argi))
+      frame_parallel = 1;
 #endif
     else if (arg_match(&arg, &verbosearg, argi))
       quiet = 0;
@@ -659,6 +691,8 @@ static int main_loop(int argc, const char **argv_) {
       enable_row_mt = arg_parse_uint(&arg);
     } else if (arg_match(&arg, &lpfoptarg, argi)) {
       enable_lpf_opt = arg_parse_uint(&arg);
+    } else if (arg_match(&arg, &componenttimingarg, argi)) {
+      component_timing = 1;
     }
 #if CONFIG_VP8_DECODER
     else if (arg_match(&arg, &addnoise_level, argi)) {
@@ -771,6 +805,10 @@ static int main_loop(int argc, const char **argv_) {
 
   dec_flags = (postproc ? VPX_CODEC_USE_POSTPROC : 0) |
               (ec_enabled ? VPX_CODEC_USE_ERROR_CONCEALMENT : 0);
+  if (frame_parallel &&
+      (vpx_codec_get_caps(interface->codec_interface()) &
+       VPX_CODEC_CAP_FRAME_THREADING))
+    dec_flags |= VPX_CODEC_USE_FRAME_THREADING;
   if (vpx_codec_dec_init(&decoder, interface->codec_interface(), &cfg,
                          dec_flags)) {
     fprintf(stderr, "Failed to initialize decoder: %s\n",
@@ -797,6 +835,14 @@ static int main_loop(int argc, const char **argv_) {
             vpx_codec_error(&decoder));
     goto fail;
   }
+#if CONFIG_VP9_DECODER
+  if (interface->fourcc == VP9_FOURCC && component_timing &&
+      vpx_codec_control(&decoder, VP9D_SET_COMPONENT_TIMING, 1)) {
+    fprintf(stderr, "Failed to enable component timing: %s\n",
+            vpx_codec_error(&decoder));
+    goto fail;
+  }
+#endif
   if (!quiet) fprintf(stderr, "%s\n", decoder.name);
 
 #if CONFIG_VP8_DECODER
@@ -1071,6 +1117,11 @@ static int main_loop(int argc, const char **argv_) {
     fprintf(stderr, "\n");
   }
 
+#if CONFIG_VP9_DECODER
+  if (interface->fourcc == VP9_FOURCC && component_timing)
+    show_component_timing(&decoder);
+#endif
+
   if (frames_corrupted) {
     fprintf(stderr, "WARNING: %d frames corrupted.\n", frames_corrupted);
   } else {
@@ -116,6 +116,8 @@ static const arg_def_t pass_arg =
     ARG_DEF(NULL, "pass", 1, "Pass to execute (1/2)");
 static const arg_def_t fpf_name =
     ARG_DEF(NULL, "fpf", 1, "First pass statistics file name");
+static const arg_def_t fpmbf_name =
+    ARG_DEF(NULL, "fpmbf", 1, "First pass block statistics file name");
 static const arg_def_t limit =
     ARG_DEF(NULL, "limit", 1, "Stop encoding after n input frames");
 static const arg_def_t skip =
@@ -134,6 +136,8 @@ static const arg_def_t verbosearg =
     ARG_DEF("v", "verbose", 0, "Show encoder parameters");
 static const arg_def_t psnrarg =
     ARG_DEF(NULL, "psnr", 0, "Show PSNR in status line");
+static const arg_def_t component_timing_arg = ARG_DEF(
+    NULL, "component-timing", 0, "Show time spent per encoder stage (VP9)");
 
 static const struct arg_enum_list test_decode_enum[] = {
   { "off", TEST_DECODE_OFF },
@@ -174,6 +178,7 @@ static const arg_def_t *main_args[] = { &help,
                                         &passes,
                                         &pass_arg,
                                         &fpf_name,
+                                        &fpmbf_name,
                                         &limit,
                                         &skip,
                                         &deadline,
@@ -183,6 +188,7 @@ static const arg_def_t *main_args[] = { &help,
                                         &quietarg,
                                         &verbosearg,
                                         &psnrarg,
+                                        &component_timing_arg,
                                         &use_webm,
                                         &use_ivf,
                                         &out_part,
@@ -531,6 +537,21 @@ static const arg_def_t disable_loopfilter =
             "1: Loopfilter off for non reference frames\n"
             "                                          "
             "2: Loopfilter off for all frames");
+
+static const arg_def_t gop_parallel =
+    ARG_DEF(NULL, "gop-parallel", 1,
+            "Number of closed GOPs of kf-max-dist frames to encode in "
+            "parallel in the last pass (0: off)");
+
+static const arg_def_t fp_mv_seeds =
+    ARG_DEF(NULL, "fp-mv-seeds", 1,
+            "Seed the last pass motion search with the first pass motion "
+            "(0: off (default), 1: on)");
+
+static const arg_def_t frame_time_budget =
+    ARG_DEF(NULL, "frame-time-budget", 1,
+            "Target encode time per frame in microseconds, adapts the speed "
+            "of --rt encoding (0: off (default))");
 #endif
 
 #if CONFIG_VP9_ENCODER
@@ -562,6 +583,9 @@ static const arg_def_t *vp9_args[] = { &cpu_used_vp9,
                                        &target_level,
                                        &row_mt,
                                        &disable_loopfilter,
+                                       &gop_parallel,
+                                       &fp_mv_seeds,
+                                       &frame_time_budget,
 // NOTE: The entries above have a corresponding entry in vp9_arg_ctrl_map. The
 // entries below do not have a corresponding entry in vp9_arg_ctrl_map. They
 // must be listed at the end of vp9_args.
@@ -598,6 +622,9 @@ static const int vp9_arg_ctrl_map[] = { VP8E_SET_CPUUSED,
                                         VP9E_SET_TARGET_LEVEL,
                                         VP9E_SET_ROW_MT,
                                         VP9E_SET_DISABLE_LOOPFILTER,
+                                        VP9E_SET_GOP_PARALLEL,
+                                        VP9E_SET_FP_MV_SEEDS,
+                                        VP9E_SET_FRAME_TIME_BUDGET,
                                         0 };
 #endif
 
@@ -675,6 +702,7 @@ struct stream_config {
   struct vpx_codec_enc_cfg cfg;
   const char *out_fn;
   const char *stats_fn;
+  const char *fpmb_stats_fn;
   stereo_format_t stereo_fmt;
   int arg_ctrls[ARG_CTRL_CNT_MAX][2];
   int arg_ctrl_cnt;
@@ -702,6 +730,7 @@ struct stream_state {
   uint64_t cx_time;
   size_t nbytes;
   stats_io_t stats;
+  stats_io_t fpmb_stats;
   struct vpx_image *img;
   vpx_codec_ctx_t decoder;
   int mismatch_seen;
@@ -786,6 +815,8 @@ static void parse_global_config(struct VpxEncoderConfig *global, char **argv) {
       global->skip_frames = arg_parse_uint(&arg);
     else if (arg_match(&arg, &psnrarg, argi))
       global->show_psnr = 1;
+    else if (arg_match(&arg, &component_timing_arg, argi))
+      global->show_component_timing = 1;
     else if (arg_match(&arg, &recontest, argi))
       global->test_decode = arg_parse_enum_or_int(&arg);
     else if (arg_match(&arg, &framerate, argi)) {
@@ -938,6 +969,8 @@ static int parse_stream_params(struct VpxEncoderConfig *global,
       config->out_fn = arg.val;
     } else if (arg_match(&arg, &fpf_name, argi)) {
       config->stats_fn = arg.val;
+    } else if (arg_match(&arg, &fpmbf_name, argi)) {
+      config->fpmb_stats_fn = arg.val;
     } else if (arg_match(&arg, &use_webm, argi)) {
 #if CONFIG_WEBM_IO
       config->write_webm = 1;
@@ -1160,6 +1193,15 @@ static void validate_stream_config(const struct stream_state *stream,
         fatal("Stream %d: duplicate stats file (from stream %d)",
               streami->index, stream->index);
     }
+
+    /* Check for two streams sharing a mb stats file. */
+    if (streami != stream) {
+      const char *a = stream->config.fpmb_stats_fn;
+      const char *b = streami->config.fpmb_stats_fn;
+      if (a && b && !strcmp(a, b))
+        fatal("Stream %d: duplicate mb stats file (from stream %d)",
+              streami->index, stream->index);
+    }
   }
 }
 
@@ -1308,6 +1350,24 @@ static void close_output_file(struct stream_state *stream,
   fclose(stream->file);
 }
 
+// Returns 1 if the first pass motion is used to seed the last pass, in which
+// case it is kept in the mb statistics store.
+static int use_fp_mv_seeds(const struct stream_state *stream,
+                           const struct VpxEncoderConfig *global) {
+#if CONFIG_VP9_ENCODER
+  int i;
+  if (global->codec->fourcc != VP9_FOURCC) return 0;
+  for (i = 0; i < stream->config.arg_ctrl_cnt; i++) {
+    if (stream->config.arg_ctrls[i][0] == VP9E_SET_FP_MV_SEEDS)
+      return stream->config.arg_ctrls[i][1] != 0;
+  }
+#else
+  (void)stream;
+  (void)global;
+#endif
+  return 0;
+}
+
 static void setup_pass(struct stream_state *stream,
                        struct VpxEncoderConfig *global, int pass) {
   if (stream->config.stats_fn) {
@@ -1318,11 +1378,24 @@ static void setup_pass(struct stream_state *stream,
       fatal("Failed to open statistics store");
   }
 
+  if (use_fp_mv_seeds(stream, global)) {
+    if (stream->config.fpmb_stats_fn) {
+      if (!stats_open_file(&stream->fpmb_stats, stream->config.fpmb_stats_fn,
+                           pass))
+        fatal("Failed to open mb statistics store");
+    } else if (!global->pass) {
+      if (!stats_open_mem(&stream->fpmb_stats, pass))
+        fatal("Failed to open mb statistics store");
+    }
+  }
+
   stream->config.cfg.g_pass = global->passes == 2
                                   ? pass ? VPX_RC_LAST_PASS : VPX_RC_FIRST_PASS
                                   : VPX_RC_ONE_PASS;
   if (pass) {
     stream->config.cfg.rc_twopass_stats_in = stats_get(&stream->stats);
+    stream->config.cfg.rc_firstpass_mb_stats_in =
+        stats_get(&stream->fpmb_stats);
   }
 
   stream->cx_time = 0;
@@ -1359,6 +1432,13 @@ static void initialize_encoder(struct stream_state *stream,
     ctx_exit_on_error(&stream->encoder, "Failed to control codec");
   }
 
+#if CONFIG_VP9_ENCODER
+  if (global->show_component_timing && global->codec->fourcc == VP9_FOURCC) {
+    vpx_codec_control(&stream->encoder, VP9E_SET_COMPONENT_TIMING, 1);
+    ctx_exit_on_error(&stream->encoder, "Failed to enable component timing");
+  }
+#endif
+
 #if CONFIG_DECODERS
   if (global->test_decode != TEST_DECODE_OFF) {
     const VpxInterface *decoder = get_vpx_decoder_by_name(global->codec->name);
@@ -1534,6 +1614,11 @@ static void get_cx_data(struct stream_state *stream,
                     pkt->data.twopass_stats.sz);
         stream->nbytes += pkt->data.raw.sz;
         break;
+      case VPX_CODEC_FPMB_STATS_PKT:
+        stats_write(&stream->fpmb_stats, pkt->data.firstpass_mb_stats.buf,
+                    pkt->data.firstpass_mb_stats.sz);
+        stream->nbytes += pkt->data.raw.sz;
+        break;
       case VPX_CODEC_PSNR_PKT:
 
         if (global->show_psnr) {
@@ -1576,6 +1661,46 @@ static float usec_to_fps(uint64_t usec, unsigned int frames) {
   return (float)(usec > 0 ? frames * 1000000.0 / (float)usec : 0);
 }
 
+#if CONFIG_VP9_ENCODER
+static void show_stage_time(const char *name, uint64_t us, uint64_t total_us) {
+  fprintf(stderr, "  %-16s %12" PRId64 " us %6.2f%%\n", name, (int64_t)us,
+          total_us > 0 ? us * 100.0 / total_us : 0.0);
+}
+
+static void show_component_timing(struct stream_state *stream) {
+  vpx_enc_component_timing_t timing;
+
+  if (vpx_codec_control(&stream->encoder, VP9E_GET_COMPONENT_TIMING, &timing))
+    return;
+
+  fprintf(stderr, "Stream %d component timing (%u frames)\n", stream->index,
+          timing.frames);
+  show_stage_time("total", timing.total_us, timing.total_us);
+  show_stage_time("first pass", timing.first_pass_us, timing.total_us);
+  show_stage_time("temporal filter", timing.temporal_filter_us,
+                  timing.total_us);
+  show_stage_time("tpl", timing.tpl_us, timing.total_us);
+  show_stage_time("encode frame", timing.encode_frame_us, timing.total_us);
+  show_stage_time("loop filter", timing.loop_filter_us, timing.total_us);
+  show_stage_time("pack bitstream", timing.pack_bitstream_us, timing.total_us);
+}
+
+static void show_speed_control(struct stream_state *stream) {
+  vpx_speed_control_stats_t stats;
+
+  if (vpx_codec_control(&stream->encoder, VP9E_GET_SPEED_CONTROL_STATS,
+                        &stats) ||
+      stats.frames == 0)
+    return;
+
+  fprintf(stderr,
+          "Stream %d speed control: %u of %u frames over budget, "
+          "%u speed changes, ending at speed %d (%" PRId64 " us/frame)\n",
+          stream->index, stats.frames_over_budget, stats.frames,
+          stats.speed_changes, stats.speed, (int64_t)stats.avg_frame_us);
+}
+#endif
+
 static void test_decode(struct stream_state *stream,
                         enum TestDecodeFatality fatal,
                         const VpxInterface *codec) {
@@ -2016,6 +2141,13 @@ int main(int argc, const char **argv_) {
       }
     }
 
+#if CONFIG_VP9_ENCODER
+    if (global.show_component_timing && global.codec->fourcc == VP9_FOURCC)
+      FOREACH_STREAM(show_component_timing(stream));
+    if (global.codec->fourcc == VP9_FOURCC)
+      FOREACH_STREAM(show_speed_control(stream));
+#endif
+
     FOREACH_STREAM(vpx_codec_destroy(&stream->encoder));
 
     if (global.test_decode != TEST_DECODE_OFF) {
@@ -2030,6 +2162,7 @@ int main(int argc, const char **argv_) {
     FOREACH_STREAM(close_output_file(stream, global.codec->fourcc));
 
     FOREACH_STREAM(stats_close(&stream->stats, global.passes - 1));
+    FOREACH_STREAM(stats_close(&stream->fpmb_stats, global.passes - 1));
 
     if (global.pass) break;
   }
@@ -46,6 +46,7 @@ struct VpxEncoderConfig {
   int limit;
   int skip_frames;
   int show_psnr;
+  int show_component_timing;
   enum TestDecodeFatality test_decode;
   int have_framerate;
   struct vpx_rational framerate;